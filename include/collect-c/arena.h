@@ -0,0 +1,299 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    collect-c/arena.h
+ *
+ * Purpose: Arena (region) allocator.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#ifdef __cplusplus
+# ifndef COLLECT_C_ARENA_SUPPRESS_CXX_WARNING
+#  error This file not currently compatible with C++ compilation
+# endif
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * version
+ */
+
+#define COLLECT_C_ARENA_VER_MAJOR       0
+#define COLLECT_C_ARENA_VER_MINOR       1
+#define COLLECT_C_ARENA_VER_PATCH       0
+#define COLLECT_C_ARENA_VER_ALPHABETA   41
+
+#define COLLECT_C_ARENA_VER \
+    (0\
+        |   (   COLLECT_C_ARENA_VER_MAJOR       << 24   ) \
+        |   (   COLLECT_C_ARENA_VER_MINOR       << 16   ) \
+        |   (   COLLECT_C_ARENA_VER_PATCH       <<  8   ) \
+        |   (   COLLECT_C_ARENA_VER_ALPHABETA   <<  0   ) \
+    )
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/common.h>
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API constants
+ */
+
+/** The default size, in bytes, of the data area of each chunk. */
+#ifndef COLLECT_C_ARENA_DEFAULT_CHUNK_SIZE
+# define COLLECT_C_ARENA_DEFAULT_CHUNK_SIZE                 (64 * 1024)
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API types
+ */
+
+struct collect_c_arena_chunk_t;
+
+/** Represents an arena (aka region) allocator, from which blocks are
+ * obtained by bumping a pointer through a chain of chunks, and which are
+ * released together, in O(1), by collect_c_arena_reset() or by
+ * collect_c_arena_rewind() to an earlier collect_c_arena_mark().
+ *
+ * Chunks are retained by reset/rewind, for reuse, and are released only by
+ * collect_c_arena_free_storage().
+ *
+ * The allocator member may be given to containers (see
+ * collect_c_allocator_t), whose storage is then obtained from the arena.
+ * Freeing a block is a no-op unless it is the most recent allocation, and
+ * reallocating the most recent allocation grows it in place when there is
+ * room; vector growth is therefore usually without copying.
+ *
+ * @note A container whose storage was obtained from an arena must not be
+ *  used after the arena is reset, or rewound to before that storage was
+ *  obtained, other than to be discarded (without calling its
+ *  free_storage function).
+ */
+struct collect_c_arena_t
+{
+    size_t                              chunk_size;     /*! The size of the data area of a chunk. 0 means COLLECT_C_ARENA_DEFAULT_CHUNK_SIZE. Larger allocations are given a chunk of their own. */
+    size_t                              num_chunks;     /*! The number of chunks held. */
+    size_t                              cb_chunks;      /*! The total size of the data areas of the chunks held. */
+    int32_t                             flags;          /*! Control flags. */
+    int32_t                             reserved0;      /*! Reserved field. */
+    struct collect_c_arena_chunk_t*     first;          /*! The first chunk. */
+    struct collect_c_arena_chunk_t*     current;        /*! The chunk from which allocations are being made. */
+    struct collect_c_allocator_t const* backing;        /*! Optional allocator from which chunks are obtained. If NULL, malloc()/free() are used. */
+    struct collect_c_allocator_t        allocator;      /*! Allocator interface to the arena, to be given to containers. */
+};
+#ifndef __cplusplus
+typedef struct collect_c_arena_t        collect_c_arena_t;
+#endif
+
+/** A position in an arena, obtained by collect_c_arena_mark(), to which
+ * the arena may be rewound by collect_c_arena_rewind().
+ */
+struct collect_c_arena_mark_t
+{
+    struct collect_c_arena_chunk_t*     chunk;
+    size_t                              used;
+};
+#ifndef __cplusplus
+typedef struct collect_c_arena_mark_t   collect_c_arena_mark_t;
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions & macros
+ */
+
+/** @def COLLECT_C_ARENA_define(a_name, chunk_size)
+ *
+ * Declares and defines an empty arena instance, whose allocator member is
+ * bound to it. No memory is obtained until the first allocation.
+ *
+ * @param a_name The name of the instance;
+ * @param chunk_size The size of the data area of each chunk, or 0 for
+ *  COLLECT_C_ARENA_DEFAULT_CHUNK_SIZE;
+ */
+#define COLLECT_C_ARENA_define(a_name, chunk_size)          \
+                                                            \
+    collect_c_arena_t a_name = COLLECT_C_ARENA_EMPTY_INITIALIZER_(a_name, chunk_size, NULL)
+
+/** @def COLLECT_C_ARENA_define_with_backing(a_name, chunk_size, backing)
+ *
+ * Declares and defines an empty arena instance, whose allocator member is
+ * bound to it, and whose chunks are obtained from the given allocator.
+ *
+ * @param a_name The name of the instance;
+ * @param chunk_size The size of the data area of each chunk, or 0 for
+ *  COLLECT_C_ARENA_DEFAULT_CHUNK_SIZE;
+ * @param backing Pointer to the allocator (collect_c_allocator_t) from
+ *  which chunks are to be obtained;
+ */
+#define COLLECT_C_ARENA_define_with_backing(a_name, chunk_size, backing)    \
+                                                                            \
+    collect_c_arena_t a_name = COLLECT_C_ARENA_EMPTY_INITIALIZER_(a_name, chunk_size, backing)
+
+
+/* attributes */
+
+#define COLLECT_C_ARENA_allocator(a_name)                   (&(a_name).allocator)
+#define COLLECT_C_ARENA_num_chunks(a_name)                  ((a_name).num_chunks)
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Obtains the value of COLLECT_C_ARENA_VER at the time of compilation of
+ * the library.
+ */
+uint32_t
+collect_c_arena_version(void);
+
+/** Releases all chunks held by the arena, invalidating all blocks obtained
+ * from it.
+ *
+ * @param a Pointer to the arena. May not be NULL;
+ *
+ * @pre (NULL != a)
+ */
+void
+collect_c_arena_free_storage(
+    collect_c_arena_t*  a
+);
+
+/** Allocates a block from the arena, aligned suitably for any type.
+ *
+ * @param a Pointer to the arena. May not be NULL;
+ * @param cb The number of bytes required;
+ *
+ * @return Pointer to the block, or NULL if a required chunk could not be
+ *  obtained.
+ *
+ * @pre (NULL != a)
+ */
+void*
+collect_c_arena_allocate(
+    collect_c_arena_t*  a
+,   size_t              cb
+);
+
+/** Releases, in O(1), all blocks obtained from the arena, retaining its
+ * chunks for reuse.
+ *
+ * @param a Pointer to the arena. May not be NULL;
+ *
+ * @pre (NULL != a)
+ */
+void
+collect_c_arena_reset(
+    collect_c_arena_t*  a
+);
+
+/** Obtains the current position of the arena, to which it may later be
+ * rewound.
+ *
+ * @param a Pointer to the arena. May not be NULL;
+ *
+ * @pre (NULL != a)
+ */
+collect_c_arena_mark_t
+collect_c_arena_mark(
+    collect_c_arena_t const*    a
+);
+
+/** Releases, in O(1), all blocks obtained from the arena since the given
+ * mark was obtained, retaining its chunks for reuse.
+ *
+ * @param a Pointer to the arena. May not be NULL;
+ * @param mark A mark obtained from the arena, since which the arena has
+ *  not been reset or rewound to an earlier mark;
+ *
+ * @pre (NULL != a)
+ */
+void
+collect_c_arena_rewind(
+    collect_c_arena_t*      a
+,   collect_c_arena_mark_t  mark
+);
+
+/* Functions that implement collect_c_allocator_t, with the arena as the
+ * context, as bound to the arena's allocator member by
+ * COLLECT_C_ARENA_define().
+ */
+
+void*
+collect_c_arena_allocator_alloc(
+    void*   context
+,   size_t  cb
+);
+
+void*
+collect_c_arena_allocator_realloc(
+    void*   context
+,   void*   p
+,   size_t  cb_old
+,   size_t  cb_new
+);
+
+void
+collect_c_arena_allocator_free(
+    void*   context
+,   void*   p
+,   size_t  cb
+);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper macros
+ */
+
+#define COLLECT_C_ARENA_EMPTY_INITIALIZER_(a_name, a_chunk_size, a_backing) \
+                                                                            \
+    {                                                                       \
+        .chunk_size = (a_chunk_size),                                       \
+        .num_chunks = 0,                                                    \
+        .cb_chunks = 0,                                                     \
+        .flags = 0,                                                         \
+        .reserved0 = 0,                                                     \
+        .first = NULL,                                                      \
+        .current = NULL,                                                    \
+        .backing = (a_backing),                                             \
+        .allocator =                                                        \
+        {                                                                   \
+            .pfn_alloc = &collect_c_arena_allocator_alloc,                  \
+            .pfn_realloc = &collect_c_arena_allocator_realloc,              \
+            .pfn_free = &collect_c_arena_allocator_free,                    \
+            .context = &(a_name),                                           \
+        },                                                                  \
+    }
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#pragma once
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -4,7 +4,7 @@
  * Purpose: Circular-queue container.
  *
  * Created: 4th February 2025
- * Updated: 11th February 2025
+ * Updated: 18th October 2026
  *
  * ////////////////////////////////////////////////////////////////////// */
 
@@ -59,6 +59,12 @@
 /** Causes adding to a full instance to overwrite the front element. Requires also that a callback function is provided. */
 #define COLLECT_C_CIRCQ_F_OVERWRITE_FRONT_WHEN_FULL         (0x00000002)
 
+/** Causes storage of at least 2MB to be obtained from the virtual memory layer (on platforms that support it), aligned to 2MB and advised to be backed by transparent huge pages. */
+#define COLLECT_C_CIRCQ_F_USE_HUGE_PAGES                    (0x00000004)
+
+/** Set by the implementation - never by the user - to indicate that the storage has been obtained from the virtual memory layer. */
+#define COLLECT_C_CIRCQ_F_VM_STORAGE                        (0x00000008)
+
 
 /* /////////////////////////////////////////////////////////////////////////
  * API types
@@ -83,6 +89,8 @@ struct collect_c_cq_t
     int32_t                     flags;              /*! Control flags. */
     int32_t                     reserved0;          /*! Reserved field. */
     void*                       storage;            /*! Pointer to the storage. */
+    struct collect_c_allocator_t const*
+                                allocator;          /*! Optional allocator. If NULL, malloc()/free() are used. */
     void*                       param_element_free; /*! Custom parameter to be passed to invocations of pfn_element_free. */
     collect_c_circq_pfn_free    pfn_element_free;   /*! Custom function to be invoked when element erased/replaced. */
 };
@@ -149,6 +157,26 @@ typedef struct collect_c_cq_t   collect_c_cq_t;
     collect_c_cq_t cq_name = COLLECT_C_CIRCQ_EMPTY_INITIALIZER_(cq_el_type, cq_cap, 0, NULL, elf_fn, elf_param)
 
 
+/** @def COLLECT_C_CIRCQ_define_empty_with_allocator(cq_el_type, cq_name, cq_cap, alloc)
+ *
+ * Declares and defines an empty queue instance whose storage is to be
+ * obtained from the given allocator. The instance will need to be further
+ * set-up via collect_c_cq_allocate_storage().
+ *
+ * @param cq_el_type The type of the elements to be stored;
+ * @param cq_name The name of the instance;
+ * @param cq_cap The capacity that the instance should have;
+ * @param alloc Pointer to the allocator (collect_c_allocator_t), which
+ *  must outlive the instance's storage;
+ *
+ * @note COLLECT_C_CIRCQ_F_USE_HUGE_PAGES has no effect for an instance
+ *  with an allocator.
+ */
+#define COLLECT_C_CIRCQ_define_empty_with_allocator(cq_el_type, cq_name, cq_cap, alloc) \
+                                                                                        \
+    collect_c_cq_t cq_name = COLLECT_C_CIRCQ_EMPTY_INITIALIZER_WITH_ALLOCATOR_(cq_el_type, cq_cap, 0, NULL, (alloc), NULL, NULL)
+
+
 /** @def COLLECT_C_CIRCQ_define_on_stack(cq_name, ar_name)
  *
  * Declares and defines a queue instance that uses for its memory the given
@@ -211,6 +239,17 @@ typedef struct collect_c_cq_t   collect_c_cq_t;
 #define COLLECT_C_CIRCQ_cfront_t(cq_name, t_el)                 (COLLECT_C_CIRCQ_cat_t(cq_name, t_el,                                0))
 #define COLLECT_C_CIRCQ_cback_t(cq_name, t_el)                  (COLLECT_C_CIRCQ_cat_t(cq_name, t_el, COLLECT_C_CIRCQ_len(cq_name) - 1))
 
+/* search */
+
+#define COLLECT_C_CIRCQ_contains_by_ref(cq_name, p_key)         (0 == collect_c_cq_find_by_ref(&(cq_name), (p_key), NULL))
+#define COLLECT_C_CIRCQ_contains_by_value(cq_name, t_el, key)   (COLLECT_C_CIRCQ_assert_el_size_(cq_name, t_el), 0 == collect_c_cq_find_by_ref(&(cq_name), &((t_el){(key)}), NULL))
+
+#define COLLECT_C_CIRCQ_count_by_ref(cq_name, p_key)            collect_c_cq_count_by_ref(&(cq_name), (p_key))
+#define COLLECT_C_CIRCQ_count_by_value(cq_name, t_el, key)      (COLLECT_C_CIRCQ_assert_el_size_(cq_name, t_el), collect_c_cq_count_by_ref(&(cq_name), &((t_el){(key)})))
+
+#define COLLECT_C_CIRCQ_find_by_value(cq_name, t_el, key, p_index)  \
+                                                                (COLLECT_C_CIRCQ_assert_el_size_(cq_name, t_el), collect_c_cq_find_by_ref(&(cq_name), &((t_el){(key)}), (p_index)))
+
 
 /* /////////////////////////////////////////////////////////////////////////
  * API functions & macros (deprecated)
@@ -238,7 +277,8 @@ extern "C" {
 uint32_t
 collect_c_cq_version(void);
 
-/** Allocates storage for an instance from the heap.
+/** Allocates storage for an instance from the heap (or, with
+ * COLLECT_C_CIRCQ_F_USE_HUGE_PAGES, from the virtual memory layer).
  *
  * @param q Pointer to the circular queue. May not be NULL. May not point to
  *  an instance that has already been successfully allocated;
@@ -268,6 +308,26 @@ collect_c_cq_free_storage(
     collect_c_cq_t* q
 );
 
+/** Obtains the number of bytes of the queue's storage that are currently
+ * backed by (transparent) huge pages.
+ *
+ * @param q Pointer to the circular queue. May not be NULL;
+ *
+ * @return The number of bytes, which is 0 if the storage is not from the
+ *  virtual memory layer, if huge pages were not obtained, or if this
+ *  cannot be determined on the current platform.
+ *
+ * @note This is intended for instrumentation, and is expensive. Where the
+ *  kernel has merged the storage's mapping with neighbouring ones, the
+ *  figure is estimated in proportion to the storage's share of them.
+ *
+ * @pre (NULL != q)
+ */
+size_t
+collect_c_cq_huge_page_bytes(
+    collect_c_cq_t const*   q
+);
+
 /** Attempts to add an item to the (back of) the queue.
  *
  * @param q Pointer to the circular queue. May not be NULL;
@@ -366,6 +426,46 @@ collect_c_cq_pop_from_front_n(
 ,   size_t*         num_dropped
 );
 
+/** Searches the queue, from the front, for the first element whose bytes
+ * are equal to those of the key.
+ *
+ * @param q Pointer to the circular queue. May not be NULL;
+ * @param p_key Pointer to the key, of el_size bytes. May not be NULL;
+ * @param p_index Optional pointer to a variable to receive the index of
+ *  the element, relative to the front of the queue;
+ *
+ * @retval 0 An element was found;
+ * @retval ENOENT No element was found;
+ *
+ * @note The elements are compared as raw bytes, as by
+ *  collect_c_vec_find_by_ref(), with each of the (at most two) contiguous
+ *  segments of the queue's storage searched in turn.
+ *
+ * @pre (NULL != q)
+ * @pre (NULL != p_key)
+ */
+int
+collect_c_cq_find_by_ref(
+    collect_c_cq_t const*   q
+,   void const*             p_key
+,   size_t*                 p_index
+);
+
+/** Counts the elements of the queue whose bytes are equal to those of the
+ * key.
+ *
+ * @param q Pointer to the circular queue. May not be NULL;
+ * @param p_key Pointer to the key, of el_size bytes. May not be NULL;
+ *
+ * @pre (NULL != q)
+ * @pre (NULL != p_key)
+ */
+size_t
+collect_c_cq_count_by_ref(
+    collect_c_cq_t const*   q
+,   void const*             p_key
+);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -375,7 +475,7 @@ collect_c_cq_pop_from_front_n(
  * helper macros
  */
 
-#define COLLECT_C_CIRCQ_EMPTY_INITIALIZER_(cq_el_type, cq_cap, cq_flags, cq_storage, elf_fn, elf_param) \
+#define COLLECT_C_CIRCQ_EMPTY_INITIALIZER_WITH_ALLOCATOR_(cq_el_type, cq_cap, cq_flags, cq_storage, cq_alloc, elf_fn, elf_param) \
                                                                             \
     {                                                                       \
         .el_size = sizeof(cq_el_type),                                      \
@@ -385,10 +485,15 @@ collect_c_cq_pop_from_front_n(
         .flags = (cq_flags),                                                \
         .reserved0 = 0,                                                     \
         .storage = (cq_storage),                                            \
+        .allocator = (cq_alloc),                                            \
         .param_element_free = (elf_param),                                  \
         .pfn_element_free = (elf_fn),                                       \
     }
 
+#define COLLECT_C_CIRCQ_EMPTY_INITIALIZER_(cq_el_type, cq_cap, cq_flags, cq_storage, elf_fn, elf_param) \
+                                                                            \
+    COLLECT_C_CIRCQ_EMPTY_INITIALIZER_WITH_ALLOCATOR_(cq_el_type, cq_cap, cq_flags, cq_storage, NULL, elf_fn, elf_param)
+
 
 /* /////////////////////////////////////////////////////////////////////////
  * inclusion control
@@ -4,7 +4,7 @@
  * Purpose: Common elements.
  *
  * Created: 5th February 2025
- * Updated: 11th February 2025
+ * Updated: 18th October 2026
  *
  * ////////////////////////////////////////////////////////////////////// */
 
@@ -13,6 +13,7 @@
  * includes
  */
 
+#include <collect-c/common/allocator.h>
 #include <collect-c/common/macros.h>
 #ifndef __cplusplus
 # include <collect-c/common/version.h>
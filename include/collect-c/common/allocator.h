@@ -0,0 +1,66 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    collect-c/common/allocator.h
+ *
+ * Purpose: Allocator interface.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <stddef.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API types
+ */
+
+/** Allocator that may be associated with a container instance, via its
+ * allocator member, to obtain the memory for its storage and/or nodes in
+ * place of malloc(), realloc() and free(). If the member is NULL - the
+ * default - those functions are used.
+ *
+ * Each function is passed the context member. The sizes of the blocks
+ * being reallocated or freed are passed so that allocators that do not
+ * otherwise record them (such as arenas and pools) need not do so.
+ *
+ * The allocator must remain valid, and must not be changed, while the
+ * instance has any memory obtained from it.
+ */
+struct collect_c_allocator_t
+{
+    /*! Allocates a block of at least cb (> 0) bytes, aligned suitably for
+     * any type, returning NULL on failure. Must not be NULL.
+     */
+    void*   (*pfn_alloc)(void* context, size_t cb);
+    /*! Resizes the block p, of cb_old bytes, to at least cb_new (> 0)
+     * bytes, preserving its contents, returning NULL (leaving p
+     * unchanged) on failure. If NULL, pfn_alloc, memcpy() and pfn_free are
+     * used instead.
+     */
+    void*   (*pfn_realloc)(void* context, void* p, size_t cb_old, size_t cb_new);
+    /*! Releases the block p, of cb bytes. If NULL, blocks are not
+     * individually released (as is the case with an arena).
+     */
+    void    (*pfn_free)(void* context, void* p, size_t cb);
+    /*! Custom parameter to be passed to each of the functions. */
+    void*   context;
+};
+#ifndef __cplusplus
+typedef struct collect_c_allocator_t    collect_c_allocator_t;
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#pragma once
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
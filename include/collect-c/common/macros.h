@@ -4,7 +4,7 @@
  * Purpose: Common macros.
  *
  * Created: 11th February 2025
- * Updated: 11th February 2025
+ * Updated: 18th October 2026
  *
  * ////////////////////////////////////////////////////////////////////// */
 
@@ -24,8 +24,54 @@
  */
 
 #define COLLECT_C_UTIL_GET_MACRO_1_or_2_(_1, _2, mac, ...)          mac
+#define COLLECT_C_UTIL_GET_MACRO_2_or_3_(_1, _2, _3, mac, ...)      mac
 #define COLLECT_C_UTIL_GET_MACRO_3_or_4_(_1, _2, _3, _4, mac, ...)  mac
 
+/* Hints that the memory at the given address will shortly be read. The
+ * address need not be valid (and may be NULL).
+ */
+#if defined(__GNUC__) || \
+    defined(__clang__)
+# define COLLECT_C_UTIL_PREFETCH_(p)                                 __builtin_prefetch((p), 0, 3)
+#else
+# define COLLECT_C_UTIL_PREFETCH_(p)                                 ((void)(p))
+#endif
+
+/* Forces the inlining of a function, in particular one that is to be
+ * specialised by COLLECT_C_UTIL_DISPATCH_SIZE_().
+ */
+#if defined(__GNUC__) || \
+    defined(__clang__)
+# define COLLECT_C_UTIL_FORCE_INLINE_                                __attribute__((always_inline)) inline
+#elif defined(_MSC_VER)
+# define COLLECT_C_UTIL_FORCE_INLINE_                                __forceinline
+#else
+# define COLLECT_C_UTIL_FORCE_INLINE_                                inline
+#endif
+
+/* Evaluates the (forced-inline) function with the given arguments and the
+ * given size - of an element, or of a key - which is a constant for each
+ * of the common sizes, so that the function is in effect compiled
+ * separately for sizes of 4, 8 and 16 bytes, for which each memcpy() or
+ * comparison reduces to a few integer instructions, and for any other size.
+ */
+#define COLLECT_C_UTIL_DISPATCH_SIZE_(size, fn, ...)                        \
+                                                                            \
+    ((4 == (size))                                                          \
+        ? fn(__VA_ARGS__, 4)                                                \
+        : (8 == (size))                                                     \
+            ? fn(__VA_ARGS__, 8)                                            \
+            : (16 == (size))                                                \
+                ? fn(__VA_ARGS__, 16)                                       \
+                : fn(__VA_ARGS__, (size)))
+
+/* The alignment of the given type, in C or C++. */
+#ifdef __cplusplus
+# define COLLECT_C_UTIL_ALIGNOF_(t)                                  alignof(t)
+#else
+# define COLLECT_C_UTIL_ALIGNOF_(t)                                  _Alignof(t)
+#endif
+
 
 /* /////////////////////////////////////////////////////////////////////////
  * inclusion control
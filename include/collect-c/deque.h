@@ -0,0 +1,407 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    collect-c/deque.h
+ *
+ * Purpose: Double-ended queue container.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#ifdef __cplusplus
+# ifndef COLLECT_C_DEQUE_SUPPRESS_CXX_WARNING
+#  error This file not currently compatible with C++ compilation
+# endif
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * version
+ */
+
+#define COLLECT_C_DEQUE_VER_MAJOR       0
+#define COLLECT_C_DEQUE_VER_MINOR       1
+#define COLLECT_C_DEQUE_VER_PATCH       0
+#define COLLECT_C_DEQUE_VER_ALPHABETA   41
+
+#define COLLECT_C_DEQUE_VER \
+    (0\
+        |   (   COLLECT_C_DEQUE_VER_MAJOR       << 24   ) \
+        |   (   COLLECT_C_DEQUE_VER_MINOR       << 16   ) \
+        |   (   COLLECT_C_DEQUE_VER_PATCH       <<  8   ) \
+        |   (   COLLECT_C_DEQUE_VER_ALPHABETA   <<  0   ) \
+    )
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/common.h>
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API constants
+ */
+
+/** The default size, in bytes, of a chunk. The number of elements per
+ * chunk is the largest power of two that fits (and at least 1).
+ */
+#ifndef COLLECT_C_DEQUE_DEFAULT_CHUNK_SIZE
+# define COLLECT_C_DEQUE_DEFAULT_CHUNK_SIZE                 (1024)
+#endif
+
+/** The initial number of slots in the chunk map. Must be a power of two.
+ */
+#ifndef COLLECT_C_DEQUE_DEFAULT_MAP_CAPACITY
+# define COLLECT_C_DEQUE_DEFAULT_MAP_CAPACITY               (8)
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API types
+ */
+
+/** Callback function that, if attached to instance, will be called back for
+ * each element upon its erasure by any of the API functions.
+ */
+typedef void (*collect_c_deque_pfn_free)(
+    size_t  el_size
+,   size_t  el_index
+,   void*   el_ptr
+,   void*   param_element_free
+);
+
+/** Represents a double-ended queue.
+ *
+ * @note Elements are held in fixed-size chunks whose pointers are kept in
+ *  a circular map, so push and pop at either end are amortized O(1),
+ *  random access is O(1), and elements are never moved other than by
+ *  collect_c_deque_erase_at(). Growing the map moves only the chunk
+ *  pointers.
+ */
+struct collect_c_deque_t
+{
+    size_t                      el_size;            /*! The element size. */
+    size_t                      chunk_capacity;     /*! The number of elements per chunk. A power of two, or 0 until storage is first allocated. */
+    size_t                      chunk_shift;        /*! log2(chunk_capacity). */
+    size_t                      size;               /*! The number of elements. */
+    size_t                      b;                  /*! The offset of el[0] within the first chunk. */
+    int32_t                     flags;              /*! Control flags. */
+    int32_t                     reserved0;          /*! Reserved field. */
+    void**                      map;                /*! The circular map of chunk pointers. */
+    size_t                      map_capacity;       /*! The number of slots in the map. A power of two. */
+    size_t                      map_b;              /*! The index in the map of the first chunk. */
+    size_t                      num_chunks;         /*! The number of chunks in use. */
+    void*                       spare;              /*! A single cached empty chunk. */
+    struct collect_c_allocator_t const*
+                                allocator;          /*! Optional allocator, from which chunks and the map are obtained. If NULL, malloc()/free() are used. */
+    void*                       param_element_free; /*! Custom parameter to be passed to invocations of pfn_element_free. */
+    collect_c_deque_pfn_free    pfn_element_free;   /*! Custom function to be invoked when element erased. */
+};
+#ifndef __cplusplus
+typedef struct collect_c_deque_t        collect_c_deque_t;
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions & macros (internal)
+ */
+
+#define COLLECT_C_DEQUE_get_l_ptr_(dq)                      _Generic((dq),  \
+                                                                            \
+                             collect_c_deque_t* :  (dq),                    \
+                       collect_c_deque_t const* :  (dq),                    \
+                                        default : &(dq)                     \
+)
+
+#define COLLECT_C_DEQUE_assert_el_size_(dq_name, t_el)      assert(sizeof(t_el) == COLLECT_C_DEQUE_get_l_ptr_(dq_name)->el_size)
+#define COLLECT_C_DEQUE_assert_ix_(dq_name, ix)             assert((ix) < COLLECT_C_DEQUE_get_l_ptr_(dq_name)->size)
+#define COLLECT_C_DEQUE_assert_not_empty_(dq_name)          assert(0 != COLLECT_C_DEQUE_get_l_ptr_(dq_name)->size)
+
+#define COLLECT_C_DEQUE_clear_1_(dq_name)                   collect_c_deque_clear(COLLECT_C_DEQUE_get_l_ptr_(dq_name), NULL, NULL, NULL)
+#define COLLECT_C_DEQUE_clear_2_(dq_name, p)                collect_c_deque_clear(COLLECT_C_DEQUE_get_l_ptr_(dq_name), NULL, NULL,  (p))
+
+#define COLLECT_C_DEQUE_chunk_(dq, g)                       ((char*)(dq)->map[((dq)->map_b + ((g) >> (dq)->chunk_shift)) & ((dq)->map_capacity - 1)])
+#define COLLECT_C_DEQUE_el_ptr_(dq, ix)                     ((void*)(COLLECT_C_DEQUE_chunk_(dq, (dq)->b + (ix)) + ((((dq)->b + (ix)) & ((dq)->chunk_capacity - 1)) * (dq)->el_size)))
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions & macros
+ */
+
+/** @def COLLECT_C_DEQUE_define_empty(el_type, dq_name)
+ *
+ * Declares and defines an empty deque instance. Storage is allocated as
+ * required by the insertion functions.
+ *
+ * @param el_type The type of the elements to be stored;
+ * @param dq_name The name of the instance;
+ */
+#define COLLECT_C_DEQUE_define_empty(el_type, dq_name)                      \
+                                                                            \
+    collect_c_deque_t dq_name = COLLECT_C_DEQUE_EMPTY_INITIALIZER_(el_type, 0, NULL, NULL)
+
+
+/** @def COLLECT_C_DEQUE_define_empty_with_callback(el_type, dq_name, elf_fn, elf_param)
+ *
+ * Declares and defines an empty deque instance. Storage is allocated as
+ * required by the insertion functions.
+ *
+ * @param el_type The type of the elements to be stored;
+ * @param dq_name The name of the instance;
+ * @param elf_fn Callback function to be invoked when element is
+ *  erased/removed;
+ * @param elf_param Parameter to be given to the callback function;
+ */
+#define COLLECT_C_DEQUE_define_empty_with_callback(el_type, dq_name, elf_fn, elf_param)    \
+                                                                                            \
+    collect_c_deque_t dq_name = COLLECT_C_DEQUE_EMPTY_INITIALIZER_(el_type, 0, elf_fn, elf_param)
+
+
+/** @def COLLECT_C_DEQUE_define_empty_with_allocator(el_type, dq_name, alloc)
+ *
+ * Declares and defines an empty deque instance whose chunks (and map) are
+ * to be obtained from the given allocator.
+ *
+ * @param el_type The type of the elements to be stored;
+ * @param dq_name The name of the instance;
+ * @param alloc Pointer to the allocator (collect_c_allocator_t), which
+ *  must outlive the instance's storage;
+ */
+#define COLLECT_C_DEQUE_define_empty_with_allocator(el_type, dq_name, alloc)  \
+                                                                            \
+    collect_c_deque_t dq_name = COLLECT_C_DEQUE_EMPTY_INITIALIZER_WITH_ALLOCATOR_(el_type, 0, (alloc), NULL, NULL)
+
+
+/* modifiers */
+
+#define COLLECT_C_DEQUE_clear(...)                          COLLECT_C_UTIL_GET_MACRO_1_or_2_(__VA_ARGS__, COLLECT_C_DEQUE_clear_2_, COLLECT_C_DEQUE_clear_1_, NULL)(__VA_ARGS__)
+
+#define COLLECT_C_DEQUE_push_back_by_ref(dq_name, ptr_new_el)   collect_c_deque_push_back_by_ref(COLLECT_C_DEQUE_get_l_ptr_(dq_name), (ptr_new_el))
+#define COLLECT_C_DEQUE_push_back_by_value(dq_name, t_el, new_el)   \
+                                                            (COLLECT_C_DEQUE_assert_el_size_(dq_name, t_el), collect_c_deque_push_back_by_ref(COLLECT_C_DEQUE_get_l_ptr_(dq_name), &((t_el){(new_el)})))
+
+#define COLLECT_C_DEQUE_push_front_by_ref(dq_name, ptr_new_el)  collect_c_deque_push_front_by_ref(COLLECT_C_DEQUE_get_l_ptr_(dq_name), (ptr_new_el))
+#define COLLECT_C_DEQUE_push_front_by_value(dq_name, t_el, new_el)  \
+                                                            (COLLECT_C_DEQUE_assert_el_size_(dq_name, t_el), collect_c_deque_push_front_by_ref(COLLECT_C_DEQUE_get_l_ptr_(dq_name), &((t_el){(new_el)})))
+
+#define COLLECT_C_DEQUE_erase_at(dq_name, ix)               collect_c_deque_erase_at(COLLECT_C_DEQUE_get_l_ptr_(dq_name), (ix))
+
+#define COLLECT_C_DEQUE_pop_back(dq_name)                   collect_c_deque_pop_from_back_n(COLLECT_C_DEQUE_get_l_ptr_(dq_name), 1, NULL)
+#define COLLECT_C_DEQUE_pop_front(dq_name)                  collect_c_deque_pop_from_front_n(COLLECT_C_DEQUE_get_l_ptr_(dq_name), 1, NULL)
+
+/* attributes */
+
+#define COLLECT_C_DEQUE_is_empty(dq_name)                   (0 == COLLECT_C_DEQUE_get_l_ptr_(dq_name)->size      )
+#define COLLECT_C_DEQUE_len(dq_name)                        (     COLLECT_C_DEQUE_get_l_ptr_(dq_name)->size      )
+#define COLLECT_C_DEQUE_num_chunks(dq_name)                 (     COLLECT_C_DEQUE_get_l_ptr_(dq_name)->num_chunks)
+
+/* accessors */
+
+#define COLLECT_C_DEQUE_at_v(dq_name, ix)                   (COLLECT_C_DEQUE_assert_ix_(dq_name, ix), COLLECT_C_DEQUE_el_ptr_(COLLECT_C_DEQUE_get_l_ptr_(dq_name), (ix)))
+#define COLLECT_C_DEQUE_at_t(dq_name, t_el, ix)             ((t_el      *)(COLLECT_C_DEQUE_assert_el_size_(dq_name, t_el), COLLECT_C_DEQUE_at_v(dq_name, ix)))
+#define COLLECT_C_DEQUE_cat_t(dq_name, t_el, ix)            ((t_el const*)(COLLECT_C_DEQUE_assert_el_size_(dq_name, t_el), COLLECT_C_DEQUE_at_v(dq_name, ix)))
+
+#define COLLECT_C_DEQUE_front_v(dq_name)                    (COLLECT_C_DEQUE_assert_not_empty_(dq_name), COLLECT_C_DEQUE_el_ptr_(COLLECT_C_DEQUE_get_l_ptr_(dq_name), 0))
+#define COLLECT_C_DEQUE_back_v(dq_name)                     (COLLECT_C_DEQUE_assert_not_empty_(dq_name), COLLECT_C_DEQUE_el_ptr_(COLLECT_C_DEQUE_get_l_ptr_(dq_name), COLLECT_C_DEQUE_get_l_ptr_(dq_name)->size - 1))
+
+#define COLLECT_C_DEQUE_cfront_t(dq_name, t_el)             ((t_el const*)(COLLECT_C_DEQUE_assert_el_size_(dq_name, t_el), COLLECT_C_DEQUE_front_v(dq_name)))
+#define COLLECT_C_DEQUE_cback_t(dq_name, t_el)              ((t_el const*)(COLLECT_C_DEQUE_assert_el_size_(dq_name, t_el),  COLLECT_C_DEQUE_back_v(dq_name)))
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Obtains the value of COLLECT_C_DEQUE_VER at the time of compilation of
+ * the library.
+ */
+uint32_t
+collect_c_deque_version(void);
+
+/** Frees storage associated with the instance, invoking the element-free
+ * callback (if any) for each element.
+ *
+ * @param dq Pointer to the deque. May not be NULL;
+ *
+ * @pre (NULL != dq)
+ */
+void
+collect_c_deque_free_storage(
+    collect_c_deque_t*  dq
+);
+
+/** Clears all elements from the deque, invoking the element-free callback
+ * (if any) for each element.
+ *
+ * @param dq Pointer to the deque. May not be NULL;
+ * @param reserved0 Reserved. Must be 0;
+ * @param reserved1 Reserved. Must be 0;
+ * @param num_dropped Optional pointer to variable to retrieve number of
+ *  entries dropped;
+ *
+ * @pre (NULL != dq)
+ * @pre (0 == reserved0)
+ * @pre (0 == reserved1)
+ */
+int
+collect_c_deque_clear(
+    collect_c_deque_t*  dq
+,   void*               reserved0
+,   void*               reserved1
+,   size_t*             num_dropped
+);
+
+/** Obtains a pointer to the element at the given index.
+ *
+ * @param dq Pointer to the deque. May not be NULL;
+ * @param index Index of the element. Must be less than the deque's size;
+ *
+ * @pre (NULL != dq)
+ * @pre (index < dq->size)
+ */
+void*
+collect_c_deque_at(
+    collect_c_deque_t const*    dq
+,   size_t                      index
+);
+
+/** Erases the element at the given index, moving whichever of the
+ * preceding or following elements are fewer.
+ *
+ * @param dq Pointer to the deque. May not be NULL;
+ * @param index Index of the element. Must be less than the deque's size;
+ *
+ * @note Pointers to the moved elements are invalidated.
+ *
+ * @pre (NULL != dq)
+ * @pre (index < dq->size)
+ */
+int
+collect_c_deque_erase_at(
+    collect_c_deque_t*  dq
+,   size_t              index
+);
+
+/** Attempts to add an item to the back of the deque.
+ *
+ * @param dq Pointer to the deque. May not be NULL;
+ * @param ptr_new_el Pointer to the new element. May not be NULL;
+ *
+ * @retval 0 The item was added;
+ * @retval ENOMEM Sufficient memory not available;
+ *
+ * @pre (NULL != dq)
+ * @pre (NULL != ptr_new_el)
+ */
+int
+collect_c_deque_push_back_by_ref(
+    collect_c_deque_t*  dq
+,   void const*         ptr_new_el
+);
+
+/** Attempts to add an item to the front of the deque.
+ *
+ * @param dq Pointer to the deque. May not be NULL;
+ * @param ptr_new_el Pointer to the new element. May not be NULL;
+ *
+ * @retval 0 The item was added;
+ * @retval ENOMEM Sufficient memory not available;
+ *
+ * @pre (NULL != dq)
+ * @pre (NULL != ptr_new_el)
+ */
+int
+collect_c_deque_push_front_by_ref(
+    collect_c_deque_t*  dq
+,   void const*         ptr_new_el
+);
+
+/** Attempts to drop a number of elements from the back of the deque.
+ *
+ * @param dq Pointer to the deque. May not be NULL;
+ * @param num_to_drop Maximum number of elements to drop;
+ * @param num_dropped Optional pointer to variable to retrieve number of
+ *  entries dropped;
+ *
+ * @pre (NULL != dq)
+ */
+int
+collect_c_deque_pop_from_back_n(
+    collect_c_deque_t*  dq
+,   size_t              num_to_drop
+,   size_t*             num_dropped
+);
+
+/** Attempts to drop a number of elements from the front of the deque.
+ *
+ * @param dq Pointer to the deque. May not be NULL;
+ * @param num_to_drop Maximum number of elements to drop;
+ * @param num_dropped Optional pointer to variable to retrieve number of
+ *  entries dropped;
+ *
+ * @pre (NULL != dq)
+ */
+int
+collect_c_deque_pop_from_front_n(
+    collect_c_deque_t*  dq
+,   size_t              num_to_drop
+,   size_t*             num_dropped
+);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper macros
+ */
+
+#define COLLECT_C_DEQUE_EMPTY_INITIALIZER_WITH_ALLOCATOR_(el_type, dq_flags, dq_alloc, elf_fn, elf_param) \
+                                                                            \
+    {                                                                       \
+        .el_size = sizeof(el_type),                                         \
+        .chunk_capacity = 0,                                                \
+        .chunk_shift = 0,                                                   \
+        .size = 0,                                                          \
+        .b = 0,                                                             \
+        .flags = (dq_flags),                                                \
+        .reserved0 = 0,                                                     \
+        .map = NULL,                                                        \
+        .map_capacity = 0,                                                  \
+        .map_b = 0,                                                         \
+        .num_chunks = 0,                                                    \
+        .spare = NULL,                                                      \
+        .allocator = (dq_alloc),                                            \
+        .param_element_free = (elf_param),                                  \
+        .pfn_element_free = (elf_fn),                                       \
+    }
+
+#define COLLECT_C_DEQUE_EMPTY_INITIALIZER_(el_type, dq_flags, elf_fn, elf_param) \
+                                                                            \
+    COLLECT_C_DEQUE_EMPTY_INITIALIZER_WITH_ALLOCATOR_(el_type, dq_flags, NULL, elf_fn, elf_param)
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#pragma once
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
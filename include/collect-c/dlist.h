@@ -4,7 +4,7 @@
  * Purpose: Doubly-linked list container.
  *
  * Created: 7th February 2025
- * Updated: 11th February 2025
+ * Updated: 18th October 2026
  *
  * ////////////////////////////////////////////////////////////////////// */
 
@@ -85,6 +85,14 @@ struct collect_c_dlist_node_t
 };
 
 
+/** A contiguous block of nodes, as created by collect_c_dlist_compact() and
+ * by the bulk insertion functions. Nodes within a block are never
+ * individually freed: when erased they become spares, and the block is
+ * freed when the list's storage is freed or when the list is next
+ * compacted. A list holds its blocks in an array sorted by address, so
+ * that whether a node resides within a block is determined by binary
+ * search.
+ */
 struct collect_c_dlist_block_t;
 #ifndef __cplusplus
 typedef struct collect_c_dlist_block_t  collect_c_dlist_block_t;
@@ -94,7 +102,6 @@ struct collect_c_dlist_block_t
     size_t                      el_size;
     size_t                      num_nodes;
     size_t                      num_used;
-    collect_c_dlist_block_t*    next_block;
     collect_c_dlist_node_t      nodes[1];
 };
 
@@ -118,7 +125,10 @@ struct collect_c_dlist_t
     collect_c_dlist_node_t*     head;               /*! */
     collect_c_dlist_node_t*     tail;               /*! */
     collect_c_dlist_node_t*     spares;             /*! */
-    collect_c_dlist_block_t*    blocks;             /*! */
+    collect_c_dlist_block_t**   blocks;             /*! Blocks of contiguous nodes, sorted by address. */
+    size_t                      num_blocks;         /*! The number of blocks. */
+    struct collect_c_allocator_t const*
+                                allocator;          /*! Optional allocator, from which nodes and blocks are obtained. If NULL, malloc()/free() are used. */
     void*                       param_element_free; /*! Custom parameter to be passed to invocations of pfn_element_free. */
     collect_c_dlist_pfn_free    pfn_element_free;   /*! Custom function to be invoked when element erased/replaced. */
 };
@@ -148,6 +158,23 @@ typedef int (*collect_c_dlist_pfn_compare_t)(
 );
 
 
+/** Callback function that, if specified to collect_c_dlist_compact(), will
+ * be called for each node that is relocated.
+ *
+ * @param l Pointer to the list. Will not be NULL;
+ * @param old_node Pointer to the node's former location. Will not be NULL,
+ *  and will be invalid after compaction completes;
+ * @param new_node Pointer to the node's new location. Will not be NULL;
+ * @param param_remap Caller-supplied parameter;
+ */
+typedef void (*collect_c_dlist_pfn_remap_t)(
+    collect_c_dlist_t const*        l
+,   collect_c_dlist_node_t const*   old_node
+,   collect_c_dlist_node_t*         new_node
+,   void*                           param_remap
+);
+
+
 /* /////////////////////////////////////////////////////////////////////////
  * API functions & macros (internal)
  */
@@ -197,6 +224,31 @@ typedef int (*collect_c_dlist_pfn_compare_t)(
     collect_c_dlist_t l_name = COLLECT_C_DLIST_EMPTY_INITIALIZER_(l_el_type, 0, NULL, NULL, 0)
 
 
+/** @def COLLECT_C_DLIST_define_empty_with_allocator(l_el_type, l_name, alloc)
+ *
+ * Declares and defines an empty list instance whose nodes are to be
+ * obtained from the given allocator.
+ *
+ * @param l_el_type The type of the elements to be stored;
+ * @param l_name The name of the instance;
+ * @param alloc Pointer to the allocator (collect_c_allocator_t), which
+ *  must outlive the instance's nodes;
+ */
+#define COLLECT_C_DLIST_define_empty_with_allocator(l_el_type, l_name, alloc)  \
+                                                                            \
+    collect_c_dlist_t l_name = COLLECT_C_DLIST_EMPTY_INITIALIZER_WITH_ALLOCATOR_(l_el_type, 0, NULL, (alloc), NULL, NULL)
+
+/** @def COLLECT_C_DLIST_node_size(l_el_type)
+ *
+ * The size of the allocation made for each node of a list of the given
+ * element type, rounded to the alignment of a node, e.g. for use with
+ * COLLECT_C_POOL_define_by_size().
+ *
+ * @param l_el_type The type of the elements to be stored;
+ */
+#define COLLECT_C_DLIST_node_size(l_el_type)                ((offsetof(collect_c_dlist_node_t, data) + sizeof(l_el_type) + (COLLECT_C_UTIL_ALIGNOF_(collect_c_dlist_node_t) - 1)) & ~(COLLECT_C_UTIL_ALIGNOF_(collect_c_dlist_node_t) - 1))
+
+
 /* modifiers */
 
 #define COLLECT_C_DLIST_clear(...)                          COLLECT_C_UTIL_GET_MACRO_1_or_2_(__VA_ARGS__, COLLECT_C_DLIST_clear_2_, COLLECT_C_DLIST_clear_1_, NULL)(__VA_ARGS__)
@@ -279,6 +331,31 @@ collect_c_dlist_clear(
 ,   size_t*             num_dropped
 );
 
+/** Relocates all nodes of the list into a single contiguous block, in list
+ * order, and frees all former nodes, spares, and blocks.
+ *
+ * @param l Pointer to the list. May not be NULL;
+ * @param pfn_remap Optional callback to be invoked for each relocated
+ *  node, so that the caller can update any node pointers it holds;
+ * @param param_remap Caller-supplied parameter to be passed to pfn_remap;
+ *
+ * @retval 0 The list was compacted;
+ * @retval ENOMEM Sufficient memory not available, in which case the list
+ *  is unchanged;
+ *
+ * @note All node pointers are invalidated by a successful call. This is
+ *  intended to be called during quiet periods, to restore sequential
+ *  traversal performance after extended random insertion and erasure.
+ *
+ * @pre (NULL != l)
+ */
+int
+collect_c_dlist_compact(
+    collect_c_dlist_t*          l
+,   collect_c_dlist_pfn_remap_t pfn_remap
+,   void*                       param_remap
+);
+
 /** Erases a node from the list.
  *
  * @param l Pointer to the list. May not be NULL;
@@ -357,6 +434,63 @@ collect_c_dlist_rfind_node(
 ,   size_t*                         num_searched
 );
 
+/** Performs a forward search of the list for a node whose element is
+ * bytewise-equal to the given key.
+ *
+ * @param l Pointer to the list. May not be NULL;
+ * @param p_key Pointer to the key, which must be el_size bytes. May not be
+ *  NULL;
+ * @param skip_found Number of matched nodes to ignore before a node is
+ *  designated as being found;
+ * @param node Pointer to a variable to receive the found node. May not be
+ *  NULL;
+ * @param num_searched Optional pointer to obtain the number of elements
+ *  traversed in the search including, if found, the matching element;
+ *
+ * @retval 0 An element was found matching the given criteria;
+ * @retval ENOENT No element was found matching the given criteria;
+ *
+ * @note This is equivalent to collect_c_dlist_find_node() with a
+ *  comparison function that uses memcmp(), but avoids the indirect call
+ *  for each node. It is not suitable for elements that contain padding
+ *  or pointers to the values that are to be compared.
+ */
+int
+collect_c_dlist_find_node_by_bytes(
+    collect_c_dlist_t const*        l
+,   void const*                     p_key
+,   size_t                          skip_count
+,   collect_c_dlist_node_t**        node
+,   size_t*                         num_searched
+);
+
+/** Performs a reverse search of the list for a node whose element is
+ * bytewise-equal to the given key.
+ *
+ * @param l Pointer to the list. May not be NULL;
+ * @param p_key Pointer to the key, which must be el_size bytes. May not be
+ *  NULL;
+ * @param skip_found Number of matched nodes to ignore before a node is
+ *  designated as being found;
+ * @param node Pointer to a variable to receive the found node. May not be
+ *  NULL;
+ * @param num_searched Optional pointer to obtain the number of elements
+ *  traversed in the search including, if found, the matching element;
+ *
+ * @retval 0 An element was found matching the given criteria;
+ * @retval ENOENT No element was found matching the given criteria;
+ *
+ * @see collect_c_dlist_find_node_by_bytes()
+ */
+int
+collect_c_dlist_rfind_node_by_bytes(
+    collect_c_dlist_t const*        l
+,   void const*                     p_key
+,   size_t                          skip_count
+,   collect_c_dlist_node_t**        node
+,   size_t*                         num_searched
+);
+
 /** Inserts a new element into the list immediately after a reference node.
  *
  * @param l Pointer to the list. May not be NULL;
@@ -379,6 +513,37 @@ collect_c_dlist_insert_after(
 ,   collect_c_dlist_node_t**    new_node
 );
 
+/** Inserts a number of new elements into the list, in order, immediately
+ * after a reference node.
+ *
+ * The nodes are obtained from the spares, if any, and then from a single
+ * contiguous block, so at most one allocation is made.
+ *
+ * @param l Pointer to the list. May not be NULL;
+ * @param reference_node Pointer to the reference node, after which the new
+ *  nodes will be inserted. May not be NULL;
+ * @param num_els Number of elements to insert;
+ * @param ptr_new_els Pointer to the new elements. May not be NULL unless
+ *  num_els is 0;
+ * @param first_new_node Optional pointer to the first created node;
+ *
+ * @retval 0 The elements were inserted;
+ * @retval ENOMEM Insufficient memory. The list is unchanged;
+ *
+ * @pre (NULL != l)
+ * @pre (NULL != reference_node)
+ * @pre (reference_node is in l);
+ * @pre (0 == num_els || NULL != ptr_new_els)
+ */
+int
+collect_c_dlist_insert_n_after(
+    collect_c_dlist_t*          l
+,   collect_c_dlist_node_t*     reference_node
+,   size_t                      num_els
+,   void const*                 ptr_new_els
+,   collect_c_dlist_node_t**    first_new_node
+);
+
 /** Inserts a new element into the list immediately before a reference node.
  *
  * @param l Pointer to the list. May not be NULL;
@@ -431,6 +596,52 @@ collect_c_dlist_push_front_by_ref(
 ,   void const*         ptr_new_el
 );
 
+/** Attempts to add a number of items, in order, to the back of the list.
+ *
+ * The nodes are obtained from the spares, if any, and then from a single
+ * contiguous block, so at most one allocation is made.
+ *
+ * @param l Pointer to the list. May not be NULL;
+ * @param num_els Number of items to add;
+ * @param ptr_new_els Pointer to the new elements. May not be NULL unless
+ *  num_els is 0;
+ *
+ * @retval 0 The items were added;
+ * @retval ENOMEM Insufficient memory. The list is unchanged;
+ *
+ * @pre (NULL != l)
+ * @pre (0 == num_els || NULL != ptr_new_els)
+ */
+int
+collect_c_dlist_push_back_n_by_ref(
+    collect_c_dlist_t*  l
+,   size_t              num_els
+,   void const*         ptr_new_els
+);
+
+/** Attempts to add a number of items, in order, to the front of the list.
+ *
+ * The nodes are obtained from the spares, if any, and then from a single
+ * contiguous block, so at most one allocation is made.
+ *
+ * @param l Pointer to the list. May not be NULL;
+ * @param num_els Number of items to add;
+ * @param ptr_new_els Pointer to the new elements. May not be NULL unless
+ *  num_els is 0;
+ *
+ * @retval 0 The items were added;
+ * @retval ENOMEM Insufficient memory. The list is unchanged;
+ *
+ * @pre (NULL != l)
+ * @pre (0 == num_els || NULL != ptr_new_els)
+ */
+int
+collect_c_dlist_push_front_n_by_ref(
+    collect_c_dlist_t*  l
+,   size_t              num_els
+,   void const*         ptr_new_els
+);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -440,7 +651,7 @@ collect_c_dlist_push_front_by_ref(
  * helper macros
  */
 
-#define COLLECT_C_DLIST_EMPTY_INITIALIZER_(l_el_type, l_flags, l_storage, elf_fn, elf_param) \
+#define COLLECT_C_DLIST_EMPTY_INITIALIZER_WITH_ALLOCATOR_(l_el_type, l_flags, l_storage, l_alloc, elf_fn, elf_param) \
                                                                             \
     {                                                                       \
         .el_size = sizeof(l_el_type),                                       \
@@ -451,10 +662,17 @@ collect_c_dlist_push_front_by_ref(
         .head = NULL,                                                       \
         .tail = NULL,                                                       \
         .spares = NULL,                                                     \
+        .blocks = NULL,                                                     \
+        .num_blocks = 0,                                                    \
+        .allocator = (l_alloc),                                             \
         .param_element_free = (elf_param),                                  \
         .pfn_element_free = (elf_fn),                                       \
     }
 
+#define COLLECT_C_DLIST_EMPTY_INITIALIZER_(l_el_type, l_flags, l_storage, elf_fn, elf_param) \
+                                                                            \
+    COLLECT_C_DLIST_EMPTY_INITIALIZER_WITH_ALLOCATOR_(l_el_type, l_flags, l_storage, NULL, elf_fn, elf_param)
+
 
 /* /////////////////////////////////////////////////////////////////////////
  * inclusion control
@@ -0,0 +1,453 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    collect-c/flatmap.h
+ *
+ * Purpose: Sorted flat map (and set) container.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#ifdef __cplusplus
+# ifndef COLLECT_C_FLATMAP_SUPPRESS_CXX_WARNING
+#  error This file not currently compatible with C++ compilation
+# endif
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * version
+ */
+
+#define COLLECT_C_FLATMAP_VER_MAJOR     0
+#define COLLECT_C_FLATMAP_VER_MINOR     1
+#define COLLECT_C_FLATMAP_VER_PATCH     0
+#define COLLECT_C_FLATMAP_VER_ALPHABETA 41
+
+#define COLLECT_C_FLATMAP_VER \
+    (0\
+        |   (   COLLECT_C_FLATMAP_VER_MAJOR     << 24   ) \
+        |   (   COLLECT_C_FLATMAP_VER_MINOR     << 16   ) \
+        |   (   COLLECT_C_FLATMAP_VER_PATCH     <<  8   ) \
+        |   (   COLLECT_C_FLATMAP_VER_ALPHABETA <<  0   ) \
+    )
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/common.h>
+#include <collect-c/vec.h>
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API types
+ */
+
+struct collect_c_flatmap_t;
+
+/** Callback function that compares keys.
+ *
+ * @param m Pointer to the map. Will not be NULL;
+ * @param p_lhs Pointer to the lhs key. Will not be NULL;
+ * @param p_rhs Pointer to the rhs key. Will not be NULL;
+ *
+ * @return A value that is less than 0 if the lhs key is ordered before
+ *  the rhs key, greater than 0 if after, and 0 if they are equal.
+ */
+typedef int (*collect_c_flatmap_pfn_compare_t)(
+    struct collect_c_flatmap_t const*   m
+,   void const*                         p_lhs
+,   void const*                         p_rhs
+);
+
+/** Represents a map, of fixed-size keys and values, held as an array of
+ * entries sorted by key. A set is a map whose value_size is 0.
+ *
+ * @note The entries are held in the vector v, each having its key at
+ *  offset 0 and its value at value_offset. Lookup is by binary search,
+ *  in O(log n); insertion and erasure of a single entry are O(n), so the
+ *  container suits tables that are read far more than they are written,
+ *  and that may be built, or changed, in bulk by
+ *  collect_c_flatmap_assign_n_by_ref() and
+ *  collect_c_flatmap_insert_n_by_ref(). Compared with a tree, it has no
+ *  per-entry overhead, and a search touches O(log n) cache lines of a
+ *  single contiguous block.
+ *
+ * @note The vector may be read directly, e.g. to iterate the entries in
+ *  order, but must not be modified other than by the API functions.
+ */
+struct collect_c_flatmap_t
+{
+    collect_c_vec_t                 v;              /*! The entries, in order of key. */
+    size_t                          key_size;       /*! The key size. */
+    size_t                          value_size;     /*! The value size. 0 for a set. */
+    size_t                          value_offset;   /*! The offset of the value within an entry. */
+    collect_c_flatmap_pfn_compare_t pfn_compare;    /*! The key comparison function. */
+};
+#ifndef __cplusplus
+typedef struct collect_c_flatmap_t      collect_c_flatmap_t;
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions & macros (internal)
+ */
+
+#define COLLECT_C_FLATMAP_get_m_ptr_(m)                     _Generic((m),   \
+                                                                            \
+                           collect_c_flatmap_t* :  (m),                     \
+                     collect_c_flatmap_t const* :  (m),                     \
+                                        default : &(m)                      \
+)
+
+#define COLLECT_C_FLATMAP_assert_key_size_(m_name, t_key)   assert(sizeof(t_key) == COLLECT_C_FLATMAP_get_m_ptr_(m_name)->key_size)
+#define COLLECT_C_FLATMAP_assert_value_size_(m_name, t_v)   assert(sizeof(t_v) == COLLECT_C_FLATMAP_get_m_ptr_(m_name)->value_size)
+#define COLLECT_C_FLATMAP_assert_ix_(m_name, ix)            assert((ix) < COLLECT_C_FLATMAP_get_m_ptr_(m_name)->v.size)
+
+#define COLLECT_C_FLATMAP_clear_1_(m_name)                  collect_c_flatmap_clear(COLLECT_C_FLATMAP_get_m_ptr_(m_name), NULL, NULL, NULL)
+#define COLLECT_C_FLATMAP_clear_2_(m_name, p)               collect_c_flatmap_clear(COLLECT_C_FLATMAP_get_m_ptr_(m_name), NULL, NULL,  (p))
+
+#define COLLECT_C_FLATMAP_max_(a, b)                        (((a) < (b)) ? (b) : (a))
+#define COLLECT_C_FLATMAP_round_(n, a)                      ((((n) + ((a) - 1)) / (a)) * (a))
+
+#define COLLECT_C_FLATMAP_value_offset_(t_key, t_value)     COLLECT_C_FLATMAP_round_(sizeof(t_key), COLLECT_C_UTIL_ALIGNOF_(t_value))
+#define COLLECT_C_FLATMAP_entry_size_(t_key, t_value)       COLLECT_C_FLATMAP_round_(COLLECT_C_FLATMAP_value_offset_(t_key, t_value) + sizeof(t_value), COLLECT_C_FLATMAP_max_(COLLECT_C_UTIL_ALIGNOF_(t_key), COLLECT_C_UTIL_ALIGNOF_(t_value)))
+
+#define COLLECT_C_FLATMAP_at_v_(m_name, ix)                 ((void*)(((char*)COLLECT_C_FLATMAP_get_m_ptr_(m_name)->v.storage) + ((COLLECT_C_FLATMAP_get_m_ptr_(m_name)->v.offset + (ix)) * COLLECT_C_FLATMAP_get_m_ptr_(m_name)->v.el_size)))
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions & macros
+ */
+
+/** @def COLLECT_C_FLATMAP_define_empty(key_type, value_type, m_name, compare_fn)
+ *
+ * Declares and defines an empty map instance. Storage is allocated as
+ * required by the insertion functions.
+ *
+ * @param key_type The type of the keys;
+ * @param value_type The type of the values;
+ * @param m_name The name of the instance;
+ * @param compare_fn The key comparison function
+ *  (collect_c_flatmap_pfn_compare_t);
+ */
+#define COLLECT_C_FLATMAP_define_empty(key_type, value_type, m_name, compare_fn)    \
+                                                                                    \
+    collect_c_flatmap_t m_name = COLLECT_C_FLATMAP_EMPTY_INITIALIZER_(sizeof(key_type), sizeof(value_type), COLLECT_C_FLATMAP_value_offset_(key_type, value_type), COLLECT_C_FLATMAP_entry_size_(key_type, value_type), compare_fn)
+
+/** @def COLLECT_C_FLATMAP_define_empty_set(key_type, m_name, compare_fn)
+ *
+ * Declares and defines an empty set instance, i.e. a map without values.
+ * Storage is allocated as required by the insertion functions.
+ *
+ * @param key_type The type of the keys;
+ * @param m_name The name of the instance;
+ * @param compare_fn The key comparison function
+ *  (collect_c_flatmap_pfn_compare_t);
+ */
+#define COLLECT_C_FLATMAP_define_empty_set(key_type, m_name, compare_fn)    \
+                                                                            \
+    collect_c_flatmap_t m_name = COLLECT_C_FLATMAP_EMPTY_INITIALIZER_(sizeof(key_type), 0, sizeof(key_type), sizeof(key_type), compare_fn)
+
+
+/* modifiers */
+
+#define COLLECT_C_FLATMAP_clear(...)                        COLLECT_C_UTIL_GET_MACRO_1_or_2_(__VA_ARGS__, COLLECT_C_FLATMAP_clear_2_, COLLECT_C_FLATMAP_clear_1_, NULL)(__VA_ARGS__)
+
+#define COLLECT_C_FLATMAP_erase_by_value(m_name, t_key, key)                \
+                                                            (COLLECT_C_FLATMAP_assert_key_size_(m_name, t_key), collect_c_flatmap_erase_by_ref(COLLECT_C_FLATMAP_get_m_ptr_(m_name), &((t_key){(key)})))
+
+#define COLLECT_C_FLATMAP_insert_by_value(m_name, t_key, key, t_value, value)   \
+                                                            (COLLECT_C_FLATMAP_assert_key_size_(m_name, t_key), COLLECT_C_FLATMAP_assert_value_size_(m_name, t_value), collect_c_flatmap_insert_by_ref(COLLECT_C_FLATMAP_get_m_ptr_(m_name), &((t_key){(key)}), &((t_value){(value)})))
+
+#define COLLECT_C_FLATMAP_insert_key_by_value(m_name, t_key, key)           \
+                                                            (COLLECT_C_FLATMAP_assert_key_size_(m_name, t_key), collect_c_flatmap_insert_by_ref(COLLECT_C_FLATMAP_get_m_ptr_(m_name), &((t_key){(key)}), NULL))
+
+/* attributes */
+
+#define COLLECT_C_FLATMAP_is_empty(m_name)                  (0 == COLLECT_C_FLATMAP_len((m_name)))
+#define COLLECT_C_FLATMAP_len(m_name)                       (COLLECT_C_FLATMAP_get_m_ptr_(m_name)->v.size)
+
+/* accessors */
+
+#define COLLECT_C_FLATMAP_at_v(m_name, ix)                  (COLLECT_C_FLATMAP_assert_ix_(m_name, ix), COLLECT_C_FLATMAP_at_v_(m_name, ix))
+
+#define COLLECT_C_FLATMAP_contains_by_value(m_name, t_key, key)             \
+                                                            (COLLECT_C_FLATMAP_assert_key_size_(m_name, t_key), 0 == collect_c_flatmap_find_by_ref(COLLECT_C_FLATMAP_get_m_ptr_(m_name), &((t_key){(key)}), NULL))
+
+#define COLLECT_C_FLATMAP_entry_key_v(m_name, entry)        ((void const*)(entry))
+#define COLLECT_C_FLATMAP_entry_value_v(m_name, entry)      ((void*)(((char*)(entry)) + COLLECT_C_FLATMAP_get_m_ptr_(m_name)->value_offset))
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Obtains the value of COLLECT_C_FLATMAP_VER at the time of compilation of
+ * the library.
+ */
+uint32_t
+collect_c_flatmap_version(void);
+
+/** Frees storage associated with the instance, invoking the element-free
+ * callback (if any) of v for each entry.
+ *
+ * @param m Pointer to the map. May not be NULL;
+ *
+ * @pre (NULL != m)
+ */
+void
+collect_c_flatmap_free_storage(
+    collect_c_flatmap_t*    m
+);
+
+/** Clears all entries from the map, invoking the element-free callback (if
+ * any) of v for each entry. The storage is retained.
+ *
+ * @param m Pointer to the map. May not be NULL;
+ * @param reserved0 Reserved. Must be 0;
+ * @param reserved1 Reserved. Must be 0;
+ * @param num_dropped Optional pointer to variable to retrieve number of
+ *  entries dropped;
+ *
+ * @pre (NULL != m)
+ * @pre (0 == reserved0)
+ * @pre (0 == reserved1)
+ */
+int
+collect_c_flatmap_clear(
+    collect_c_flatmap_t*    m
+,   void*                   reserved0
+,   void*                   reserved1
+,   size_t*                 num_dropped
+);
+
+/** Obtains the index of the first entry whose key is not ordered before
+ * the given key, or the size if there is none.
+ *
+ * @param m Pointer to the map. May not be NULL;
+ * @param p_key Pointer to the key. May not be NULL;
+ *
+ * @note The search is branchless - each step selects the half by a
+ *  conditional move, rather than a jump that would be mispredicted half
+ *  the time - and prefetches the candidates of the following step.
+ *
+ * @pre (NULL != m)
+ * @pre (NULL != p_key)
+ */
+size_t
+collect_c_flatmap_lower_bound(
+    collect_c_flatmap_t const*  m
+,   void const*                 p_key
+);
+
+/** Obtains the index of the first entry whose key is ordered after the
+ * given key, or the size if there is none.
+ *
+ * @param m Pointer to the map. May not be NULL;
+ * @param p_key Pointer to the key. May not be NULL;
+ *
+ * @pre (NULL != m)
+ * @pre (NULL != p_key)
+ */
+size_t
+collect_c_flatmap_upper_bound(
+    collect_c_flatmap_t const*  m
+,   void const*                 p_key
+);
+
+/** Obtains the range of indexes, [*index_first, *index_last), of the
+ * entries whose keys are equal to the given key, which, since keys are
+ * unique, is empty or has one entry.
+ *
+ * @param m Pointer to the map. May not be NULL;
+ * @param p_key Pointer to the key. May not be NULL;
+ * @param index_first Pointer to variable to receive the index of the
+ *  first entry. May not be NULL;
+ * @param index_last Pointer to variable to receive the index one past the
+ *  last entry. May not be NULL;
+ *
+ * @pre (NULL != m)
+ * @pre (NULL != p_key)
+ * @pre (NULL != index_first)
+ * @pre (NULL != index_last)
+ */
+void
+collect_c_flatmap_equal_range(
+    collect_c_flatmap_t const*  m
+,   void const*                 p_key
+,   size_t*                     index_first
+,   size_t*                     index_last
+);
+
+/** Searches the map for the entry with the given key.
+ *
+ * @param m Pointer to the map. May not be NULL;
+ * @param p_key Pointer to the key. May not be NULL;
+ * @param p_entry Optional pointer to a variable to receive a pointer to
+ *  the entry;
+ *
+ * @retval 0 An entry was found;
+ * @retval ENOENT No entry was found;
+ *
+ * @pre (NULL != m)
+ * @pre (NULL != p_key)
+ */
+int
+collect_c_flatmap_find_by_ref(
+    collect_c_flatmap_t const*  m
+,   void const*                 p_key
+,   void**                      p_entry
+);
+
+/** Inserts an entry into the map, if none has the given key.
+ *
+ * @param m Pointer to the map. May not be NULL;
+ * @param p_key Pointer to the key. May not be NULL;
+ * @param p_value Pointer to the value. May be NULL, in which case the
+ *  value is zeroed. Ignored for a set;
+ *
+ * @retval 0 The entry was inserted;
+ * @retval EEXIST An entry with the key already exists. It is unchanged;
+ * @retval ENOMEM Insufficient memory. The map is unchanged;
+ *
+ * @note The entries after the insertion position are moved, so that
+ *  inserting k entries in this way is O(k * n). To insert many, use
+ *  collect_c_flatmap_insert_n_by_ref().
+ *
+ * @pre (NULL != m)
+ * @pre (NULL != p_key)
+ */
+int
+collect_c_flatmap_insert_by_ref(
+    collect_c_flatmap_t*    m
+,   void const*             p_key
+,   void const*             p_value
+);
+
+/** Inserts a number of entries into the map, each if none has its key.
+ *
+ * @param m Pointer to the map. May not be NULL;
+ * @param num_entries The number of entries;
+ * @param p_entries Pointer to the array of entries, of size v.el_size,
+ *  each with its key at offset 0 and its value at value_offset, in any
+ *  order. May be NULL only if num_entries is 0;
+ * @param num_inserted Optional pointer to variable to retrieve the number
+ *  of entries inserted;
+ *
+ * @retval 0 The entries were inserted;
+ * @retval ENOMEM Insufficient memory. The map is unchanged;
+ *
+ * @note The entries are sorted (where there are several with the same key
+ *  the first is taken), and then merged with those of the map from the
+ *  back, so that each existing entry is moved at most once: O(n + k log k)
+ *  rather than O(k * n).
+ *
+ * @pre (NULL != m)
+ * @pre (0 == num_entries || NULL != p_entries)
+ */
+int
+collect_c_flatmap_insert_n_by_ref(
+    collect_c_flatmap_t*    m
+,   size_t                  num_entries
+,   void const*             p_entries
+,   size_t*                 num_inserted
+);
+
+/** Replaces the entries of the map with the given entries.
+ *
+ * @param m Pointer to the map. May not be NULL;
+ * @param num_entries The number of entries;
+ * @param p_entries Pointer to the array of entries, of size v.el_size,
+ *  each with its key at offset 0 and its value at value_offset, in any
+ *  order. May be NULL only if num_entries is 0;
+ *
+ * @retval 0 The map was built;
+ * @retval ENOMEM Insufficient memory. The map is unchanged;
+ *
+ * @note The entries are sorted by a (stable) merge sort, whose final pass
+ *  also drops all but the first of each set of entries with the same key,
+ *  so building is O(k log k) in one sort-and-unique operation.
+ *
+ * @pre (NULL != m)
+ * @pre (0 == num_entries || NULL != p_entries)
+ */
+int
+collect_c_flatmap_assign_n_by_ref(
+    collect_c_flatmap_t*    m
+,   size_t                  num_entries
+,   void const*             p_entries
+);
+
+/** Erases the entry with the given key.
+ *
+ * @param m Pointer to the map. May not be NULL;
+ * @param p_key Pointer to the key. May not be NULL;
+ *
+ * @retval 0 The entry was erased;
+ * @retval ENOENT No entry was found;
+ *
+ * @pre (NULL != m)
+ * @pre (NULL != p_key)
+ */
+int
+collect_c_flatmap_erase_by_ref(
+    collect_c_flatmap_t*    m
+,   void const*             p_key
+);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper macros
+ */
+
+#define COLLECT_C_FLATMAP_EMPTY_INITIALIZER_(cb_key, cb_value, cb_value_offset, cb_entry, compare_fn)  \
+                                                                            \
+    {                                                                       \
+        .v = {                                                              \
+            .el_size = (cb_entry),                                          \
+            .capacity = 0,                                                  \
+            .offset = 0,                                                    \
+            .size = 0,                                                      \
+            .flags = COLLECT_C_VEC_F_NO_BOO,                                \
+            .reserved0 = 0,                                                 \
+            .storage = NULL,                                                \
+            .growth_policy = NULL,                                          \
+            .allocator = NULL,                                              \
+            .param_element_free = NULL,                                     \
+            .pfn_element_free = NULL,                                       \
+        },                                                                  \
+        .key_size = (cb_key),                                               \
+        .value_size = (cb_value),                                           \
+        .value_offset = (cb_value_offset),                                  \
+        .pfn_compare = (compare_fn),                                        \
+    }
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#pragma once
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,304 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    collect-c/frozen.h
+ *
+ * Purpose: Frozen (static) sorted array, in a cache-friendly layout.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#ifdef __cplusplus
+# ifndef COLLECT_C_FROZEN_SUPPRESS_CXX_WARNING
+#  error This file not currently compatible with C++ compilation
+# endif
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * version
+ */
+
+#define COLLECT_C_FROZEN_VER_MAJOR      0
+#define COLLECT_C_FROZEN_VER_MINOR      1
+#define COLLECT_C_FROZEN_VER_PATCH      0
+#define COLLECT_C_FROZEN_VER_ALPHABETA  41
+
+#define COLLECT_C_FROZEN_VER \
+    (0\
+        |   (   COLLECT_C_FROZEN_VER_MAJOR      << 24   ) \
+        |   (   COLLECT_C_FROZEN_VER_MINOR      << 16   ) \
+        |   (   COLLECT_C_FROZEN_VER_PATCH      <<  8   ) \
+        |   (   COLLECT_C_FROZEN_VER_ALPHABETA  <<  0   ) \
+    )
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/common.h>
+#include <collect-c/vec.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API constants
+ */
+
+/** Layout in which the elements are ordered as a breadth-first traversal
+ * of a complete binary search tree. The default.
+ */
+#define COLLECT_C_FROZEN_F_EYTZINGER                        (0x00000000)
+/** Layout in which the elements are held in blocks of a cache line, each
+ * a node of a static B-tree whose children are held contiguously.
+ */
+#define COLLECT_C_FROZEN_F_BTREE                            (0x00000001)
+
+/** The size of a cache line, to which the storage is aligned. */
+#define COLLECT_C_FROZEN_CACHE_LINE_SIZE                    (64)
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API types
+ */
+
+struct collect_c_frozen_t;
+
+/** Callback function that compares an element with a key.
+ *
+ * @param z Pointer to the instance. Will not be NULL;
+ * @param p_el Pointer to the element. Will not be NULL;
+ * @param p_key Pointer to the key, as passed to the search functions. Will
+ *  not be NULL;
+ *
+ * @return A value that is less than 0 if the element is ordered before the
+ *  key, greater than 0 if after, and 0 if they are equal.
+ */
+typedef int (*collect_c_frozen_pfn_compare_t)(
+    struct collect_c_frozen_t const*    z
+,   void const*                         p_el
+,   void const*                         p_key
+);
+
+/** Represents an immutable sorted array, of fixed-size elements, that is
+ * held in a layout in which a search takes fewer cache misses than a
+ * binary search of the sorted array.
+ *
+ * @note A binary search of a large array takes a cache miss at nearly
+ *  every step. With COLLECT_C_FROZEN_F_EYTZINGER the first few levels of
+ *  the tree share a handful of cache lines that stay in cache, and the
+ *  descendants some levels below each node are contiguous, so that the
+ *  search prefetches them several steps before they are needed. With
+ *  COLLECT_C_FROZEN_F_BTREE each step is within a single cache line (for
+ *  elements of up to half its size), so that a search takes only
+ *  log(B + 1)(n) misses, where B is the number of elements per line.
+ *
+ * @note The storage is to be treated as opaque: to iterate in order, use
+ *  the sorted vector from which the instance was frozen.
+ */
+struct collect_c_frozen_t
+{
+    size_t                          el_size;            /*! The element size. */
+    size_t                          size;               /*! The number of elements. */
+    int32_t                         flags;              /*! The layout flags. */
+    int32_t                         reserved0;          /*! Reserved field. */
+    void*                           storage;            /*! Pointer to the (aligned) storage. */
+    size_t                          num_slots;          /*! The number of slots in the storage. */
+    size_t                          block_size;         /*! The number of elements in a block (BTREE) or of descendants to be prefetched (EYTZINGER). */
+    void*                           allocation;         /*! Pointer to the allocated memory. */
+    size_t                          cb_allocation;      /*! The size of the allocated memory. */
+    collect_c_frozen_pfn_compare_t  pfn_compare;        /*! The element-key comparison function. */
+    struct collect_c_allocator_t const*
+                                    allocator;          /*! Optional allocator. If NULL, malloc()/free() are used. */
+};
+#ifndef __cplusplus
+typedef struct collect_c_frozen_t       collect_c_frozen_t;
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions & macros (internal)
+ */
+
+#define COLLECT_C_FROZEN_get_z_ptr_(z)                      _Generic((z),   \
+                                                                            \
+                            collect_c_frozen_t* :  (z),                     \
+                      collect_c_frozen_t const* :  (z),                     \
+                                        default : &(z)                      \
+)
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions & macros
+ */
+
+/** @def COLLECT_C_FROZEN_define_empty(el_type, z_name, compare_fn)
+ *
+ * Declares and defines an empty instance, which is to be populated by
+ * collect_c_frozen_freeze().
+ *
+ * @param el_type The type of the elements;
+ * @param z_name The name of the instance;
+ * @param compare_fn The element-key comparison function
+ *  (collect_c_frozen_pfn_compare_t);
+ */
+#define COLLECT_C_FROZEN_define_empty(el_type, z_name, compare_fn)          \
+                                                                            \
+    collect_c_frozen_t z_name = COLLECT_C_FROZEN_EMPTY_INITIALIZER_(sizeof(el_type), compare_fn, NULL)
+
+/** @def COLLECT_C_FROZEN_define_empty_with_allocator(el_type, z_name, compare_fn, alloc)
+ *
+ * Declares and defines an empty instance, whose storage is to be obtained
+ * from the given allocator.
+ *
+ * @param el_type The type of the elements;
+ * @param z_name The name of the instance;
+ * @param compare_fn The element-key comparison function
+ *  (collect_c_frozen_pfn_compare_t);
+ * @param alloc Pointer to the allocator (collect_c_allocator_t);
+ */
+#define COLLECT_C_FROZEN_define_empty_with_allocator(el_type, z_name, compare_fn, alloc)    \
+                                                                            \
+    collect_c_frozen_t z_name = COLLECT_C_FROZEN_EMPTY_INITIALIZER_(sizeof(el_type), compare_fn, (alloc))
+
+/* attributes */
+
+#define COLLECT_C_FROZEN_is_empty(z_name)                   (0 == COLLECT_C_FROZEN_len((z_name)))
+#define COLLECT_C_FROZEN_len(z_name)                        (COLLECT_C_FROZEN_get_z_ptr_(z_name)->size)
+
+/* accessors */
+
+#define COLLECT_C_FROZEN_contains_by_ref(z_name, p_key)     (0 == collect_c_frozen_find_by_ref(COLLECT_C_FROZEN_get_z_ptr_(z_name), (p_key), NULL))
+#define COLLECT_C_FROZEN_contains_by_value(z_name, t_key, key)              \
+                                                            (0 == collect_c_frozen_find_by_ref(COLLECT_C_FROZEN_get_z_ptr_(z_name), &((t_key){(key)}), NULL))
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Obtains the value of COLLECT_C_FROZEN_VER at the time of compilation of
+ * the library.
+ */
+uint32_t
+collect_c_frozen_version(void);
+
+/** Frees storage associated with the instance.
+ *
+ * @param z Pointer to the instance. May not be NULL;
+ *
+ * @pre (NULL != z)
+ */
+void
+collect_c_frozen_free_storage(
+    collect_c_frozen_t* z
+);
+
+/** Populates the instance from a sorted vector, replacing any previous
+ * contents.
+ *
+ * @param z Pointer to the instance. May not be NULL;
+ * @param v Pointer to the vector, whose elements must be sorted in the
+ *  order defined by the comparison function. May not be NULL;
+ * @param flags The layout: COLLECT_C_FROZEN_F_EYTZINGER or
+ *  COLLECT_C_FROZEN_F_BTREE;
+ *
+ * @retval 0 The instance was populated;
+ * @retval ENOMEM Insufficient memory. The instance is unchanged;
+ *
+ * @note The elements are copied, so the vector may be freed or changed
+ *  afterwards. The element-free callback of the vector (if any) is not
+ *  transferred.
+ *
+ * @pre (NULL != z)
+ * @pre (NULL != v)
+ * @pre (z->el_size == v->el_size)
+ */
+int
+collect_c_frozen_freeze(
+    collect_c_frozen_t*     z
+,   collect_c_vec_t const*  v
+,   int32_t                 flags
+);
+
+/** Obtains a pointer to the first (in sorted order) element that is not
+ * ordered before the key, or NULL if there is none.
+ *
+ * @param z Pointer to the instance. May not be NULL;
+ * @param p_key Pointer to the key. May not be NULL;
+ *
+ * @pre (NULL != z)
+ * @pre (NULL != p_key)
+ */
+void const*
+collect_c_frozen_lower_bound(
+    collect_c_frozen_t const*   z
+,   void const*                 p_key
+);
+
+/** Searches for an element that is equal to the key.
+ *
+ * @param z Pointer to the instance. May not be NULL;
+ * @param p_key Pointer to the key. May not be NULL;
+ * @param p_el Optional pointer to a variable to receive a pointer to the
+ *  element;
+ *
+ * @retval 0 An element was found;
+ * @retval ENOENT No element was found;
+ *
+ * @pre (NULL != z)
+ * @pre (NULL != p_key)
+ */
+int
+collect_c_frozen_find_by_ref(
+    collect_c_frozen_t const*   z
+,   void const*                 p_key
+,   void const**                p_el
+);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper macros
+ */
+
+#define COLLECT_C_FROZEN_EMPTY_INITIALIZER_(cb_el, compare_fn, alloc)       \
+                                                                            \
+    {                                                                       \
+        .el_size = (cb_el),                                                 \
+        .size = 0,                                                          \
+        .flags = 0,                                                         \
+        .reserved0 = 0,                                                     \
+        .storage = NULL,                                                    \
+        .num_slots = 0,                                                     \
+        .block_size = 0,                                                    \
+        .allocation = NULL,                                                 \
+        .cb_allocation = 0,                                                 \
+        .pfn_compare = (compare_fn),                                        \
+        .allocator = (alloc),                                               \
+    }
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#pragma once
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
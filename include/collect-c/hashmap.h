@@ -0,0 +1,492 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    collect-c/hashmap.h
+ *
+ * Purpose: Hash map container.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#ifdef __cplusplus
+# ifndef COLLECT_C_HASHMAP_SUPPRESS_CXX_WARNING
+#  error This file not currently compatible with C++ compilation
+# endif
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * version
+ */
+
+#define COLLECT_C_HASHMAP_VER_MAJOR     0
+#define COLLECT_C_HASHMAP_VER_MINOR     1
+#define COLLECT_C_HASHMAP_VER_PATCH     0
+#define COLLECT_C_HASHMAP_VER_ALPHABETA 41
+
+#define COLLECT_C_HASHMAP_VER \
+    (0\
+        |   (   COLLECT_C_HASHMAP_VER_MAJOR     << 24   ) \
+        |   (   COLLECT_C_HASHMAP_VER_MINOR     << 16   ) \
+        |   (   COLLECT_C_HASHMAP_VER_PATCH     <<  8   ) \
+        |   (   COLLECT_C_HASHMAP_VER_ALPHABETA <<  0   ) \
+    )
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/common.h>
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API types
+ */
+
+/** Callback function that, if attached to instance, will be called back for
+ * each entry upon its erasure or replacement by any of the API functions.
+ *
+ * @param el_size The size of the entry;
+ * @param el_index Always 0;
+ * @param el_ptr Pointer to the entry, whose key is at offset 0 and whose
+ *  value is at the map's value_offset;
+ * @param param_element_free The map's param_element_free;
+ */
+typedef void (*collect_c_hashmap_pfn_free)(
+    size_t  el_size
+,   size_t  el_index    /* always 0 */
+,   void*   el_ptr
+,   void*   param_element_free
+);
+
+struct collect_c_hashmap_t;
+
+/** Callback function that obtains the hash of a key.
+ *
+ * @param m Pointer to the map. Will not be NULL;
+ * @param p_key Pointer to the key. Will not be NULL;
+ *
+ * @note Any two keys for which the map's comparison function returns 0
+ *  must produce the same hash. All bits of the result should depend on the
+ *  key, since both the high and the low bits are used.
+ */
+typedef size_t (*collect_c_hashmap_pfn_hash_t)(
+    struct collect_c_hashmap_t const*   m
+,   void const*                         p_key
+);
+
+/** Callback function that compares keys for equality.
+ *
+ * @param m Pointer to the map. Will not be NULL;
+ * @param p_lhs Pointer to the lhs key. Will not be NULL;
+ * @param p_rhs Pointer to the rhs key. Will not be NULL;
+ *
+ * @retval 0 The keys are equal;
+ * @retval non-0 The keys are not equal;
+ */
+typedef int (*collect_c_hashmap_pfn_compare_t)(
+    struct collect_c_hashmap_t const*   m
+,   void const*                         p_lhs
+,   void const*                         p_rhs
+);
+
+/** Represents a hash map, of fixed-size keys and values.
+ *
+ * @note The implementation is an open-addressing table in the style of
+ *  SwissTable: each slot has a control byte holding 7 bits of the hash of
+ *  its key, and the control bytes of a group of 16 slots are matched
+ *  against a probed key at once (using SSE2 where available), so that most
+ *  non-matching slots are rejected without comparing keys. The maximum
+ *  load factor is 7/8. Erased entries leave tombstones only where needed,
+ *  which are removed when the table is next rehashed.
+ *
+ * @note If pfn_hash is NULL, built-in hashing is used: an integer mixer
+ *  for 4-, 8- and 16-byte keys, otherwise a bytewise hash. If pfn_compare is
+ *  NULL, keys are compared bytewise. Keys that contain padding, or
+ *  pointers to data that determine equality, require both functions.
+ */
+struct collect_c_hashmap_t
+{
+    size_t                          key_size;           /*! The key size. */
+    size_t                          value_size;         /*! The value size. */
+    size_t                          value_offset;       /*! The offset of the value within an entry. */
+    size_t                          entry_size;         /*! The entry size. */
+    size_t                          size;               /*! The number of entries. */
+    size_t                          capacity;           /*! The number of slots: 0, or a power of 2 that is at least 16. */
+    int32_t                         flags;              /*! Control flags. */
+    int32_t                         reserved0;          /*! Reserved field. */
+    size_t                          growth_left;        /*! The number of empty slots that may be filled before rehashing. */
+    size_t                          num_deleted;        /*! The number of tombstones. */
+    int8_t*                         ctrl;               /*! The control bytes, one per slot. */
+    void*                           entries;            /*! The entries, one per slot, following the control bytes. */
+    collect_c_hashmap_pfn_hash_t    pfn_hash;           /*! Optional key hashing function. */
+    collect_c_hashmap_pfn_compare_t pfn_compare;        /*! Optional key comparison function. */
+    struct collect_c_allocator_t const*
+                                    allocator;          /*! Optional allocator. If NULL, malloc()/free() are used. */
+    void*                           param_element_free; /*! Custom parameter to be passed to invocations of pfn_element_free. */
+    collect_c_hashmap_pfn_free      pfn_element_free;   /*! Custom function to be invoked when an entry is erased/replaced. */
+};
+#ifndef __cplusplus
+typedef struct collect_c_hashmap_t      collect_c_hashmap_t;
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions & macros (internal)
+ */
+
+#define COLLECT_C_HASHMAP_get_m_ptr_(m)                     _Generic((m),   \
+                                                                            \
+                           collect_c_hashmap_t* :  (m),                     \
+                     collect_c_hashmap_t const* :  (m),                     \
+                                        default : &(m)                      \
+)
+
+#define COLLECT_C_HASHMAP_assert_key_size_(m_name, t_key)   assert(sizeof(t_key) == COLLECT_C_HASHMAP_get_m_ptr_(m_name)->key_size)
+#define COLLECT_C_HASHMAP_assert_value_size_(m_name, t_v)   assert(sizeof(t_v) == COLLECT_C_HASHMAP_get_m_ptr_(m_name)->value_size)
+
+#define COLLECT_C_HASHMAP_clear_1_(m_name)                  collect_c_hashmap_clear(COLLECT_C_HASHMAP_get_m_ptr_(m_name), NULL, NULL, NULL)
+#define COLLECT_C_HASHMAP_clear_2_(m_name, p)               collect_c_hashmap_clear(COLLECT_C_HASHMAP_get_m_ptr_(m_name), NULL, NULL,  (p))
+
+#define COLLECT_C_HASHMAP_max_(a, b)                        (((a) < (b)) ? (b) : (a))
+#define COLLECT_C_HASHMAP_round_(n, a)                      ((((n) + ((a) - 1)) / (a)) * (a))
+
+#define COLLECT_C_HASHMAP_value_offset_(t_key, t_value)     COLLECT_C_HASHMAP_round_(sizeof(t_key), COLLECT_C_UTIL_ALIGNOF_(t_value))
+#define COLLECT_C_HASHMAP_entry_size_(t_key, t_value)       COLLECT_C_HASHMAP_round_(COLLECT_C_HASHMAP_value_offset_(t_key, t_value) + sizeof(t_value), COLLECT_C_HASHMAP_max_(COLLECT_C_UTIL_ALIGNOF_(t_key), COLLECT_C_UTIL_ALIGNOF_(t_value)))
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions & macros
+ */
+
+/** @def COLLECT_C_HASHMAP_define_empty(key_type, value_type, m_name)
+ *
+ * Declares and defines an empty map instance, using built-in hashing and
+ * bytewise comparison of keys. Storage is allocated as required by the
+ * insertion functions, or by collect_c_hashmap_reserve().
+ *
+ * @param key_type The type of the keys;
+ * @param value_type The type of the values;
+ * @param m_name The name of the instance;
+ */
+#define COLLECT_C_HASHMAP_define_empty(key_type, value_type, m_name)        \
+                                                                            \
+    collect_c_hashmap_t m_name = COLLECT_C_HASHMAP_EMPTY_INITIALIZER_(key_type, value_type, NULL, NULL, NULL, NULL, NULL)
+
+/** @def COLLECT_C_HASHMAP_define_empty_with_functions(key_type, value_type, m_name, hash_fn, compare_fn)
+ *
+ * Declares and defines an empty map instance, using the given key hashing
+ * and comparison functions.
+ *
+ * @param key_type The type of the keys;
+ * @param value_type The type of the values;
+ * @param m_name The name of the instance;
+ * @param hash_fn The key hashing function, or NULL for built-in hashing;
+ * @param compare_fn The key comparison function, or NULL for bytewise
+ *  comparison;
+ */
+#define COLLECT_C_HASHMAP_define_empty_with_functions(key_type, value_type, m_name, hash_fn, compare_fn)    \
+                                                                                                            \
+    collect_c_hashmap_t m_name = COLLECT_C_HASHMAP_EMPTY_INITIALIZER_(key_type, value_type, hash_fn, compare_fn, NULL, NULL, NULL)
+
+/** @def COLLECT_C_HASHMAP_define_empty_with_callback(key_type, value_type, m_name, hash_fn, compare_fn, elf_fn, elf_param)
+ *
+ * Declares and defines an empty map instance, with an element-free
+ * callback.
+ *
+ * @param key_type The type of the keys;
+ * @param value_type The type of the values;
+ * @param m_name The name of the instance;
+ * @param hash_fn The key hashing function, or NULL for built-in hashing;
+ * @param compare_fn The key comparison function, or NULL for bytewise
+ *  comparison;
+ * @param elf_fn Callback function to be invoked when an entry is
+ *  erased/overwritten;
+ * @param elf_param Parameter to be given to the callback function;
+ */
+#define COLLECT_C_HASHMAP_define_empty_with_callback(key_type, value_type, m_name, hash_fn, compare_fn, elf_fn, elf_param) \
+                                                                                                                            \
+    collect_c_hashmap_t m_name = COLLECT_C_HASHMAP_EMPTY_INITIALIZER_(key_type, value_type, hash_fn, compare_fn, NULL, elf_fn, elf_param)
+
+/** @def COLLECT_C_HASHMAP_define_empty_with_allocator(key_type, value_type, m_name, alloc)
+ *
+ * Declares and defines an empty map instance whose storage is to be
+ * obtained from the given allocator.
+ *
+ * @param key_type The type of the keys;
+ * @param value_type The type of the values;
+ * @param m_name The name of the instance;
+ * @param alloc Pointer to the allocator (collect_c_allocator_t), which
+ *  must outlive the instance's storage;
+ */
+#define COLLECT_C_HASHMAP_define_empty_with_allocator(key_type, value_type, m_name, alloc)  \
+                                                                                            \
+    collect_c_hashmap_t m_name = COLLECT_C_HASHMAP_EMPTY_INITIALIZER_(key_type, value_type, NULL, NULL, alloc, NULL, NULL)
+
+
+/* modifiers */
+
+#define COLLECT_C_HASHMAP_clear(...)                        COLLECT_C_UTIL_GET_MACRO_1_or_2_(__VA_ARGS__, COLLECT_C_HASHMAP_clear_2_, COLLECT_C_HASHMAP_clear_1_, NULL)(__VA_ARGS__)
+
+#define COLLECT_C_HASHMAP_erase_by_value(m_name, t_key, key)                \
+                                                            (COLLECT_C_HASHMAP_assert_key_size_(m_name, t_key), collect_c_hashmap_erase_by_ref(COLLECT_C_HASHMAP_get_m_ptr_(m_name), &((t_key){(key)})))
+
+#define COLLECT_C_HASHMAP_insert_by_value(m_name, t_key, key, t_value, value)   \
+                                                            (COLLECT_C_HASHMAP_assert_key_size_(m_name, t_key), COLLECT_C_HASHMAP_assert_value_size_(m_name, t_value), collect_c_hashmap_insert_by_ref(COLLECT_C_HASHMAP_get_m_ptr_(m_name), &((t_key){(key)}), &((t_value){(value)}), NULL))
+
+#define COLLECT_C_HASHMAP_insert_or_assign_by_value(m_name, t_key, key, t_value, value) \
+                                                            (COLLECT_C_HASHMAP_assert_key_size_(m_name, t_key), COLLECT_C_HASHMAP_assert_value_size_(m_name, t_value), collect_c_hashmap_insert_or_assign_by_ref(COLLECT_C_HASHMAP_get_m_ptr_(m_name), &((t_key){(key)}), &((t_value){(value)})))
+
+/* attributes */
+
+#define COLLECT_C_HASHMAP_is_empty(m_name)                  (0 == COLLECT_C_HASHMAP_get_m_ptr_(m_name)->size    )
+#define COLLECT_C_HASHMAP_len(m_name)                       (     COLLECT_C_HASHMAP_get_m_ptr_(m_name)->size    )
+#define COLLECT_C_HASHMAP_capacity(m_name)                  (     COLLECT_C_HASHMAP_get_m_ptr_(m_name)->capacity)
+
+/* accessors */
+
+#define COLLECT_C_HASHMAP_contains_by_value(m_name, t_key, key)             \
+                                                            (COLLECT_C_HASHMAP_assert_key_size_(m_name, t_key), 0 == collect_c_hashmap_find_by_ref(COLLECT_C_HASHMAP_get_m_ptr_(m_name), &((t_key){(key)}), NULL))
+
+#define COLLECT_C_HASHMAP_entry_key_v(m_name, entry)        ((void const*)(entry))
+#define COLLECT_C_HASHMAP_entry_value_v(m_name, entry)      ((void*)(((char*)(entry)) + COLLECT_C_HASHMAP_get_m_ptr_(m_name)->value_offset))
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Obtains the value of COLLECT_C_HASHMAP_VER at the time of compilation of
+ * the library.
+ */
+uint32_t
+collect_c_hashmap_version(void);
+
+/** Obtains the built-in hash of the given bytes, e.g. for use within a
+ * custom hashing function.
+ *
+ * @param p Pointer to the bytes. May be NULL only if cb is 0;
+ * @param cb The number of bytes;
+ */
+size_t
+collect_c_hashmap_hash_bytes(
+    void const* p
+,   size_t      cb
+);
+
+/** Frees storage associated with the instance, invoking the element-free
+ * callback (if any) for each entry.
+ *
+ * @param m Pointer to the map. May not be NULL;
+ *
+ * @pre (NULL != m)
+ */
+int
+collect_c_hashmap_free_storage(
+    collect_c_hashmap_t*    m
+);
+
+/** Clears all entries from the map, invoking the element-free callback (if
+ * any) for each entry. The storage is retained.
+ *
+ * @param m Pointer to the map. May not be NULL;
+ * @param reserved0 Reserved. Must be 0;
+ * @param reserved1 Reserved. Must be 0;
+ * @param num_dropped Optional pointer to variable to retrieve number of
+ *  entries dropped;
+ *
+ * @pre (NULL != m)
+ * @pre (0 == reserved0)
+ * @pre (0 == reserved1)
+ */
+int
+collect_c_hashmap_clear(
+    collect_c_hashmap_t*    m
+,   void*                   reserved0
+,   void*                   reserved1
+,   size_t*                 num_dropped
+);
+
+/** Ensures that the map can hold at least the given number of entries
+ * without rehashing.
+ *
+ * @param m Pointer to the map. May not be NULL;
+ * @param num_entries The number of entries;
+ *
+ * @retval 0 The capacity is sufficient;
+ * @retval ENOMEM Insufficient memory. The map is unchanged;
+ *
+ * @pre (NULL != m)
+ */
+int
+collect_c_hashmap_reserve(
+    collect_c_hashmap_t*    m
+,   size_t                  num_entries
+);
+
+/** Searches the map for the entry with the given key.
+ *
+ * @param m Pointer to the map. May not be NULL;
+ * @param p_key Pointer to the key. May not be NULL;
+ * @param p_value Optional pointer to a variable to receive a pointer to
+ *  the entry's value;
+ *
+ * @retval 0 An entry was found;
+ * @retval ENOENT No entry was found;
+ *
+ * @pre (NULL != m)
+ * @pre (NULL != p_key)
+ */
+int
+collect_c_hashmap_find_by_ref(
+    collect_c_hashmap_t const*  m
+,   void const*                 p_key
+,   void**                      p_value
+);
+
+/** Inserts an entry into the map, if none has the given key.
+ *
+ * @param m Pointer to the map. May not be NULL;
+ * @param p_key Pointer to the key. May not be NULL;
+ * @param p_value Pointer to the value. May be NULL, in which case the
+ *  value is zeroed;
+ * @param p_entry_value Optional pointer to a variable to receive a pointer
+ *  to the value of the inserted - or, on EEXIST, the existing - entry;
+ *
+ * @retval 0 The entry was inserted;
+ * @retval EEXIST An entry with the key already exists. It is unchanged;
+ * @retval ENOMEM Insufficient memory. The map is unchanged;
+ *
+ * @pre (NULL != m)
+ * @pre (NULL != p_key)
+ */
+int
+collect_c_hashmap_insert_by_ref(
+    collect_c_hashmap_t*    m
+,   void const*             p_key
+,   void const*             p_value
+,   void**                  p_entry_value
+);
+
+/** Inserts an entry into the map or, if one has the given key, replaces
+ * it - the element-free callback (if any) being invoked on the existing
+ * entry.
+ *
+ * @param m Pointer to the map. May not be NULL;
+ * @param p_key Pointer to the key. May not be NULL;
+ * @param p_value Pointer to the value. May not be NULL;
+ *
+ * @retval 0 The entry was inserted or replaced;
+ * @retval ENOMEM Insufficient memory. The map is unchanged;
+ *
+ * @pre (NULL != m)
+ * @pre (NULL != p_key)
+ * @pre (NULL != p_value)
+ */
+int
+collect_c_hashmap_insert_or_assign_by_ref(
+    collect_c_hashmap_t*    m
+,   void const*             p_key
+,   void const*             p_value
+);
+
+/** Erases the entry with the given key, invoking the element-free callback
+ * (if any) on it.
+ *
+ * @param m Pointer to the map. May not be NULL;
+ * @param p_key Pointer to the key. May not be NULL;
+ *
+ * @retval 0 The entry was erased;
+ * @retval ENOENT No entry was found;
+ *
+ * @pre (NULL != m)
+ * @pre (NULL != p_key)
+ */
+int
+collect_c_hashmap_erase_by_ref(
+    collect_c_hashmap_t*    m
+,   void const*             p_key
+);
+
+/** Obtains the next entry in the map, in an unspecified order, for
+ * enumerating the entries.
+ *
+ * @param m Pointer to the map. May not be NULL;
+ * @param cursor Pointer to the enumeration state, which must be 0 on the
+ *  first call. May not be NULL;
+ * @param p_key Optional pointer to a variable to receive a pointer to the
+ *  entry's key;
+ * @param p_value Optional pointer to a variable to receive a pointer to
+ *  the entry's value;
+ *
+ * @retval 0 An entry was obtained;
+ * @retval ENOENT There are no more entries;
+ *
+ * @pre (NULL != m)
+ * @pre (NULL != cursor)
+ *
+ * @note The map must not be modified during the enumeration, other than
+ *  by changing the values of its entries.
+ */
+int
+collect_c_hashmap_next_entry(
+    collect_c_hashmap_t const*  m
+,   size_t*                     cursor
+,   void const**                p_key
+,   void**                      p_value
+);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper macros
+ */
+
+#define COLLECT_C_HASHMAP_EMPTY_INITIALIZER_(key_type, value_type, hash_fn, compare_fn, alloc, elf_fn, elf_param) \
+                                                                            \
+    {                                                                       \
+        .key_size = sizeof(key_type),                                       \
+        .value_size = sizeof(value_type),                                   \
+        .value_offset = COLLECT_C_HASHMAP_value_offset_(key_type, value_type), \
+        .entry_size = COLLECT_C_HASHMAP_entry_size_(key_type, value_type),  \
+        .size = 0,                                                          \
+        .capacity = 0,                                                      \
+        .flags = 0,                                                         \
+        .reserved0 = 0,                                                     \
+        .growth_left = 0,                                                   \
+        .num_deleted = 0,                                                   \
+        .ctrl = NULL,                                                       \
+        .entries = NULL,                                                    \
+        .pfn_hash = (hash_fn),                                              \
+        .pfn_compare = (compare_fn),                                        \
+        .allocator = (alloc),                                               \
+        .param_element_free = (elf_param),                                  \
+        .pfn_element_free = (elf_fn),                                       \
+    }
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#pragma once
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
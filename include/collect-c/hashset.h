@@ -0,0 +1,381 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    collect-c/hashset.h
+ *
+ * Purpose: Hash set container.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#ifdef __cplusplus
+# ifndef COLLECT_C_HASHSET_SUPPRESS_CXX_WARNING
+#  error This file not currently compatible with C++ compilation
+# endif
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * version
+ */
+
+#define COLLECT_C_HASHSET_VER_MAJOR     0
+#define COLLECT_C_HASHSET_VER_MINOR     1
+#define COLLECT_C_HASHSET_VER_PATCH     0
+#define COLLECT_C_HASHSET_VER_ALPHABETA 41
+
+#define COLLECT_C_HASHSET_VER \
+    (0\
+        |   (   COLLECT_C_HASHSET_VER_MAJOR     << 24   ) \
+        |   (   COLLECT_C_HASHSET_VER_MINOR     << 16   ) \
+        |   (   COLLECT_C_HASHSET_VER_PATCH     <<  8   ) \
+        |   (   COLLECT_C_HASHSET_VER_ALPHABETA <<  0   ) \
+    )
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/common.h>
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API types
+ */
+
+/** Represents a hash set, of fixed-size keys.
+ *
+ * @note The implementation is the open-addressing table of the hash map
+ *  (collect_c_hashmap_t), holding keys only. The operations are compiled
+ *  separately for keys of 4, 8 and 16 bytes, for which hashing and
+ *  comparison reduce to a few integer instructions, and generically for
+ *  keys of any other size.
+ *
+ * @note Keys are hashed and compared bytewise, so must not contain
+ *  padding.
+ */
+struct collect_c_hashset_t
+{
+    size_t                          key_size;       /*! The key size. */
+    size_t                          size;           /*! The number of keys. */
+    size_t                          capacity;       /*! The number of slots: 0, or a power of 2 that is at least 16. */
+    int32_t                         flags;          /*! Control flags. */
+    int32_t                         reserved0;      /*! Reserved field. */
+    size_t                          growth_left;    /*! The number of empty slots that may be filled before rehashing. */
+    size_t                          num_deleted;    /*! The number of tombstones. */
+    int8_t*                         ctrl;           /*! The control bytes, one per slot. */
+    void*                           keys;           /*! The keys, one per slot, following the control bytes. */
+    struct collect_c_allocator_t const*
+                                    allocator;      /*! Optional allocator. If NULL, malloc()/free() are used. */
+};
+#ifndef __cplusplus
+typedef struct collect_c_hashset_t      collect_c_hashset_t;
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions & macros (internal)
+ */
+
+#define COLLECT_C_HASHSET_get_s_ptr_(s)                     _Generic((s),   \
+                                                                            \
+                           collect_c_hashset_t* :  (s),                     \
+                     collect_c_hashset_t const* :  (s),                     \
+                                        default : &(s)                      \
+)
+
+#define COLLECT_C_HASHSET_assert_key_size_(s_name, t_key)   assert(sizeof(t_key) == COLLECT_C_HASHSET_get_s_ptr_(s_name)->key_size)
+
+#define COLLECT_C_HASHSET_clear_1_(s_name)                  collect_c_hashset_clear(COLLECT_C_HASHSET_get_s_ptr_(s_name), NULL, NULL, NULL)
+#define COLLECT_C_HASHSET_clear_2_(s_name, p)               collect_c_hashset_clear(COLLECT_C_HASHSET_get_s_ptr_(s_name), NULL, NULL,  (p))
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions & macros
+ */
+
+/** @def COLLECT_C_HASHSET_define_empty(key_type, s_name)
+ *
+ * Declares and defines an empty set instance. Storage is allocated as
+ * required by the insertion functions, or by collect_c_hashset_reserve().
+ *
+ * @param key_type The type of the keys;
+ * @param s_name The name of the instance;
+ */
+#define COLLECT_C_HASHSET_define_empty(key_type, s_name)                    \
+                                                                            \
+    collect_c_hashset_t s_name = COLLECT_C_HASHSET_EMPTY_INITIALIZER_(key_type, NULL)
+
+/** @def COLLECT_C_HASHSET_define_empty_with_allocator(key_type, s_name, alloc)
+ *
+ * Declares and defines an empty set instance whose storage is to be
+ * obtained from the given allocator.
+ *
+ * @param key_type The type of the keys;
+ * @param s_name The name of the instance;
+ * @param alloc Pointer to the allocator (collect_c_allocator_t), which
+ *  must outlive the instance's storage;
+ */
+#define COLLECT_C_HASHSET_define_empty_with_allocator(key_type, s_name, alloc)  \
+                                                                                \
+    collect_c_hashset_t s_name = COLLECT_C_HASHSET_EMPTY_INITIALIZER_(key_type, alloc)
+
+
+/* modifiers */
+
+#define COLLECT_C_HASHSET_clear(...)                        COLLECT_C_UTIL_GET_MACRO_1_or_2_(__VA_ARGS__, COLLECT_C_HASHSET_clear_2_, COLLECT_C_HASHSET_clear_1_, NULL)(__VA_ARGS__)
+
+#define COLLECT_C_HASHSET_erase_by_value(s_name, t_key, key)                \
+                                                            (COLLECT_C_HASHSET_assert_key_size_(s_name, t_key), collect_c_hashset_erase_by_ref(COLLECT_C_HASHSET_get_s_ptr_(s_name), &((t_key){(key)})))
+
+#define COLLECT_C_HASHSET_insert_by_value(s_name, t_key, key)               \
+                                                            (COLLECT_C_HASHSET_assert_key_size_(s_name, t_key), collect_c_hashset_insert_by_ref(COLLECT_C_HASHSET_get_s_ptr_(s_name), &((t_key){(key)})))
+
+/* attributes */
+
+#define COLLECT_C_HASHSET_is_empty(s_name)                  (0 == COLLECT_C_HASHSET_get_s_ptr_(s_name)->size    )
+#define COLLECT_C_HASHSET_len(s_name)                       (     COLLECT_C_HASHSET_get_s_ptr_(s_name)->size    )
+#define COLLECT_C_HASHSET_capacity(s_name)                  (     COLLECT_C_HASHSET_get_s_ptr_(s_name)->capacity)
+
+/* accessors */
+
+#define COLLECT_C_HASHSET_contains_by_value(s_name, t_key, key)             \
+                                                            (COLLECT_C_HASHSET_assert_key_size_(s_name, t_key), 0 == collect_c_hashset_find_by_ref(COLLECT_C_HASHSET_get_s_ptr_(s_name), &((t_key){(key)})))
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Obtains the value of COLLECT_C_HASHSET_VER at the time of compilation of
+ * the library.
+ */
+uint32_t
+collect_c_hashset_version(void);
+
+/** Frees storage associated with the instance.
+ *
+ * @param s Pointer to the set. May not be NULL;
+ *
+ * @pre (NULL != s)
+ */
+int
+collect_c_hashset_free_storage(
+    collect_c_hashset_t*    s
+);
+
+/** Clears all keys from the set. The storage is retained.
+ *
+ * @param s Pointer to the set. May not be NULL;
+ * @param reserved0 Reserved. Must be 0;
+ * @param reserved1 Reserved. Must be 0;
+ * @param num_dropped Optional pointer to variable to retrieve number of
+ *  keys dropped;
+ *
+ * @pre (NULL != s)
+ * @pre (0 == reserved0)
+ * @pre (0 == reserved1)
+ */
+int
+collect_c_hashset_clear(
+    collect_c_hashset_t*    s
+,   void*                   reserved0
+,   void*                   reserved1
+,   size_t*                 num_dropped
+);
+
+/** Ensures that the set can hold at least the given number of keys
+ * without rehashing.
+ *
+ * @param s Pointer to the set. May not be NULL;
+ * @param num_keys The number of keys;
+ *
+ * @retval 0 The capacity is sufficient;
+ * @retval ENOMEM Insufficient memory. The set is unchanged;
+ *
+ * @pre (NULL != s)
+ */
+int
+collect_c_hashset_reserve(
+    collect_c_hashset_t*    s
+,   size_t                  num_keys
+);
+
+/** Searches the set for the given key.
+ *
+ * @param s Pointer to the set. May not be NULL;
+ * @param p_key Pointer to the key. May not be NULL;
+ *
+ * @retval 0 The key was found;
+ * @retval ENOENT The key was not found;
+ *
+ * @pre (NULL != s)
+ * @pre (NULL != p_key)
+ */
+int
+collect_c_hashset_find_by_ref(
+    collect_c_hashset_t const*  s
+,   void const*                 p_key
+);
+
+/** Searches the set for each of an array of keys.
+ *
+ * @param s Pointer to the set. May not be NULL;
+ * @param num_keys The number of keys;
+ * @param p_keys Pointer to the array of keys. May be NULL only if
+ *  num_keys is 0;
+ * @param found Optional pointer to an array of num_keys flags, each of
+ *  which receives 1 if the corresponding key was found, otherwise 0;
+ * @param num_found Optional pointer to variable to retrieve the number of
+ *  keys found;
+ *
+ * @note The hashes of the keys are computed, and their probe groups
+ *  prefetched, in batches, so that the memory latency of each batch's
+ *  probes is overlapped.
+ *
+ * @pre (NULL != s)
+ * @pre (NULL != p_keys || 0 == num_keys)
+ */
+int
+collect_c_hashset_find_n_by_ref(
+    collect_c_hashset_t const*  s
+,   size_t                      num_keys
+,   void const*                 p_keys
+,   unsigned char*              found
+,   size_t*                     num_found
+);
+
+/** Inserts a key into the set, if not already present.
+ *
+ * @param s Pointer to the set. May not be NULL;
+ * @param p_key Pointer to the key. May not be NULL;
+ *
+ * @retval 0 The key was inserted;
+ * @retval EEXIST The key is already present;
+ * @retval ENOMEM Insufficient memory. The set is unchanged;
+ *
+ * @pre (NULL != s)
+ * @pre (NULL != p_key)
+ */
+int
+collect_c_hashset_insert_by_ref(
+    collect_c_hashset_t*    s
+,   void const*             p_key
+);
+
+/** Inserts each of an array of keys into the set, if not already present.
+ *
+ * @param s Pointer to the set. May not be NULL;
+ * @param num_keys The number of keys;
+ * @param p_keys Pointer to the array of keys. May be NULL only if
+ *  num_keys is 0;
+ * @param num_inserted Optional pointer to variable to retrieve the number
+ *  of keys inserted, i.e. those not already present (including those
+ *  earlier in the array);
+ *
+ * @retval 0 The keys were inserted;
+ * @retval ENOMEM Insufficient memory. The keys before the first that
+ *  could not be inserted have been inserted;
+ *
+ * @note The hashes of the keys are computed, and their probe groups
+ *  prefetched, in batches, so that the memory latency of each batch's
+ *  probes is overlapped.
+ *
+ * @pre (NULL != s)
+ * @pre (NULL != p_keys || 0 == num_keys)
+ */
+int
+collect_c_hashset_insert_n_by_ref(
+    collect_c_hashset_t*    s
+,   size_t                  num_keys
+,   void const*             p_keys
+,   size_t*                 num_inserted
+);
+
+/** Erases a key from the set.
+ *
+ * @param s Pointer to the set. May not be NULL;
+ * @param p_key Pointer to the key. May not be NULL;
+ *
+ * @retval 0 The key was erased;
+ * @retval ENOENT The key was not found;
+ *
+ * @pre (NULL != s)
+ * @pre (NULL != p_key)
+ */
+int
+collect_c_hashset_erase_by_ref(
+    collect_c_hashset_t*    s
+,   void const*             p_key
+);
+
+/** Enumerates the keys of the set, in an unspecified order.
+ *
+ * @param s Pointer to the set. May not be NULL;
+ * @param cursor Pointer to the enumeration cursor, which must be 0 to
+ *  begin. May not be NULL;
+ * @param p_key Optional pointer to a variable to receive a pointer to the
+ *  key;
+ *
+ * @retval 0 A key was obtained, and the cursor advanced;
+ * @retval ENOENT There are no more keys;
+ *
+ * @note The set must not be modified during the enumeration.
+ *
+ * @pre (NULL != s)
+ * @pre (NULL != cursor)
+ */
+int
+collect_c_hashset_next_key(
+    collect_c_hashset_t const*  s
+,   size_t*                     cursor
+,   void const**                p_key
+);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper macros
+ */
+
+#define COLLECT_C_HASHSET_EMPTY_INITIALIZER_(key_type, alloc)               \
+                                                                            \
+    {                                                                       \
+        .key_size = sizeof(key_type),                                       \
+        .size = 0,                                                          \
+        .capacity = 0,                                                      \
+        .flags = 0,                                                         \
+        .reserved0 = 0,                                                     \
+        .growth_left = 0,                                                   \
+        .num_deleted = 0,                                                   \
+        .ctrl = NULL,                                                       \
+        .keys = NULL,                                                       \
+        .allocator = (alloc),                                               \
+    }
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#pragma once
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,542 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    collect-c/ilist.h
+ *
+ * Purpose: Index-linked list container.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#ifdef __cplusplus
+# ifndef COLLECT_C_ILIST_SUPPRESS_CXX_WARNING
+#  error This file not currently compatible with C++ compilation
+# endif
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * version
+ */
+
+#define COLLECT_C_ILIST_VER_MAJOR       0
+#define COLLECT_C_ILIST_VER_MINOR       1
+#define COLLECT_C_ILIST_VER_PATCH       0
+#define COLLECT_C_ILIST_VER_ALPHABETA   41
+
+#define COLLECT_C_ILIST_VER \
+    (0\
+        |   (   COLLECT_C_ILIST_VER_MAJOR       << 24   ) \
+        |   (   COLLECT_C_ILIST_VER_MINOR       << 16   ) \
+        |   (   COLLECT_C_ILIST_VER_PATCH       <<  8   ) \
+        |   (   COLLECT_C_ILIST_VER_ALPHABETA   <<  0   ) \
+    )
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/common.h>
+#include <collect-c/vec.h>
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API constants
+ */
+
+/** The index value that denotes no node. */
+#define COLLECT_C_ILIST_NIL                                 (UINT32_MAX)
+
+/** The capacity allocated on first insertion, if storage has not been
+ * explicitly allocated via collect_c_ilist_allocate_storage().
+ */
+#ifndef COLLECT_C_ILIST_DEFAULT_INITIAL_CAPACITY
+# define COLLECT_C_ILIST_DEFAULT_INITIAL_CAPACITY           (16)
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API types
+ */
+
+/** The links of a node. For a node in the free chain, next refers to the
+ * next free node.
+ */
+struct collect_c_ilist_link_t
+{
+    uint32_t    prev;
+    uint32_t    next;
+};
+#ifndef __cplusplus
+typedef struct collect_c_ilist_link_t   collect_c_ilist_link_t;
+#endif
+
+/** Callback function that, if attached to instance, will be called back for
+ * each element upon its erasure or replacement by any of the API functions.
+ */
+typedef void (*collect_c_ilist_pfn_free)(
+    size_t  el_size
+,   size_t  el_index    /* the node index */
+,   void*   el_ptr
+,   void*   param_element_free
+);
+
+/** Represents an index-linked list.
+ *
+ * @note Nodes are identified by uint32_t indices into two parallel arrays
+ *  - the elements and the links - each held in a collect_c_vec_t, rather
+ *  than being separately allocated and linked by pointers. This halves the
+ *  link overhead (on 64-bit builds) compared with collect_c_dlist_t,
+ *  keeps traversal within dense regions of memory, and allows the whole
+ *  list to be freed or copied in one operation. Erased nodes are kept in
+ *  a free chain and reused by subsequent insertions. Node indices are
+ *  stable for the lifetime of the node, though element addresses are not
+ *  (since the arrays may be reallocated upon insertion).
+ */
+struct collect_c_ilist_t
+{
+    size_t                      el_size;            /*! The element size. */
+    size_t                      size;               /*! The number of elements. */
+    uint32_t                    head;               /*! Index of the first node, or COLLECT_C_ILIST_NIL. */
+    uint32_t                    tail;               /*! Index of the last node, or COLLECT_C_ILIST_NIL. */
+    uint32_t                    free_head;          /*! Index of the first free node, or COLLECT_C_ILIST_NIL. */
+    uint32_t                    num_free;           /*! The number of free nodes. */
+    int32_t                     flags;              /*! Control flags. */
+    int32_t                     reserved0;          /*! Reserved field. */
+    collect_c_vec_t             data;               /*! The elements, indexed by node. */
+    collect_c_vec_t             links;              /*! The links, indexed by node. */
+    struct collect_c_allocator_t const*
+                                allocator;          /*! Optional allocator, which is also that of data and links. If NULL, malloc()/realloc()/free() are used. */
+    void*                       param_element_free; /*! Custom parameter to be passed to invocations of pfn_element_free. */
+    collect_c_ilist_pfn_free    pfn_element_free;   /*! Custom function to be invoked when element erased/replaced. */
+};
+#ifndef __cplusplus
+typedef struct collect_c_ilist_t        collect_c_ilist_t;
+#endif
+
+/** Callback function that performs comparison between elements for the
+ * purpose of search.
+ *
+ * @param l Pointer to the list. Will not be NULL;
+ * @param p_lhs Pointer to the lhs element. Will not be NULL;
+ * @param p_rhs Pointer to the lhs element. Will not be NULL;
+ *
+ * @retval <0 The element referred to by p_lhs is "less than" the element
+ *  referred to by p_rhs;
+ * @retval 0 A matching element is found;
+ * @retval >0 The element referred to by p_lhs is "greater than" the element
+ *  referred to by p_rhs;
+ *
+ * @note No modifications to l are permitted.
+ */
+typedef int (*collect_c_ilist_pfn_compare_t)(
+    collect_c_ilist_t const*    l
+,   void const*                 p_lhs
+,   void const*                 p_rhs
+);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions & macros (internal)
+ */
+
+#define COLLECT_C_ILIST_get_l_ptr_(l)                       _Generic((l),   \
+                                                                            \
+                             collect_c_ilist_t* :  (l),                     \
+                       collect_c_ilist_t const* :  (l),                     \
+                                        default : &(l)                      \
+)
+
+#define COLLECT_C_ILIST_assert_el_size_(l_name, t_el)       assert(sizeof(t_el) == COLLECT_C_ILIST_get_l_ptr_(l_name)->el_size)
+#define COLLECT_C_ILIST_assert_ix_(l_name, ix)              assert((ix) < COLLECT_C_ILIST_get_l_ptr_(l_name)->links.size)
+#define COLLECT_C_ILIST_assert_not_empty_(l_name)           assert(0 != COLLECT_C_ILIST_get_l_ptr_(l_name)->size)
+
+#define COLLECT_C_ILIST_clear_1_(l_name)                    collect_c_ilist_clear(COLLECT_C_ILIST_get_l_ptr_(l_name), NULL, NULL, NULL)
+#define COLLECT_C_ILIST_clear_2_(l_name, p)                 collect_c_ilist_clear(COLLECT_C_ILIST_get_l_ptr_(l_name), NULL, NULL,  (p))
+
+#define COLLECT_C_ILIST_link_(l_name, ix)                   (((collect_c_ilist_link_t const*)COLLECT_C_ILIST_get_l_ptr_(l_name)->links.storage)[(ix)])
+
+#define COLLECT_C_ILIST_at_v_(l_name, ix)                   ((void      *)(((char      *)COLLECT_C_ILIST_get_l_ptr_(l_name)->data.storage) + ((ix) * COLLECT_C_ILIST_get_l_ptr_(l_name)->el_size)))
+#define COLLECT_C_ILIST_cat_v_(l_name, ix)                  ((void const*)(((char const*)COLLECT_C_ILIST_get_l_ptr_(l_name)->data.storage) + ((ix) * COLLECT_C_ILIST_get_l_ptr_(l_name)->el_size)))
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions & macros
+ */
+
+/** @def COLLECT_C_ILIST_define_empty(el_type, l_name)
+ *
+ * Declares and defines an empty list instance. Storage will be allocated
+ * upon first insertion, or may be allocated explicitly via
+ * collect_c_ilist_allocate_storage().
+ *
+ * @param el_type The type of the elements to be stored;
+ * @param l_name The name of the instance;
+ */
+#define COLLECT_C_ILIST_define_empty(el_type, l_name)                       \
+                                                                            \
+    collect_c_ilist_t l_name = COLLECT_C_ILIST_EMPTY_INITIALIZER_(el_type, 0, NULL, NULL)
+
+
+/** @def COLLECT_C_ILIST_define_empty_with_callback(el_type, l_name, elf_fn, elf_param)
+ *
+ * Declares and defines an empty list instance.
+ *
+ * @param el_type The type of the elements to be stored;
+ * @param l_name The name of the instance;
+ * @param elf_fn Callback function to be invoked when element is
+ *  erased/removed/overwritten;
+ * @param elf_param Parameter to be given to the callback function;
+ */
+#define COLLECT_C_ILIST_define_empty_with_callback(el_type, l_name, elf_fn, elf_param) \
+                                                                                        \
+    collect_c_ilist_t l_name = COLLECT_C_ILIST_EMPTY_INITIALIZER_(el_type, 0, elf_fn, elf_param)
+
+
+/** @def COLLECT_C_ILIST_define_empty_with_allocator(el_type, l_name, alloc)
+ *
+ * Declares and defines an empty list instance whose storage - of both
+ * elements and links - is to be obtained from the given allocator.
+ *
+ * @param el_type The type of the elements to be stored;
+ * @param l_name The name of the instance;
+ * @param alloc Pointer to the allocator (collect_c_allocator_t), which
+ *  must outlive the instance's storage;
+ */
+#define COLLECT_C_ILIST_define_empty_with_allocator(el_type, l_name, alloc) \
+                                                                            \
+    collect_c_ilist_t l_name = COLLECT_C_ILIST_EMPTY_INITIALIZER_WITH_ALLOCATOR_(el_type, 0, (alloc), NULL, NULL)
+
+
+/* modifiers */
+
+#define COLLECT_C_ILIST_clear(...)                          COLLECT_C_UTIL_GET_MACRO_1_or_2_(__VA_ARGS__, COLLECT_C_ILIST_clear_2_, COLLECT_C_ILIST_clear_1_, NULL)(__VA_ARGS__)
+
+#define COLLECT_C_ILIST_erase(l_name, ix)                   collect_c_ilist_erase(COLLECT_C_ILIST_get_l_ptr_(l_name), (ix))
+
+#define COLLECT_C_ILIST_insert_after(l_name, ix, ptr_new_el)    collect_c_ilist_insert_after(COLLECT_C_ILIST_get_l_ptr_(l_name), (ix), (ptr_new_el), NULL)
+#define COLLECT_C_ILIST_insert_before(l_name, ix, ptr_new_el)   collect_c_ilist_insert_before(COLLECT_C_ILIST_get_l_ptr_(l_name), (ix), (ptr_new_el), NULL)
+
+#define COLLECT_C_ILIST_push_back_by_ref(l_name, ptr_new_el)    collect_c_ilist_push_back_by_ref(COLLECT_C_ILIST_get_l_ptr_(l_name), (ptr_new_el), NULL)
+#define COLLECT_C_ILIST_push_back_by_value(l_name, t_el, new_el)    \
+                                                            (COLLECT_C_ILIST_assert_el_size_(l_name, t_el), collect_c_ilist_push_back_by_ref(COLLECT_C_ILIST_get_l_ptr_(l_name), &((t_el){(new_el)}), NULL))
+
+#define COLLECT_C_ILIST_push_front_by_ref(l_name, ptr_new_el)   collect_c_ilist_push_front_by_ref(COLLECT_C_ILIST_get_l_ptr_(l_name), (ptr_new_el), NULL)
+#define COLLECT_C_ILIST_push_front_by_value(l_name, t_el, new_el)   \
+                                                            (COLLECT_C_ILIST_assert_el_size_(l_name, t_el), collect_c_ilist_push_front_by_ref(COLLECT_C_ILIST_get_l_ptr_(l_name), &((t_el){(new_el)}), NULL))
+
+/* attributes */
+
+#define COLLECT_C_ILIST_is_empty(l_name)                    (0 == COLLECT_C_ILIST_get_l_ptr_(l_name)->size)
+#define COLLECT_C_ILIST_len(l_name)                         (     COLLECT_C_ILIST_get_l_ptr_(l_name)->size)
+#define COLLECT_C_ILIST_num_free(l_name)                    (     COLLECT_C_ILIST_get_l_ptr_(l_name)->num_free)
+
+/* traversal */
+
+#define COLLECT_C_ILIST_head(l_name)                        (COLLECT_C_ILIST_get_l_ptr_(l_name)->head)
+#define COLLECT_C_ILIST_tail(l_name)                        (COLLECT_C_ILIST_get_l_ptr_(l_name)->tail)
+#define COLLECT_C_ILIST_next(l_name, ix)                    (COLLECT_C_ILIST_assert_ix_(l_name, ix), COLLECT_C_ILIST_link_(l_name, ix).next)
+#define COLLECT_C_ILIST_prev(l_name, ix)                    (COLLECT_C_ILIST_assert_ix_(l_name, ix), COLLECT_C_ILIST_link_(l_name, ix).prev)
+
+/* accessors */
+
+#define COLLECT_C_ILIST_at_v(l_name, ix)                    (COLLECT_C_ILIST_assert_ix_(l_name, ix),  COLLECT_C_ILIST_at_v_(l_name, ix))
+#define COLLECT_C_ILIST_cat_v(l_name, ix)                   (COLLECT_C_ILIST_assert_ix_(l_name, ix), COLLECT_C_ILIST_cat_v_(l_name, ix))
+
+#define COLLECT_C_ILIST_at_t(l_name, t_el, ix)              ((t_el      *)(COLLECT_C_ILIST_assert_el_size_(l_name, t_el),  COLLECT_C_ILIST_at_v(l_name, ix)))
+#define COLLECT_C_ILIST_cat_t(l_name, t_el, ix)             ((t_el const*)(COLLECT_C_ILIST_assert_el_size_(l_name, t_el), COLLECT_C_ILIST_cat_v(l_name, ix)))
+
+#define COLLECT_C_ILIST_cfront_t(l_name, t_el)              (COLLECT_C_ILIST_assert_not_empty_(l_name), COLLECT_C_ILIST_cat_t(l_name, t_el, COLLECT_C_ILIST_get_l_ptr_(l_name)->head))
+#define COLLECT_C_ILIST_cback_t(l_name, t_el)               (COLLECT_C_ILIST_assert_not_empty_(l_name), COLLECT_C_ILIST_cat_t(l_name, t_el, COLLECT_C_ILIST_get_l_ptr_(l_name)->tail))
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Obtains the value of COLLECT_C_ILIST_VER at the time of compilation of
+ * the library.
+ */
+uint32_t
+collect_c_ilist_version(void);
+
+/** Allocates storage for an instance from the heap.
+ *
+ * @param l Pointer to the list. May not be NULL. May not point to an
+ *  instance that has already been allocated;
+ * @param initial_capacity The initial number of nodes to be allocated;
+ *
+ * @retval 0 Operation succeed;
+ * @retval ENOMEM Sufficient memory not available;
+ *
+ * @pre (NULL != l)
+ * @pre (NULL == l->data.storage)
+ */
+int
+collect_c_ilist_allocate_storage(
+    collect_c_ilist_t*  l
+,   size_t              initial_capacity
+);
+
+/** Frees storage associated with the instance, invoking the element-free
+ * callback (if any) for each element.
+ *
+ * @param l Pointer to the list. May not be NULL;
+ *
+ * @pre (NULL != l)
+ */
+void
+collect_c_ilist_free_storage(
+    collect_c_ilist_t*  l
+);
+
+/** Clears all elements from the list, invoking the element-free callback
+ * (if any) for each element. The allocated storage is retained.
+ *
+ * @param l Pointer to the list. May not be NULL;
+ * @param reserved0 Reserved. Must be 0;
+ * @param reserved1 Reserved. Must be 0;
+ * @param num_dropped Optional pointer to variable to retrieve number of
+ *  entries dropped;
+ *
+ * @pre (NULL != l)
+ * @pre (0 == reserved0)
+ * @pre (0 == reserved1)
+ */
+int
+collect_c_ilist_clear(
+    collect_c_ilist_t*  l
+,   void*               reserved0
+,   void*               reserved1
+,   size_t*             num_dropped
+);
+
+/** Copies the contents of one list into another, in a single allocation
+ * per array. Node indices are preserved.
+ *
+ * @param dst Pointer to the destination list. May not be NULL. Must not
+ *  have allocated storage, and must have the same element size as src;
+ * @param src Pointer to the source list. May not be NULL;
+ *
+ * @retval 0 Operation succeed;
+ * @retval ENOMEM Sufficient memory not available;
+ *
+ * @note Elements are copied bitwise.
+ *
+ * @pre (NULL != dst)
+ * @pre (NULL == dst->data.storage)
+ * @pre (NULL != src)
+ * @pre (dst->el_size == src->el_size)
+ */
+int
+collect_c_ilist_copy(
+    collect_c_ilist_t*          dst
+,   collect_c_ilist_t const*    src
+);
+
+/** Erases the given node from the list, placing it in the free chain.
+ *
+ * @param l Pointer to the list. May not be NULL;
+ * @param index Index of the node to be erased. Must refer to a node in the
+ *  list;
+ *
+ * @pre (NULL != l)
+ */
+int
+collect_c_ilist_erase(
+    collect_c_ilist_t*  l
+,   uint32_t            index
+);
+
+/** Performs a forward search of the list for an element matching the
+ * search criteria.
+ *
+ * @param l Pointer to the list. May not be NULL;
+ * @param pfn Comparison function that will be used to identify an
+ *  element. May not be NULL;
+ * @param p_lhs Caller-supplied parameter to be passed back to pfn as its
+ *  lhs. May not be NULL;
+ * @param skip_count Number of matched elements to ignore before an element
+ *  is designated as being found;
+ * @param index Pointer to a variable to receive the node index of the
+ *  found element, or COLLECT_C_ILIST_NIL. May not be NULL;
+ * @param num_searched Optional pointer to obtain the number of elements
+ *  traversed in the search including, if found, the matching element;
+ *
+ * @retval 0 An element was found matching the given criteria;
+ * @retval ENOENT No element was found matching the given criteria;
+ */
+int
+collect_c_ilist_find(
+    collect_c_ilist_t const*        l
+,   collect_c_ilist_pfn_compare_t   pfn
+,   void const*                     p_lhs
+,   size_t                          skip_count
+,   uint32_t*                       index
+,   size_t*                         num_searched
+);
+
+/** Performs a reverse search of the list for an element matching the
+ * search criteria.
+ *
+ * @param l Pointer to the list. May not be NULL;
+ * @param pfn Comparison function that will be used to identify an
+ *  element. May not be NULL;
+ * @param p_lhs Caller-supplied parameter to be passed back to pfn as its
+ *  lhs. May not be NULL;
+ * @param skip_count Number of matched elements to ignore before an element
+ *  is designated as being found;
+ * @param index Pointer to a variable to receive the node index of the
+ *  found element, or COLLECT_C_ILIST_NIL. May not be NULL;
+ * @param num_searched Optional pointer to obtain the number of elements
+ *  traversed in the search including, if found, the matching element;
+ *
+ * @retval 0 An element was found matching the given criteria;
+ * @retval ENOENT No element was found matching the given criteria;
+ */
+int
+collect_c_ilist_rfind(
+    collect_c_ilist_t const*        l
+,   collect_c_ilist_pfn_compare_t   pfn
+,   void const*                     p_lhs
+,   size_t                          skip_count
+,   uint32_t*                       index
+,   size_t*                         num_searched
+);
+
+/** Inserts a new element after the given node.
+ *
+ * @param l Pointer to the list. May not be NULL;
+ * @param ref Index of the node after which the new element is to be
+ *  inserted. Must refer to a node in the list;
+ * @param ptr_new_el Pointer to the new element. May not be NULL;
+ * @param new_index Optional pointer to variable to receive the index of
+ *  the new node;
+ *
+ * @retval 0 The element was inserted;
+ * @retval ENOMEM Sufficient memory not available;
+ * @retval ENOSPC The maximum number of nodes has been reached;
+ *
+ * @pre (NULL != l)
+ * @pre (NULL != ptr_new_el)
+ */
+int
+collect_c_ilist_insert_after(
+    collect_c_ilist_t*  l
+,   uint32_t            ref
+,   void const*         ptr_new_el
+,   uint32_t*           new_index
+);
+
+/** Inserts a new element before the given node.
+ *
+ * @param l Pointer to the list. May not be NULL;
+ * @param ref Index of the node before which the new element is to be
+ *  inserted. Must refer to a node in the list;
+ * @param ptr_new_el Pointer to the new element. May not be NULL;
+ * @param new_index Optional pointer to variable to receive the index of
+ *  the new node;
+ *
+ * @retval 0 The element was inserted;
+ * @retval ENOMEM Sufficient memory not available;
+ * @retval ENOSPC The maximum number of nodes has been reached;
+ *
+ * @pre (NULL != l)
+ * @pre (NULL != ptr_new_el)
+ */
+int
+collect_c_ilist_insert_before(
+    collect_c_ilist_t*  l
+,   uint32_t            ref
+,   void const*         ptr_new_el
+,   uint32_t*           new_index
+);
+
+/** Attempts to add an item to the back of the list.
+ *
+ * @param l Pointer to the list. May not be NULL;
+ * @param ptr_new_el Pointer to the new element. May not be NULL;
+ * @param new_index Optional pointer to variable to receive the index of
+ *  the new node;
+ *
+ * @pre (NULL != l)
+ * @pre (NULL != ptr_new_el)
+ */
+int
+collect_c_ilist_push_back_by_ref(
+    collect_c_ilist_t*  l
+,   void const*         ptr_new_el
+,   uint32_t*           new_index
+);
+
+/** Attempts to add an item to the front of the list.
+ *
+ * @param l Pointer to the list. May not be NULL;
+ * @param ptr_new_el Pointer to the new element. May not be NULL;
+ * @param new_index Optional pointer to variable to receive the index of
+ *  the new node;
+ *
+ * @pre (NULL != l)
+ * @pre (NULL != ptr_new_el)
+ */
+int
+collect_c_ilist_push_front_by_ref(
+    collect_c_ilist_t*  l
+,   void const*         ptr_new_el
+,   uint32_t*           new_index
+);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper macros
+ */
+
+#define COLLECT_C_ILIST_EMPTY_INITIALIZER_WITH_ALLOCATOR_(el_type, l_flags, l_alloc, elf_fn, elf_param) \
+                                                                            \
+    {                                                                       \
+        .el_size = sizeof(el_type),                                         \
+        .size = 0,                                                          \
+        .head = COLLECT_C_ILIST_NIL,                                        \
+        .tail = COLLECT_C_ILIST_NIL,                                        \
+        .free_head = COLLECT_C_ILIST_NIL,                                   \
+        .num_free = 0,                                                      \
+        .flags = (l_flags),                                                 \
+        .reserved0 = 0,                                                     \
+        .data = COLLECT_C_VEC_EMPTY_INITIALIZER_WITH_ALLOCATOR_(el_type, 0, COLLECT_C_VEC_F_NO_BOO, NULL, l_alloc, NULL, NULL), \
+        .links = COLLECT_C_VEC_EMPTY_INITIALIZER_WITH_ALLOCATOR_(collect_c_ilist_link_t, 0, COLLECT_C_VEC_F_NO_BOO, NULL, l_alloc, NULL, NULL), \
+        .allocator = (l_alloc),                                             \
+        .param_element_free = (elf_param),                                  \
+        .pfn_element_free = (elf_fn),                                       \
+    }
+
+#define COLLECT_C_ILIST_EMPTY_INITIALIZER_(el_type, l_flags, elf_fn, elf_param) \
+                                                                            \
+    COLLECT_C_ILIST_EMPTY_INITIALIZER_WITH_ALLOCATOR_(el_type, l_flags, NULL, elf_fn, elf_param)
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#pragma once
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,403 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    collect-c/lru.h
+ *
+ * Purpose: Hash-indexed LRU cache container.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#ifdef __cplusplus
+# ifndef COLLECT_C_LRU_SUPPRESS_CXX_WARNING
+#  error This file not currently compatible with C++ compilation
+# endif
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * version
+ */
+
+#define COLLECT_C_LRU_VER_MAJOR         0
+#define COLLECT_C_LRU_VER_MINOR         1
+#define COLLECT_C_LRU_VER_PATCH         0
+#define COLLECT_C_LRU_VER_ALPHABETA     41
+
+#define COLLECT_C_LRU_VER \
+    (0\
+        |   (   COLLECT_C_LRU_VER_MAJOR         << 24   ) \
+        |   (   COLLECT_C_LRU_VER_MINOR         << 16   ) \
+        |   (   COLLECT_C_LRU_VER_PATCH         <<  8   ) \
+        |   (   COLLECT_C_LRU_VER_ALPHABETA     <<  0   ) \
+    )
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/common.h>
+#include <collect-c/dlist.h>
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API types
+ */
+
+/** Callback function that obtains the hash of an element.
+ *
+ * @param l Pointer to the (recency) list of the cache. Will not be NULL;
+ * @param p_el Pointer to the element, or to the search key. Will not be
+ *  NULL;
+ *
+ * @note Any two elements for which the cache's comparison function returns
+ *  0 must produce the same hash.
+ */
+typedef size_t (*collect_c_lru_pfn_hash_t)(
+    collect_c_dlist_t const*    l
+,   void const*                 p_el
+);
+
+struct collect_c_lru_slot_t
+{
+    size_t                      hash;               /*! The cached hash of the element. */
+    collect_c_dlist_node_t*     node;               /*! The indexed node, or NULL if the slot is empty. */
+};
+#ifndef __cplusplus
+typedef struct collect_c_lru_slot_t     collect_c_lru_slot_t;
+#endif
+
+/** Represents a least-recently-used cache.
+ *
+ * @note The elements are held in a doubly-linked list in order of recency
+ *  of use - most-recently used at the head - and are indexed by an
+ *  open-addressing hash table, such that lookup, move-to-front, and
+ *  eviction are all O(1). When the number of elements would exceed
+ *  max_size the least-recently used element is evicted, causing
+ *  invocation of the list's pfn_element_free. The index is sized from
+ *  the number of elements, doubling as required, so a generous max_size
+ *  costs nothing until it is approached.
+ */
+struct collect_c_lru_t
+{
+    collect_c_dlist_t               list;           /*! The recency list, most-recently used at head. */
+    size_t                          max_size;       /*! The maximum number of elements, or 0 for unbounded. */
+    size_t                          num_slots;      /*! The number of slots in the index (a power of 2). */
+    int32_t                         flags;          /*! Control flags. */
+    int32_t                         reserved0;      /*! Reserved field. */
+    collect_c_lru_slot_t*           slots;          /*! The index. */
+    collect_c_lru_pfn_hash_t        pfn_hash;       /*! The element hashing function. */
+    collect_c_dlist_pfn_compare_t   pfn_compare;    /*! The element comparison function. */
+    struct collect_c_allocator_t const*
+                                    allocator;      /*! Optional allocator, from which the index is obtained, and which is also that of the list. If NULL, malloc()/free() are used. */
+};
+#ifndef __cplusplus
+typedef struct collect_c_lru_t          collect_c_lru_t;
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions & macros (internal)
+ */
+
+#define COLLECT_C_LRU_get_l_ptr_(c)                         _Generic((c),   \
+                                                                            \
+                               collect_c_lru_t* :  (c),                     \
+                         collect_c_lru_t const* :  (c),                     \
+                                        default : &(c)                      \
+)
+
+#define COLLECT_C_LRU_assert_el_size_(c_name, t_el)         assert(sizeof(t_el) == COLLECT_C_LRU_get_l_ptr_(c_name)->list.el_size)
+
+#define COLLECT_C_LRU_clear_1_(c_name)                      collect_c_lru_clear(COLLECT_C_LRU_get_l_ptr_(c_name), NULL, NULL, NULL)
+#define COLLECT_C_LRU_clear_2_(c_name, p)                   collect_c_lru_clear(COLLECT_C_LRU_get_l_ptr_(c_name), NULL, NULL,  (p))
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions & macros
+ */
+
+/** @def COLLECT_C_LRU_define_empty(el_type, c_name, c_max_size, hash_fn, compare_fn)
+ *
+ * Declares and defines an empty cache instance. Storage is allocated as
+ * required by the insertion functions.
+ *
+ * @param el_type The type of the elements to be stored;
+ * @param c_name The name of the instance;
+ * @param c_max_size The maximum number of elements, or 0 for unbounded;
+ * @param hash_fn The element hashing function;
+ * @param compare_fn The element comparison function;
+ */
+#define COLLECT_C_LRU_define_empty(el_type, c_name, c_max_size, hash_fn, compare_fn)   \
+                                                                                        \
+    collect_c_lru_t c_name = COLLECT_C_LRU_EMPTY_INITIALIZER_(el_type, c_max_size, 0, hash_fn, compare_fn, NULL, NULL)
+
+
+/** @def COLLECT_C_LRU_define_empty_with_callback(el_type, c_name, c_max_size, hash_fn, compare_fn, elf_fn, elf_param)
+ *
+ * Declares and defines an empty cache instance. Storage is allocated as
+ * required by the insertion functions.
+ *
+ * @param el_type The type of the elements to be stored;
+ * @param c_name The name of the instance;
+ * @param c_max_size The maximum number of elements, or 0 for unbounded;
+ * @param hash_fn The element hashing function;
+ * @param compare_fn The element comparison function;
+ * @param elf_fn Callback function to be invoked when element is
+ *  erased/evicted/overwritten;
+ * @param elf_param Parameter to be given to the callback function;
+ */
+#define COLLECT_C_LRU_define_empty_with_callback(el_type, c_name, c_max_size, hash_fn, compare_fn, elf_fn, elf_param)  \
+                                                                                                                        \
+    collect_c_lru_t c_name = COLLECT_C_LRU_EMPTY_INITIALIZER_(el_type, c_max_size, 0, hash_fn, compare_fn, elf_fn, elf_param)
+
+
+/** @def COLLECT_C_LRU_define_empty_with_allocator(el_type, c_name, c_max_size, hash_fn, compare_fn, alloc)
+ *
+ * Declares and defines an empty cache instance whose nodes and index are
+ * to be obtained from the given allocator.
+ *
+ * @param el_type The type of the elements to be stored;
+ * @param c_name The name of the instance;
+ * @param c_max_size The maximum number of elements, or 0 for unbounded;
+ * @param hash_fn The element hashing function;
+ * @param compare_fn The element comparison function;
+ * @param alloc Pointer to the allocator (collect_c_allocator_t), which
+ *  must outlive the instance's storage;
+ */
+#define COLLECT_C_LRU_define_empty_with_allocator(el_type, c_name, c_max_size, hash_fn, compare_fn, alloc)  \
+                                                                                                            \
+    collect_c_lru_t c_name = COLLECT_C_LRU_EMPTY_INITIALIZER_WITH_ALLOCATOR_(el_type, c_max_size, 0, hash_fn, compare_fn, (alloc), NULL, NULL)
+
+
+/* modifiers */
+
+#define COLLECT_C_LRU_clear(...)                            COLLECT_C_UTIL_GET_MACRO_1_or_2_(__VA_ARGS__, COLLECT_C_LRU_clear_2_, COLLECT_C_LRU_clear_1_, NULL)(__VA_ARGS__)
+
+#define COLLECT_C_LRU_erase_node(c_name, node)              collect_c_lru_erase_node(COLLECT_C_LRU_get_l_ptr_(c_name), (node))
+
+#define COLLECT_C_LRU_insert_by_ref(c_name, ptr_new_el)     collect_c_lru_insert_by_ref(COLLECT_C_LRU_get_l_ptr_(c_name), (ptr_new_el), NULL)
+#define COLLECT_C_LRU_insert_by_value(c_name, t_el, new_el) \
+                                                            (COLLECT_C_LRU_assert_el_size_(c_name, t_el), collect_c_lru_insert_by_ref(COLLECT_C_LRU_get_l_ptr_(c_name), &((t_el){(new_el)}), NULL))
+
+#define COLLECT_C_LRU_touch_node(c_name, node)              collect_c_lru_touch_node(COLLECT_C_LRU_get_l_ptr_(c_name), (node))
+
+/* attributes */
+
+#define COLLECT_C_LRU_is_empty(c_name)                      (0 == COLLECT_C_LRU_get_l_ptr_(c_name)->list.size)
+#define COLLECT_C_LRU_len(c_name)                           (     COLLECT_C_LRU_get_l_ptr_(c_name)->list.size)
+#define COLLECT_C_LRU_max_size(c_name)                      (     COLLECT_C_LRU_get_l_ptr_(c_name)->max_size)
+
+/* accessors */
+
+#define COLLECT_C_LRU_cmru_t(c_name, t_el)                  COLLECT_C_DLIST_cfront_t(COLLECT_C_LRU_get_l_ptr_(c_name)->list, t_el)
+#define COLLECT_C_LRU_clru_t(c_name, t_el)                  COLLECT_C_DLIST_cback_t( COLLECT_C_LRU_get_l_ptr_(c_name)->list, t_el)
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Obtains the value of COLLECT_C_LRU_VER at the time of compilation of
+ * the library.
+ */
+uint32_t
+collect_c_lru_version(void);
+
+/** Frees storage associated with the instance, invoking the element-free
+ * callback (if any) for each element.
+ *
+ * @param c Pointer to the cache. May not be NULL;
+ *
+ * @pre (NULL != c)
+ */
+int
+collect_c_lru_free_storage(
+    collect_c_lru_t*    c
+);
+
+/** Clears all elements from the cache, invoking the element-free callback
+ * (if any) for each element.
+ *
+ * @param c Pointer to the cache. May not be NULL;
+ * @param reserved0 Reserved. Must be 0;
+ * @param reserved1 Reserved. Must be 0;
+ * @param num_dropped Optional pointer to variable to retrieve number of
+ *  entries dropped;
+ *
+ * @pre (NULL != c)
+ * @pre (0 == reserved0)
+ * @pre (0 == reserved1)
+ */
+int
+collect_c_lru_clear(
+    collect_c_lru_t*    c
+,   void*               reserved0
+,   void*               reserved1
+,   size_t*             num_dropped
+);
+
+/** Compacts the cache's storage, relocating all elements into a single
+ * contiguous block in recency order, and updating the index accordingly.
+ *
+ * @param c Pointer to the cache. May not be NULL;
+ *
+ * @retval 0 The cache was compacted;
+ * @retval ENOMEM Insufficient memory. The cache is unchanged;
+ *
+ * @pre (NULL != c)
+ *
+ * @note All node pointers obtained from the cache are invalidated by a
+ *  successful call.
+ */
+int
+collect_c_lru_compact(
+    collect_c_lru_t*    c
+);
+
+/** Erases a node from the cache.
+ *
+ * @param c Pointer to the cache. May not be NULL;
+ * @param node Pointer to the node to be erased. May not be NULL. Must
+ *  point to a node that is currently in the cache. Invalidated by a
+ *  successful call;
+ *
+ * @pre (NULL != c)
+ * @pre (NULL != node)
+ * @pre (node is in c);
+ */
+int
+collect_c_lru_erase_node(
+    collect_c_lru_t*        c
+,   collect_c_dlist_node_t* node
+);
+
+/** Searches the cache for the node whose element matches the given key,
+ * without changing its recency.
+ *
+ * @param c Pointer to the cache. May not be NULL;
+ * @param p_key Pointer to the key. Will be passed as the lhs to the
+ *  comparison function. May not be NULL;
+ * @param node Pointer to a variable to receive the found node. May not be
+ *  NULL;
+ *
+ * @retval 0 An element was found matching the given key;
+ * @retval ENOENT No element was found matching the given key;
+ */
+int
+collect_c_lru_find_node(
+    collect_c_lru_t const*      c
+,   void const*                 p_key
+,   collect_c_dlist_node_t**    node
+);
+
+/** Searches the cache for the node whose element matches the given key
+ * and, if found, marks it as the most-recently used.
+ *
+ * @param c Pointer to the cache. May not be NULL;
+ * @param p_key Pointer to the key. Will be passed as the lhs to the
+ *  comparison function. May not be NULL;
+ * @param node Pointer to a variable to receive the found node. May not be
+ *  NULL;
+ *
+ * @retval 0 An element was found matching the given key;
+ * @retval ENOENT No element was found matching the given key;
+ */
+int
+collect_c_lru_lookup(
+    collect_c_lru_t*            c
+,   void const*                 p_key
+,   collect_c_dlist_node_t**    node
+);
+
+/** Marks the given node as the most-recently used, by relinking it at the
+ * head of the list.
+ *
+ * @param c Pointer to the cache. May not be NULL;
+ * @param node Pointer to the node. May not be NULL. Must point to a node
+ *  that is currently in the cache;
+ *
+ * @pre (NULL != c)
+ * @pre (NULL != node)
+ * @pre (node is in c);
+ */
+int
+collect_c_lru_touch_node(
+    collect_c_lru_t*        c
+,   collect_c_dlist_node_t* node
+);
+
+/** Inserts an element into the cache as the most-recently used, evicting
+ * the least-recently used element if the cache is at its maximum size.
+ *
+ * If a matching element is already in the cache it is replaced - the
+ * element-free callback (if any) being invoked on the existing element -
+ * and marked as the most-recently used.
+ *
+ * @param c Pointer to the cache. May not be NULL;
+ * @param ptr_new_el Pointer to the new element. May not be NULL;
+ * @param new_node Optional pointer to the node holding the element;
+ *
+ * @retval 0 The element was inserted;
+ * @retval ENOMEM Sufficient memory not available;
+ *
+ * @pre (NULL != c)
+ * @pre (NULL != ptr_new_el)
+ */
+int
+collect_c_lru_insert_by_ref(
+    collect_c_lru_t*            c
+,   void const*                 ptr_new_el
+,   collect_c_dlist_node_t**    new_node
+);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper macros
+ */
+
+#define COLLECT_C_LRU_EMPTY_INITIALIZER_WITH_ALLOCATOR_(el_type, c_max_size, c_flags, hash_fn, compare_fn, c_alloc, elf_fn, elf_param) \
+                                                                            \
+    {                                                                       \
+        .list = COLLECT_C_DLIST_EMPTY_INITIALIZER_WITH_ALLOCATOR_(el_type, 0, NULL, c_alloc, elf_fn, elf_param), \
+        .max_size = (c_max_size),                                           \
+        .num_slots = 0,                                                     \
+        .flags = (c_flags),                                                 \
+        .reserved0 = 0,                                                     \
+        .slots = NULL,                                                      \
+        .pfn_hash = (hash_fn),                                              \
+        .pfn_compare = (compare_fn),                                        \
+        .allocator = (c_alloc),                                             \
+    }
+
+#define COLLECT_C_LRU_EMPTY_INITIALIZER_(el_type, c_max_size, c_flags, hash_fn, compare_fn, elf_fn, elf_param) \
+                                                                            \
+    COLLECT_C_LRU_EMPTY_INITIALIZER_WITH_ALLOCATOR_(el_type, c_max_size, c_flags, hash_fn, compare_fn, NULL, elf_fn, elf_param)
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#pragma once
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
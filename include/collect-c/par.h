@@ -0,0 +1,416 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    collect-c/par.h
+ *
+ * Purpose: Work-stealing thread pool, and parallel algorithms over vector
+ *          storage.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#ifdef __cplusplus
+# ifndef COLLECT_C_PAR_SUPPRESS_CXX_WARNING
+#  error This file not currently compatible with C++ compilation
+# endif
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * version
+ */
+
+#define COLLECT_C_PAR_VER_MAJOR         0
+#define COLLECT_C_PAR_VER_MINOR         1
+#define COLLECT_C_PAR_VER_PATCH         0
+#define COLLECT_C_PAR_VER_ALPHABETA     41
+
+#define COLLECT_C_PAR_VER \
+    (0\
+        |   (   COLLECT_C_PAR_VER_MAJOR         << 24   ) \
+        |   (   COLLECT_C_PAR_VER_MINOR         << 16   ) \
+        |   (   COLLECT_C_PAR_VER_PATCH         <<  8   ) \
+        |   (   COLLECT_C_PAR_VER_ALPHABETA     <<  0   ) \
+    )
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/common.h>
+#include <collect-c/vec.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API constants
+ */
+
+/** The number of elements below which the algorithms do not divide a
+ * range into chunks.
+ */
+#define COLLECT_C_PAR_GRAIN_SIZE                            (4096)
+
+/** The maximum number of chunks into which the algorithms divide a range.
+ */
+#define COLLECT_C_PAR_MAX_CHUNKS                            (256)
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API types
+ */
+
+/** Opaque type of a pool of worker threads, each of which has its own
+ * deque of tasks, from the back of which it takes its own work and from
+ * the front of which idle workers steal.
+ */
+struct collect_c_par_pool_t;
+#ifndef __cplusplus
+typedef struct collect_c_par_pool_t     collect_c_par_pool_t;
+#endif
+
+/** Callback function that carries out one of the tasks of
+ * collect_c_par_pool_run().
+ *
+ * @param index The index of the task, in [0, num_tasks);
+ * @param param The parameter passed to collect_c_par_pool_run();
+ */
+typedef void (*collect_c_par_pfn_task_t)(
+    size_t  index
+,   void*   param
+);
+
+/** Callback function that is applied to an element by
+ * collect_c_par_for_each().
+ *
+ * @param v Pointer to the vector. Will not be NULL;
+ * @param index The index of the element;
+ * @param p_el Pointer to the element, which may be modified. Will not be
+ *  NULL;
+ * @param param The parameter passed to collect_c_par_for_each();
+ */
+typedef void (*collect_c_par_pfn_for_each_t)(
+    struct collect_c_vec_t const*   v
+,   size_t                          index
+,   void*                           p_el
+,   void*                           param
+);
+
+/** Callback function that is applied to an element by
+ * collect_c_par_transform().
+ *
+ * @param v Pointer to the source vector. Will not be NULL;
+ * @param index The index of the element;
+ * @param p_src Pointer to the source element. Will not be NULL;
+ * @param p_dst Pointer to the destination element, at the same index in
+ *  the destination vector. Will not be NULL;
+ * @param param The parameter passed to collect_c_par_transform();
+ */
+typedef void (*collect_c_par_pfn_transform_t)(
+    struct collect_c_vec_t const*   v
+,   size_t                          index
+,   void const*                     p_src
+,   void*                           p_dst
+,   void*                           param
+);
+
+/** Callback function that folds an element into an accumulator, for
+ * collect_c_par_reduce().
+ *
+ * @param v Pointer to the vector. Will not be NULL;
+ * @param p_acc Pointer to the accumulator. Will not be NULL;
+ * @param p_el Pointer to the element. Will not be NULL;
+ * @param param The parameter passed to collect_c_par_reduce();
+ */
+typedef void (*collect_c_par_pfn_accumulate_t)(
+    struct collect_c_vec_t const*   v
+,   void*                           p_acc
+,   void const*                     p_el
+,   void*                           param
+);
+
+/** Callback function that folds one accumulator into another, for
+ * collect_c_par_reduce().
+ *
+ * @param v Pointer to the vector. Will not be NULL;
+ * @param p_acc Pointer to the accumulator, of the earlier elements. Will
+ *  not be NULL;
+ * @param p_other Pointer to the accumulator of the elements that follow
+ *  those of p_acc. Will not be NULL;
+ * @param param The parameter passed to collect_c_par_reduce();
+ */
+typedef void (*collect_c_par_pfn_combine_t)(
+    struct collect_c_vec_t const*   v
+,   void*                           p_acc
+,   void const*                     p_other
+,   void*                           param
+);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions & macros
+ */
+
+#define COLLECT_C_PAR_for_each(pool, v_name, pfn, param)    collect_c_par_for_each((pool), COLLECT_C_VEC_get_l_ptr_(v_name), 0, COLLECT_C_VEC_len(v_name), (pfn), (param))
+
+#define COLLECT_C_PAR_sort(pool, v_name, compare_fn)        collect_c_par_sort((pool), COLLECT_C_VEC_get_l_ptr_(v_name), 0, COLLECT_C_VEC_len(v_name), (compare_fn))
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Obtains the value of COLLECT_C_PAR_VER at the time of compilation of
+ * the library.
+ */
+uint32_t
+collect_c_par_version(void);
+
+/** Creates a thread pool.
+ *
+ * @param num_threads The number of threads that take part in the work,
+ *  including a thread that calls collect_c_par_pool_run(), so that
+ *  (num_threads - 1) worker threads are started. If 0, the number of
+ *  online processors is used;
+ * @param allocator Optional allocator, for the pool itself. If NULL,
+ *  malloc()/free() are used;
+ * @param p_pool Pointer to a variable to receive the pool. May not be NULL;
+ *
+ * @retval 0 The pool was created;
+ * @retval ENOMEM Insufficient memory;
+ * @retval EAGAIN Insufficient resources to start the worker threads;
+ *
+ * @note On platforms without POSIX threads no worker threads are started,
+ *  and all work is carried out by the calling thread.
+ *
+ * @pre (NULL != p_pool)
+ */
+int
+collect_c_par_pool_create(
+    size_t                              num_threads
+,   struct collect_c_allocator_t const* allocator
+,   collect_c_par_pool_t**              p_pool
+);
+
+/** Stops the worker threads of, and destroys, a thread pool.
+ *
+ * @param pool The pool. May be NULL;
+ *
+ * @pre No collect_c_par_pool_run() is in progress on the pool.
+ */
+void
+collect_c_par_pool_destroy(
+    collect_c_par_pool_t*   pool
+);
+
+/** Obtains the number of threads that take part in the work of the pool.
+ *
+ * @param pool The pool. If NULL, 1 is returned;
+ */
+size_t
+collect_c_par_pool_num_threads(
+    collect_c_par_pool_t const* pool
+);
+
+/** Carries out num_tasks tasks, in parallel, and returns once all are
+ * complete.
+ *
+ * @param pool The pool. If NULL, the tasks are carried out in order by the
+ *  calling thread;
+ * @param num_tasks The number of tasks;
+ * @param pfn The task function. May not be NULL;
+ * @param param Parameter to be passed to the task function;
+ *
+ * @note The calling thread takes part in the work. The tasks are split
+ *  lazily, in halves, with each worker carrying on with one half and
+ *  leaving the other in its deque to be stolen, so that there is no
+ *  allocation and the overhead is O(log(num_tasks)) per worker.
+ *
+ * @note A task may itself call collect_c_par_pool_run() (or any of the
+ *  algorithms), on the same pool, in which case the worker carries out
+ *  other tasks while it waits.
+ *
+ * @pre (NULL != pfn)
+ */
+void
+collect_c_par_pool_run(
+    collect_c_par_pool_t*       pool
+,   size_t                      num_tasks
+,   collect_c_par_pfn_task_t    pfn
+,   void*                       param
+);
+
+/** Applies a function to each element in the range [first, last) of a
+ * vector, in parallel.
+ *
+ * @param pool The pool. If NULL, the elements are visited in order by the
+ *  calling thread;
+ * @param v Pointer to the vector. May not be NULL;
+ * @param first The index of the first element of the range;
+ * @param last The index one past the last element of the range;
+ * @param pfn The function. May not be NULL;
+ * @param param Parameter to be passed to the function;
+ *
+ * @pre (NULL != v)
+ * @pre (first <= last)
+ * @pre (last <= v->size)
+ * @pre (NULL != pfn)
+ */
+void
+collect_c_par_for_each(
+    collect_c_par_pool_t*           pool
+,   collect_c_vec_t*                v
+,   size_t                          first
+,   size_t                          last
+,   collect_c_par_pfn_for_each_t    pfn
+,   void*                           param
+);
+
+/** Applies a function to each element in the range [first, last) of a
+ * vector, in parallel, to produce the element at the same index of a
+ * destination vector.
+ *
+ * @param pool The pool. If NULL, the elements are visited in order by the
+ *  calling thread;
+ * @param v Pointer to the source vector. May not be NULL;
+ * @param first The index of the first element of the range;
+ * @param last The index one past the last element of the range;
+ * @param v_dst Pointer to the destination vector, whose size must be at
+ *  least last, and whose element size may differ from that of v. May be
+ *  the same as v. May not be NULL;
+ * @param pfn The function. May not be NULL;
+ * @param param Parameter to be passed to the function;
+ *
+ * @pre (NULL != v)
+ * @pre (first <= last)
+ * @pre (last <= v->size)
+ * @pre (NULL != v_dst)
+ * @pre (last <= v_dst->size)
+ * @pre (NULL != pfn)
+ */
+void
+collect_c_par_transform(
+    collect_c_par_pool_t*           pool
+,   collect_c_vec_t const*          v
+,   size_t                          first
+,   size_t                          last
+,   collect_c_vec_t*                v_dst
+,   collect_c_par_pfn_transform_t   pfn
+,   void*                           param
+);
+
+/** Reduces the elements in the range [first, last) of a vector to a
+ * single value, in parallel.
+ *
+ * @param pool The pool. If NULL, the work is carried out by the calling
+ *  thread;
+ * @param v Pointer to the vector. May not be NULL;
+ * @param first The index of the first element of the range;
+ * @param last The index one past the last element of the range;
+ * @param cb_result The size of the result (and of each accumulator). May
+ *  not be 0;
+ * @param p_identity Pointer to the identity value of the reduction, with
+ *  which each accumulator is initialised. May not be NULL;
+ * @param pfn_accumulate The function that folds an element into an
+ *  accumulator. May not be NULL;
+ * @param pfn_combine The function that folds one accumulator into
+ *  another. May not be NULL;
+ * @param param Parameter to be passed to the functions;
+ * @param p_result Pointer to the result, which may be the same as
+ *  p_identity. May not be NULL;
+ *
+ * @retval 0 The range was reduced;
+ * @retval ENOMEM Insufficient memory for the accumulators;
+ *
+ * @note The range is divided into chunks whose boundaries depend only on
+ *  the length of the range, not on the number of threads or on the order
+ *  in which the chunks are processed, and the accumulators of the chunks
+ *  are combined in order. Hence the result of an associative reduction is
+ *  the same from run to run, and is the same as that for a NULL pool,
+ *  even where (as with floating-point addition) it is associative only
+ *  approximately.
+ *
+ * @pre (NULL != v)
+ * @pre (first <= last)
+ * @pre (last <= v->size)
+ * @pre (0 != cb_result)
+ * @pre (NULL != p_identity)
+ * @pre (NULL != pfn_accumulate)
+ * @pre (NULL != pfn_combine)
+ * @pre (NULL != p_result)
+ */
+int
+collect_c_par_reduce(
+    collect_c_par_pool_t*           pool
+,   collect_c_vec_t const*          v
+,   size_t                          first
+,   size_t                          last
+,   size_t                          cb_result
+,   void const*                     p_identity
+,   collect_c_par_pfn_accumulate_t  pfn_accumulate
+,   collect_c_par_pfn_combine_t     pfn_combine
+,   void*                           param
+,   void*                           p_result
+);
+
+/** Sorts the elements in the range [first, last) of a vector, in
+ * parallel.
+ *
+ * @param pool The pool. If NULL, the work is carried out by the calling
+ *  thread;
+ * @param v Pointer to the vector. May not be NULL;
+ * @param first The index of the first element of the range;
+ * @param last The index one past the last element of the range;
+ * @param pfn_compare The element comparison function. May not be NULL;
+ *
+ * @retval 0 The range was sorted;
+ * @retval ENOMEM Insufficient memory for the scratch storage. The range is
+ *  unchanged;
+ *
+ * @note The sort is a parallel merge sort: the chunks of the range are
+ *  sorted by collect_c_vec_sort_range(), and then merged pairwise, with
+ *  each merge divided among the threads by merge-path partitioning. The
+ *  chunks depend only on the length of the range, so the order of
+ *  equivalent elements is the same from run to run, for any number of
+ *  threads, though the sort is not stable. Scratch storage of the size of
+ *  the range is obtained from the vector's allocator.
+ *
+ * @pre (NULL != v)
+ * @pre (first <= last)
+ * @pre (last <= v->size)
+ * @pre (NULL != pfn_compare)
+ */
+int
+collect_c_par_sort(
+    collect_c_par_pool_t*       pool
+,   collect_c_vec_t*            v
+,   size_t                      first
+,   size_t                      last
+,   collect_c_vec_pfn_compare   pfn_compare
+);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#pragma once
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,387 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    collect-c/pool.h
+ *
+ * Purpose: Fixed-size object pool.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#ifdef __cplusplus
+# ifndef COLLECT_C_POOL_SUPPRESS_CXX_WARNING
+#  error This file not currently compatible with C++ compilation
+# endif
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * version
+ */
+
+#define COLLECT_C_POOL_VER_MAJOR        0
+#define COLLECT_C_POOL_VER_MINOR        1
+#define COLLECT_C_POOL_VER_PATCH        0
+#define COLLECT_C_POOL_VER_ALPHABETA    41
+
+#define COLLECT_C_POOL_VER \
+    (0\
+        |   (   COLLECT_C_POOL_VER_MAJOR        << 24   ) \
+        |   (   COLLECT_C_POOL_VER_MINOR        << 16   ) \
+        |   (   COLLECT_C_POOL_VER_PATCH        <<  8   ) \
+        |   (   COLLECT_C_POOL_VER_ALPHABETA    <<  0   ) \
+    )
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/common.h>
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API constants
+ */
+
+/** Serialises access to the (shared) pool, as is required when it is used
+ * from multiple threads, usually via a collect_c_pool_cache_t per thread.
+ */
+#define COLLECT_C_POOL_F_SYNCHRONISED                       (0x00000001)
+
+/** The default number of slots in each block. */
+#ifndef COLLECT_C_POOL_DEFAULT_SLOTS_PER_BLOCK
+# define COLLECT_C_POOL_DEFAULT_SLOTS_PER_BLOCK             (64)
+#endif
+
+/** The default number of slots transferred between a cache and its pool. */
+#ifndef COLLECT_C_POOL_DEFAULT_CACHE_BATCH_SIZE
+# define COLLECT_C_POOL_DEFAULT_CACHE_BATCH_SIZE            (32)
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API types
+ */
+
+struct collect_c_pool_block_t;
+
+/** Statistics of a pool.
+ */
+struct collect_c_pool_stats_t
+{
+    size_t                              num_blocks;     /*! The number of blocks held. */
+    size_t                              num_slots;      /*! The total number of slots in the blocks held. */
+    size_t                              num_in_use;     /*! The number of slots acquired, including those held in caches. */
+    size_t                              peak_in_use;    /*! The highest value of num_in_use. */
+    size_t                              num_acquires;   /*! The number of slots acquired from the pool. */
+    size_t                              num_releases;   /*! The number of slots released to the pool. */
+};
+#ifndef __cplusplus
+typedef struct collect_c_pool_stats_t   collect_c_pool_stats_t;
+#endif
+
+/** Represents a pool of fixed-size slots, which are carved from blocks
+ * obtained as required, and which are acquired and released in O(1) via an
+ * intrusive free list.
+ *
+ * Blocks are retained until collect_c_pool_free_storage() is called.
+ *
+ * The allocator member may be given to node-based containers (see
+ * collect_c_allocator_t), whose node allocations of up to el_size bytes
+ * are then served by the pool; larger allocations are passed to the
+ * backing allocator.
+ */
+struct collect_c_pool_t
+{
+    size_t                              el_size;        /*! The size of the objects. */
+    size_t                              slot_size;      /*! The size of each slot, being el_size rounded to a multiple of the size of a pointer. */
+    size_t                              slots_per_block;/*! The number of slots in a block. 0 means COLLECT_C_POOL_DEFAULT_SLOTS_PER_BLOCK. */
+    int32_t                             flags;          /*! Control flags. */
+    int32_t                             lock;           /*! Lock, used when COLLECT_C_POOL_F_SYNCHRONISED is specified. */
+    void*                               free_list;      /*! The released slots, linked through their first bytes. */
+    void*                               unused;         /*! The first never-acquired slot in the newest block. */
+    size_t                              num_unused;     /*! The number of never-acquired slots in the newest block. */
+    struct collect_c_pool_block_t*      blocks;         /*! The blocks. */
+    struct collect_c_allocator_t const* backing;        /*! Optional allocator from which blocks are obtained. If NULL, malloc()/free() are used. */
+    struct collect_c_pool_stats_t       stats;          /*! Statistics. */
+    struct collect_c_allocator_t        allocator;      /*! Allocator interface to the pool, to be given to containers. */
+};
+#ifndef __cplusplus
+typedef struct collect_c_pool_t         collect_c_pool_t;
+#endif
+
+/** Represents a cache of slots of a pool, intended to be used by a single
+ * thread, which acquires slots from and releases them to the pool in
+ * batches, so that the pool is accessed (and locked) infrequently.
+ */
+struct collect_c_pool_cache_t
+{
+    struct collect_c_pool_t*            pool;           /*! The pool. */
+    size_t                              batch_size;     /*! The number of slots transferred at a time. 0 means COLLECT_C_POOL_DEFAULT_CACHE_BATCH_SIZE. */
+    size_t                              num_free;       /*! The number of slots held in free_list. */
+    void*                               free_list;      /*! The slots held. */
+};
+#ifndef __cplusplus
+typedef struct collect_c_pool_cache_t   collect_c_pool_cache_t;
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions & macros
+ */
+
+/** @def COLLECT_C_POOL_define(el_type, p_name, slots_per_block)
+ *
+ * Declares and defines an empty pool instance, whose allocator member is
+ * bound to it. No memory is obtained until the first acquisition.
+ *
+ * @param el_type The type of the objects;
+ * @param p_name The name of the instance;
+ * @param slots_per_block The number of slots in each block, or 0 for
+ *  COLLECT_C_POOL_DEFAULT_SLOTS_PER_BLOCK;
+ */
+#define COLLECT_C_POOL_define(el_type, p_name, slots_per_block)             \
+                                                                            \
+    collect_c_pool_t p_name = COLLECT_C_POOL_EMPTY_INITIALIZER_(p_name, sizeof(el_type), slots_per_block, NULL)
+
+/** @def COLLECT_C_POOL_define_by_size(el_size, p_name, slots_per_block)
+ *
+ * Declares and defines an empty pool instance of objects of the given
+ * size, e.g. COLLECT_C_DLIST_node_size(int).
+ *
+ * @param el_size The size of the objects;
+ * @param p_name The name of the instance;
+ * @param slots_per_block The number of slots in each block, or 0 for
+ *  COLLECT_C_POOL_DEFAULT_SLOTS_PER_BLOCK;
+ */
+#define COLLECT_C_POOL_define_by_size(el_size, p_name, slots_per_block)     \
+                                                                            \
+    collect_c_pool_t p_name = COLLECT_C_POOL_EMPTY_INITIALIZER_(p_name, (el_size), slots_per_block, NULL)
+
+/** @def COLLECT_C_POOL_define_with_backing(el_type, p_name, slots_per_block, backing)
+ *
+ * Declares and defines an empty pool instance whose blocks are obtained
+ * from the given allocator.
+ *
+ * @param el_type The type of the objects;
+ * @param p_name The name of the instance;
+ * @param slots_per_block The number of slots in each block, or 0 for
+ *  COLLECT_C_POOL_DEFAULT_SLOTS_PER_BLOCK;
+ * @param backing Pointer to the allocator (collect_c_allocator_t) from
+ *  which blocks are to be obtained;
+ */
+#define COLLECT_C_POOL_define_with_backing(el_type, p_name, slots_per_block, backing)   \
+                                                                                        \
+    collect_c_pool_t p_name = COLLECT_C_POOL_EMPTY_INITIALIZER_(p_name, sizeof(el_type), slots_per_block, backing)
+
+/** @def COLLECT_C_POOL_CACHE_define(c_name, p_ptr, c_batch_size)
+ *
+ * Declares and defines an empty cache of the given pool.
+ *
+ * @param c_name The name of the instance;
+ * @param p_ptr Pointer to the pool;
+ * @param c_batch_size The number of slots transferred at a time, or 0 for
+ *  COLLECT_C_POOL_DEFAULT_CACHE_BATCH_SIZE;
+ */
+#define COLLECT_C_POOL_CACHE_define(c_name, p_ptr, c_batch_size)              \
+                                                                            \
+    collect_c_pool_cache_t c_name = { .pool = (p_ptr), .batch_size = (c_batch_size), .num_free = 0, .free_list = NULL, }
+
+
+/* attributes */
+
+#define COLLECT_C_POOL_allocator(p_name)                    (&(p_name).allocator)
+#define COLLECT_C_POOL_num_in_use(p_name)                   ((p_name).stats.num_in_use)
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Obtains the value of COLLECT_C_POOL_VER at the time of compilation of
+ * the library.
+ */
+uint32_t
+collect_c_pool_version(void);
+
+/** Releases all blocks held by the pool, invalidating all slots obtained
+ * from it.
+ *
+ * @param p Pointer to the pool. May not be NULL;
+ *
+ * @pre (NULL != p)
+ * @pre no caches of the pool are in use
+ */
+void
+collect_c_pool_free_storage(
+    collect_c_pool_t*   p
+);
+
+/** Acquires a slot from the pool.
+ *
+ * @param p Pointer to the pool. May not be NULL;
+ *
+ * @return Pointer to the slot, aligned suitably for an object of el_size,
+ *  or NULL if a required block could not be obtained.
+ *
+ * @pre (NULL != p)
+ */
+void*
+collect_c_pool_acquire(
+    collect_c_pool_t*   p
+);
+
+/** Releases a slot to the pool.
+ *
+ * @param p Pointer to the pool. May not be NULL;
+ * @param ptr Pointer to a slot acquired from the pool, or NULL;
+ *
+ * @pre (NULL != p)
+ */
+void
+collect_c_pool_release(
+    collect_c_pool_t*   p
+,   void*               ptr
+);
+
+/** Obtains the statistics of the pool.
+ *
+ * @param p Pointer to the pool. May not be NULL;
+ * @param stats Pointer to the statistics to be written. May not be NULL;
+ *
+ * @pre (NULL != p)
+ * @pre (NULL != stats)
+ */
+void
+collect_c_pool_get_stats(
+    collect_c_pool_t*       p
+,   collect_c_pool_stats_t* stats
+);
+
+/** Acquires a slot via the cache, refilling it from the pool, with a batch
+ * of slots, when it is empty.
+ *
+ * @param c Pointer to the cache. May not be NULL;
+ *
+ * @return Pointer to the slot, or NULL if a required block could not be
+ *  obtained.
+ *
+ * @pre (NULL != c)
+ * @pre (NULL != c->pool)
+ */
+void*
+collect_c_pool_cache_acquire(
+    collect_c_pool_cache_t* c
+);
+
+/** Releases a slot via the cache, which returns a batch of slots to the
+ * pool when it holds twice the batch size.
+ *
+ * @param c Pointer to the cache. May not be NULL;
+ * @param ptr Pointer to a slot acquired from the cache's pool, or NULL;
+ *
+ * @pre (NULL != c)
+ * @pre (NULL != c->pool)
+ */
+void
+collect_c_pool_cache_release(
+    collect_c_pool_cache_t* c
+,   void*                   ptr
+);
+
+/** Returns all slots held by the cache to the pool. Must be called before
+ * a cache is discarded (e.g. on thread exit).
+ *
+ * @param c Pointer to the cache. May not be NULL;
+ *
+ * @pre (NULL != c)
+ * @pre (NULL != c->pool)
+ */
+void
+collect_c_pool_cache_flush(
+    collect_c_pool_cache_t* c
+);
+
+/* Functions that implement collect_c_allocator_t, with the pool as the
+ * context, as bound to the pool's allocator member by
+ * COLLECT_C_POOL_define().
+ */
+
+void*
+collect_c_pool_allocator_alloc(
+    void*   context
+,   size_t  cb
+);
+
+void
+collect_c_pool_allocator_free(
+    void*   context
+,   void*   ptr
+,   size_t  cb
+);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper macros
+ */
+
+#define COLLECT_C_POOL_INTERNAL_slot_size_(el_size)         ((((el_size) < sizeof(void*) ? sizeof(void*) : (el_size)) + (sizeof(void*) - 1)) & ~(sizeof(void*) - 1))
+
+#define COLLECT_C_POOL_EMPTY_INITIALIZER_(p_name, p_el_size, p_slots_per_block, p_backing)  \
+                                                                            \
+    {                                                                       \
+        .el_size = (p_el_size),                                             \
+        .slot_size = COLLECT_C_POOL_INTERNAL_slot_size_(p_el_size),         \
+        .slots_per_block = (p_slots_per_block),                             \
+        .flags = 0,                                                         \
+        .lock = 0,                                                          \
+        .free_list = NULL,                                                  \
+        .unused = NULL,                                                     \
+        .num_unused = 0,                                                    \
+        .blocks = NULL,                                                     \
+        .backing = (p_backing),                                             \
+        .stats =                                                            \
+        {                                                                   \
+            .num_blocks = 0,                                                \
+            .num_slots = 0,                                                 \
+            .num_in_use = 0,                                                \
+            .peak_in_use = 0,                                               \
+            .num_acquires = 0,                                              \
+            .num_releases = 0,                                              \
+        },                                                                  \
+        .allocator =                                                        \
+        {                                                                   \
+            .pfn_alloc = &collect_c_pool_allocator_alloc,                   \
+            .pfn_realloc = NULL,                                            \
+            .pfn_free = &collect_c_pool_allocator_free,                     \
+            .context = &(p_name),                                           \
+        },                                                                  \
+    }
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#pragma once
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,548 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    collect-c/pq.h
+ *
+ * Purpose: Priority queue container.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#ifdef __cplusplus
+# ifndef COLLECT_C_PQ_SUPPRESS_CXX_WARNING
+#  error This file not currently compatible with C++ compilation
+# endif
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * version
+ */
+
+#define COLLECT_C_PQ_VER_MAJOR      0
+#define COLLECT_C_PQ_VER_MINOR      1
+#define COLLECT_C_PQ_VER_PATCH      0
+#define COLLECT_C_PQ_VER_ALPHABETA  41
+
+#define COLLECT_C_PQ_VER \
+    (0\
+        |   (   COLLECT_C_PQ_VER_MAJOR      << 24   ) \
+        |   (   COLLECT_C_PQ_VER_MINOR      << 16   ) \
+        |   (   COLLECT_C_PQ_VER_PATCH      <<  8   ) \
+        |   (   COLLECT_C_PQ_VER_ALPHABETA  <<  0   ) \
+    )
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/common.h>
+#include <collect-c/vec.h>
+
+#include <assert.h>
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API constants
+ */
+
+/** The arity of the heap. */
+#define COLLECT_C_PQ_ARITY                                  (4)
+
+/** The capacity allocated on first insertion, if storage has not been
+ * explicitly allocated via collect_c_pq_reserve().
+ */
+#ifndef COLLECT_C_PQ_DEFAULT_INITIAL_CAPACITY
+# define COLLECT_C_PQ_DEFAULT_INITIAL_CAPACITY              (16)
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API types
+ */
+
+struct collect_c_pq_t;
+
+/** Callback function that compares elements.
+ *
+ * @param q Pointer to the queue. Will not be NULL;
+ * @param p_lhs Pointer to the lhs element. Will not be NULL;
+ * @param p_rhs Pointer to the rhs element. Will not be NULL;
+ *
+ * @return A value that is less than 0 if the lhs element is to be popped
+ *  before the rhs element, greater than 0 if after, and 0 if either order
+ *  is acceptable.
+ */
+typedef int (*collect_c_pq_pfn_compare_t)(
+    struct collect_c_pq_t const*    q
+,   void const*                     p_lhs
+,   void const*                     p_rhs
+);
+
+/** Represents a priority queue, whose top is the least element according
+ * to its comparison function.
+ *
+ * @note The implementation is a 4-ary heap held in the vector v, in which
+ *  the children of the element at index i are at indexes 4i+1 to 4i+4.
+ *  Compared with a binary heap it has half the depth, and the (up to) four
+ *  children compared at each level of a pop are adjacent in memory, so
+ *  that popping incurs fewer cache misses, for slightly more comparisons.
+ *
+ * @note The vector may be manipulated directly - e.g. to append elements
+ *  with collect_c_v_push_back_by_ref(), or to change the priority of
+ *  elements - after which the heap must be re-established by
+ *  collect_c_pq_heapify().
+ *
+ * @note The element-free callback (if any) of v is invoked on elements
+ *  popped without being retrieved, and on those cleared.
+ */
+struct collect_c_pq_t
+{
+    collect_c_vec_t                 v;              /*! The storage. */
+    collect_c_pq_pfn_compare_t      pfn_compare;    /*! The comparison function. */
+};
+#ifndef __cplusplus
+typedef struct collect_c_pq_t           collect_c_pq_t;
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions & macros (internal)
+ */
+
+#define COLLECT_C_PQ_get_q_ptr_(q)                          _Generic((q),   \
+                                                                            \
+                                collect_c_pq_t* :  (q),                     \
+                          collect_c_pq_t const* :  (q),                     \
+                                        default : &(q)                      \
+)
+
+#define COLLECT_C_PQ_assert_el_size_(q_name, t_el)          assert(sizeof(t_el) == COLLECT_C_PQ_get_q_ptr_(q_name)->v.el_size)
+#define COLLECT_C_PQ_assert_not_empty_(q_name)              assert(0 != COLLECT_C_PQ_get_q_ptr_(q_name)->v.size)
+
+#define COLLECT_C_PQ_clear_1_(q_name)                       collect_c_pq_clear(COLLECT_C_PQ_get_q_ptr_(q_name), NULL, NULL, NULL)
+#define COLLECT_C_PQ_clear_2_(q_name, p)                    collect_c_pq_clear(COLLECT_C_PQ_get_q_ptr_(q_name), NULL, NULL,  (p))
+
+#define COLLECT_C_PQ_top_v_(q_name)                         ((void const*)(((char const*)COLLECT_C_PQ_get_q_ptr_(q_name)->v.storage) + (COLLECT_C_PQ_get_q_ptr_(q_name)->v.offset * COLLECT_C_PQ_get_q_ptr_(q_name)->v.el_size)))
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions & macros
+ */
+
+/** @def COLLECT_C_PQ_define_empty(el_type, q_name, compare_fn)
+ *
+ * Declares and defines an empty queue instance. Storage is allocated as
+ * required by the push functions, or by collect_c_pq_reserve().
+ *
+ * @param el_type The type of the elements to be stored;
+ * @param q_name The name of the instance;
+ * @param compare_fn The comparison function (collect_c_pq_pfn_compare_t).
+ *  May be NULL only if the queue is manipulated solely by functions
+ *  defined by COLLECT_C_PQ_define_typed_functions();
+ */
+#define COLLECT_C_PQ_define_empty(el_type, q_name, compare_fn)              \
+                                                                            \
+    collect_c_pq_t q_name = COLLECT_C_PQ_EMPTY_INITIALIZER_(el_type, compare_fn, NULL)
+
+/** @def COLLECT_C_PQ_define_empty_with_allocator(el_type, q_name, compare_fn, alloc)
+ *
+ * Declares and defines an empty queue instance whose storage is to be
+ * obtained from the given allocator.
+ *
+ * @param el_type The type of the elements to be stored;
+ * @param q_name The name of the instance;
+ * @param compare_fn The comparison function (collect_c_pq_pfn_compare_t);
+ * @param alloc Pointer to the allocator (collect_c_allocator_t), which
+ *  must outlive the instance's storage;
+ */
+#define COLLECT_C_PQ_define_empty_with_allocator(el_type, q_name, compare_fn, alloc)    \
+                                                                                        \
+    collect_c_pq_t q_name = COLLECT_C_PQ_EMPTY_INITIALIZER_(el_type, compare_fn, alloc)
+
+/** @def COLLECT_C_PQ_define_typed_functions(fn_prefix, t_el, fn_less)
+ *
+ * Defines static inline functions that manipulate queues of elements of
+ * type t_el, ordered by fn_less, which may be a function or a macro and is
+ * expanded inline, rather than called via the queue's pfn_compare:
+ *
+ * - int fn_prefix_push(collect_c_pq_t* q, t_el const* p_el);
+ * - int fn_prefix_pop(collect_c_pq_t* q, t_el* p_el);
+ * - t_el const* fn_prefix_top(collect_c_pq_t const* q);
+ * - void fn_prefix_heapify(collect_c_pq_t* q);
+ *
+ * which have the semantics of the corresponding collect_c_pq_*()
+ * functions, except that fn_prefix_top() obtains NULL if the queue is
+ * empty.
+ *
+ * @param fn_prefix The prefix of the names of the functions;
+ * @param t_el The type of the elements;
+ * @param fn_less The ordering, invoked as fn_less(p_lhs, p_rhs) with
+ *  arguments of type (t_el const*), that evaluates to non-0 if the lhs
+ *  element is to be popped before the rhs element. It must be consistent
+ *  with the queue's pfn_compare, if any;
+ */
+#define COLLECT_C_PQ_define_typed_functions(fn_prefix, t_el, fn_less)      \
+                                                                            \
+    static inline                                                           \
+    int                                                                     \
+    fn_prefix ## _push(                                                     \
+        collect_c_pq_t* q                                                   \
+    ,   t_el const*     p_el                                                \
+    )                                                                       \
+    {                                                                       \
+        t_el const  el  =   *p_el;                                          \
+        t_el*       base;                                                   \
+        size_t      ix;                                                     \
+                                                                            \
+        assert(sizeof(t_el) == q->v.el_size);                               \
+                                                                            \
+        if (NULL == q->v.storage)                                           \
+        {                                                                   \
+            int const r = collect_c_vec_reserve(&q->v, COLLECT_C_PQ_DEFAULT_INITIAL_CAPACITY, 0); \
+                                                                            \
+            if (0 != r)                                                     \
+            {                                                               \
+                return r;                                                   \
+            }                                                               \
+        }                                                                   \
+                                                                            \
+        {                                                                   \
+            int const r = collect_c_v_push_back_by_ref(&q->v, &el);         \
+                                                                            \
+            if (0 != r)                                                     \
+            {                                                               \
+                return r;                                                   \
+            }                                                               \
+        }                                                                   \
+                                                                            \
+        base    =   ((t_el*)q->v.storage) + q->v.offset;                    \
+        ix      =   q->v.size - 1;                                          \
+                                                                            \
+        while (0 != ix)                                                     \
+        {                                                                   \
+            size_t const parent = (ix - 1) / COLLECT_C_PQ_ARITY;            \
+                                                                            \
+            if (!(fn_less(&el, &base[parent])))                             \
+            {                                                               \
+                break;                                                      \
+            }                                                               \
+                                                                            \
+            base[ix] = base[parent];                                        \
+            ix = parent;                                                    \
+        }                                                                   \
+                                                                            \
+        base[ix] = el;                                                      \
+                                                                            \
+        return 0;                                                           \
+    }                                                                       \
+                                                                            \
+    static inline                                                           \
+    void                                                                    \
+    fn_prefix ## _sift_down_(                                               \
+        t_el*           base                                                \
+    ,   size_t          n                                                   \
+    ,   size_t          ix                                                  \
+    ,   t_el const*     p_el                                                \
+    )                                                                       \
+    {                                                                       \
+        for (;;)                                                            \
+        {                                                                   \
+            size_t const    first   =   (COLLECT_C_PQ_ARITY * ix) + 1;      \
+            size_t          last;                                           \
+            size_t          best;                                           \
+                                                                            \
+            if (first >= n)                                                 \
+            {                                                               \
+                break;                                                      \
+            }                                                               \
+                                                                            \
+            last = (n - first < COLLECT_C_PQ_ARITY) ? n : (first + COLLECT_C_PQ_ARITY);  \
+            best = first;                                                   \
+                                                                            \
+            for (size_t j = first + 1; last != j; ++j)                      \
+            {                                                               \
+                if (fn_less(&base[j], &base[best]))                         \
+                {                                                           \
+                    best = j;                                               \
+                }                                                           \
+            }                                                               \
+                                                                            \
+            if (!(fn_less(&base[best], p_el)))                              \
+            {                                                               \
+                break;                                                      \
+            }                                                               \
+                                                                            \
+            base[ix] = base[best];                                          \
+            ix = best;                                                      \
+        }                                                                   \
+                                                                            \
+        base[ix] = *p_el;                                                   \
+    }                                                                       \
+                                                                            \
+    static inline                                                           \
+    int                                                                     \
+    fn_prefix ## _pop(                                                      \
+        collect_c_pq_t* q                                                   \
+    ,   t_el*           p_el                                                \
+    )                                                                       \
+    {                                                                       \
+        assert(sizeof(t_el) == q->v.el_size);                               \
+                                                                            \
+        if (0 == q->v.size)                                                 \
+        {                                                                   \
+            return ENOENT;                                                  \
+        }                                                                   \
+        else                                                                \
+        {                                                                   \
+            t_el* const     base    =   ((t_el*)q->v.storage) + q->v.offset;    \
+            size_t const    n       =   --q->v.size;                        \
+                                                                            \
+            if (NULL != p_el)                                               \
+            {                                                               \
+                *p_el = base[0];                                            \
+            }                                                               \
+            else if (NULL != q->v.pfn_element_free)                         \
+            {                                                               \
+                (*q->v.pfn_element_free)(sizeof(t_el), 0, &base[0], q->v.param_element_free);  \
+            }                                                               \
+                                                                            \
+            if (0 != n)                                                     \
+            {                                                               \
+                t_el const last = base[n];                                  \
+                                                                            \
+                fn_prefix ## _sift_down_(base, n, 0, &last);                \
+            }                                                               \
+                                                                            \
+            return 0;                                                       \
+        }                                                                   \
+    }                                                                       \
+                                                                            \
+    static inline                                                           \
+    t_el const*                                                             \
+    fn_prefix ## _top(                                                      \
+        collect_c_pq_t const*   q                                           \
+    )                                                                       \
+    {                                                                       \
+        return (0 == q->v.size) ? NULL : ((t_el const*)q->v.storage) + q->v.offset; \
+    }                                                                       \
+                                                                            \
+    static inline                                                           \
+    void                                                                    \
+    fn_prefix ## _heapify(                                                  \
+        collect_c_pq_t* q                                                   \
+    )                                                                       \
+    {                                                                       \
+        size_t const n = q->v.size;                                         \
+                                                                            \
+        if (n > 1)                                                          \
+        {                                                                   \
+            t_el* const base = ((t_el*)q->v.storage) + q->v.offset;         \
+                                                                            \
+            for (size_t ix = ((n - 2) / COLLECT_C_PQ_ARITY) + 1; 0 != ix--; )   \
+            {                                                               \
+                t_el const el = base[ix];                                   \
+                                                                            \
+                fn_prefix ## _sift_down_(base, n, ix, &el);                 \
+            }                                                               \
+        }                                                                   \
+    }
+
+
+/* modifiers */
+
+#define COLLECT_C_PQ_clear(...)                             COLLECT_C_UTIL_GET_MACRO_1_or_2_(__VA_ARGS__, COLLECT_C_PQ_clear_2_, COLLECT_C_PQ_clear_1_, NULL)(__VA_ARGS__)
+
+#define COLLECT_C_PQ_pop(q_name)                            collect_c_pq_pop(COLLECT_C_PQ_get_q_ptr_(q_name), NULL)
+
+#define COLLECT_C_PQ_push_by_ref(q_name, ptr_new_el)        collect_c_pq_push_by_ref(COLLECT_C_PQ_get_q_ptr_(q_name), (ptr_new_el))
+#define COLLECT_C_PQ_push_by_value(q_name, t_el, new_el)    \
+                                                            (COLLECT_C_PQ_assert_el_size_(q_name, t_el), collect_c_pq_push_by_ref(COLLECT_C_PQ_get_q_ptr_(q_name), &((t_el){(new_el)})))
+
+/* attributes */
+
+#define COLLECT_C_PQ_is_empty(q_name)                       (0 == COLLECT_C_PQ_len((q_name)))
+#define COLLECT_C_PQ_len(q_name)                            (COLLECT_C_PQ_get_q_ptr_(q_name)->v.size)
+
+/* accessors */
+
+#define COLLECT_C_PQ_top_v(q_name)                          (COLLECT_C_PQ_assert_not_empty_(q_name), COLLECT_C_PQ_top_v_(q_name))
+#define COLLECT_C_PQ_top_t(q_name, t_el)                    ((t_el const*)(COLLECT_C_PQ_assert_el_size_(q_name, t_el), COLLECT_C_PQ_top_v(q_name)))
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Obtains the value of COLLECT_C_PQ_VER at the time of compilation of
+ * the library.
+ */
+uint32_t
+collect_c_pq_version(void);
+
+/** Frees storage associated with the instance, invoking the element-free
+ * callback (if any) for each element.
+ *
+ * @param q Pointer to the queue. May not be NULL;
+ *
+ * @pre (NULL != q)
+ */
+void
+collect_c_pq_free_storage(
+    collect_c_pq_t* q
+);
+
+/** Clears all elements from the queue, invoking the element-free callback
+ * (if any) for each element. The storage is retained.
+ *
+ * @param q Pointer to the queue. May not be NULL;
+ * @param reserved0 Reserved. Must be 0;
+ * @param reserved1 Reserved. Must be 0;
+ * @param num_dropped Optional pointer to variable to retrieve number of
+ *  elements dropped;
+ *
+ * @pre (NULL != q)
+ * @pre (0 == reserved0)
+ * @pre (0 == reserved1)
+ */
+int
+collect_c_pq_clear(
+    collect_c_pq_t* q
+,   void*           reserved0
+,   void*           reserved1
+,   size_t*         num_dropped
+);
+
+/** Ensures that the queue can hold at least the given number of elements
+ * without reallocation.
+ *
+ * @param q Pointer to the queue. May not be NULL;
+ * @param n The number of elements;
+ *
+ * @retval 0 Operation succeed;
+ * @retval ENOMEM Sufficient memory not available;
+ *
+ * @pre (NULL != q)
+ */
+int
+collect_c_pq_reserve(
+    collect_c_pq_t* q
+,   size_t          n
+);
+
+/** Adds an element to the queue.
+ *
+ * @param q Pointer to the queue. May not be NULL;
+ * @param ptr_new_el Pointer to the new element. May not be NULL;
+ *
+ * @retval 0 Operation succeed;
+ * @retval ENOMEM Sufficient memory not available;
+ *
+ * @note O(log n) in the worst case, and O(1) on average for elements in
+ *  random order.
+ *
+ * @pre (NULL != q)
+ * @pre (NULL != q->pfn_compare)
+ * @pre (NULL != ptr_new_el)
+ */
+int
+collect_c_pq_push_by_ref(
+    collect_c_pq_t* q
+,   void const*     ptr_new_el
+);
+
+/** Adds a number of elements to the queue.
+ *
+ * @param q Pointer to the queue. May not be NULL;
+ * @param num_els The number of elements;
+ * @param ptr_new_els Pointer to the array of num_els new elements. May be
+ *  NULL only if num_els is 0;
+ *
+ * @retval 0 Operation succeed;
+ * @retval ENOMEM Sufficient memory not available. The queue is unchanged;
+ *
+ * @note If num_els is not small relative to the size of the queue, the
+ *  elements are appended and the heap rebuilt, in O(n) overall, rather
+ *  than being pushed one at a time in O(num_els log n). Hence this is the
+ *  means to build a queue from an array.
+ *
+ * @pre (NULL != q)
+ * @pre (NULL != q->pfn_compare)
+ * @pre (0 == num_els || NULL != ptr_new_els)
+ */
+int
+collect_c_pq_push_n_by_ref(
+    collect_c_pq_t* q
+,   size_t          num_els
+,   void const*     ptr_new_els
+);
+
+/** Removes the top element from the queue.
+ *
+ * @param q Pointer to the queue. May not be NULL;
+ * @param ptr_el Optional pointer to storage to receive the element. If
+ *  NULL, the element-free callback (if any) is invoked on the element;
+ *
+ * @retval 0 Operation succeed;
+ * @retval ENOENT The queue is empty;
+ *
+ * @pre (NULL != q)
+ * @pre (NULL != q->pfn_compare)
+ */
+int
+collect_c_pq_pop(
+    collect_c_pq_t* q
+,   void*           ptr_el
+);
+
+/** Re-establishes the heap, in O(n), after the vector has been
+ * manipulated directly.
+ *
+ * @param q Pointer to the queue. May not be NULL;
+ *
+ * @pre (NULL != q)
+ * @pre (NULL != q->pfn_compare)
+ */
+void
+collect_c_pq_heapify(
+    collect_c_pq_t* q
+);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper macros
+ */
+
+#define COLLECT_C_PQ_EMPTY_INITIALIZER_(el_type, compare_fn, alloc)         \
+                                                                            \
+    {                                                                       \
+        .v = COLLECT_C_VEC_EMPTY_INITIALIZER_WITH_ALLOCATOR_(el_type, 0, COLLECT_C_VEC_F_NO_BOO, NULL, alloc, NULL, NULL), \
+        .pfn_compare = (compare_fn),                                        \
+    }
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#pragma once
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
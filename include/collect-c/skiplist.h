@@ -0,0 +1,530 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    collect-c/skiplist.h
+ *
+ * Purpose: Ordered skip-list container.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#ifdef __cplusplus
+# ifndef COLLECT_C_SKIPLIST_SUPPRESS_CXX_WARNING
+#  error This file not currently compatible with C++ compilation
+# endif
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * version
+ */
+
+#define COLLECT_C_SKIPLIST_VER_MAJOR    0
+#define COLLECT_C_SKIPLIST_VER_MINOR    1
+#define COLLECT_C_SKIPLIST_VER_PATCH    0
+#define COLLECT_C_SKIPLIST_VER_ALPHABETA 41
+
+#define COLLECT_C_SKIPLIST_VER \
+    (0\
+        |   (   COLLECT_C_SKIPLIST_VER_MAJOR        << 24   ) \
+        |   (   COLLECT_C_SKIPLIST_VER_MINOR        << 16   ) \
+        |   (   COLLECT_C_SKIPLIST_VER_PATCH        <<  8   ) \
+        |   (   COLLECT_C_SKIPLIST_VER_ALPHABETA    <<  0   ) \
+    )
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/common.h>
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API constants
+ */
+
+/** The maximum height of any node. With a promotion probability of 1/4
+ * this is sufficient for any number of elements that can be addressed.
+ */
+#define COLLECT_C_SKIPLIST_MAX_HEIGHT                       (32)
+
+/** The default size, in bytes, of the blocks from which nodes are
+ * allocated.
+ */
+#ifndef COLLECT_C_SKIPLIST_DEFAULT_BLOCK_SIZE
+# define COLLECT_C_SKIPLIST_DEFAULT_BLOCK_SIZE              (4096)
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API types
+ */
+
+typedef union
+{
+    char            data[1];
+    int             _i;
+    long            _l;
+    long long       _ll;
+    double          _d;
+    long double     _ld;
+    void*           _pv;
+} collect_c_skiplist_node_data_t;
+
+struct collect_c_skiplist_node_t;
+#ifndef __cplusplus
+typedef struct collect_c_skiplist_node_t    collect_c_skiplist_node_t;
+#endif
+
+/** A node of the skip-list.
+ *
+ * @note prev and next are the level-0 links, so may be used for ordered
+ *  iteration in either direction. The links for any higher levels follow
+ *  the element data and are not part of the public API.
+ */
+struct collect_c_skiplist_node_t
+{
+    collect_c_skiplist_node_t*      prev;
+    collect_c_skiplist_node_t*      next;
+    size_t                          height;
+    collect_c_skiplist_node_data_t  data[1];
+};
+
+/** A block of memory from which nodes are allocated. Nodes are never
+ * individually freed: when erased they are kept on a free-list for their
+ * height, and the blocks are freed along with the list's storage.
+ */
+struct collect_c_skiplist_block_t;
+#ifndef __cplusplus
+typedef struct collect_c_skiplist_block_t   collect_c_skiplist_block_t;
+#endif
+struct collect_c_skiplist_block_t
+{
+    collect_c_skiplist_block_t*     next_block;
+    size_t                          size;
+    size_t                          num_used;
+    collect_c_skiplist_node_data_t  data[1];
+};
+
+/** Callback function that, if attached to instance, will be called back for
+ * each element upon its erasure by any of the API functions.
+ */
+typedef void (*collect_c_skiplist_pfn_free)(
+    size_t  el_size
+,   size_t  el_index    /* always 0 */
+,   void*   el_ptr
+,   void*   param_element_free
+);
+
+struct collect_c_skiplist_t;
+#ifndef __cplusplus
+typedef struct collect_c_skiplist_t     collect_c_skiplist_t;
+#endif
+
+/** Callback function that performs comparison between elements for the
+ * purpose of ordering and search.
+ *
+ * @param sl Pointer to the list. Will not be NULL;
+ * @param p_lhs Pointer to the lhs element, or key. Will not be NULL;
+ * @param p_rhs Pointer to the rhs element. Will not be NULL;
+ *
+ * @retval <0 The element referred to by p_lhs is "less than" the element
+ *  referred to by p_rhs;
+ * @retval 0 The elements are equivalent;
+ * @retval >0 The element referred to by p_lhs is "greater than" the element
+ *  referred to by p_rhs;
+ *
+ * @note No modifications to sl are permitted.
+ */
+typedef int (*collect_c_skiplist_pfn_compare_t)(
+    collect_c_skiplist_t const* sl
+,   void const*                 p_lhs
+,   void const*                 p_rhs
+);
+
+/** Represents an ordered skip-list of unique elements.
+ *
+ * @note Each node has a randomly chosen height, with each additional level
+ *  having a probability of 1/4, so that find, insert, and erase are
+ *  expected O(log n). Nodes are allocated from blocks of
+ *  COLLECT_C_SKIPLIST_DEFAULT_BLOCK_SIZE bytes, and erased nodes are
+ *  reused by subsequent insertions of the same height.
+ */
+struct collect_c_skiplist_t
+{
+    size_t                              el_size;            /*! The element size. */
+    size_t                              size;               /*! The number of elements. */
+    size_t                              height;             /*! The number of levels in use. */
+    int32_t                             flags;              /*! Control flags. */
+    int32_t                             reserved0;          /*! Reserved field. */
+    uint64_t                            rng_state;          /*! State of the height generator. */
+    collect_c_skiplist_node_t*          heads[COLLECT_C_SKIPLIST_MAX_HEIGHT];       /*! The first node of each level. */
+    collect_c_skiplist_node_t*          tail;               /*! The last node. */
+    collect_c_skiplist_node_t*          free_lists[COLLECT_C_SKIPLIST_MAX_HEIGHT];  /*! Erased nodes, by height - 1. */
+    collect_c_skiplist_block_t*         blocks;             /*! The blocks from which nodes are allocated. */
+    collect_c_skiplist_pfn_compare_t    pfn_compare;        /*! The element comparison function. */
+    struct collect_c_allocator_t const* allocator;          /*! Optional allocator, from which blocks are obtained. If NULL, malloc()/free() are used. */
+    void*                               param_element_free; /*! Custom parameter to be passed to invocations of pfn_element_free. */
+    collect_c_skiplist_pfn_free         pfn_element_free;   /*! Custom function to be invoked when element erased. */
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions & macros (internal)
+ */
+
+#define COLLECT_C_SKIPLIST_get_l_ptr_(sl)                   _Generic((sl),  \
+                                                                            \
+                          collect_c_skiplist_t* :  (sl),                    \
+                    collect_c_skiplist_t const* :  (sl),                    \
+                                        default : &(sl)                     \
+)
+
+#define COLLECT_C_SKIPLIST_assert_el_size_(sl_name, t_el)   assert(sizeof(t_el) == COLLECT_C_SKIPLIST_get_l_ptr_(sl_name)->el_size)
+#define COLLECT_C_SKIPLIST_assert_not_empty_(sl_name)       assert(0 != COLLECT_C_SKIPLIST_get_l_ptr_(sl_name)->size)
+
+#define COLLECT_C_SKIPLIST_clear_1_(sl_name)                collect_c_skiplist_clear(COLLECT_C_SKIPLIST_get_l_ptr_(sl_name), NULL, NULL, NULL)
+#define COLLECT_C_SKIPLIST_clear_2_(sl_name, p)             collect_c_skiplist_clear(COLLECT_C_SKIPLIST_get_l_ptr_(sl_name), NULL, NULL,  (p))
+
+#define COLLECT_C_SKIPLIST_insert_2_(sl_name, ptr_new_el)               collect_c_skiplist_insert_by_ref(COLLECT_C_SKIPLIST_get_l_ptr_(sl_name), (ptr_new_el), NULL)
+#define COLLECT_C_SKIPLIST_insert_3_(sl_name, ptr_new_el, p_new_node)   collect_c_skiplist_insert_by_ref(COLLECT_C_SKIPLIST_get_l_ptr_(sl_name), (ptr_new_el), (p_new_node))
+
+#define COLLECT_C_SKIPLIST_node_data_(n)                    ((void      *)(&(n)->data[0].data[0]))
+#define COLLECT_C_SKIPLIST_node_cdata_(n)                   ((void const*)(&(n)->data[0].data[0]))
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions & macros
+ */
+
+/** @def COLLECT_C_SKIPLIST_define_empty(el_type, sl_name, compare_fn)
+ *
+ * Declares and defines an empty list instance. Storage is allocated as
+ * required by the insertion functions.
+ *
+ * @param el_type The type of the elements to be stored;
+ * @param sl_name The name of the instance;
+ * @param compare_fn The element comparison function;
+ */
+#define COLLECT_C_SKIPLIST_define_empty(el_type, sl_name, compare_fn)       \
+                                                                            \
+    collect_c_skiplist_t sl_name = COLLECT_C_SKIPLIST_EMPTY_INITIALIZER_(el_type, 0, compare_fn, NULL, NULL)
+
+
+/** @def COLLECT_C_SKIPLIST_define_empty_with_callback(el_type, sl_name, compare_fn, elf_fn, elf_param)
+ *
+ * Declares and defines an empty list instance. Storage is allocated as
+ * required by the insertion functions.
+ *
+ * @param el_type The type of the elements to be stored;
+ * @param sl_name The name of the instance;
+ * @param compare_fn The element comparison function;
+ * @param elf_fn Callback function to be invoked when element is erased;
+ * @param elf_param Parameter to be given to the callback function;
+ */
+#define COLLECT_C_SKIPLIST_define_empty_with_callback(el_type, sl_name, compare_fn, elf_fn, elf_param)  \
+                                                                                                        \
+    collect_c_skiplist_t sl_name = COLLECT_C_SKIPLIST_EMPTY_INITIALIZER_(el_type, 0, compare_fn, elf_fn, elf_param)
+
+
+/** @def COLLECT_C_SKIPLIST_define_empty_with_allocator(el_type, sl_name, compare_fn, alloc)
+ *
+ * Declares and defines an empty list instance whose blocks of nodes are to
+ * be obtained from the given allocator.
+ *
+ * @param el_type The type of the elements to be stored;
+ * @param sl_name The name of the instance;
+ * @param compare_fn The element comparison function;
+ * @param alloc Pointer to the allocator (collect_c_allocator_t), which
+ *  must outlive the instance's blocks;
+ */
+#define COLLECT_C_SKIPLIST_define_empty_with_allocator(el_type, sl_name, compare_fn, alloc)  \
+                                                                                            \
+    collect_c_skiplist_t sl_name = COLLECT_C_SKIPLIST_EMPTY_INITIALIZER_WITH_ALLOCATOR_(el_type, 0, compare_fn, (alloc), NULL, NULL)
+
+
+/* modifiers */
+
+#define COLLECT_C_SKIPLIST_clear(...)                       COLLECT_C_UTIL_GET_MACRO_1_or_2_(__VA_ARGS__, COLLECT_C_SKIPLIST_clear_2_, COLLECT_C_SKIPLIST_clear_1_, NULL)(__VA_ARGS__)
+
+#define COLLECT_C_SKIPLIST_erase_node(sl_name, node)        collect_c_skiplist_erase_node(COLLECT_C_SKIPLIST_get_l_ptr_(sl_name), (node))
+
+#define COLLECT_C_SKIPLIST_insert_by_ref(...)               COLLECT_C_UTIL_GET_MACRO_2_or_3_(__VA_ARGS__, COLLECT_C_SKIPLIST_insert_3_, COLLECT_C_SKIPLIST_insert_2_, NULL)(__VA_ARGS__)
+#define COLLECT_C_SKIPLIST_insert_by_value(sl_name, t_el, new_el)   \
+                                                            (COLLECT_C_SKIPLIST_assert_el_size_(sl_name, t_el), collect_c_skiplist_insert_by_ref(COLLECT_C_SKIPLIST_get_l_ptr_(sl_name), &((t_el){(new_el)}), NULL))
+
+/* attributes */
+
+#define COLLECT_C_SKIPLIST_is_empty(sl_name)                (0 == COLLECT_C_SKIPLIST_get_l_ptr_(sl_name)->size  )
+#define COLLECT_C_SKIPLIST_len(sl_name)                     (     COLLECT_C_SKIPLIST_get_l_ptr_(sl_name)->size  )
+
+/* accessors */
+
+#define COLLECT_C_SKIPLIST_first_node(sl_name)              (COLLECT_C_SKIPLIST_get_l_ptr_(sl_name)->heads[0])
+#define COLLECT_C_SKIPLIST_last_node(sl_name)               (COLLECT_C_SKIPLIST_get_l_ptr_(sl_name)->tail)
+
+#define COLLECT_C_SKIPLIST_cfront_t(sl_name, t_el)          ((t_el const*)(COLLECT_C_SKIPLIST_assert_el_size_(sl_name, t_el), COLLECT_C_SKIPLIST_assert_not_empty_(sl_name), COLLECT_C_SKIPLIST_node_cdata_(COLLECT_C_SKIPLIST_first_node(sl_name))))
+#define COLLECT_C_SKIPLIST_cback_t(sl_name, t_el)           ((t_el const*)(COLLECT_C_SKIPLIST_assert_el_size_(sl_name, t_el), COLLECT_C_SKIPLIST_assert_not_empty_(sl_name), COLLECT_C_SKIPLIST_node_cdata_(COLLECT_C_SKIPLIST_last_node(sl_name))))
+
+/* iteration */
+
+#define COLLECT_C_SKIPLIST_node_data_v(n)                   COLLECT_C_SKIPLIST_node_data_(n)
+#define COLLECT_C_SKIPLIST_node_cdata_v(n)                  COLLECT_C_SKIPLIST_node_cdata_(n)
+#define COLLECT_C_SKIPLIST_node_cdata_t(n, t_el)            ((t_el const*)COLLECT_C_SKIPLIST_node_cdata_(n))
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Obtains the value of COLLECT_C_SKIPLIST_VER at the time of compilation
+ * of the library.
+ */
+uint32_t
+collect_c_skiplist_version(void);
+
+/** Frees storage associated with the instance, invoking the element-free
+ * callback (if any) for each element.
+ *
+ * @param sl Pointer to the list. May not be NULL;
+ *
+ * @pre (NULL != sl)
+ */
+void
+collect_c_skiplist_free_storage(
+    collect_c_skiplist_t*   sl
+);
+
+/** Clears all elements from the list, invoking the element-free callback
+ * (if any) for each element. The nodes are retained for reuse.
+ *
+ * @param sl Pointer to the list. May not be NULL;
+ * @param reserved0 Reserved. Must be 0;
+ * @param reserved1 Reserved. Must be 0;
+ * @param num_dropped Optional pointer to variable to retrieve number of
+ *  entries dropped;
+ *
+ * @pre (NULL != sl)
+ * @pre (0 == reserved0)
+ * @pre (0 == reserved1)
+ */
+int
+collect_c_skiplist_clear(
+    collect_c_skiplist_t*   sl
+,   void*                   reserved0
+,   void*                   reserved1
+,   size_t*                 num_dropped
+);
+
+/** Erases a node from the list, invoking the element-free callback (if
+ * any).
+ *
+ * @param sl Pointer to the list. May not be NULL;
+ * @param node Pointer to the node to be erased. May not be NULL. Must
+ *  point to a node that is currently in the list. Invalidated by a
+ *  successful call;
+ *
+ * @pre (NULL != sl)
+ * @pre (NULL != node)
+ * @pre (node is in sl);
+ */
+int
+collect_c_skiplist_erase_node(
+    collect_c_skiplist_t*       sl
+,   collect_c_skiplist_node_t*  node
+);
+
+/** Erases the element equivalent to the given key, invoking the
+ * element-free callback (if any).
+ *
+ * @param sl Pointer to the list. May not be NULL;
+ * @param p_key Pointer to the key. May not be NULL;
+ *
+ * @retval 0 The element was erased;
+ * @retval ENOENT No equivalent element was found;
+ *
+ * @pre (NULL != sl)
+ * @pre (NULL != p_key)
+ */
+int
+collect_c_skiplist_erase_by_key(
+    collect_c_skiplist_t*   sl
+,   void const*             p_key
+);
+
+/** Searches the list for the node whose element is equivalent to the
+ * given key.
+ *
+ * @param sl Pointer to the list. May not be NULL;
+ * @param p_key Pointer to the key. May not be NULL;
+ * @param node Pointer to a variable to receive the found node. May not be
+ *  NULL;
+ *
+ * @retval 0 An equivalent element was found;
+ * @retval ENOENT No equivalent element was found;
+ *
+ * @pre (NULL != sl)
+ * @pre (NULL != p_key)
+ * @pre (NULL != node)
+ */
+int
+collect_c_skiplist_find_node(
+    collect_c_skiplist_t const*     sl
+,   void const*                     p_key
+,   collect_c_skiplist_node_t**     node
+);
+
+/** Obtains the first node whose element is not less than the given key.
+ *
+ * @param sl Pointer to the list. May not be NULL;
+ * @param p_key Pointer to the key. May not be NULL;
+ * @param node Pointer to a variable to receive the found node. May not be
+ *  NULL;
+ *
+ * @retval 0 A node was found;
+ * @retval ENOENT All elements are less than the key;
+ *
+ * @pre (NULL != sl)
+ * @pre (NULL != p_key)
+ * @pre (NULL != node)
+ */
+int
+collect_c_skiplist_lower_bound(
+    collect_c_skiplist_t const*     sl
+,   void const*                     p_key
+,   collect_c_skiplist_node_t**     node
+);
+
+/** Obtains the first node whose element is greater than the given key.
+ *
+ * @param sl Pointer to the list. May not be NULL;
+ * @param p_key Pointer to the key. May not be NULL;
+ * @param node Pointer to a variable to receive the found node. May not be
+ *  NULL;
+ *
+ * @retval 0 A node was found;
+ * @retval ENOENT No elements are greater than the key;
+ *
+ * @pre (NULL != sl)
+ * @pre (NULL != p_key)
+ * @pre (NULL != node)
+ */
+int
+collect_c_skiplist_upper_bound(
+    collect_c_skiplist_t const*     sl
+,   void const*                     p_key
+,   collect_c_skiplist_node_t**     node
+);
+
+/** Obtains the half-open range of nodes whose elements are not less than
+ * p_lo and are less than p_hi, which may be traversed as:
+ *
+ *   for (n = first; end != n; n = n->next)
+ *
+ * @param sl Pointer to the list. May not be NULL;
+ * @param p_lo Pointer to the lower (inclusive) key. May not be NULL;
+ * @param p_hi Pointer to the upper (exclusive) key. May not be NULL;
+ * @param first Pointer to a variable to receive the first node in the
+ *  range. May not be NULL;
+ * @param end Pointer to a variable to receive the node following the
+ *  range, which will be NULL if the range extends to the end of the list.
+ *  May not be NULL;
+ * @param num_els Optional pointer to a variable to receive the number of
+ *  elements in the range;
+ *
+ * @retval 0 The range contains at least one element;
+ * @retval ENOENT The range is empty, in which case *first == *end;
+ *
+ * @pre (NULL != sl)
+ * @pre (NULL != p_lo)
+ * @pre (NULL != p_hi)
+ * @pre (NULL != first)
+ * @pre (NULL != end)
+ */
+int
+collect_c_skiplist_range(
+    collect_c_skiplist_t const*     sl
+,   void const*                     p_lo
+,   void const*                     p_hi
+,   collect_c_skiplist_node_t**     first
+,   collect_c_skiplist_node_t**     end
+,   size_t*                         num_els
+);
+
+/** Inserts a new element into the list at its ordered position.
+ *
+ * @param sl Pointer to the list. May not be NULL;
+ * @param ptr_new_el Pointer to the new element. May not be NULL;
+ * @param new_node Optional pointer to a variable to receive the created
+ *  node or, if EEXIST is returned, the node of the equivalent element;
+ *
+ * @retval 0 The element was inserted;
+ * @retval EEXIST An equivalent element is already in the list, which is
+ *  unchanged;
+ * @retval ENOMEM Sufficient memory not available;
+ *
+ * @pre (NULL != sl)
+ * @pre (NULL != ptr_new_el)
+ */
+int
+collect_c_skiplist_insert_by_ref(
+    collect_c_skiplist_t*       sl
+,   void const*                 ptr_new_el
+,   collect_c_skiplist_node_t** new_node
+);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper macros
+ */
+
+#define COLLECT_C_SKIPLIST_EMPTY_INITIALIZER_WITH_ALLOCATOR_(el_type, sl_flags, compare_fn, sl_alloc, elf_fn, elf_param) \
+                                                                            \
+    {                                                                       \
+        .el_size = sizeof(el_type),                                         \
+        .size = 0,                                                          \
+        .height = 0,                                                        \
+        .flags = (sl_flags),                                                \
+        .reserved0 = 0,                                                     \
+        .rng_state = 0,                                                     \
+        .heads = { NULL },                                                  \
+        .tail = NULL,                                                       \
+        .free_lists = { NULL },                                             \
+        .blocks = NULL,                                                     \
+        .pfn_compare = (compare_fn),                                        \
+        .allocator = (sl_alloc),                                            \
+        .param_element_free = (elf_param),                                  \
+        .pfn_element_free = (elf_fn),                                       \
+    }
+
+#define COLLECT_C_SKIPLIST_EMPTY_INITIALIZER_(el_type, sl_flags, compare_fn, elf_fn, elf_param) \
+                                                                            \
+    COLLECT_C_SKIPLIST_EMPTY_INITIALIZER_WITH_ALLOCATOR_(el_type, sl_flags, compare_fn, NULL, elf_fn, elf_param)
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#pragma once
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,45 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    collect-c/terse/arena.h
+ *
+ * Purpose: Arena (region) allocator terse api.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/arena.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * terse-form macros
+ */
+
+#define CLC_AR_define                                       COLLECT_C_ARENA_define
+#define CLC_AR_define_with_backing                          COLLECT_C_ARENA_define_with_backing
+
+#define CLC_AR_allocator                                    COLLECT_C_ARENA_allocator
+#define CLC_AR_num_chunks                                   COLLECT_C_ARENA_num_chunks
+
+
+#define clc_ar_free_storage                                 collect_c_arena_free_storage
+#define clc_ar_allocate                                     collect_c_arena_allocate
+#define clc_ar_reset                                        collect_c_arena_reset
+#define clc_ar_mark                                         collect_c_arena_mark
+#define clc_ar_rewind                                       collect_c_arena_rewind
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#pragma once
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
+
@@ -4,7 +4,7 @@
  * Purpose: Circular-queue container terse api.
  *
  * Created: 5th February 2025
- * Updated: 10th February 2025
+ * Updated: 18th October 2026
  *
  * ////////////////////////////////////////////////////////////////////// */
 
@@ -22,9 +22,12 @@
 
 #define CLC_CQ_F_USE_STACK_ARRAY                            COLLECT_C_CIRCQ_F_USE_STACK_ARRAY
 #define CLC_CQ_F_OVERWRITE_FRONT_WHEN_FULL                  COLLECT_C_CIRCQ_F_OVERWRITE_FRONT_WHEN_FULL
+#define CLC_CQ_F_USE_HUGE_PAGES                             COLLECT_C_CIRCQ_F_USE_HUGE_PAGES
+#define CLC_CQ_F_VM_STORAGE                                 COLLECT_C_CIRCQ_F_VM_STORAGE
 
 #define CLC_CQ_define_empty                                 COLLECT_C_CIRCQ_define_empty
 #define CLC_CQ_define_empty_with_cb                         COLLECT_C_CIRCQ_define_empty_with_callback
+#define CLC_CQ_define_empty_with_allocator                  COLLECT_C_CIRCQ_define_empty_with_allocator
 #define CLC_CQ_define_on_stack                              COLLECT_C_CIRCQ_define_on_stack
 #define CLC_CQ_define_on_stack_with_cb                      COLLECT_C_CIRCQ_define_on_stack_with_callback
 
@@ -45,6 +48,11 @@
 #define CLC_CQ_pop_back                                     COLLECT_C_CIRCQ_pop_back
 #define CLC_CQ_pop_front                                    COLLECT_C_CIRCQ_pop_front
 #define CLC_CQ_clear                                        COLLECT_C_CIRCQ_clear
+#define CLC_CQ_contains_by_ref                              COLLECT_C_CIRCQ_contains_by_ref
+#define CLC_CQ_contains_by_value                            COLLECT_C_CIRCQ_contains_by_value
+#define CLC_CQ_count_by_ref                                 COLLECT_C_CIRCQ_count_by_ref
+#define CLC_CQ_count_by_value                               COLLECT_C_CIRCQ_count_by_value
+#define CLC_CQ_find_by_value                                COLLECT_C_CIRCQ_find_by_value
 
 
 #define clc_cq_allocate_storage                             collect_c_cq_allocate_storage
@@ -53,6 +61,8 @@
 #define clc_cq_clear                                        collect_c_cq_clear
 #define clc_cq_pop_from_back_n                              collect_c_cq_pop_from_back_n
 #define clc_cq_pop_from_front_n                             collect_c_cq_pop_from_front_n
+#define clc_cq_find_by_ref                                  collect_c_cq_find_by_ref
+#define clc_cq_count_by_ref                                 collect_c_cq_count_by_ref
 
 
 /* /////////////////////////////////////////////////////////////////////////
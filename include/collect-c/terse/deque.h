@@ -0,0 +1,66 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    collect-c/terse/deque.h
+ *
+ * Purpose: Double-ended queue container terse api.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/deque.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * terse-form macros
+ */
+
+#define CLC_DQ_define_empty                                 COLLECT_C_DEQUE_define_empty
+#define CLC_DQ_define_empty_with_cb                         COLLECT_C_DEQUE_define_empty_with_callback
+#define CLC_DQ_define_empty_with_allocator                  COLLECT_C_DEQUE_define_empty_with_allocator
+
+#define CLC_DQ_is_empty                                     COLLECT_C_DEQUE_is_empty
+#define CLC_DQ_len                                          COLLECT_C_DEQUE_len
+#define CLC_DQ_num_chunks                                   COLLECT_C_DEQUE_num_chunks
+
+#define CLC_DQ_at_v                                         COLLECT_C_DEQUE_at_v
+#define CLC_DQ_at_t                                         COLLECT_C_DEQUE_at_t
+#define CLC_DQ_cat_t                                        COLLECT_C_DEQUE_cat_t
+#define CLC_DQ_front_v                                      COLLECT_C_DEQUE_front_v
+#define CLC_DQ_back_v                                       COLLECT_C_DEQUE_back_v
+#define CLC_DQ_cfront_t                                     COLLECT_C_DEQUE_cfront_t
+#define CLC_DQ_cback_t                                      COLLECT_C_DEQUE_cback_t
+
+#define CLC_DQ_clear                                        COLLECT_C_DEQUE_clear
+#define CLC_DQ_erase_at                                     COLLECT_C_DEQUE_erase_at
+#define CLC_DQ_pop_back                                     COLLECT_C_DEQUE_pop_back
+#define CLC_DQ_pop_front                                    COLLECT_C_DEQUE_pop_front
+#define CLC_DQ_push_back_by_ref                             COLLECT_C_DEQUE_push_back_by_ref
+#define CLC_DQ_push_back_by_value                           COLLECT_C_DEQUE_push_back_by_value
+#define CLC_DQ_push_front_by_ref                            COLLECT_C_DEQUE_push_front_by_ref
+#define CLC_DQ_push_front_by_value                          COLLECT_C_DEQUE_push_front_by_value
+
+
+#define clc_dq_free_storage                                 collect_c_deque_free_storage
+#define clc_dq_clear                                        collect_c_deque_clear
+#define clc_dq_at                                           collect_c_deque_at
+#define clc_dq_erase_at                                     collect_c_deque_erase_at
+#define clc_dq_push_back_by_ref                             collect_c_deque_push_back_by_ref
+#define clc_dq_push_front_by_ref                            collect_c_deque_push_front_by_ref
+#define clc_dq_pop_from_back_n                              collect_c_deque_pop_from_back_n
+#define clc_dq_pop_from_front_n                             collect_c_deque_pop_from_front_n
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#pragma once
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
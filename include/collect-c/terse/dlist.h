@@ -4,7 +4,7 @@
  * Purpose: Doubly-linked list container terse api.
  *
  * Created: 7th February 2025
- * Updated: 10th February 2025
+ * Updated: 18th October 2026
  *
  * ////////////////////////////////////////////////////////////////////// */
 
@@ -23,6 +23,8 @@
 #define CLC_DL_F_NO_SPARES                                  COLLECT_C_DLIST_F_NO_SPARES
 
 #define CLC_DL_define_empty                                 COLLECT_C_DLIST_define_empty
+#define CLC_DL_define_empty_with_allocator                  COLLECT_C_DLIST_define_empty_with_allocator
+#define CLC_DL_node_size                                    COLLECT_C_DLIST_node_size
 
 #define CLC_DL_is_empty                                     COLLECT_C_DLIST_is_empty
 #define CLC_DL_len                                          COLLECT_C_DLIST_len
@@ -0,0 +1,59 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    collect-c/terse/flatmap.h
+ *
+ * Purpose: Sorted flat map (and set) container terse api.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/flatmap.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * terse-form macros
+ */
+
+#define CLC_FM_define_empty                                 COLLECT_C_FLATMAP_define_empty
+#define CLC_FM_define_empty_set                             COLLECT_C_FLATMAP_define_empty_set
+
+#define CLC_FM_clear                                        COLLECT_C_FLATMAP_clear
+#define CLC_FM_erase_by_value                               COLLECT_C_FLATMAP_erase_by_value
+#define CLC_FM_insert_by_value                              COLLECT_C_FLATMAP_insert_by_value
+#define CLC_FM_insert_key_by_value                          COLLECT_C_FLATMAP_insert_key_by_value
+
+#define CLC_FM_is_empty                                     COLLECT_C_FLATMAP_is_empty
+#define CLC_FM_len                                          COLLECT_C_FLATMAP_len
+
+#define CLC_FM_at_v                                         COLLECT_C_FLATMAP_at_v
+#define CLC_FM_contains_by_value                            COLLECT_C_FLATMAP_contains_by_value
+#define CLC_FM_entry_key_v                                  COLLECT_C_FLATMAP_entry_key_v
+#define CLC_FM_entry_value_v                                COLLECT_C_FLATMAP_entry_value_v
+
+
+#define clc_fm_free_storage                                 collect_c_flatmap_free_storage
+#define clc_fm_clear                                        collect_c_flatmap_clear
+#define clc_fm_lower_bound                                  collect_c_flatmap_lower_bound
+#define clc_fm_upper_bound                                  collect_c_flatmap_upper_bound
+#define clc_fm_equal_range                                  collect_c_flatmap_equal_range
+#define clc_fm_find_by_ref                                  collect_c_flatmap_find_by_ref
+#define clc_fm_insert_by_ref                                collect_c_flatmap_insert_by_ref
+#define clc_fm_insert_n_by_ref                              collect_c_flatmap_insert_n_by_ref
+#define clc_fm_assign_n_by_ref                              collect_c_flatmap_assign_n_by_ref
+#define clc_fm_erase_by_ref                                 collect_c_flatmap_erase_by_ref
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#pragma once
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,49 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    collect-c/terse/frozen.h
+ *
+ * Purpose: Frozen (static) sorted array terse api.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/frozen.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * terse-form macros
+ */
+
+#define CLC_FZ_F_EYTZINGER                                  COLLECT_C_FROZEN_F_EYTZINGER
+#define CLC_FZ_F_BTREE                                      COLLECT_C_FROZEN_F_BTREE
+
+#define CLC_FZ_define_empty                                 COLLECT_C_FROZEN_define_empty
+#define CLC_FZ_define_empty_with_allocator                  COLLECT_C_FROZEN_define_empty_with_allocator
+
+#define CLC_FZ_is_empty                                     COLLECT_C_FROZEN_is_empty
+#define CLC_FZ_len                                          COLLECT_C_FROZEN_len
+
+#define CLC_FZ_contains_by_ref                              COLLECT_C_FROZEN_contains_by_ref
+#define CLC_FZ_contains_by_value                            COLLECT_C_FROZEN_contains_by_value
+
+
+#define clc_fz_free_storage                                 collect_c_frozen_free_storage
+#define clc_fz_freeze                                       collect_c_frozen_freeze
+#define clc_fz_lower_bound                                  collect_c_frozen_lower_bound
+#define clc_fz_find_by_ref                                  collect_c_frozen_find_by_ref
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#pragma once
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
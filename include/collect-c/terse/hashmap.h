@@ -0,0 +1,60 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    collect-c/terse/hashmap.h
+ *
+ * Purpose: Hash map container terse api.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/hashmap.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * terse-form macros
+ */
+
+#define CLC_HM_define_empty                                 COLLECT_C_HASHMAP_define_empty
+#define CLC_HM_define_empty_with_functions                  COLLECT_C_HASHMAP_define_empty_with_functions
+#define CLC_HM_define_empty_with_cb                         COLLECT_C_HASHMAP_define_empty_with_callback
+#define CLC_HM_define_empty_with_allocator                  COLLECT_C_HASHMAP_define_empty_with_allocator
+
+#define CLC_HM_clear                                        COLLECT_C_HASHMAP_clear
+#define CLC_HM_erase_by_value                               COLLECT_C_HASHMAP_erase_by_value
+#define CLC_HM_insert_by_value                              COLLECT_C_HASHMAP_insert_by_value
+#define CLC_HM_insert_or_assign_by_value                    COLLECT_C_HASHMAP_insert_or_assign_by_value
+
+#define CLC_HM_is_empty                                     COLLECT_C_HASHMAP_is_empty
+#define CLC_HM_len                                          COLLECT_C_HASHMAP_len
+#define CLC_HM_capacity                                     COLLECT_C_HASHMAP_capacity
+
+#define CLC_HM_contains_by_value                            COLLECT_C_HASHMAP_contains_by_value
+#define CLC_HM_entry_key_v                                  COLLECT_C_HASHMAP_entry_key_v
+#define CLC_HM_entry_value_v                                COLLECT_C_HASHMAP_entry_value_v
+
+
+#define clc_hm_free_storage                                 collect_c_hashmap_free_storage
+#define clc_hm_clear                                        collect_c_hashmap_clear
+#define clc_hm_reserve                                      collect_c_hashmap_reserve
+#define clc_hm_find_by_ref                                  collect_c_hashmap_find_by_ref
+#define clc_hm_insert_by_ref                                collect_c_hashmap_insert_by_ref
+#define clc_hm_insert_or_assign_by_ref                      collect_c_hashmap_insert_or_assign_by_ref
+#define clc_hm_erase_by_ref                                 collect_c_hashmap_erase_by_ref
+#define clc_hm_next_entry                                   collect_c_hashmap_next_entry
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#pragma once
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
+
@@ -0,0 +1,56 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    collect-c/terse/hashset.h
+ *
+ * Purpose: Hash set container terse api.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/hashset.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * terse-form macros
+ */
+
+#define CLC_HS_define_empty                                 COLLECT_C_HASHSET_define_empty
+#define CLC_HS_define_empty_with_allocator                  COLLECT_C_HASHSET_define_empty_with_allocator
+
+#define CLC_HS_clear                                        COLLECT_C_HASHSET_clear
+#define CLC_HS_erase_by_value                               COLLECT_C_HASHSET_erase_by_value
+#define CLC_HS_insert_by_value                              COLLECT_C_HASHSET_insert_by_value
+
+#define CLC_HS_is_empty                                     COLLECT_C_HASHSET_is_empty
+#define CLC_HS_len                                          COLLECT_C_HASHSET_len
+#define CLC_HS_capacity                                     COLLECT_C_HASHSET_capacity
+
+#define CLC_HS_contains_by_value                            COLLECT_C_HASHSET_contains_by_value
+
+
+#define clc_hs_free_storage                                 collect_c_hashset_free_storage
+#define clc_hs_clear                                        collect_c_hashset_clear
+#define clc_hs_reserve                                      collect_c_hashset_reserve
+#define clc_hs_find_by_ref                                  collect_c_hashset_find_by_ref
+#define clc_hs_find_n_by_ref                                collect_c_hashset_find_n_by_ref
+#define clc_hs_insert_by_ref                                collect_c_hashset_insert_by_ref
+#define clc_hs_insert_n_by_ref                              collect_c_hashset_insert_n_by_ref
+#define clc_hs_erase_by_ref                                 collect_c_hashset_erase_by_ref
+#define clc_hs_next_key                                     collect_c_hashset_next_key
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#pragma once
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
+
@@ -0,0 +1,75 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    collect-c/terse/ilist.h
+ *
+ * Purpose: Index-linked list container terse api.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/ilist.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * terse-form macros
+ */
+
+#define CLC_IL_NIL                                          COLLECT_C_ILIST_NIL
+
+#define CLC_IL_define_empty                                 COLLECT_C_ILIST_define_empty
+#define CLC_IL_define_empty_with_cb                         COLLECT_C_ILIST_define_empty_with_callback
+#define CLC_IL_define_empty_with_allocator                  COLLECT_C_ILIST_define_empty_with_allocator
+
+#define CLC_IL_is_empty                                     COLLECT_C_ILIST_is_empty
+#define CLC_IL_len                                          COLLECT_C_ILIST_len
+#define CLC_IL_num_free                                     COLLECT_C_ILIST_num_free
+
+#define CLC_IL_head                                         COLLECT_C_ILIST_head
+#define CLC_IL_tail                                         COLLECT_C_ILIST_tail
+#define CLC_IL_next                                         COLLECT_C_ILIST_next
+#define CLC_IL_prev                                         COLLECT_C_ILIST_prev
+
+#define CLC_IL_at_v                                         COLLECT_C_ILIST_at_v
+#define CLC_IL_cat_v                                        COLLECT_C_ILIST_cat_v
+#define CLC_IL_at_t                                         COLLECT_C_ILIST_at_t
+#define CLC_IL_cat_t                                        COLLECT_C_ILIST_cat_t
+#define CLC_IL_cfront_t                                     COLLECT_C_ILIST_cfront_t
+#define CLC_IL_cback_t                                      COLLECT_C_ILIST_cback_t
+
+#define CLC_IL_clear                                        COLLECT_C_ILIST_clear
+#define CLC_IL_erase                                        COLLECT_C_ILIST_erase
+#define CLC_IL_insert_after                                 COLLECT_C_ILIST_insert_after
+#define CLC_IL_insert_before                                COLLECT_C_ILIST_insert_before
+#define CLC_IL_push_back_by_ref                             COLLECT_C_ILIST_push_back_by_ref
+#define CLC_IL_push_back_by_value                           COLLECT_C_ILIST_push_back_by_value
+#define CLC_IL_push_front_by_ref                            COLLECT_C_ILIST_push_front_by_ref
+#define CLC_IL_push_front_by_value                          COLLECT_C_ILIST_push_front_by_value
+
+
+#define clc_il_allocate_storage                             collect_c_ilist_allocate_storage
+#define clc_il_free_storage                                 collect_c_ilist_free_storage
+#define clc_il_clear                                        collect_c_ilist_clear
+#define clc_il_copy                                         collect_c_ilist_copy
+#define clc_il_erase                                        collect_c_ilist_erase
+#define clc_il_find                                         collect_c_ilist_find
+#define clc_il_rfind                                        collect_c_ilist_rfind
+#define clc_il_insert_after                                 collect_c_ilist_insert_after
+#define clc_il_insert_before                                collect_c_ilist_insert_before
+#define clc_il_push_back_by_ref                             collect_c_ilist_push_back_by_ref
+#define clc_il_push_front_by_ref                            collect_c_ilist_push_front_by_ref
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#pragma once
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,58 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    collect-c/terse/lru.h
+ *
+ * Purpose: Hash-indexed LRU cache container terse api.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/lru.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * terse-form macros
+ */
+
+#define CLC_LRU_define_empty                                COLLECT_C_LRU_define_empty
+#define CLC_LRU_define_empty_with_cb                        COLLECT_C_LRU_define_empty_with_callback
+#define CLC_LRU_define_empty_with_allocator                 COLLECT_C_LRU_define_empty_with_allocator
+
+#define CLC_LRU_is_empty                                    COLLECT_C_LRU_is_empty
+#define CLC_LRU_len                                         COLLECT_C_LRU_len
+#define CLC_LRU_max_size                                    COLLECT_C_LRU_max_size
+
+#define CLC_LRU_cmru_t                                      COLLECT_C_LRU_cmru_t
+#define CLC_LRU_clru_t                                      COLLECT_C_LRU_clru_t
+
+#define CLC_LRU_clear                                       COLLECT_C_LRU_clear
+#define CLC_LRU_erase_node                                  COLLECT_C_LRU_erase_node
+#define CLC_LRU_insert_by_ref                               COLLECT_C_LRU_insert_by_ref
+#define CLC_LRU_insert_by_value                             COLLECT_C_LRU_insert_by_value
+#define CLC_LRU_touch_node                                  COLLECT_C_LRU_touch_node
+
+
+#define clc_lru_free_storage                                collect_c_lru_free_storage
+#define clc_lru_clear                                       collect_c_lru_clear
+#define clc_lru_compact                                     collect_c_lru_compact
+#define clc_lru_erase_node                                  collect_c_lru_erase_node
+#define clc_lru_find_node                                   collect_c_lru_find_node
+#define clc_lru_lookup                                      collect_c_lru_lookup
+#define clc_lru_touch_node                                  collect_c_lru_touch_node
+#define clc_lru_insert_by_ref                               collect_c_lru_insert_by_ref
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#pragma once
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,44 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    collect-c/terse/par.h
+ *
+ * Purpose: Work-stealing thread pool, and parallel algorithms, terse api.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/par.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * terse-form macros
+ */
+
+#define CLC_PAR_for_each                                    COLLECT_C_PAR_for_each
+#define CLC_PAR_sort                                        COLLECT_C_PAR_sort
+
+
+#define clc_par_pool_create                                 collect_c_par_pool_create
+#define clc_par_pool_destroy                                collect_c_par_pool_destroy
+#define clc_par_pool_num_threads                            collect_c_par_pool_num_threads
+#define clc_par_pool_run                                    collect_c_par_pool_run
+#define clc_par_for_each                                    collect_c_par_for_each
+#define clc_par_transform                                   collect_c_par_transform
+#define clc_par_reduce                                      collect_c_par_reduce
+#define clc_par_sort                                        collect_c_par_sort
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#pragma once
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
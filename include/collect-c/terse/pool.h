@@ -0,0 +1,51 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    collect-c/terse/pool.h
+ *
+ * Purpose: Fixed-size object pool terse api.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/pool.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * terse-form macros
+ */
+
+#define CLC_PL_F_SYNCHRONISED                               COLLECT_C_POOL_F_SYNCHRONISED
+
+#define CLC_PL_define                                       COLLECT_C_POOL_define
+#define CLC_PL_define_by_size                               COLLECT_C_POOL_define_by_size
+#define CLC_PL_define_with_backing                          COLLECT_C_POOL_define_with_backing
+#define CLC_PL_CACHE_define                                 COLLECT_C_POOL_CACHE_define
+
+#define CLC_PL_allocator                                    COLLECT_C_POOL_allocator
+#define CLC_PL_num_in_use                                   COLLECT_C_POOL_num_in_use
+
+
+#define clc_pl_free_storage                                 collect_c_pool_free_storage
+#define clc_pl_acquire                                      collect_c_pool_acquire
+#define clc_pl_release                                      collect_c_pool_release
+#define clc_pl_get_stats                                    collect_c_pool_get_stats
+#define clc_pl_cache_acquire                                collect_c_pool_cache_acquire
+#define clc_pl_cache_release                                collect_c_pool_cache_release
+#define clc_pl_cache_flush                                  collect_c_pool_cache_flush
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#pragma once
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
+
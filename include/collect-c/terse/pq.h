@@ -0,0 +1,55 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    collect-c/terse/pq.h
+ *
+ * Purpose: Priority queue container terse api.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/pq.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * terse-form macros
+ */
+
+#define CLC_PQ_define_empty                                 COLLECT_C_PQ_define_empty
+#define CLC_PQ_define_empty_with_allocator                  COLLECT_C_PQ_define_empty_with_allocator
+#define CLC_PQ_define_typed_functions                       COLLECT_C_PQ_define_typed_functions
+
+#define CLC_PQ_clear                                        COLLECT_C_PQ_clear
+#define CLC_PQ_pop                                          COLLECT_C_PQ_pop
+#define CLC_PQ_push_by_ref                                  COLLECT_C_PQ_push_by_ref
+#define CLC_PQ_push_by_value                                COLLECT_C_PQ_push_by_value
+
+#define CLC_PQ_is_empty                                     COLLECT_C_PQ_is_empty
+#define CLC_PQ_len                                          COLLECT_C_PQ_len
+
+#define CLC_PQ_top_v                                        COLLECT_C_PQ_top_v
+#define CLC_PQ_top_t                                        COLLECT_C_PQ_top_t
+
+
+#define clc_pq_free_storage                                 collect_c_pq_free_storage
+#define clc_pq_clear                                        collect_c_pq_clear
+#define clc_pq_reserve                                      collect_c_pq_reserve
+#define clc_pq_push_by_ref                                  collect_c_pq_push_by_ref
+#define clc_pq_push_n_by_ref                                collect_c_pq_push_n_by_ref
+#define clc_pq_pop                                          collect_c_pq_pop
+#define clc_pq_heapify                                      collect_c_pq_heapify
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#pragma once
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,63 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    collect-c/terse/skiplist.h
+ *
+ * Purpose: Ordered skip-list container terse api.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/skiplist.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * terse-form macros
+ */
+
+#define CLC_SL_define_empty                                 COLLECT_C_SKIPLIST_define_empty
+#define CLC_SL_define_empty_with_cb                         COLLECT_C_SKIPLIST_define_empty_with_callback
+#define CLC_SL_define_empty_with_allocator                  COLLECT_C_SKIPLIST_define_empty_with_allocator
+
+#define CLC_SL_is_empty                                     COLLECT_C_SKIPLIST_is_empty
+#define CLC_SL_len                                          COLLECT_C_SKIPLIST_len
+
+#define CLC_SL_first_node                                   COLLECT_C_SKIPLIST_first_node
+#define CLC_SL_last_node                                    COLLECT_C_SKIPLIST_last_node
+#define CLC_SL_cfront_t                                     COLLECT_C_SKIPLIST_cfront_t
+#define CLC_SL_cback_t                                      COLLECT_C_SKIPLIST_cback_t
+
+#define CLC_SL_node_data_v                                  COLLECT_C_SKIPLIST_node_data_v
+#define CLC_SL_node_cdata_v                                 COLLECT_C_SKIPLIST_node_cdata_v
+#define CLC_SL_node_cdata_t                                 COLLECT_C_SKIPLIST_node_cdata_t
+
+#define CLC_SL_clear                                        COLLECT_C_SKIPLIST_clear
+#define CLC_SL_erase_node                                   COLLECT_C_SKIPLIST_erase_node
+#define CLC_SL_insert_by_ref                                COLLECT_C_SKIPLIST_insert_by_ref
+#define CLC_SL_insert_by_value                              COLLECT_C_SKIPLIST_insert_by_value
+
+
+#define clc_sl_free_storage                                 collect_c_skiplist_free_storage
+#define clc_sl_clear                                        collect_c_skiplist_clear
+#define clc_sl_erase_node                                   collect_c_skiplist_erase_node
+#define clc_sl_erase_by_key                                 collect_c_skiplist_erase_by_key
+#define clc_sl_find_node                                    collect_c_skiplist_find_node
+#define clc_sl_lower_bound                                  collect_c_skiplist_lower_bound
+#define clc_sl_upper_bound                                  collect_c_skiplist_upper_bound
+#define clc_sl_range                                        collect_c_skiplist_range
+#define clc_sl_insert_by_ref                                collect_c_skiplist_insert_by_ref
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#pragma once
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,73 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    collect-c/terse/ulist.h
+ *
+ * Purpose: Unrolled linked list container terse api.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/ulist.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * terse-form macros
+ */
+
+#define CLC_UL_define_empty                                 COLLECT_C_ULIST_define_empty
+#define CLC_UL_define_empty_with_cb                         COLLECT_C_ULIST_define_empty_with_callback
+#define CLC_UL_define_empty_with_allocator                  COLLECT_C_ULIST_define_empty_with_allocator
+
+#define CLC_UL_is_empty                                     COLLECT_C_ULIST_is_empty
+#define CLC_UL_len                                          COLLECT_C_ULIST_len
+#define CLC_UL_num_nodes                                    COLLECT_C_ULIST_num_nodes
+
+#define CLC_UL_at_v                                         COLLECT_C_ULIST_at_v
+#define CLC_UL_at_t                                         COLLECT_C_ULIST_at_t
+#define CLC_UL_cat_t                                        COLLECT_C_ULIST_cat_t
+#define CLC_UL_front_v                                      COLLECT_C_ULIST_front_v
+#define CLC_UL_back_v                                       COLLECT_C_ULIST_back_v
+#define CLC_UL_cfront_t                                     COLLECT_C_ULIST_cfront_t
+#define CLC_UL_cback_t                                      COLLECT_C_ULIST_cback_t
+
+#define CLC_UL_node_el_v                                    COLLECT_C_ULIST_node_el_v
+#define CLC_UL_node_cel_v                                   COLLECT_C_ULIST_node_cel_v
+
+#define CLC_UL_clear                                        COLLECT_C_ULIST_clear
+#define CLC_UL_erase_at                                     COLLECT_C_ULIST_erase_at
+#define CLC_UL_insert_at                                    COLLECT_C_ULIST_insert_at
+#define CLC_UL_pop_back                                     COLLECT_C_ULIST_pop_back
+#define CLC_UL_pop_front                                    COLLECT_C_ULIST_pop_front
+#define CLC_UL_push_back_by_ref                             COLLECT_C_ULIST_push_back_by_ref
+#define CLC_UL_push_back_by_value                           COLLECT_C_ULIST_push_back_by_value
+#define CLC_UL_push_front_by_ref                            COLLECT_C_ULIST_push_front_by_ref
+#define CLC_UL_push_front_by_value                          COLLECT_C_ULIST_push_front_by_value
+
+
+#define clc_ul_free_storage                                 collect_c_ulist_free_storage
+#define clc_ul_clear                                        collect_c_ulist_clear
+#define clc_ul_at                                           collect_c_ulist_at
+#define clc_ul_erase_at                                     collect_c_ulist_erase_at
+#define clc_ul_find                                         collect_c_ulist_find
+#define clc_ul_rfind                                        collect_c_ulist_rfind
+#define clc_ul_insert_at                                    collect_c_ulist_insert_at
+#define clc_ul_push_back_by_ref                             collect_c_ulist_push_back_by_ref
+#define clc_ul_push_front_by_ref                            collect_c_ulist_push_front_by_ref
+#define clc_ul_pop_from_back_n                              collect_c_ulist_pop_from_back_n
+#define clc_ul_pop_from_front_n                             collect_c_ulist_pop_from_front_n
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#pragma once
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
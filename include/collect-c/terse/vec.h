@@ -4,7 +4,7 @@
  * Purpose: Vector container terse api.
  *
  * Created: 5th February 2025
- * Updated: 11th February 2025
+ * Updated: 18th October 2026
  *
  * ////////////////////////////////////////////////////////////////////// */
 
@@ -22,22 +22,41 @@
 
 #define CLC_V_F_USE_STACK_ARRAY                             COLLECT_C_VEC_F_USE_STACK_ARRAY
 #define CLC_V_F_NO_BOO                                      COLLECT_C_VEC_F_NO_BOO
+#define CLC_V_F_VM_STORAGE                                  COLLECT_C_VEC_F_VM_STORAGE
+#define CLC_V_F_USE_HUGE_PAGES                              COLLECT_C_VEC_F_USE_HUGE_PAGES
+#define CLC_V_F_SPILL_TO_HEAP                               COLLECT_C_VEC_F_SPILL_TO_HEAP
 
 
 #define CLC_V_define_empty                                  COLLECT_C_VEC_define_empty
 #define CLC_V_define_empty_with_cb                          COLLECT_C_VEC_define_empty_with_callback
+#define CLC_V_define_empty_with_allocator                   COLLECT_C_VEC_define_empty_with_allocator
 #define CLC_V_define_on_stack                               COLLECT_C_VEC_define_on_stack
+#define CLC_V_define_on_stack_with_spill                    COLLECT_C_VEC_define_on_stack_with_spill
 
 #define CLC_V_clear                                         COLLECT_C_VEC_clear
 
+#define CLC_V_erase_range                                   COLLECT_C_VEC_erase_range
+
+#define CLC_V_insert_n_by_ref                               COLLECT_C_VEC_insert_n_by_ref
+
+#define CLC_V_pop_back                                      COLLECT_C_VEC_pop_back
+#define CLC_V_pop_front                                     COLLECT_C_VEC_pop_front
+
 #define CLC_V_push_back_by_ref                              COLLECT_C_VEC_push_back_by_ref
 #define CLC_V_push_back_by_value                            COLLECT_C_VEC_push_back_by_value
 
 #define CLC_V_push_front_by_ref                             COLLECT_C_VEC_push_front_by_ref
 #define CLC_V_push_front_by_value                           COLLECT_C_VEC_push_front_by_value
 
+#define CLC_V_reserve                                       COLLECT_C_VEC_reserve
+
 #define CLC_V_shrink_to_fit                                 COLLECT_C_VEC_shrink_to_fit
 
+#define CLC_V_sort                                          COLLECT_C_VEC_sort
+#define CLC_V_radix_sort_by_member                          COLLECT_C_VEC_radix_sort_by_member
+
+#define CLC_V_truncate                                      COLLECT_C_VEC_truncate
+
 #define CLC_V_is_empty                                      COLLECT_C_VEC_is_empty
 #define CLC_V_len                                           COLLECT_C_VEC_len
 #define CLC_V_spare                                         COLLECT_C_VEC_spare
@@ -56,6 +75,12 @@
 #define CLC_V_cfront_t                                      COLLECT_C_VEC_cfront_t
 #define CLC_V_cback_t                                       COLLECT_C_VEC_cback_t
 
+#define CLC_V_contains_by_ref                               COLLECT_C_VEC_contains_by_ref
+#define CLC_V_contains_by_value                             COLLECT_C_VEC_contains_by_value
+#define CLC_V_count_by_ref                                  COLLECT_C_VEC_count_by_ref
+#define CLC_V_count_by_value                                COLLECT_C_VEC_count_by_value
+#define CLC_V_find_by_value                                 COLLECT_C_VEC_find_by_value
+
 #define CLC_V_begin_v                                       COLLECT_C_VEC_begin_v
 #define CLC_V_end_v                                         COLLECT_C_VEC_end_v
 
@@ -0,0 +1,524 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    collect-c/ulist.h
+ *
+ * Purpose: Unrolled linked list container.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#ifdef __cplusplus
+# ifndef COLLECT_C_ULIST_SUPPRESS_CXX_WARNING
+#  error This file not currently compatible with C++ compilation
+# endif
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * version
+ */
+
+#define COLLECT_C_ULIST_VER_MAJOR       0
+#define COLLECT_C_ULIST_VER_MINOR       1
+#define COLLECT_C_ULIST_VER_PATCH       0
+#define COLLECT_C_ULIST_VER_ALPHABETA   41
+
+#define COLLECT_C_ULIST_VER \
+    (0\
+        |   (   COLLECT_C_ULIST_VER_MAJOR       << 24   ) \
+        |   (   COLLECT_C_ULIST_VER_MINOR       << 16   ) \
+        |   (   COLLECT_C_ULIST_VER_PATCH       <<  8   ) \
+        |   (   COLLECT_C_ULIST_VER_ALPHABETA   <<  0   ) \
+    )
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/common.h>
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API constants
+ */
+
+/** The default size, in bytes, of a node, including its header. Chosen to
+ * span a small number of cache lines.
+ */
+#ifndef COLLECT_C_ULIST_DEFAULT_NODE_SIZE
+# define COLLECT_C_ULIST_DEFAULT_NODE_SIZE                  (256)
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API types
+ */
+
+typedef union
+{
+    char            data[1];
+    int             _i;
+    long            _l;
+    long long       _ll;
+    double          _d;
+    long double     _ld;
+    void*           _pv;
+} collect_c_ulist_node_data_t;
+
+struct collect_c_ulist_node_t;
+#ifndef __cplusplus
+typedef struct collect_c_ulist_node_t   collect_c_ulist_node_t;
+#endif
+
+struct collect_c_ulist_node_t
+{
+    collect_c_ulist_node_t*     prev;
+    collect_c_ulist_node_t*     next;
+    size_t                      num_els;
+    collect_c_ulist_node_data_t data[1];
+};
+
+/** Callback function that, if attached to instance, will be called back for
+ * each element upon its erasure or replacement by any of the API functions.
+ */
+typedef void (*collect_c_ulist_pfn_free)(
+    size_t  el_size
+,   size_t  el_index
+,   void*   el_ptr
+,   void*   param_element_free
+);
+
+/** Represents an unrolled linked list.
+ *
+ * @note Each node holds up to node_capacity contiguous elements, so that
+ *  traversal and search touch far fewer cache lines, and far fewer
+ *  allocations are made, than with collect_c_dlist_t. Appending to either
+ *  end fills the end node before a new one is created; inserting into a
+ *  full node splits it; erasing from a sparse node merges it with a
+ *  neighbour where possible.
+ */
+struct collect_c_ulist_t
+{
+    size_t                      el_size;            /*! The element size. */
+    size_t                      node_capacity;      /*! The number of elements per node. */
+    size_t                      size;               /*! The number of elements. */
+    size_t                      num_nodes;          /*! The number of nodes. */
+    int32_t                     flags;              /*! Control flags. */
+    int32_t                     reserved0;          /*! Reserved field. */
+    collect_c_ulist_node_t*     head;               /*! */
+    collect_c_ulist_node_t*     tail;               /*! */
+    collect_c_ulist_node_t*     spare;              /*! A single cached empty node. */
+    struct collect_c_allocator_t const*
+                                allocator;          /*! Optional allocator, from which nodes are obtained. If NULL, malloc()/free() are used. */
+    void*                       param_element_free; /*! Custom parameter to be passed to invocations of pfn_element_free. */
+    collect_c_ulist_pfn_free    pfn_element_free;   /*! Custom function to be invoked when element erased/replaced. */
+};
+#ifndef __cplusplus
+typedef struct collect_c_ulist_t        collect_c_ulist_t;
+#endif
+
+/** Callback function that performs comparison between elements for the
+ * purpose of search.
+ *
+ * @param ul Pointer to the list. Will not be NULL;
+ * @param p_lhs Pointer to the lhs element. Will not be NULL;
+ * @param p_rhs Pointer to the lhs element. Will not be NULL;
+ *
+ * @retval <0 The element referred to by p_lhs is "less than" the element
+ *  referred to by p_rhs;
+ * @retval 0 A matching element is found;
+ * @retval >0 The element referred to by p_lhs is "greater than" the element
+ *  referred to by p_rhs;
+ *
+ * @note No modifications to ul are permitted.
+ */
+typedef int (*collect_c_ulist_pfn_compare_t)(
+    collect_c_ulist_t const*    ul
+,   void const*                 p_lhs
+,   void const*                 p_rhs
+);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions & macros (internal)
+ */
+
+#define COLLECT_C_ULIST_get_l_ptr_(ul)                      _Generic((ul),  \
+                                                                            \
+                             collect_c_ulist_t* :  (ul),                    \
+                       collect_c_ulist_t const* :  (ul),                    \
+                                        default : &(ul)                     \
+)
+
+#define COLLECT_C_ULIST_node_capacity_(el_size)             ((COLLECT_C_ULIST_DEFAULT_NODE_SIZE - offsetof(collect_c_ulist_node_t, data)) < (el_size) ? 1 : (COLLECT_C_ULIST_DEFAULT_NODE_SIZE - offsetof(collect_c_ulist_node_t, data)) / (el_size))
+
+#define COLLECT_C_ULIST_assert_el_size_(ul_name, t_el)      assert(sizeof(t_el) == COLLECT_C_ULIST_get_l_ptr_(ul_name)->el_size)
+#define COLLECT_C_ULIST_assert_ix_(ul_name, ix)             assert((ix) < COLLECT_C_ULIST_get_l_ptr_(ul_name)->size)
+#define COLLECT_C_ULIST_assert_not_empty_(ul_name)          assert(0 != COLLECT_C_ULIST_get_l_ptr_(ul_name)->size)
+
+#define COLLECT_C_ULIST_clear_1_(ul_name)                   collect_c_ulist_clear(COLLECT_C_ULIST_get_l_ptr_(ul_name), NULL, NULL, NULL)
+#define COLLECT_C_ULIST_clear_2_(ul_name, p)                collect_c_ulist_clear(COLLECT_C_ULIST_get_l_ptr_(ul_name), NULL, NULL,  (p))
+
+#define COLLECT_C_ULIST_node_el_v_(ul_name, n, ix)          ((void      *)(&(n)->data[0].data[0] + ((ix) * COLLECT_C_ULIST_get_l_ptr_(ul_name)->el_size)))
+#define COLLECT_C_ULIST_node_cel_v_(ul_name, n, ix)         ((void const*)(&(n)->data[0].data[0] + ((ix) * COLLECT_C_ULIST_get_l_ptr_(ul_name)->el_size)))
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions & macros
+ */
+
+/** @def COLLECT_C_ULIST_define_empty(el_type, ul_name)
+ *
+ * Declares and defines an empty list instance.
+ *
+ * @param el_type The type of the elements to be stored;
+ * @param ul_name The name of the instance;
+ */
+#define COLLECT_C_ULIST_define_empty(el_type, ul_name)                      \
+                                                                            \
+    collect_c_ulist_t ul_name = COLLECT_C_ULIST_EMPTY_INITIALIZER_(el_type, 0, NULL, NULL)
+
+
+/** @def COLLECT_C_ULIST_define_empty_with_callback(el_type, ul_name, elf_fn, elf_param)
+ *
+ * Declares and defines an empty list instance.
+ *
+ * @param el_type The type of the elements to be stored;
+ * @param ul_name The name of the instance;
+ * @param elf_fn Callback function to be invoked when element is
+ *  erased/removed/overwritten;
+ * @param elf_param Parameter to be given to the callback function;
+ */
+#define COLLECT_C_ULIST_define_empty_with_callback(el_type, ul_name, elf_fn, elf_param)    \
+                                                                                            \
+    collect_c_ulist_t ul_name = COLLECT_C_ULIST_EMPTY_INITIALIZER_(el_type, 0, elf_fn, elf_param)
+
+
+/** @def COLLECT_C_ULIST_define_empty_with_allocator(el_type, ul_name, alloc)
+ *
+ * Declares and defines an empty list instance whose nodes are to be
+ * obtained from the given allocator.
+ *
+ * @param el_type The type of the elements to be stored;
+ * @param ul_name The name of the instance;
+ * @param alloc Pointer to the allocator (collect_c_allocator_t), which
+ *  must outlive the instance's nodes;
+ */
+#define COLLECT_C_ULIST_define_empty_with_allocator(el_type, ul_name, alloc)    \
+                                                                                \
+    collect_c_ulist_t ul_name = COLLECT_C_ULIST_EMPTY_INITIALIZER_WITH_ALLOCATOR_(el_type, 0, (alloc), NULL, NULL)
+
+
+/* modifiers */
+
+#define COLLECT_C_ULIST_clear(...)                          COLLECT_C_UTIL_GET_MACRO_1_or_2_(__VA_ARGS__, COLLECT_C_ULIST_clear_2_, COLLECT_C_ULIST_clear_1_, NULL)(__VA_ARGS__)
+
+#define COLLECT_C_ULIST_push_back_by_ref(ul_name, ptr_new_el)   collect_c_ulist_push_back_by_ref(COLLECT_C_ULIST_get_l_ptr_(ul_name), (ptr_new_el))
+#define COLLECT_C_ULIST_push_back_by_value(ul_name, t_el, new_el)   \
+                                                            (COLLECT_C_ULIST_assert_el_size_(ul_name, t_el), collect_c_ulist_push_back_by_ref(COLLECT_C_ULIST_get_l_ptr_(ul_name), &((t_el){(new_el)})))
+
+#define COLLECT_C_ULIST_push_front_by_ref(ul_name, ptr_new_el)  collect_c_ulist_push_front_by_ref(COLLECT_C_ULIST_get_l_ptr_(ul_name), (ptr_new_el))
+#define COLLECT_C_ULIST_push_front_by_value(ul_name, t_el, new_el)  \
+                                                            (COLLECT_C_ULIST_assert_el_size_(ul_name, t_el), collect_c_ulist_push_front_by_ref(COLLECT_C_ULIST_get_l_ptr_(ul_name), &((t_el){(new_el)})))
+
+#define COLLECT_C_ULIST_insert_at(ul_name, ix, ptr_new_el)  collect_c_ulist_insert_at(COLLECT_C_ULIST_get_l_ptr_(ul_name), (ix), (ptr_new_el))
+#define COLLECT_C_ULIST_erase_at(ul_name, ix)               collect_c_ulist_erase_at(COLLECT_C_ULIST_get_l_ptr_(ul_name), (ix))
+
+#define COLLECT_C_ULIST_pop_back(ul_name)                   collect_c_ulist_pop_from_back_n(COLLECT_C_ULIST_get_l_ptr_(ul_name), 1, NULL)
+#define COLLECT_C_ULIST_pop_front(ul_name)                  collect_c_ulist_pop_from_front_n(COLLECT_C_ULIST_get_l_ptr_(ul_name), 1, NULL)
+
+/* attributes */
+
+#define COLLECT_C_ULIST_is_empty(ul_name)                   (0 == COLLECT_C_ULIST_get_l_ptr_(ul_name)->size     )
+#define COLLECT_C_ULIST_len(ul_name)                        (     COLLECT_C_ULIST_get_l_ptr_(ul_name)->size     )
+#define COLLECT_C_ULIST_num_nodes(ul_name)                  (     COLLECT_C_ULIST_get_l_ptr_(ul_name)->num_nodes)
+
+/* accessors */
+
+#define COLLECT_C_ULIST_at_v(ul_name, ix)                   (COLLECT_C_ULIST_assert_ix_(ul_name, ix), collect_c_ulist_at(COLLECT_C_ULIST_get_l_ptr_(ul_name), (ix)))
+#define COLLECT_C_ULIST_at_t(ul_name, t_el, ix)             ((t_el      *)(COLLECT_C_ULIST_assert_el_size_(ul_name, t_el), COLLECT_C_ULIST_at_v(ul_name, ix)))
+#define COLLECT_C_ULIST_cat_t(ul_name, t_el, ix)            ((t_el const*)(COLLECT_C_ULIST_assert_el_size_(ul_name, t_el), COLLECT_C_ULIST_at_v(ul_name, ix)))
+
+#define COLLECT_C_ULIST_front_v(ul_name)                    (COLLECT_C_ULIST_assert_not_empty_(ul_name),  COLLECT_C_ULIST_node_el_v_(ul_name, COLLECT_C_ULIST_get_l_ptr_(ul_name)->head, 0))
+#define COLLECT_C_ULIST_back_v(ul_name)                     (COLLECT_C_ULIST_assert_not_empty_(ul_name),  COLLECT_C_ULIST_node_el_v_(ul_name, COLLECT_C_ULIST_get_l_ptr_(ul_name)->tail, COLLECT_C_ULIST_get_l_ptr_(ul_name)->tail->num_els - 1))
+
+#define COLLECT_C_ULIST_cfront_t(ul_name, t_el)             ((t_el const*)(COLLECT_C_ULIST_assert_el_size_(ul_name, t_el), COLLECT_C_ULIST_front_v(ul_name)))
+#define COLLECT_C_ULIST_cback_t(ul_name, t_el)              ((t_el const*)(COLLECT_C_ULIST_assert_el_size_(ul_name, t_el),  COLLECT_C_ULIST_back_v(ul_name)))
+
+/* iteration */
+
+#define COLLECT_C_ULIST_node_el_v(ul_name, n, ix)           (assert((ix) < (n)->num_els),  COLLECT_C_ULIST_node_el_v_(ul_name, n, ix))
+#define COLLECT_C_ULIST_node_cel_v(ul_name, n, ix)          (assert((ix) < (n)->num_els), COLLECT_C_ULIST_node_cel_v_(ul_name, n, ix))
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Obtains the value of COLLECT_C_ULIST_VER at the time of compilation of
+ * the library.
+ */
+uint32_t
+collect_c_ulist_version(void);
+
+/** Frees storage associated with the instance, invoking the element-free
+ * callback (if any) for each element.
+ *
+ * @param ul Pointer to the list. May not be NULL;
+ *
+ * @pre (NULL != ul)
+ */
+void
+collect_c_ulist_free_storage(
+    collect_c_ulist_t*  ul
+);
+
+/** Clears all elements from the list, invoking the element-free callback
+ * (if any) for each element.
+ *
+ * @param ul Pointer to the list. May not be NULL;
+ * @param reserved0 Reserved. Must be 0;
+ * @param reserved1 Reserved. Must be 0;
+ * @param num_dropped Optional pointer to variable to retrieve number of
+ *  entries dropped;
+ *
+ * @pre (NULL != ul)
+ * @pre (0 == reserved0)
+ * @pre (0 == reserved1)
+ */
+int
+collect_c_ulist_clear(
+    collect_c_ulist_t*  ul
+,   void*               reserved0
+,   void*               reserved1
+,   size_t*             num_dropped
+);
+
+/** Obtains a pointer to the element at the given index.
+ *
+ * @param ul Pointer to the list. May not be NULL;
+ * @param index Index of the element. Must be less than the list's size;
+ *
+ * @note This is O(n / node_capacity), traversing from whichever end is
+ *  nearer.
+ *
+ * @pre (NULL != ul)
+ * @pre (index < ul->size)
+ */
+void*
+collect_c_ulist_at(
+    collect_c_ulist_t const*    ul
+,   size_t                      index
+);
+
+/** Erases the element at the given index.
+ *
+ * @param ul Pointer to the list. May not be NULL;
+ * @param index Index of the element. Must be less than the list's size;
+ *
+ * @pre (NULL != ul)
+ * @pre (index < ul->size)
+ */
+int
+collect_c_ulist_erase_at(
+    collect_c_ulist_t*  ul
+,   size_t              index
+);
+
+/** Performs a forward search of the list for an element matching the
+ * search criteria.
+ *
+ * @param ul Pointer to the list. May not be NULL;
+ * @param pfn Comparison function that will be used to identify an
+ *  element. May not be NULL;
+ * @param p_lhs Caller-supplied parameter to be passed back to pfn as its
+ *  lhs. May not be NULL;
+ * @param skip_count Number of matched elements to ignore before an element
+ *  is designated as being found;
+ * @param index Pointer to a variable to receive the index of the found
+ *  element. May not be NULL;
+ * @param el_ptr Optional pointer to a variable to receive a pointer to the
+ *  found element;
+ * @param num_searched Optional pointer to obtain the number of elements
+ *  traversed in the search including, if found, the matching element;
+ *
+ * @retval 0 An element was found matching the given criteria;
+ * @retval ENOENT No element was found matching the given criteria;
+ */
+int
+collect_c_ulist_find(
+    collect_c_ulist_t const*        ul
+,   collect_c_ulist_pfn_compare_t   pfn
+,   void const*                     p_lhs
+,   size_t                          skip_count
+,   size_t*                         index
+,   void**                          el_ptr
+,   size_t*                         num_searched
+);
+
+/** Performs a reverse search of the list for an element matching the
+ * search criteria.
+ *
+ * @param ul Pointer to the list. May not be NULL;
+ * @param pfn Comparison function that will be used to identify an
+ *  element. May not be NULL;
+ * @param p_lhs Caller-supplied parameter to be passed back to pfn as its
+ *  lhs. May not be NULL;
+ * @param skip_count Number of matched elements to ignore before an element
+ *  is designated as being found;
+ * @param index Pointer to a variable to receive the index of the found
+ *  element. May not be NULL;
+ * @param el_ptr Optional pointer to a variable to receive a pointer to the
+ *  found element;
+ * @param num_searched Optional pointer to obtain the number of elements
+ *  traversed in the search including, if found, the matching element;
+ *
+ * @retval 0 An element was found matching the given criteria;
+ * @retval ENOENT No element was found matching the given criteria;
+ */
+int
+collect_c_ulist_rfind(
+    collect_c_ulist_t const*        ul
+,   collect_c_ulist_pfn_compare_t   pfn
+,   void const*                     p_lhs
+,   size_t                          skip_count
+,   size_t*                         index
+,   void**                          el_ptr
+,   size_t*                         num_searched
+);
+
+/** Inserts a new element into the list at the given index.
+ *
+ * @param ul Pointer to the list. May not be NULL;
+ * @param index Index at which the new element is to be inserted. Must not
+ *  be greater than the list's size;
+ * @param ptr_new_el Pointer to the new element. May not be NULL;
+ *
+ * @retval 0 The element was inserted;
+ * @retval ENOMEM Sufficient memory not available;
+ *
+ * @pre (NULL != ul)
+ * @pre (index <= ul->size)
+ * @pre (NULL != ptr_new_el)
+ */
+int
+collect_c_ulist_insert_at(
+    collect_c_ulist_t*  ul
+,   size_t              index
+,   void const*         ptr_new_el
+);
+
+/** Attempts to add an item to the back of the list.
+ *
+ * @param ul Pointer to the list. May not be NULL;
+ * @param ptr_new_el Pointer to the new element. May not be NULL;
+ *
+ * @pre (NULL != ul)
+ * @pre (NULL != ptr_new_el)
+ */
+int
+collect_c_ulist_push_back_by_ref(
+    collect_c_ulist_t*  ul
+,   void const*         ptr_new_el
+);
+
+/** Attempts to add an item to the front of the list.
+ *
+ * @param ul Pointer to the list. May not be NULL;
+ * @param ptr_new_el Pointer to the new element. May not be NULL;
+ *
+ * @pre (NULL != ul)
+ * @pre (NULL != ptr_new_el)
+ */
+int
+collect_c_ulist_push_front_by_ref(
+    collect_c_ulist_t*  ul
+,   void const*         ptr_new_el
+);
+
+/** Attempts to drop a number of elements from the back of the list.
+ *
+ * @param ul Pointer to the list. May not be NULL;
+ * @param num_to_drop Maximum number of elements to drop;
+ * @param num_dropped Optional pointer to variable to retrieve number of
+ *  entries dropped;
+ *
+ * @pre (NULL != ul)
+ */
+int
+collect_c_ulist_pop_from_back_n(
+    collect_c_ulist_t*  ul
+,   size_t              num_to_drop
+,   size_t*             num_dropped
+);
+
+/** Attempts to drop a number of elements from the front of the list.
+ *
+ * @param ul Pointer to the list. May not be NULL;
+ * @param num_to_drop Maximum number of elements to drop;
+ * @param num_dropped Optional pointer to variable to retrieve number of
+ *  entries dropped;
+ *
+ * @pre (NULL != ul)
+ */
+int
+collect_c_ulist_pop_from_front_n(
+    collect_c_ulist_t*  ul
+,   size_t              num_to_drop
+,   size_t*             num_dropped
+);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper macros
+ */
+
+#define COLLECT_C_ULIST_EMPTY_INITIALIZER_WITH_ALLOCATOR_(el_type, ul_flags, ul_alloc, elf_fn, elf_param) \
+                                                                            \
+    {                                                                       \
+        .el_size = sizeof(el_type),                                         \
+        .node_capacity = COLLECT_C_ULIST_node_capacity_(sizeof(el_type)),   \
+        .size = 0,                                                          \
+        .num_nodes = 0,                                                     \
+        .flags = (ul_flags),                                                \
+        .reserved0 = 0,                                                     \
+        .head = NULL,                                                       \
+        .tail = NULL,                                                       \
+        .spare = NULL,                                                      \
+        .allocator = (ul_alloc),                                            \
+        .param_element_free = (elf_param),                                  \
+        .pfn_element_free = (elf_fn),                                       \
+    }
+
+#define COLLECT_C_ULIST_EMPTY_INITIALIZER_(el_type, ul_flags, elf_fn, elf_param) \
+                                                                            \
+    COLLECT_C_ULIST_EMPTY_INITIALIZER_WITH_ALLOCATOR_(el_type, ul_flags, NULL, elf_fn, elf_param)
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#pragma once
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
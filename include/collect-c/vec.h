@@ -4,7 +4,7 @@
  * Purpose: Vector container.
  *
  * Created: 5th February 2025
- * Updated: 11th February 2025
+ * Updated: 18th October 2026
  *
  * ////////////////////////////////////////////////////////////////////// */
 
@@ -63,6 +63,36 @@
 /** Prevents the use of base-offset optimisation. */
 #define COLLECT_C_VEC_F_NO_BOO                              (0x00000002)
 
+/** Set by the implementation - never by the user - to indicate that the
+ * storage has been obtained from the virtual memory layer, rather than from
+ * the heap.
+ */
+#define COLLECT_C_VEC_F_VM_STORAGE                          (0x00000004)
+
+/** Causes storage of at least 2MB to be obtained from the virtual memory
+ * layer (on platforms that support it), aligned to 2MB and advised to be
+ * backed by transparent huge pages, including after growth. Must not be
+ * changed once storage has been allocated.
+ */
+#define COLLECT_C_VEC_F_USE_HUGE_PAGES                      (0x00000008)
+
+/** Used with COLLECT_C_VEC_F_USE_STACK_ARRAY, causes an insertion that
+ * would exceed the capacity of the array to move the elements to heap
+ * storage - thereafter managed as if it had been obtained via
+ * collect_c_vec_allocate_storage(), including base-offset optimisation
+ * unless COLLECT_C_VEC_F_NO_BOO is specified - rather than failing with
+ * ENOSPC. Upon the move, COLLECT_C_VEC_F_USE_STACK_ARRAY is cleared.
+ */
+#define COLLECT_C_VEC_F_SPILL_TO_HEAP                       (0x00000010)
+
+/** The storage size, in bytes, at and above which the default growth
+ * policy causes storage to be obtained from the virtual memory layer (on
+ * platforms that support it).
+ */
+#ifndef COLLECT_C_VEC_DEFAULT_VM_THRESHOLD
+# define COLLECT_C_VEC_DEFAULT_VM_THRESHOLD                 (32 * 1024 * 1024)
+#endif
+
 
 /* /////////////////////////////////////////////////////////////////////////
  * API types
@@ -78,6 +108,55 @@ typedef void (*collect_c_vec_pfn_free)(
 ,   void*   param_element_free
 );
 
+struct collect_c_vec_t;
+
+/** Callback function that compares elements, for sorting.
+ *
+ * @param v Pointer to the vector. Will not be NULL;
+ * @param p_lhs Pointer to the lhs element. Will not be NULL;
+ * @param p_rhs Pointer to the rhs element. Will not be NULL;
+ *
+ * @return A value that is less than 0 if the lhs element is ordered before
+ *  the rhs element, greater than 0 if after, and 0 if they are equivalent.
+ */
+typedef int (*collect_c_vec_pfn_compare)(
+    struct collect_c_vec_t const*   v
+,   void const*                     p_lhs
+,   void const*                     p_rhs
+);
+
+/** Growth policy that may be associated with a vector instance, via its
+ * growth_policy member, to control how its storage is enlarged when an
+ * insertion requires more capacity.
+ *
+ * The new capacity is the greatest of: the current capacity multiplied by
+ * factor_numerator / factor_denominator; the current capacity plus
+ * min_step; and the capacity required by the insertion. With base-offset
+ * optimisation, a further (new capacity / front_divisor) is reserved at
+ * the front (none if front_divisor is 0). If round_to_bytes is non-0 the
+ * allocation size is rounded up to a multiple of it (e.g. the page size),
+ * with the extra being available at the back.
+ *
+ * If vm_threshold is non-0 and the growth is to a storage size (in bytes)
+ * at or above it then, on platforms that support it (currently Linux), the
+ * storage is moved to page-aligned anonymous memory that is thereafter
+ * grown by remapping pages rather than copying, and growth caused by
+ * pushing to the back retains the current front-spare rather than
+ * re-centring (which would move every element).
+ */
+struct collect_c_vec_growth_policy_t
+{
+    size_t  factor_numerator;   /*! Numerator of the growth factor. */
+    size_t  factor_denominator; /*! Denominator of the growth factor. Must not be 0. */
+    size_t  min_step;           /*! Minimum number of elements by which capacity grows. Must not be 0. */
+    size_t  round_to_bytes;     /*! If non-0, the allocation size is rounded up to a multiple of this. */
+    size_t  front_divisor;      /*! With BOO, divisor of new capacity that determines the front-spare. 0 means none. */
+    size_t  vm_threshold;       /*! Storage size at and above which virtual memory storage is used. 0 means never. */
+};
+#ifndef __cplusplus
+typedef struct collect_c_vec_growth_policy_t    collect_c_vec_growth_policy_t;
+#endif
+
 /** Represents a classic vector container.
  *
  * @note This type supports what we refer to as "base-offset optimisation",
@@ -101,6 +180,10 @@ struct collect_c_vec_t
     int32_t                 flags;              /*! Control flags. */
     int32_t                 reserved0;          /*! Reserved field. */
     void*                   storage;            /*! Pointer to the storage. */
+    struct collect_c_vec_growth_policy_t const*
+                            growth_policy;      /*! Optional growth policy. If NULL, the default (1.5x, with a quarter at the front with BOO) is used. */
+    struct collect_c_allocator_t const*
+                            allocator;          /*! Optional allocator. If NULL, malloc()/realloc()/free() are used. */
     void*                   param_element_free; /*! Custom parameter to be passed to invocations of pfn_element_free. */
     collect_c_vec_pfn_free  pfn_element_free;   /*! Custom function to be invoked when element erased/replaced. */
 };
@@ -152,7 +235,7 @@ typedef struct collect_c_vec_t  collect_c_vec_t;
  */
 #define COLLECT_C_VEC_define_empty(el_type, v_name)         \
                                                             \
-    collect_c_vec_t v_name = { .el_size = sizeof(el_type), }
+    collect_c_vec_t v_name = COLLECT_C_VEC_EMPTY_INITIALIZER_(el_type, 0, 0, NULL, NULL, NULL)
 
 
 /** @def COLLECT_C_VEC_define_empty_with_callback(el_type, v_name, elf_fn, elf_param)
@@ -168,7 +251,26 @@ typedef struct collect_c_vec_t  collect_c_vec_t;
  */
 #define COLLECT_C_VEC_define_empty_with_callback(el_type, v_name, elf_fn, elf_param)    \
                                                                                         \
-                                                            collect_c_vec_t v_name = { .el_size = sizeof(el_type), .pfn_element_free = elf_fn, .param_element_free = elf_param, }
+    collect_c_vec_t v_name = COLLECT_C_VEC_EMPTY_INITIALIZER_(el_type, 0, 0, NULL, elf_fn, elf_param)
+
+
+/** @def COLLECT_C_VEC_define_empty_with_allocator(el_type, v_name, alloc)
+ *
+ * Declares and defines an empty vector instance whose storage is to be
+ * obtained from the given allocator. The instance will need to be further
+ * set-up via collect_c_vec_allocate_storage().
+ *
+ * @param el_type The type of the elements to be stored;
+ * @param v_name The name of the instance;
+ * @param alloc Pointer to the allocator (collect_c_allocator_t), which
+ *  must outlive the instance's storage;
+ *
+ * @note Storage is not obtained from the virtual memory layer (see
+ *  collect_c_vec_growth_policy_t) for an instance with an allocator.
+ */
+#define COLLECT_C_VEC_define_empty_with_allocator(el_type, v_name, alloc)   \
+                                                                            \
+    collect_c_vec_t v_name = COLLECT_C_VEC_EMPTY_INITIALIZER_WITH_ALLOCATOR_(el_type, 0, 0, NULL, (alloc), NULL, NULL)
 
 
 /** @def COLLECT_C_VEC_define_on_stack(v_name, ar_name)
@@ -185,10 +287,35 @@ typedef struct collect_c_vec_t  collect_c_vec_t;
     collect_c_vec_t v_name = COLLECT_C_VEC_EMPTY_INITIALIZER_(((ar_name)[0]), (sizeof((ar_name)) / sizeof((ar_name)[0])), COLLECT_C_VEC_F_USE_STACK_ARRAY, &(ar_name)[0], NULL, 0)
 
 
+/** @def COLLECT_C_VEC_define_on_stack_with_spill(v_name, ar_name)
+ *
+ * Declares and defines a vector instance that uses for its memory the given
+ * array instance until that is full, whereupon the elements are moved to
+ * heap storage (see COLLECT_C_VEC_F_SPILL_TO_HEAP). Whether or not the
+ * elements have moved, collect_c_vec_free_storage() must be called.
+ *
+ * @param v_name The name of the instance;
+ * @param ar_name The name of the array instance that will serve as the
+ *  initial memory of the vector instance;
+ */
+#define COLLECT_C_VEC_define_on_stack_with_spill(v_name, ar_name)           \
+                                                                            \
+    collect_c_vec_t v_name = COLLECT_C_VEC_EMPTY_INITIALIZER_(((ar_name)[0]), (sizeof((ar_name)) / sizeof((ar_name)[0])), COLLECT_C_VEC_F_USE_STACK_ARRAY | COLLECT_C_VEC_F_SPILL_TO_HEAP, &(ar_name)[0], NULL, 0)
+
+
 /* modifiers */
 
 #define COLLECT_C_VEC_clear(...)                            COLLECT_C_UTIL_GET_MACRO_1_or_2_(__VA_ARGS__, COLLECT_C_VEC_clear_2_, COLLECT_C_VEC_clear_1_, NULL)(__VA_ARGS__)
 
+#define COLLECT_C_VEC_erase_range(v_name, ix_first, ix_last) \
+                                                            collect_c_v_erase_range(COLLECT_C_VEC_get_l_ptr_(v_name), (ix_first), (ix_last), NULL)
+
+#define COLLECT_C_VEC_insert_n_by_ref(v_name, ix, num_els, ptr_new_els) \
+                                                            collect_c_v_insert_n_by_ref(COLLECT_C_VEC_get_l_ptr_(v_name), (ix), (num_els), (ptr_new_els))
+
+#define COLLECT_C_VEC_pop_back(v_name)                      collect_c_v_pop_from_back_n(COLLECT_C_VEC_get_l_ptr_(v_name), 1, NULL)
+#define COLLECT_C_VEC_pop_front(v_name)                     collect_c_v_pop_from_front_n(COLLECT_C_VEC_get_l_ptr_(v_name), 1, NULL)
+
 #define COLLECT_C_VEC_push_back_by_ref(v_name, ptr_new_el)  collect_c_v_push_back_by_ref(COLLECT_C_VEC_get_l_ptr_(v_name), (ptr_new_el))
 #define COLLECT_C_VEC_push_back_by_value(v_name, t_el, new_el)  \
                                                                 \
@@ -197,10 +324,18 @@ typedef struct collect_c_vec_t  collect_c_vec_t;
 #define COLLECT_C_VEC_push_front_by_ref(v_name, ptr_new_el)  collect_c_v_push_front_by_ref(COLLECT_C_VEC_get_l_ptr_(v_name), (ptr_new_el))
 #define COLLECT_C_VEC_push_front_by_value(v_name, t_el, new_el) \
                                                                 \
-                                                            (COLLECT_C_VEC_assert_el_size_(v_name, t_el), collect_c_v_push_front_by_ref(COLLECT_C_VEC_get_l_ptr_(v_name)->, &((t_el){(new_el)})))
+                                                            (COLLECT_C_VEC_assert_el_size_(v_name, t_el), collect_c_v_push_front_by_ref(COLLECT_C_VEC_get_l_ptr_(v_name), &((t_el){(new_el)})))
+
+#define COLLECT_C_VEC_reserve(v_name, n, front_n)           collect_c_vec_reserve(COLLECT_C_VEC_get_l_ptr_(v_name), (n), (front_n))
 
 #define COLLECT_C_VEC_shrink_to_fit(v_name)                 collect_c_vec_shrink_to_fit(COLLECT_C_VEC_get_l_ptr_(v_name))
 
+#define COLLECT_C_VEC_sort(v_name, compare_fn)              collect_c_vec_sort(COLLECT_C_VEC_get_l_ptr_(v_name), (compare_fn))
+#define COLLECT_C_VEC_radix_sort_by_member(v_name, t_el, member)    \
+                                                            (COLLECT_C_VEC_assert_el_size_(v_name, t_el), collect_c_vec_radix_sort(COLLECT_C_VEC_get_l_ptr_(v_name), offsetof(t_el, member), sizeof(((t_el*)NULL)->member)))
+
+#define COLLECT_C_VEC_truncate(v_name, new_size)            collect_c_v_truncate(COLLECT_C_VEC_get_l_ptr_(v_name), (new_size), NULL)
+
 /* attributes */
 
 #define COLLECT_C_VEC_is_empty(v_name)                      (0 == COLLECT_C_VEC_len((v_name)))
@@ -223,6 +358,17 @@ typedef struct collect_c_vec_t  collect_c_vec_t;
 #define COLLECT_C_VEC_cfront_t(v_name, t_el)                (COLLECT_C_VEC_assert_not_empty_(v_name), COLLECT_C_VEC_cat_t(v_name, t_el,                 0))
 #define COLLECT_C_VEC_cback_t(v_name, t_el)                 (COLLECT_C_VEC_assert_not_empty_(v_name), COLLECT_C_VEC_cat_t(v_name, t_el, COLLECT_C_VEC_get_l_ptr_(v_name)->size - 1))
 
+/* search */
+
+#define COLLECT_C_VEC_contains_by_ref(v_name, p_key)        (0 == collect_c_vec_find_by_ref(COLLECT_C_VEC_get_l_ptr_(v_name), (p_key), NULL))
+#define COLLECT_C_VEC_contains_by_value(v_name, t_el, key)  (COLLECT_C_VEC_assert_el_size_(v_name, t_el), 0 == collect_c_vec_find_by_ref(COLLECT_C_VEC_get_l_ptr_(v_name), &((t_el){(key)}), NULL))
+
+#define COLLECT_C_VEC_count_by_ref(v_name, p_key)           collect_c_vec_count_by_ref(COLLECT_C_VEC_get_l_ptr_(v_name), (p_key))
+#define COLLECT_C_VEC_count_by_value(v_name, t_el, key)     (COLLECT_C_VEC_assert_el_size_(v_name, t_el), collect_c_vec_count_by_ref(COLLECT_C_VEC_get_l_ptr_(v_name), &((t_el){(key)})))
+
+#define COLLECT_C_VEC_find_by_value(v_name, t_el, key, p_index) \
+                                                            (COLLECT_C_VEC_assert_el_size_(v_name, t_el), collect_c_vec_find_by_ref(COLLECT_C_VEC_get_l_ptr_(v_name), &((t_el){(key)}), (p_index)))
+
 /* iteration */
 
 #define COLLECT_C_VEC_begin_v(v_name)                       COLLECT_C_VEC_begin_(v_name)
@@ -272,7 +418,9 @@ collect_c_vec_allocate_storage(
 );
 
 /** Frees storage associated with the instance. Must be called if the
- * instance's allocation was obtained via collect_c_vec_allocate_storage().
+ * instance's allocation was obtained via collect_c_vec_allocate_storage(),
+ * or if it was defined with COLLECT_C_VEC_F_SPILL_TO_HEAP. Only storage
+ * obtained by the implementation is released; a stack array is not.
  *
  * @param v Pointer to the vector. May not be NULL;
  *
@@ -308,6 +456,60 @@ collect_c_vec_clear(
 ,   size_t*             num_dropped
 );
 
+/** Ensures that the vector has storage sufficient to hold n elements
+ * (counting from its current front) and front_n elements in front of its
+ * current front, without further reallocation.
+ *
+ * @param v Pointer to the vector. May not be NULL;
+ * @param n The number of elements, including those already held, that the
+ *  vector must be able to hold without reallocation when pushing to the
+ *  back;
+ * @param front_n The number of elements that the vector must be able to
+ *  accommodate without reallocation when pushing to the front;
+ *
+ * @return Indicates whether operation succeeded.
+ * @retval 0 Operation succeed;
+ * @retval ENOMEM Sufficient memory not available;
+ * @retval ENODEV The vector uses a stack array, without
+ *  COLLECT_C_VEC_F_SPILL_TO_HEAP, and the requested storage is not already
+ *  available;
+ *
+ * @note If (re)allocation is required, exactly the requested front_n
+ *  elements are reserved at the front, rather than the front-spare that
+ *  would be provided by the growth policy. This may be called on an
+ *  instance whose storage has not yet been allocated, as an alternative to
+ *  collect_c_vec_allocate_storage().
+ *
+ * @pre (NULL != v)
+ * @pre (0 == front_n || 0 == (COLLECT_C_VEC_F_NO_BOO & v->flags))
+ */
+int
+collect_c_vec_reserve(
+    collect_c_vec_t*    v
+,   size_t              n
+,   size_t              front_n
+);
+
+/** Obtains the number of bytes of the vector's storage that are currently
+ * backed by (transparent) huge pages.
+ *
+ * @param v Pointer to the vector. May not be NULL;
+ *
+ * @return The number of bytes, which is 0 if the storage is not from the
+ *  virtual memory layer, if huge pages were not obtained, or if this
+ *  cannot be determined on the current platform.
+ *
+ * @note This is intended for instrumentation, and is expensive. Where the
+ *  kernel has merged the storage's mapping with neighbouring ones, the
+ *  figure is estimated in proportion to the storage's share of them.
+ *
+ * @pre (NULL != v)
+ */
+size_t
+collect_c_vec_huge_page_bytes(
+    collect_c_vec_t const*  v
+);
+
 /** Causes all currently unused storage to be offered back to the underlying
  * memory layer, such that the actual allocation may well be shrunk.
  *
@@ -321,6 +523,120 @@ collect_c_vec_shrink_to_fit(
     collect_c_vec_t*    v
 );
 
+/** Sorts the elements of the vector.
+ *
+ * @param v Pointer to the vector. May not be NULL;
+ * @param pfn_compare The element comparison function. May not be NULL;
+ *
+ * @note The sort is a pattern-defeating quicksort: O(n log n) in the worst
+ *  case (by way of a heapsort fallback), O(n) for input that is already
+ *  sorted, reverse-sorted, or has few distinct elements, and not stable.
+ *  The elements are moved by kernels specialised for elements of 4, 8 and
+ *  16 bytes, rather than byte-wise as by qsort().
+ *
+ * @pre (NULL != v)
+ * @pre (NULL != v->storage || 0 == v->size)
+ * @pre (NULL != pfn_compare)
+ */
+void
+collect_c_vec_sort(
+    collect_c_vec_t*            v
+,   collect_c_vec_pfn_compare   pfn_compare
+);
+
+/** Sorts the elements in the range [first, last) of the vector.
+ *
+ * @param v Pointer to the vector. May not be NULL;
+ * @param first The index of the first element of the range;
+ * @param last The index one past the last element of the range;
+ * @param pfn_compare The element comparison function. May not be NULL;
+ *
+ * @note The sort is as collect_c_vec_sort(), and elements outside the range
+ *  are not touched.
+ *
+ * @pre (NULL != v)
+ * @pre (first <= last)
+ * @pre (last <= v->size)
+ * @pre (NULL != pfn_compare)
+ */
+void
+collect_c_vec_sort_range(
+    collect_c_vec_t*            v
+,   size_t                      first
+,   size_t                      last
+,   collect_c_vec_pfn_compare   pfn_compare
+);
+
+/** Sorts the elements of the vector by an unsigned integer key within each
+ * element, in ascending order of key.
+ *
+ * @param v Pointer to the vector. May not be NULL;
+ * @param key_offset The offset of the key within the element;
+ * @param key_size The size of the key: 1, 2, 4 or 8;
+ *
+ * @retval 0 The elements were sorted;
+ * @retval ENOMEM Insufficient memory. The vector is unchanged;
+ *
+ * @note The sort is a least-significant-digit radix sort, of a byte per
+ *  pass, and is stable. It takes no comparisons, O(n) time, and scratch
+ *  storage of the size of the elements (from the vector's allocator).
+ *  Passes over bytes that are the same in all keys are skipped.
+ *
+ * @pre (NULL != v)
+ * @pre (NULL != v->storage || 0 == v->size)
+ * @pre (1 == key_size || 2 == key_size || 4 == key_size || 8 == key_size)
+ * @pre (key_offset + key_size <= v->el_size)
+ */
+int
+collect_c_vec_radix_sort(
+    collect_c_vec_t*    v
+,   size_t              key_offset
+,   size_t              key_size
+);
+
+/** Searches the vector for the first element whose bytes are equal to
+ * those of the key.
+ *
+ * @param v Pointer to the vector. May not be NULL;
+ * @param p_key Pointer to the key, of el_size bytes. May not be NULL;
+ * @param p_index Optional pointer to a variable to receive the index of
+ *  the element;
+ *
+ * @retval 0 An element was found;
+ * @retval ENOENT No element was found;
+ *
+ * @note The elements are compared as raw bytes, so any padding within
+ *  them must be consistently initialised. Elements of 1, 2, 4 and 8 bytes
+ *  are compared many at a time, by AVX2 or SSE2 kernels as determined, by
+ *  CPUID, on first use.
+ *
+ * @pre (NULL != v)
+ * @pre (NULL != p_key)
+ */
+int
+collect_c_vec_find_by_ref(
+    collect_c_vec_t const*  v
+,   void const*             p_key
+,   size_t*                 p_index
+);
+
+/** Counts the elements of the vector whose bytes are equal to those of
+ * the key.
+ *
+ * @param v Pointer to the vector. May not be NULL;
+ * @param p_key Pointer to the key, of el_size bytes. May not be NULL;
+ *
+ * @note The elements are compared as by collect_c_vec_find_by_ref().
+ *
+ * @pre (NULL != v)
+ * @pre (NULL != p_key)
+ */
+size_t
+collect_c_vec_count_by_ref(
+    collect_c_vec_t const*  v
+,   void const*             p_key
+);
+
 /** Attempts to add an item to the back of the vector.
  *
  * @param v Pointer to the vector. May not be NULL;
@@ -351,6 +667,130 @@ collect_c_v_push_front_by_ref(
 ,   void const*         ptr_new_el
 );
 
+/** Attempts to insert a number of elements at the given position.
+ *
+ * @param v Pointer to the vector. May not be NULL;
+ * @param index The position at which the new elements are to be inserted.
+ *  Must not be greater than the size;
+ * @param num_els The number of elements to be inserted;
+ * @param ptr_new_els Pointer to the array of num_els new elements to be
+ *  inserted. May be NULL only if num_els is 0. Must not refer to elements
+ *  of the vector itself;
+ *
+ * @return Indicates whether operation succeeded.
+ * @retval 0 Operation succeed;
+ * @retval ENOMEM Sufficient memory not available;
+ * @retval ENOSPC The vector uses a stack array, without
+ *  COLLECT_C_VEC_F_SPILL_TO_HEAP, that has insufficient space;
+ *
+ * @note The elements before or those after the insertion position are
+ *  moved - whichever are fewer, using the front-spare made available by
+ *  base-offset optimisation for the former - so that at most one
+ *  allocation and one move of each part is carried out.
+ *
+ * @pre (NULL != v)
+ * @pre (NULL != v->storage)
+ * @pre (index <= v->size)
+ * @pre (0 == num_els || NULL != ptr_new_els)
+ */
+int
+collect_c_v_insert_n_by_ref(
+    collect_c_vec_t*    v
+,   size_t              index
+,   size_t              num_els
+,   void const*         ptr_new_els
+);
+
+/** Erases the elements in the range [index_first, index_last).
+ *
+ * @param v Pointer to the vector. May not be NULL;
+ * @param index_first The position of the first element to be erased;
+ * @param index_last The position one past the last element to be erased;
+ * @param num_dropped Optional pointer to variable to retrieve number of
+ *  entries dropped;
+ *
+ * @note The elements before or those after the erased range are moved -
+ *  whichever are fewer, the former being possible only with base-offset
+ *  optimisation - with a single move.
+ *
+ * @pre (NULL != v)
+ * @pre (NULL != v->storage || 0 == v->size)
+ * @pre (index_first <= index_last)
+ * @pre (index_last <= v->size)
+ */
+int
+collect_c_v_erase_range(
+    collect_c_vec_t*    v
+,   size_t              index_first
+,   size_t              index_last
+,   size_t*             num_dropped
+);
+
+/** Attempts to drop a number of elements from the back of the vector.
+ *
+ * @param v Pointer to the vector. May not be NULL;
+ * @param num_to_drop Maximum number of elements to drop working from the
+ *  back of the vector;
+ * @param num_dropped Optional pointer to variable to retrieve number of
+ *  entries dropped;
+ *
+ * @pre (NULL != v)
+ * @pre (NULL != v->storage || 0 == v->size)
+ */
+int
+collect_c_v_pop_from_back_n(
+    collect_c_vec_t*    v
+,   size_t              num_to_drop
+,   size_t*             num_dropped
+);
+
+/** Attempts to drop a number of elements from the front of the vector.
+ *
+ * @param v Pointer to the vector. May not be NULL;
+ * @param num_to_drop Maximum number of elements to drop working from the
+ *  front of the vector;
+ * @param num_dropped Optional pointer to variable to retrieve number of
+ *  entries dropped;
+ *
+ * @note With base-offset optimisation (the default) this is O(1) in the
+ *  number of retained elements, since only the offset is advanced (except
+ *  that, when the back is full, the retained elements may be moved down so
+ *  that the vector may be used efficiently as a work queue). When
+ *  COLLECT_C_VEC_F_NO_BOO (or COLLECT_C_VEC_F_USE_STACK_ARRAY) is specified
+ *  the retained elements are moved down to the start of the storage.
+ *
+ * @pre (NULL != v)
+ * @pre (NULL != v->storage || 0 == v->size)
+ */
+int
+collect_c_v_pop_from_front_n(
+    collect_c_vec_t*    v
+,   size_t              num_to_drop
+,   size_t*             num_dropped
+);
+
+/** Reduces the size of the vector to the given size, dropping all elements
+ * at and beyond that position. Has no effect if the vector is not larger
+ * than new_size.
+ *
+ * @param v Pointer to the vector. May not be NULL;
+ * @param new_size The size to which the vector is to be reduced;
+ * @param num_dropped Optional pointer to variable to retrieve number of
+ *  entries dropped;
+ *
+ * @note This function does not change the allocated memory underlying the
+ *  instance. To do this, call collect_c_vec_shrink_to_fit().
+ *
+ * @pre (NULL != v)
+ * @pre (NULL != v->storage || 0 == v->size)
+ */
+int
+collect_c_v_truncate(
+    collect_c_vec_t*    v
+,   size_t              new_size
+,   size_t*             num_dropped
+);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -360,7 +800,7 @@ collect_c_v_push_front_by_ref(
  * helper macros
  */
 
-#define COLLECT_C_VEC_EMPTY_INITIALIZER_(vec_el_type, vec_cap, vec_flags, vec_storage, elf_fn, elf_param) \
+#define COLLECT_C_VEC_EMPTY_INITIALIZER_WITH_ALLOCATOR_(vec_el_type, vec_cap, vec_flags, vec_storage, vec_alloc, elf_fn, elf_param) \
                                                                             \
     {                                                                       \
         .el_size = sizeof(vec_el_type),                                     \
@@ -370,10 +810,16 @@ collect_c_v_push_front_by_ref(
         .flags = (vec_flags),                                               \
         .reserved0 = 0,                                                     \
         .storage = (vec_storage),                                           \
+        .growth_policy = NULL,                                              \
+        .allocator = (vec_alloc),                                           \
         .param_element_free = (elf_param),                                  \
         .pfn_element_free = (elf_fn),                                       \
     }
 
+#define COLLECT_C_VEC_EMPTY_INITIALIZER_(vec_el_type, vec_cap, vec_flags, vec_storage, elf_fn, elf_param) \
+                                                                            \
+    COLLECT_C_VEC_EMPTY_INITIALIZER_WITH_ALLOCATOR_(vec_el_type, vec_cap, vec_flags, vec_storage, NULL, elf_fn, elf_param)
+
 
 /* /////////////////////////////////////////////////////////////////////////
  * inclusion control
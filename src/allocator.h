@@ -0,0 +1,115 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    src/allocator.h
+ *
+ * Purpose: Internal dispatch to per-instance allocators.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/common/allocator.h>
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * internal functions
+ */
+
+/* Each of these takes the allocator (member) of an instance, which may be
+ * NULL, in which case the C standard library functions are used, so that
+ * the default involves only a (well-predicted) branch.
+ */
+
+static inline
+void*
+collect_c_mem_alloc(
+    collect_c_allocator_t const*    a
+,   size_t                          cb
+)
+{
+    if (NULL == a)
+    {
+        return malloc(cb);
+    }
+    else
+    {
+        assert(NULL != a->pfn_alloc);
+
+        return (*a->pfn_alloc)(a->context, cb);
+    }
+}
+
+static inline
+void
+collect_c_mem_free(
+    collect_c_allocator_t const*    a
+,   void*                           p
+,   size_t                          cb
+)
+{
+    if (NULL == a)
+    {
+        free(p);
+    }
+    else if (NULL != p &&
+             NULL != a->pfn_free)
+    {
+        (*a->pfn_free)(a->context, p, cb);
+    }
+}
+
+/* As realloc(), except that p may not be NULL, and cb_new may not be 0. */
+static inline
+void*
+collect_c_mem_realloc(
+    collect_c_allocator_t const*    a
+,   void*                           p
+,   size_t                          cb_old
+,   size_t                          cb_new
+)
+{
+    assert(NULL != p);
+    assert(0 != cb_new);
+
+    if (NULL == a)
+    {
+        return realloc(p, cb_new);
+    }
+    else if (NULL != a->pfn_realloc)
+    {
+        return (*a->pfn_realloc)(a->context, p, cb_old, cb_new);
+    }
+    else
+    {
+        void* const p_new = collect_c_mem_alloc(a, cb_new);
+
+        if (NULL != p_new)
+        {
+            memcpy(p_new, p, (cb_old < cb_new) ? cb_old : cb_new);
+
+            collect_c_mem_free(a, p, cb_old);
+        }
+
+        return p_new;
+    }
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#pragma once
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,329 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    src/arena.c
+ *
+ * Purpose: Arena (region) allocator.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/arena.h>
+
+#include "allocator.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * local types
+ */
+
+/* The chunks form a list, in which all chunks after the current chunk are
+ * (logically) empty, being retained after a reset or rewind for reuse.
+ */
+struct collect_c_arena_chunk_t
+{
+    struct collect_c_arena_chunk_t* next;
+    size_t                          capacity;   /* size of the data area */
+    size_t                          used;       /* bytes used in the data area */
+};
+typedef struct collect_c_arena_chunk_t                      chunk_t;
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions and macros
+ */
+
+#define COLLECT_C_ARENA_INTERNAL_ALIGNMENT_                 (_Alignof(max_align_t))
+
+#define COLLECT_C_ARENA_INTERNAL_round_(cb)                 (((cb) + (COLLECT_C_ARENA_INTERNAL_ALIGNMENT_ - 1)) & ~(size_t)(COLLECT_C_ARENA_INTERNAL_ALIGNMENT_ - 1))
+
+#define COLLECT_C_ARENA_INTERNAL_header_size_()             COLLECT_C_ARENA_INTERNAL_round_(sizeof(chunk_t))
+
+#define COLLECT_C_ARENA_INTERNAL_data_(ch)                  (((char*)(ch)) + COLLECT_C_ARENA_INTERNAL_header_size_())
+
+#define COLLECT_C_ARENA_INTERNAL_top_(ch)                   (COLLECT_C_ARENA_INTERNAL_data_(ch) + (ch)->used)
+
+/* Obtains a new chunk with a data area of at least cb_r bytes, and links
+ * it in after the current chunk (ahead of any retained chunks).
+ */
+static
+chunk_t*
+clc_c_ar_add_chunk_(
+    collect_c_arena_t*  a
+,   size_t              cb_r
+)
+{
+    size_t const    chunk_size  =   (0 == a->chunk_size) ? COLLECT_C_ARENA_DEFAULT_CHUNK_SIZE : a->chunk_size;
+    size_t const    capacity    =   (cb_r > chunk_size) ? cb_r : COLLECT_C_ARENA_INTERNAL_round_(chunk_size);
+    chunk_t* const  ch          =   collect_c_mem_alloc(a->backing, COLLECT_C_ARENA_INTERNAL_header_size_() + capacity);
+
+    if (NULL != ch)
+    {
+        ch->capacity    =   capacity;
+        ch->used        =   0;
+
+        if (NULL == a->current)
+        {
+            assert(NULL == a->first);
+
+            ch->next    =   NULL;
+            a->first    =   ch;
+        }
+        else
+        {
+            ch->next            =   a->current->next;
+            a->current->next    =   ch;
+        }
+
+        ++a->num_chunks;
+        a->cb_chunks += capacity;
+    }
+
+    return ch;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+uint32_t
+collect_c_arena_version(void)
+{
+    return COLLECT_C_ARENA_VER;
+}
+
+void
+collect_c_arena_free_storage(
+    collect_c_arena_t*  a
+)
+{
+    assert(NULL != a);
+
+    for (chunk_t* ch = a->first; NULL != ch; )
+    {
+        chunk_t* const ch2 = ch;
+
+        ch = ch->next;
+
+        collect_c_mem_free(a->backing, ch2, COLLECT_C_ARENA_INTERNAL_header_size_() + ch2->capacity);
+    }
+
+    a->first        =   NULL;
+    a->current      =   NULL;
+    a->num_chunks   =   0;
+    a->cb_chunks    =   0;
+}
+
+void*
+collect_c_arena_allocate(
+    collect_c_arena_t*  a
+,   size_t              cb
+)
+{
+    assert(NULL != a);
+
+    if (cb > SIZE_MAX / 2)
+    {
+        return NULL;
+    }
+    else
+    {
+        size_t const    cb_r    =   COLLECT_C_ARENA_INTERNAL_round_((0 == cb) ? 1 : cb);
+        chunk_t*        ch      =   a->current;
+
+        if (NULL == ch ||
+            ch->capacity - ch->used < cb_r)
+        {
+            /* move to the next (retained) chunk, if it is large enough,
+             * otherwise obtain a new one
+             */
+
+            if (NULL != ch &&
+                NULL != ch->next &&
+                ch->next->capacity >= cb_r)
+            {
+                ch = ch->next;
+
+                ch->used = 0;
+            }
+            else if (NULL == ch &&
+                     NULL != a->first &&
+                     a->first->capacity >= cb_r)
+            {
+                ch = a->first;
+
+                ch->used = 0;
+            }
+            else
+            {
+                if (NULL == ch &&
+                    NULL != a->first)
+                {
+                    /* the retained first chunk is too small, so just go
+                     * past it
+                     */
+
+                    a->current = a->first;
+
+                    a->first->used = a->first->capacity;
+                }
+
+                if (NULL == (ch = clc_c_ar_add_chunk_(a, cb_r)))
+                {
+                    return NULL;
+                }
+            }
+
+            a->current = ch;
+        }
+
+        {
+            void* const p = COLLECT_C_ARENA_INTERNAL_top_(ch);
+
+            ch->used += cb_r;
+
+            return p;
+        }
+    }
+}
+
+void
+collect_c_arena_reset(
+    collect_c_arena_t*  a
+)
+{
+    assert(NULL != a);
+
+    a->current = NULL;
+}
+
+collect_c_arena_mark_t
+collect_c_arena_mark(
+    collect_c_arena_t const*    a
+)
+{
+    assert(NULL != a);
+
+    {
+        collect_c_arena_mark_t mark;
+
+        mark.chunk  =   a->current;
+        mark.used   =   (NULL == a->current) ? 0 : a->current->used;
+
+        return mark;
+    }
+}
+
+void
+collect_c_arena_rewind(
+    collect_c_arena_t*      a
+,   collect_c_arena_mark_t  mark
+)
+{
+    assert(NULL != a);
+
+    a->current = mark.chunk;
+
+    if (NULL != mark.chunk)
+    {
+        assert(mark.used <= mark.chunk->used);
+
+        mark.chunk->used = mark.used;
+    }
+}
+
+void*
+collect_c_arena_allocator_alloc(
+    void*   context
+,   size_t  cb
+)
+{
+    return collect_c_arena_allocate((collect_c_arena_t*)context, cb);
+}
+
+void*
+collect_c_arena_allocator_realloc(
+    void*   context
+,   void*   p
+,   size_t  cb_old
+,   size_t  cb_new
+)
+{
+    collect_c_arena_t* const    a   =   (collect_c_arena_t*)context;
+    chunk_t* const              ch  =   a->current;
+
+    if (NULL == p)
+    {
+        return collect_c_arena_allocate(a, cb_new);
+    }
+    else
+    {
+        size_t const cb_old_r = COLLECT_C_ARENA_INTERNAL_round_((0 == cb_old) ? 1 : cb_old);
+
+        /* the most recent allocation is resized in place, if possible */
+
+        if (NULL != ch &&
+            ((char*)p) + cb_old_r == COLLECT_C_ARENA_INTERNAL_top_(ch) &&
+            cb_new <= SIZE_MAX / 2)
+        {
+            size_t const cb_new_r = COLLECT_C_ARENA_INTERNAL_round_((0 == cb_new) ? 1 : cb_new);
+
+            if (ch->used - cb_old_r + cb_new_r <= ch->capacity)
+            {
+                ch->used = ch->used - cb_old_r + cb_new_r;
+
+                return p;
+            }
+        }
+
+        {
+            void* const p_new = collect_c_arena_allocate(a, cb_new);
+
+            if (NULL != p_new)
+            {
+                memcpy(p_new, p, (cb_old < cb_new) ? cb_old : cb_new);
+            }
+
+            return p_new;
+        }
+    }
+}
+
+void
+collect_c_arena_allocator_free(
+    void*   context
+,   void*   p
+,   size_t  cb
+)
+{
+    collect_c_arena_t* const    a   =   (collect_c_arena_t*)context;
+    chunk_t* const              ch  =   a->current;
+
+    /* only the most recent allocation is actually released */
+
+    if (NULL != p &&
+        NULL != ch)
+    {
+        size_t const cb_r = COLLECT_C_ARENA_INTERNAL_round_((0 == cb) ? 1 : cb);
+
+        if (((char*)p) + cb_r == COLLECT_C_ARENA_INTERNAL_top_(ch))
+        {
+            ch->used -= cb_r;
+        }
+    }
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -4,7 +4,7 @@
  * Purpose: Circular-queue container.
  *
  * Created: 4th February 2025
- * Updated: 10th February 2025
+ * Updated: 18th October 2026
  *
  * ////////////////////////////////////////////////////////////////////// */
 
@@ -15,6 +15,10 @@
 
 #include <collect-c/circq.h>
 
+#include "allocator.h"
+#include "vm.h"
+#include "scan.h"
+
 #include <errno.h>
 #include <assert.h>
 #include <stdbool.h>
@@ -50,9 +54,20 @@ collect_c_cq_allocate_storage(
     {
         size_t const cb = q->el_size * q->capacity;
 
-        if (NULL == (q->storage = malloc(cb)))
+        if (0 != (COLLECT_C_CIRCQ_F_USE_HUGE_PAGES & q->flags) &&
+            NULL == q->allocator &&
+            cb >= COLLECT_C_VM_HUGE_PAGE_SIZE &&
+            collect_c_vm_is_supported() &&
+            NULL != (q->storage = collect_c_vm_allocate(cb, true)))
+        {
+            q->flags |= COLLECT_C_CIRCQ_F_VM_STORAGE;
+
+            return 0;
+        }
+
+        if (NULL == (q->storage = collect_c_mem_alloc(q->allocator, cb)))
         {
-            return errno;
+            return ENOMEM;
         }
         else
         {
@@ -87,7 +102,16 @@ collect_c_cq_free_storage(
 
         if (0 == (COLLECT_C_CIRCQ_F_USE_STACK_ARRAY & q->flags))
         {
-            free(q->storage);
+            if (0 != (COLLECT_C_CIRCQ_F_VM_STORAGE & q->flags))
+            {
+                collect_c_vm_free(q->storage, q->el_size * q->capacity, true);
+
+                q->flags &= ~COLLECT_C_CIRCQ_F_VM_STORAGE;
+            }
+            else
+            {
+                collect_c_mem_free(q->allocator, q->storage, q->el_size * q->capacity);
+            }
 
             q->storage = NULL;
         }
@@ -96,6 +120,23 @@ collect_c_cq_free_storage(
     }
 }
 
+size_t
+collect_c_cq_huge_page_bytes(
+    collect_c_cq_t const*   q
+)
+{
+    assert(NULL != q);
+
+    if (0 == (COLLECT_C_CIRCQ_F_VM_STORAGE & q->flags))
+    {
+        return 0;
+    }
+    else
+    {
+        return collect_c_vm_huge_page_bytes(q->storage, q->el_size * q->capacity);
+    }
+}
+
 int
 collect_c_cq_push_back_by_ref(
     collect_c_cq_t* q
@@ -328,5 +369,77 @@ collect_c_cq_pop_from_front_n(
 }
 
 
+int
+collect_c_cq_find_by_ref(
+    collect_c_cq_t const*   q
+,   void const*             p_key
+,   size_t*                 p_index
+)
+{
+    assert(NULL != q);
+    assert(NULL != p_key);
+
+    {
+        size_t const len = q->e - q->b;
+
+        if (0 != len)
+        {
+            /* the queue occupies at most two contiguous segments: from the
+             * front to the end of the storage, and (when wrapped) from the
+             * start of the storage
+             */
+
+            size_t const    ix0     =   q->b % q->capacity;
+            size_t const    n0      =   (len < q->capacity - ix0) ? len : (q->capacity - ix0);
+            size_t          ix      =   collect_c_scan_find(COLLECT_C_CIRCQ_INTERNAL_el_ptr_from_ix_(q, ix0), n0, q->el_size, p_key);
+
+            if (n0 == ix)
+            {
+                ix = n0 + collect_c_scan_find(q->storage, len - n0, q->el_size, p_key);
+            }
+
+            if (len != ix)
+            {
+                if (NULL != p_index)
+                {
+                    *p_index = ix;
+                }
+
+                return 0;
+            }
+        }
+
+        return ENOENT;
+    }
+}
+
+size_t
+collect_c_cq_count_by_ref(
+    collect_c_cq_t const*   q
+,   void const*             p_key
+)
+{
+    assert(NULL != q);
+    assert(NULL != p_key);
+
+    {
+        size_t const len = q->e - q->b;
+
+        if (0 == len)
+        {
+            return 0;
+        }
+        else
+        {
+            size_t const    ix0     =   q->b % q->capacity;
+            size_t const    n0      =   (len < q->capacity - ix0) ? len : (q->capacity - ix0);
+
+            return collect_c_scan_count(COLLECT_C_CIRCQ_INTERNAL_el_ptr_from_ix_(q, ix0), n0, q->el_size, p_key)
+                +  collect_c_scan_count(q->storage, len - n0, q->el_size, p_key);
+        }
+    }
+}
+
+
 /* ///////////////////////////// end of file //////////////////////////// */
 
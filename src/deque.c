@@ -0,0 +1,480 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    src/deque.c
+ *
+ * Purpose: Double-ended queue container.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/deque.h>
+
+#include "allocator.h"
+
+#include <errno.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions and macros
+ */
+
+#define COLLECT_C_DEQUE_INTERNAL_map_ix_(dq, chunk_ix)      (((dq)->map_b + (chunk_ix)) & ((dq)->map_capacity - 1))
+
+static
+void
+clc_c_dq_init_chunk_capacity_(
+    collect_c_deque_t*  dq
+)
+{
+    if (0 == dq->chunk_capacity)
+    {
+        size_t cap      =   1;
+        size_t shift    =   0;
+
+        for (; (cap * 2) * dq->el_size <= COLLECT_C_DEQUE_DEFAULT_CHUNK_SIZE; cap *= 2)
+        {
+            ++shift;
+        }
+
+        dq->chunk_capacity  =   cap;
+        dq->chunk_shift     =   shift;
+    }
+}
+
+static
+void
+clc_c_dq_release_chunk_(
+    collect_c_deque_t*  dq
+,   void*               chunk
+)
+{
+    if (NULL == dq->spare)
+    {
+        dq->spare = chunk;
+    }
+    else
+    {
+        collect_c_mem_free(dq->allocator, chunk, dq->chunk_capacity * dq->el_size);
+    }
+}
+
+static
+void
+clc_c_dq_release_all_chunks_(
+    collect_c_deque_t*  dq
+)
+{
+    for (size_t i = 0; dq->num_chunks != i; ++i)
+    {
+        clc_c_dq_release_chunk_(dq, dq->map[COLLECT_C_DEQUE_INTERNAL_map_ix_(dq, i)]);
+    }
+
+    dq->num_chunks  =   0;
+    dq->map_b       =   0;
+    dq->b           =   0;
+}
+
+/* Adds a chunk at the front or back of the map, growing the map (which
+ * moves only the chunk pointers) if it is full.
+ */
+static
+int
+clc_c_dq_add_chunk_(
+    collect_c_deque_t*  dq
+,   bool                at_front
+)
+{
+    void* chunk;
+
+    clc_c_dq_init_chunk_capacity_(dq);
+
+    if (dq->num_chunks == dq->map_capacity)
+    {
+        size_t const    new_cap =   (0 == dq->map_capacity) ? COLLECT_C_DEQUE_DEFAULT_MAP_CAPACITY : (dq->map_capacity * 2);
+        void** const    new_map =   collect_c_mem_alloc(dq->allocator, new_cap * sizeof(void*));
+
+        if (NULL == new_map)
+        {
+            return ENOMEM;
+        }
+
+        for (size_t i = 0; dq->num_chunks != i; ++i)
+        {
+            new_map[i] = dq->map[COLLECT_C_DEQUE_INTERNAL_map_ix_(dq, i)];
+        }
+
+        collect_c_mem_free(dq->allocator, dq->map, dq->map_capacity * sizeof(void*));
+
+        dq->map             =   new_map;
+        dq->map_capacity    =   new_cap;
+        dq->map_b           =   0;
+    }
+
+    if (NULL != dq->spare)
+    {
+        chunk = dq->spare;
+
+        dq->spare = NULL;
+    }
+    else
+    {
+        if (NULL == (chunk = collect_c_mem_alloc(dq->allocator, dq->chunk_capacity * dq->el_size)))
+        {
+            return ENOMEM;
+        }
+    }
+
+    if (at_front)
+    {
+        dq->map_b = (dq->map_b - 1) & (dq->map_capacity - 1);
+
+        dq->map[dq->map_b] = chunk;
+    }
+    else
+    {
+        dq->map[COLLECT_C_DEQUE_INTERNAL_map_ix_(dq, dq->num_chunks)] = chunk;
+    }
+
+    ++dq->num_chunks;
+
+    return 0;
+}
+
+/* Removes the back element, without invoking the callback, releasing the
+ * last chunk if it becomes unused.
+ */
+static
+void
+clc_c_dq_drop_back_(
+    collect_c_deque_t*  dq
+)
+{
+    assert(0 != dq->size);
+
+    --dq->size;
+
+    if (0 == dq->size)
+    {
+        clc_c_dq_release_all_chunks_(dq);
+    }
+    else if (dq->b + dq->size <= ((dq->num_chunks - 1) << dq->chunk_shift))
+    {
+        --dq->num_chunks;
+
+        clc_c_dq_release_chunk_(dq, dq->map[COLLECT_C_DEQUE_INTERNAL_map_ix_(dq, dq->num_chunks)]);
+    }
+}
+
+/* Removes the front element, without invoking the callback, releasing the
+ * first chunk if it becomes unused.
+ */
+static
+void
+clc_c_dq_drop_front_(
+    collect_c_deque_t*  dq
+)
+{
+    assert(0 != dq->size);
+
+    --dq->size;
+    ++dq->b;
+
+    if (0 == dq->size)
+    {
+        clc_c_dq_release_all_chunks_(dq);
+    }
+    else if (dq->chunk_capacity == dq->b)
+    {
+        clc_c_dq_release_chunk_(dq, dq->map[dq->map_b]);
+
+        dq->map_b = COLLECT_C_DEQUE_INTERNAL_map_ix_(dq, 1);
+        --dq->num_chunks;
+        dq->b = 0;
+    }
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+uint32_t
+collect_c_deque_version(void)
+{
+    return COLLECT_C_DEQUE_VER;
+}
+
+void
+collect_c_deque_free_storage(
+    collect_c_deque_t*  dq
+)
+{
+    assert(NULL != dq);
+
+    collect_c_deque_clear(dq, NULL, NULL, NULL);
+
+    collect_c_mem_free(dq->allocator, dq->spare, dq->chunk_capacity * dq->el_size);
+    collect_c_mem_free(dq->allocator, dq->map, dq->map_capacity * sizeof(void*));
+
+    dq->spare           =   NULL;
+    dq->map             =   NULL;
+    dq->map_capacity    =   0;
+}
+
+int
+collect_c_deque_clear(
+    collect_c_deque_t*  dq
+,   void*               reserved0
+,   void*               reserved1
+,   size_t*             num_dropped
+)
+{
+    assert(NULL != dq);
+    assert(NULL == reserved0);
+    assert(NULL == reserved1);
+
+    ((void)&reserved0);
+    ((void)&reserved1);
+
+    {
+        size_t dummy;
+
+        if (NULL == num_dropped)
+        {
+            num_dropped = &dummy;
+        }
+
+        if (NULL != dq->pfn_element_free)
+        {
+            for (size_t i = 0; dq->size != i; ++i)
+            {
+                (*dq->pfn_element_free)(dq->el_size, i, COLLECT_C_DEQUE_el_ptr_(dq, i), dq->param_element_free);
+            }
+        }
+
+        *num_dropped = dq->size;
+
+        dq->size = 0;
+
+        clc_c_dq_release_all_chunks_(dq);
+
+        return 0;
+    }
+}
+
+void*
+collect_c_deque_at(
+    collect_c_deque_t const*    dq
+,   size_t                      index
+)
+{
+    assert(NULL != dq);
+    assert(index < dq->size);
+
+    return COLLECT_C_DEQUE_el_ptr_(dq, index);
+}
+
+int
+collect_c_deque_erase_at(
+    collect_c_deque_t*  dq
+,   size_t              index
+)
+{
+    assert(NULL != dq);
+    assert(index < dq->size);
+
+    if (NULL != dq->pfn_element_free)
+    {
+        (*dq->pfn_element_free)(dq->el_size, index, COLLECT_C_DEQUE_el_ptr_(dq, index), dq->param_element_free);
+    }
+
+    if (index < dq->size - 1 - index)
+    {
+        /* shift the preceding elements up by one */
+
+        for (size_t i = index; 0 != i; --i)
+        {
+            memcpy(COLLECT_C_DEQUE_el_ptr_(dq, i), COLLECT_C_DEQUE_el_ptr_(dq, i - 1), dq->el_size);
+        }
+
+        clc_c_dq_drop_front_(dq);
+    }
+    else
+    {
+        /* shift the following elements down by one */
+
+        for (size_t i = index; dq->size - 1 != i; ++i)
+        {
+            memcpy(COLLECT_C_DEQUE_el_ptr_(dq, i), COLLECT_C_DEQUE_el_ptr_(dq, i + 1), dq->el_size);
+        }
+
+        clc_c_dq_drop_back_(dq);
+    }
+
+    return 0;
+}
+
+int
+collect_c_deque_push_back_by_ref(
+    collect_c_deque_t*  dq
+,   void const*         ptr_new_el
+)
+{
+    assert(NULL != dq);
+    assert(NULL != ptr_new_el);
+
+    if (0 == dq->num_chunks)
+    {
+        int const r = clc_c_dq_add_chunk_(dq, false);
+
+        if (0 != r)
+        {
+            return r;
+        }
+
+        /* start mid-chunk, so that either end may grow without a new chunk */
+        dq->b = dq->chunk_capacity / 2;
+    }
+
+    if (dq->b + dq->size == (dq->num_chunks << dq->chunk_shift))
+    {
+        int const r = clc_c_dq_add_chunk_(dq, false);
+
+        if (0 != r)
+        {
+            return r;
+        }
+    }
+
+    memcpy(COLLECT_C_DEQUE_el_ptr_(dq, dq->size), ptr_new_el, dq->el_size);
+
+    ++dq->size;
+
+    return 0;
+}
+
+int
+collect_c_deque_push_front_by_ref(
+    collect_c_deque_t*  dq
+,   void const*         ptr_new_el
+)
+{
+    assert(NULL != dq);
+    assert(NULL != ptr_new_el);
+
+    if (0 == dq->num_chunks)
+    {
+        int const r = clc_c_dq_add_chunk_(dq, false);
+
+        if (0 != r)
+        {
+            return r;
+        }
+
+        /* start mid-chunk, so that either end may grow without a new chunk */
+        dq->b = dq->chunk_capacity / 2;
+    }
+
+    if (0 == dq->b)
+    {
+        int const r = clc_c_dq_add_chunk_(dq, true);
+
+        if (0 != r)
+        {
+            return r;
+        }
+
+        dq->b = dq->chunk_capacity;
+    }
+
+    --dq->b;
+    ++dq->size;
+
+    memcpy(COLLECT_C_DEQUE_el_ptr_(dq, 0), ptr_new_el, dq->el_size);
+
+    return 0;
+}
+
+int
+collect_c_deque_pop_from_back_n(
+    collect_c_deque_t*  dq
+,   size_t              num_to_drop
+,   size_t*             num_dropped
+)
+{
+    assert(NULL != dq);
+
+    {
+        size_t dummy;
+
+        if (NULL == num_dropped)
+        {
+            num_dropped = &dummy;
+        }
+
+        *num_dropped = 0;
+
+        for (size_t lix = 0; 0 != dq->size && 0 != num_to_drop; --num_to_drop, ++lix)
+        {
+            if (NULL != dq->pfn_element_free)
+            {
+                (*dq->pfn_element_free)(dq->el_size, lix, COLLECT_C_DEQUE_el_ptr_(dq, dq->size - 1), dq->param_element_free);
+            }
+
+            clc_c_dq_drop_back_(dq);
+
+            ++*num_dropped;
+        }
+
+        return 0;
+    }
+}
+
+int
+collect_c_deque_pop_from_front_n(
+    collect_c_deque_t*  dq
+,   size_t              num_to_drop
+,   size_t*             num_dropped
+)
+{
+    assert(NULL != dq);
+
+    {
+        size_t dummy;
+
+        if (NULL == num_dropped)
+        {
+            num_dropped = &dummy;
+        }
+
+        *num_dropped = 0;
+
+        for (size_t lix = 0; 0 != dq->size && 0 != num_to_drop; --num_to_drop, ++lix)
+        {
+            if (NULL != dq->pfn_element_free)
+            {
+                (*dq->pfn_element_free)(dq->el_size, lix, COLLECT_C_DEQUE_el_ptr_(dq, 0), dq->param_element_free);
+            }
+
+            clc_c_dq_drop_front_(dq);
+
+            ++*num_dropped;
+        }
+
+        return 0;
+    }
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -4,7 +4,7 @@
  * Purpose: Doubly-linked list container.
  *
  * Created: 7th February 2025
- * Updated: 10th February 2025
+ * Updated: 18th October 2026
  *
  * ////////////////////////////////////////////////////////////////////// */
 
@@ -15,10 +15,13 @@
 
 #include <collect-c/dlist.h>
 
+#include "allocator.h"
+
 #include <errno.h>
 #include <assert.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -28,6 +31,7 @@
  */
 
 typedef collect_c_dlist_node_t                              node_t;
+typedef collect_c_dlist_block_t                             block_t;
 
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -36,27 +40,382 @@ typedef collect_c_dlist_node_t                              node_t;
 
 #define COLLECT_C_DLIST_INTERNAL_sizeof_node_(el_size)      (offsetof(collect_c_dlist_node_t, data) + el_size)
 
+/* the distance between adjacent nodes within a block */
+#define COLLECT_C_DLIST_INTERNAL_node_stride_(el_size)      ((COLLECT_C_DLIST_INTERNAL_sizeof_node_(el_size) + (_Alignof(collect_c_dlist_node_t) - 1)) & ~(_Alignof(collect_c_dlist_node_t) - 1))
+
+#define COLLECT_C_DLIST_INTERNAL_block_node_(b, stride, ix) ((node_t*)(((char*)&(b)->nodes[0]) + ((ix) * (stride))))
+
 static
 node_t*
 clc_c_dl_make_node_(
-    node_t*     prev
-,   node_t*     next
-,   size_t      el_size
-,   void const* ptr_new_el
+    collect_c_dlist_t*  l
+,   node_t*             prev
+,   node_t*             next
+,   void const*         ptr_new_el
 )
 {
-    size_t const    cb  =   COLLECT_C_DLIST_INTERNAL_sizeof_node_(el_size);
-    node_t* const   nd  =   malloc(cb);
+    node_t* nd;
+
+    if (NULL != l->spares)
+    {
+        /* reuse a spare, if available */
+
+        nd = l->spares;
+
+        l->spares = nd->next;
+
+        --l->num_spares;
+    }
+    else
+    {
+        size_t const cb = COLLECT_C_DLIST_INTERNAL_sizeof_node_(l->el_size);
+
+        if (NULL == (nd = collect_c_mem_alloc(l->allocator, cb)))
+        {
+            return NULL;
+        }
+    }
 
     nd->prev    =   prev;
     nd->next    =   next;
 
-    memcpy(&nd->data->data[0], ptr_new_el, el_size);
+    memcpy(&nd->data->data[0], ptr_new_el, l->el_size);
 
     return nd;
 }
 
 
+static
+block_t*
+clc_c_dl_make_block_(
+    collect_c_dlist_t*  l
+,   size_t              num_nodes
+)
+{
+    size_t const    stride  =   COLLECT_C_DLIST_INTERNAL_node_stride_(l->el_size);
+    size_t const    cb      =   offsetof(block_t, nodes) + (num_nodes * stride);
+    block_t* const  b       =   collect_c_mem_alloc(l->allocator, cb);
+
+    if (NULL != b)
+    {
+        b->el_size      =   l->el_size;
+        b->num_nodes    =   num_nodes;
+        b->num_used     =   0;
+    }
+
+    return b;
+}
+
+/* The capacity of the block index holding the given number of blocks,
+ * which grows by doubling from a minimum of 4.
+ */
+static
+size_t
+clc_c_dl_block_index_capacity_(
+    size_t  num_blocks
+)
+{
+    size_t n = 4;
+
+    if (0 == num_blocks)
+    {
+        return 0;
+    }
+
+    for (; n < num_blocks; n *= 2)
+    {}
+
+    return n;
+}
+
+/* Adds the given block to the list's block index, maintaining the order by
+ * address. The list is unchanged on failure.
+ */
+static
+int
+clc_c_dl_add_block_(
+    collect_c_dlist_t*  l
+,   block_t*            b
+)
+{
+    size_t const    cap =   clc_c_dl_block_index_capacity_(l->num_blocks);
+    size_t          lo  =   0;
+    size_t          hi  =   l->num_blocks;
+
+    if (cap == l->num_blocks)
+    {
+        size_t const    cap2    =   clc_c_dl_block_index_capacity_(l->num_blocks + 1);
+        block_t** const blocks  =   (NULL == l->blocks)
+                                    ? collect_c_mem_alloc(l->allocator, cap2 * sizeof(block_t*))
+                                    : collect_c_mem_realloc(l->allocator, l->blocks, cap * sizeof(block_t*), cap2 * sizeof(block_t*));
+
+        if (NULL == blocks)
+        {
+            return ENOMEM;
+        }
+
+        l->blocks = blocks;
+    }
+
+    /* blocks are usually obtained at ascending addresses, so this is
+     * ordinarily an append
+     */
+
+    for (; lo != hi; )
+    {
+        size_t const mid = lo + (hi - lo) / 2;
+
+        if ((uintptr_t)l->blocks[mid] < (uintptr_t)b)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    memmove(&l->blocks[lo + 1], &l->blocks[lo], (l->num_blocks - lo) * sizeof(block_t*));
+
+    l->blocks[lo] = b;
+
+    ++l->num_blocks;
+
+    return 0;
+}
+
+/* Determines whether the given node resides within one of the list's
+ * blocks, in which case it must not be individually freed.
+ */
+static
+bool
+clc_c_dl_is_block_node_(
+    collect_c_dlist_t const*    l
+,   node_t const*               node
+)
+{
+    uintptr_t const addr    =   (uintptr_t)node;
+    size_t          lo      =   0;
+    size_t          hi      =   l->num_blocks;
+
+    /* find the last block that starts at or before the node */
+
+    for (; lo != hi; )
+    {
+        size_t const mid = lo + (hi - lo) / 2;
+
+        if ((uintptr_t)l->blocks[mid] <= addr)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    if (0 == lo)
+    {
+        return false;
+    }
+    else
+    {
+        block_t const* const    b       =   l->blocks[lo - 1];
+        size_t const            stride  =   COLLECT_C_DLIST_INTERNAL_node_stride_(l->el_size);
+        uintptr_t const         begin   =   (uintptr_t)&b->nodes[0];
+        uintptr_t const         end     =   begin + (b->num_nodes * stride);
+
+        return addr >= begin && addr < end;
+    }
+}
+
+/* Frees the given node, unless it resides within a block, in which case it
+ * will be freed along with its block.
+ */
+static
+void
+clc_c_dl_free_node_(
+    collect_c_dlist_t const*    l
+,   node_t*                     node
+)
+{
+    if (0 == l->num_blocks ||
+        !clc_c_dl_is_block_node_(l, node))
+    {
+        collect_c_mem_free(l->allocator, node, COLLECT_C_DLIST_INTERNAL_sizeof_node_(l->el_size));
+    }
+}
+
+/* Frees all the list's blocks, and its block index. */
+static
+void
+clc_c_dl_free_blocks_(
+    collect_c_dlist_t*  l
+)
+{
+    size_t const stride = COLLECT_C_DLIST_INTERNAL_node_stride_(l->el_size);
+
+    for (size_t i = 0; l->num_blocks != i; ++i)
+    {
+        block_t* const b = l->blocks[i];
+
+        collect_c_mem_free(l->allocator, b, offsetof(block_t, nodes) + (b->num_nodes * stride));
+    }
+
+    collect_c_mem_free(l->allocator, l->blocks, clc_c_dl_block_index_capacity_(l->num_blocks) * sizeof(block_t*));
+
+    l->blocks       =   NULL;
+    l->num_blocks   =   0;
+}
+
+
+/* Obtains a chain of num_els (> 0) linked nodes, holding copies of the
+ * given elements, taking first from the spares and then from a single new
+ * block. The list is unchanged on failure.
+ */
+static
+int
+clc_c_dl_make_chain_(
+    collect_c_dlist_t*  l
+,   size_t              num_els
+,   void const*         ptr_new_els
+,   node_t**            first
+,   node_t**            last
+)
+{
+    size_t const    num_from_spares =   (num_els < l->num_spares) ? num_els : l->num_spares;
+    size_t const    num_from_block  =   num_els - num_from_spares;
+    size_t const    stride          =   COLLECT_C_DLIST_INTERNAL_node_stride_(l->el_size);
+    block_t*        b               =   NULL;
+    node_t*         prev            =   NULL;
+
+    assert(0 != num_els);
+
+    if (0 != num_from_block)
+    {
+        if (NULL == (b = clc_c_dl_make_block_(l, num_from_block)))
+        {
+            return ENOMEM;
+        }
+
+        if (0 != clc_c_dl_add_block_(l, b))
+        {
+            collect_c_mem_free(l->allocator, b, offsetof(block_t, nodes) + (num_from_block * stride));
+
+            return ENOMEM;
+        }
+
+        b->num_used = num_from_block;
+    }
+
+    for (size_t i = 0; num_els != i; ++i)
+    {
+        node_t* nd;
+
+        if (i < num_from_spares)
+        {
+            nd = l->spares;
+
+            l->spares = nd->next;
+
+            --l->num_spares;
+        }
+        else
+        {
+            nd = COLLECT_C_DLIST_INTERNAL_block_node_(b, stride, i - num_from_spares);
+        }
+
+        memcpy(&nd->data->data[0], (char const*)ptr_new_els + (i * l->el_size), l->el_size);
+
+        nd->prev = prev;
+        nd->next = NULL;
+
+        if (NULL == prev)
+        {
+            *first = nd;
+        }
+        else
+        {
+            prev->next = nd;
+        }
+
+        prev = nd;
+    }
+
+    *last = prev;
+
+    return 0;
+}
+
+/* Links the chain [first, last] between prev and next, either of which
+ * may be NULL to indicate the front or back of the list, respectively.
+ */
+static
+void
+clc_c_dl_splice_chain_(
+    collect_c_dlist_t*  l
+,   node_t*             prev
+,   node_t*             next
+,   node_t*             first
+,   node_t*             last
+,   size_t              num_els
+)
+{
+    first->prev = prev;
+    last->next  = next;
+
+    if (NULL != prev)
+    {
+        prev->next = first;
+    }
+    else
+    {
+        l->head = first;
+    }
+
+    if (NULL != next)
+    {
+        next->prev = last;
+    }
+    else
+    {
+        l->tail = last;
+    }
+
+    l->size += num_els;
+}
+
+
+/* Compares for bytewise equality, specialised for the common element sizes
+ * so that the comparison is inlined rather than calling memcmp().
+ */
+static
+inline
+bool
+clc_c_dl_bytes_equal_(
+    void const* p_lhs
+,   void const* p_rhs
+,   size_t      el_size
+)
+{
+    switch (el_size)
+    {
+    case 1:
+        return 0 == memcmp(p_lhs, p_rhs, 1);
+    case 2:
+        return 0 == memcmp(p_lhs, p_rhs, 2);
+    case 4:
+        return 0 == memcmp(p_lhs, p_rhs, 4);
+    case 8:
+        return 0 == memcmp(p_lhs, p_rhs, 8);
+    case 16:
+        return 0 == memcmp(p_lhs, p_rhs, 16);
+    default:
+        return 0 == memcmp(p_lhs, p_rhs, el_size);
+    }
+}
+
+
 /* /////////////////////////////////////////////////////////////////////////
  * API functions
  */
@@ -81,7 +440,7 @@ clc_dlist_free_storage(
 
             n = n->next;
 
-            free(n2);
+            clc_c_dl_free_node_(l, n2);
         }
 
         l->head = l->tail = NULL;
@@ -93,10 +452,13 @@ clc_dlist_free_storage(
 
             n = n->next;
 
-            free(n2);
+            clc_c_dl_free_node_(l, n2);
         }
 
         l->spares = NULL;
+        l->num_spares = 0;
+
+        clc_c_dl_free_blocks_(l);
 
         return 0;
     }
@@ -155,6 +517,108 @@ collect_c_dlist_clear(
     }
 }
 
+int
+collect_c_dlist_compact(
+    collect_c_dlist_t*          l
+,   collect_c_dlist_pfn_remap_t pfn_remap
+,   void*                       param_remap
+)
+{
+    assert(NULL != l);
+
+    {
+        block_t*        b       =   NULL;
+        block_t**       blocks  =   NULL;
+        node_t* const   head    =   l->head;
+        node_t* const   spares  =   l->spares;
+
+        if (0 != l->size)
+        {
+            size_t const    stride  =   COLLECT_C_DLIST_INTERNAL_node_stride_(l->el_size);
+            node_t*         prev    =   NULL;
+            size_t          ix      =   0;
+
+            if (NULL == (b = clc_c_dl_make_block_(l, l->size)))
+            {
+                return ENOMEM;
+            }
+
+            if (NULL == (blocks = collect_c_mem_alloc(l->allocator, clc_c_dl_block_index_capacity_(1) * sizeof(block_t*))))
+            {
+                collect_c_mem_free(l->allocator, b, offsetof(block_t, nodes) + (l->size * stride));
+
+                return ENOMEM;
+            }
+
+            /* 1. copy the live nodes, in list order, into the block */
+
+            for (node_t* n = head; NULL != n; n = n->next, ++ix)
+            {
+                node_t* const nn = COLLECT_C_DLIST_INTERNAL_block_node_(b, stride, ix);
+
+                memcpy(&nn->data->data[0], &n->data->data[0], l->el_size);
+
+                nn->prev = prev;
+                nn->next = NULL;
+
+                if (NULL != prev)
+                {
+                    prev->next = nn;
+                }
+
+                if (NULL != pfn_remap)
+                {
+                    (*pfn_remap)(l, n, nn, param_remap);
+                }
+
+                prev = nn;
+            }
+
+            assert(l->size == ix);
+
+            b->num_used = ix;
+
+            l->head = COLLECT_C_DLIST_INTERNAL_block_node_(b, stride, 0);
+            l->tail = prev;
+        }
+
+        /* 2. free all the former nodes, spares, and blocks */
+
+        for (node_t* n = head; NULL != n; )
+        {
+            node_t* const n2 = n;
+
+            n = n->next;
+
+            clc_c_dl_free_node_(l, n2);
+        }
+
+        for (node_t* n = spares; NULL != n; )
+        {
+            node_t* const n2 = n;
+
+            n = n->next;
+
+            clc_c_dl_free_node_(l, n2);
+        }
+
+        clc_c_dl_free_blocks_(l);
+
+        l->spares       =   NULL;
+        l->num_spares   =   0;
+
+        if (NULL != b)
+        {
+            blocks[0]       =   b;
+
+            l->blocks       =   blocks;
+            l->num_blocks   =   1;
+        }
+
+        return 0;
+    }
+}
+
 int
 collect_c_dlist_erase_node(
     collect_c_dlist_t*      l
@@ -210,9 +674,11 @@ collect_c_dlist_erase_node(
 
             --l->size;
 
-            if (0 != (COLLECT_C_DLIST_F_NO_SPARES & l->flags))
+            if (0 != (COLLECT_C_DLIST_F_NO_SPARES & l->flags) &&
+                (0 == l->num_blocks ||
+                 !clc_c_dl_is_block_node_(l, node)))
             {
-                free(node);
+                collect_c_mem_free(l->allocator, node, COLLECT_C_DLIST_INTERNAL_sizeof_node_(l->el_size));
             }
             else
             {
@@ -257,6 +723,8 @@ collect_c_dlist_find_node(
 
         for (collect_c_dlist_node_t* n = l->head; NULL != n; n = n->next)
         {
+            COLLECT_C_UTIL_PREFETCH_(n->next);
+
             int const r = (*pfn)(l, p_lhs, &n->data->data[0]);
 
             ++*num_searched;
@@ -305,6 +773,8 @@ collect_c_dlist_rfind_node(
 
         for (collect_c_dlist_node_t* n = l->tail; NULL != n; n = n->prev)
         {
+            COLLECT_C_UTIL_PREFETCH_(n->prev);
+
             int const r = (*pfn)(l, p_lhs, &n->data->data[0]);
 
             ++*num_searched;
@@ -324,6 +794,96 @@ collect_c_dlist_rfind_node(
     }
 }
 
+int
+collect_c_dlist_find_node_by_bytes(
+    collect_c_dlist_t const*        l
+,   void const*                     p_key
+,   size_t                          skip_count
+,   collect_c_dlist_node_t**        node
+,   size_t*                         num_searched
+)
+{
+    assert(NULL != l);
+    assert(NULL != p_key);
+    assert(NULL != node);
+
+    *node = NULL;
+
+    {
+        size_t const    el_size =   l->el_size;
+        size_t          n_srch  =   0;
+
+        for (collect_c_dlist_node_t* n = l->head; NULL != n; n = n->next)
+        {
+            COLLECT_C_UTIL_PREFETCH_(n->next);
+
+            ++n_srch;
+
+            if (clc_c_dl_bytes_equal_(p_key, &n->data->data[0], el_size))
+            {
+                if (0 == skip_count--)
+                {
+                    *node = n;
+
+                    break;
+                }
+            }
+        }
+
+        if (NULL != num_searched)
+        {
+            *num_searched = n_srch;
+        }
+
+        return (NULL != *node) ? 0 : ENOENT;
+    }
+}
+
+int
+collect_c_dlist_rfind_node_by_bytes(
+    collect_c_dlist_t const*        l
+,   void const*                     p_key
+,   size_t                          skip_count
+,   collect_c_dlist_node_t**        node
+,   size_t*                         num_searched
+)
+{
+    assert(NULL != l);
+    assert(NULL != p_key);
+    assert(NULL != node);
+
+    *node = NULL;
+
+    {
+        size_t const    el_size =   l->el_size;
+        size_t          n_srch  =   0;
+
+        for (collect_c_dlist_node_t* n = l->tail; NULL != n; n = n->prev)
+        {
+            COLLECT_C_UTIL_PREFETCH_(n->prev);
+
+            ++n_srch;
+
+            if (clc_c_dl_bytes_equal_(p_key, &n->data->data[0], el_size))
+            {
+                if (0 == skip_count--)
+                {
+                    *node = n;
+
+                    break;
+                }
+            }
+        }
+
+        if (NULL != num_searched)
+        {
+            *num_searched = n_srch;
+        }
+
+        return (NULL != *node) ? 0 : ENOENT;
+    }
+}
+
 int
 collect_c_dlist_insert_after(
     collect_c_dlist_t*          l
@@ -344,7 +904,7 @@ collect_c_dlist_insert_after(
             new_node = &dummy;
         }
 
-        *new_node = clc_c_dl_make_node_(reference_node, reference_node->next, l->el_size, ptr_new_el);
+        *new_node = clc_c_dl_make_node_(l, reference_node, reference_node->next, ptr_new_el);
 
         if (NULL == *new_node)
         {
@@ -371,6 +931,50 @@ collect_c_dlist_insert_after(
 }
 
 
+int
+collect_c_dlist_insert_n_after(
+    collect_c_dlist_t*          l
+,   collect_c_dlist_node_t*     reference_node
+,   size_t                      num_els
+,   void const*                 ptr_new_els
+,   collect_c_dlist_node_t**    first_new_node
+)
+{
+    assert(NULL != l);
+    assert(NULL != reference_node);
+    assert(0 == num_els || NULL != ptr_new_els);
+
+    {
+        collect_c_dlist_node_t* dummy;
+        node_t*                 last;
+
+        if (NULL == first_new_node)
+        {
+            first_new_node = &dummy;
+        }
+
+        *first_new_node = NULL;
+
+        if (0 == num_els)
+        {
+            return 0;
+        }
+        else
+        {
+            int const r = clc_c_dl_make_chain_(l, num_els, ptr_new_els, first_new_node, &last);
+
+            if (0 != r)
+            {
+                return r;
+            }
+
+            clc_c_dl_splice_chain_(l, reference_node, reference_node->next, *first_new_node, last, num_els);
+
+            return 0;
+        }
+    }
+}
+
 int
 collect_c_dlist_insert_before(
     collect_c_dlist_t*          l
@@ -391,7 +995,7 @@ collect_c_dlist_insert_before(
             new_node = &dummy;
         }
 
-        *new_node = clc_c_dl_make_node_(reference_node->prev, reference_node, l->el_size, ptr_new_el);
+        *new_node = clc_c_dl_make_node_(l, reference_node->prev, reference_node, ptr_new_el);
 
         if (NULL == *new_node)
         {
@@ -431,7 +1035,7 @@ collect_c_dlist_push_back_by_ref(
     {
         if (NULL == l->head)
         {
-            collect_c_dlist_node_t* const nd = clc_c_dl_make_node_(NULL, NULL, l->el_size, ptr_new_el);
+            collect_c_dlist_node_t* const nd = clc_c_dl_make_node_(l, NULL, NULL, ptr_new_el);
 
             if (NULL == nd)
             {
@@ -448,7 +1052,7 @@ collect_c_dlist_push_back_by_ref(
         {
             collect_c_dlist_node_t* const   prev    =   l->tail;
             collect_c_dlist_node_t* const   next    =   NULL;
-            collect_c_dlist_node_t* const   nd      =   clc_c_dl_make_node_(prev, next, l->el_size, ptr_new_el);
+            collect_c_dlist_node_t* const   nd      =   clc_c_dl_make_node_(l, prev, next, ptr_new_el);
 
             if (NULL == nd)
             {
@@ -479,7 +1083,7 @@ collect_c_dlist_push_front_by_ref(
     {
         if (NULL == l->head)
         {
-            collect_c_dlist_node_t* const nd = clc_c_dl_make_node_(NULL, NULL, l->el_size, ptr_new_el);
+            collect_c_dlist_node_t* const nd = clc_c_dl_make_node_(l, NULL, NULL, ptr_new_el);
 
             if (NULL == nd)
             {
@@ -496,7 +1100,7 @@ collect_c_dlist_push_front_by_ref(
         {
             collect_c_dlist_node_t* const   prev    =   NULL;
             collect_c_dlist_node_t* const   next    =   l->head;
-            collect_c_dlist_node_t* const   nd      =   clc_c_dl_make_node_(prev, next, l->el_size, ptr_new_el);
+            collect_c_dlist_node_t* const   nd      =   clc_c_dl_make_node_(l, prev, next, ptr_new_el);
 
             if (NULL == nd)
             {
@@ -514,5 +1118,72 @@ collect_c_dlist_push_front_by_ref(
 }
 
 
+int
+collect_c_dlist_push_back_n_by_ref(
+    collect_c_dlist_t*  l
+,   size_t              num_els
+,   void const*         ptr_new_els
+)
+{
+    assert(NULL != l);
+    assert(0 == num_els || NULL != ptr_new_els);
+
+    assert((NULL == l->head) == (NULL == l->tail));
+
+    if (0 == num_els)
+    {
+        return 0;
+    }
+    else
+    {
+        node_t*     first;
+        node_t*     last;
+        int const   r = clc_c_dl_make_chain_(l, num_els, ptr_new_els, &first, &last);
+
+        if (0 != r)
+        {
+            return r;
+        }
+
+        clc_c_dl_splice_chain_(l, l->tail, NULL, first, last, num_els);
+
+        return 0;
+    }
+}
+
+int
+collect_c_dlist_push_front_n_by_ref(
+    collect_c_dlist_t*  l
+,   size_t              num_els
+,   void const*         ptr_new_els
+)
+{
+    assert(NULL != l);
+    assert(0 == num_els || NULL != ptr_new_els);
+
+    assert((NULL == l->head) == (NULL == l->tail));
+
+    if (0 == num_els)
+    {
+        return 0;
+    }
+    else
+    {
+        node_t*     first;
+        node_t*     last;
+        int const   r = clc_c_dl_make_chain_(l, num_els, ptr_new_els, &first, &last);
+
+        if (0 != r)
+        {
+            return r;
+        }
+
+        clc_c_dl_splice_chain_(l, NULL, l->head, first, last, num_els);
+
+        return 0;
+    }
+}
+
+
 /* ///////////////////////////// end of file //////////////////////////// */
 
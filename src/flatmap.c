@@ -0,0 +1,618 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    src/flatmap.c
+ *
+ * Purpose: Sorted flat map (and set) container.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/flatmap.h>
+
+#include "allocator.h"
+
+#include <assert.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions and macros
+ */
+
+#define COLLECT_C_FLATMAP_INTERNAL_INITIAL_CAPACITY_        (16)
+#define COLLECT_C_FLATMAP_INTERNAL_SORT_RUN_                (16)
+
+#define COLLECT_C_FLATMAP_INTERNAL_base_(m)                 (((char*)(m)->v.storage) + ((m)->v.offset * (m)->v.el_size))
+
+#define COLLECT_C_FLATMAP_INTERNAL_compare_(m, p_lhs, p_rhs)    ((*(m)->pfn_compare)((m), (p_lhs), (p_rhs)))
+
+/* Obtains the index of the first of the n entries at base that is not
+ * ordered before the key (or, if is_upper, that is ordered after it).
+ *
+ * Each step halves the range without a branch on the comparison, so there
+ * are no mispredictions, and prefetches the middle of each of the two
+ * ranges that the following step may search.
+ */
+static
+size_t
+clc_c_fm_bound_(
+    collect_c_flatmap_t const*  m
+,   char const*                 base
+,   size_t                      n
+,   void const*                 p_key
+,   bool                        is_upper
+)
+{
+    size_t const    el_size =   m->v.el_size;
+    int const       limit   =   is_upper ? 1 : 0;
+    size_t          lo      =   0;
+
+    if (0 == n)
+    {
+        return 0;
+    }
+
+    for (; n > 1; )
+    {
+        size_t const    half    =   n / 2;
+        size_t const    quarter =   (n - half) / 2;
+
+        COLLECT_C_UTIL_PREFETCH_(base + ((lo + quarter) * el_size));
+        COLLECT_C_UTIL_PREFETCH_(base + ((lo + half + quarter) * el_size));
+
+        lo += (COLLECT_C_FLATMAP_INTERNAL_compare_(m, base + ((lo + half) * el_size), p_key) < limit) ? half : 0;
+        n -= half;
+    }
+
+    return lo + (COLLECT_C_FLATMAP_INTERNAL_compare_(m, base + (lo * el_size), p_key) < limit);
+}
+
+/* Merges the sorted runs [lo, mid) and [mid, hi) of src into dst, from
+ * index out, taking from the first run where entries are equal, and, if
+ * unique, dropping each entry equal to its predecessor. Returns the index
+ * one past the last entry written.
+ */
+static
+size_t
+clc_c_fm_merge_(
+    collect_c_flatmap_t const*  m
+,   char const*                 src
+,   char*                       dst
+,   size_t                      lo
+,   size_t                      mid
+,   size_t                      hi
+,   size_t                      out
+,   bool                        unique
+)
+{
+    size_t const    el_size =   m->v.el_size;
+    size_t          i       =   lo;
+    size_t          j       =   mid;
+
+    for (; i != mid || j != hi; )
+    {
+        char const* p_src;
+
+        if (i == mid)
+        {
+            p_src = src + (j++ * el_size);
+        }
+        else if (j == hi ||
+                 COLLECT_C_FLATMAP_INTERNAL_compare_(m, src + (j * el_size), src + (i * el_size)) >= 0)
+        {
+            p_src = src + (i++ * el_size);
+        }
+        else
+        {
+            p_src = src + (j++ * el_size);
+        }
+
+        if (unique &&
+            0 != out &&
+            0 == COLLECT_C_FLATMAP_INTERNAL_compare_(m, dst + ((out - 1) * el_size), p_src))
+        {
+            continue;
+        }
+
+        memcpy(dst + (out++ * el_size), p_src, el_size);
+    }
+
+    return out;
+}
+
+/* Sorts the n entries at base, stably, and drops all but the first of
+ * each set of equal entries, using scratch, which must have space for n
+ * entries. Returns the number of entries retained.
+ *
+ * Runs are first sorted by insertion and then merged bottom-up between
+ * base and scratch, the final merge also dropping the duplicates, so that
+ * the unique requires no separate pass (except where n is small enough
+ * that there are no merges).
+ */
+static
+size_t
+clc_c_fm_sort_unique_(
+    collect_c_flatmap_t const*  m
+,   char*                       base
+,   char*                       scratch
+,   size_t                      n
+)
+{
+    size_t const el_size = m->v.el_size;
+
+    for (size_t lo = 0; lo < n; lo += COLLECT_C_FLATMAP_INTERNAL_SORT_RUN_)
+    {
+        size_t const hi = (n - lo < COLLECT_C_FLATMAP_INTERNAL_SORT_RUN_) ? n : (lo + COLLECT_C_FLATMAP_INTERNAL_SORT_RUN_);
+
+        for (size_t ix = lo + 1; ix < hi; ++ix)
+        {
+            size_t jx = ix;
+
+            memcpy(scratch, base + (ix * el_size), el_size);
+
+            for (; lo != jx && COLLECT_C_FLATMAP_INTERNAL_compare_(m, scratch, base + ((jx - 1) * el_size)) < 0; --jx)
+            {}
+
+            if (ix != jx)
+            {
+                memmove(base + ((jx + 1) * el_size), base + (jx * el_size), (ix - jx) * el_size);
+                memcpy(base + (jx * el_size), scratch, el_size);
+            }
+        }
+    }
+
+    if (n <= COLLECT_C_FLATMAP_INTERNAL_SORT_RUN_)
+    {
+        size_t out = 0;
+
+        for (size_t ix = 0; n != ix; ++ix)
+        {
+            if (0 == out ||
+                0 != COLLECT_C_FLATMAP_INTERNAL_compare_(m, base + ((out - 1) * el_size), base + (ix * el_size)))
+            {
+                if (out != ix)
+                {
+                    memcpy(base + (out * el_size), base + (ix * el_size), el_size);
+                }
+
+                ++out;
+            }
+        }
+
+        return out;
+    }
+    else
+    {
+        char*   src =   base;
+        char*   dst =   scratch;
+        size_t  out =   n;
+
+        for (size_t width = COLLECT_C_FLATMAP_INTERNAL_SORT_RUN_; width < n; width *= 2)
+        {
+            bool const is_final = width >= n - width;
+
+            out = 0;
+
+            for (size_t lo = 0; lo < n; lo += 2 * width)
+            {
+                size_t const    mid =   (n - lo < width) ? n : (lo + width);
+                size_t const    hi  =   (n - mid < width) ? n : (mid + width);
+
+                out = clc_c_fm_merge_(m, src, dst, lo, mid, hi, out, is_final);
+            }
+
+            {
+                char* const t = src;
+
+                src = dst;
+                dst = t;
+            }
+        }
+
+        if (src != base)
+        {
+            memcpy(base, src, out * el_size);
+        }
+
+        return out;
+    }
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+uint32_t
+collect_c_flatmap_version(void)
+{
+    return COLLECT_C_FLATMAP_VER;
+}
+
+void
+collect_c_flatmap_free_storage(
+    collect_c_flatmap_t*    m
+)
+{
+    assert(NULL != m);
+
+    if (NULL != m->v.storage)
+    {
+        collect_c_vec_free_storage(&m->v);
+    }
+}
+
+int
+collect_c_flatmap_clear(
+    collect_c_flatmap_t*    m
+,   void*                   reserved0
+,   void*                   reserved1
+,   size_t*                 num_dropped
+)
+{
+    ((void)&reserved0);
+    ((void)&reserved1);
+
+    assert(NULL != m);
+    assert(NULL == reserved0);
+    assert(NULL == reserved1);
+
+    {
+        size_t dummy;
+
+        if (NULL == num_dropped)
+        {
+            num_dropped = &dummy;
+        }
+
+        *num_dropped = m->v.size;
+
+        if (NULL != m->v.storage)
+        {
+            collect_c_vec_clear(&m->v, NULL, NULL, NULL);
+        }
+
+        return 0;
+    }
+}
+
+size_t
+collect_c_flatmap_lower_bound(
+    collect_c_flatmap_t const*  m
+,   void const*                 p_key
+)
+{
+    assert(NULL != m);
+    assert(NULL != m->pfn_compare);
+    assert(NULL != p_key);
+
+    return clc_c_fm_bound_(m, COLLECT_C_FLATMAP_INTERNAL_base_(m), m->v.size, p_key, false);
+}
+
+size_t
+collect_c_flatmap_upper_bound(
+    collect_c_flatmap_t const*  m
+,   void const*                 p_key
+)
+{
+    assert(NULL != m);
+    assert(NULL != m->pfn_compare);
+    assert(NULL != p_key);
+
+    return clc_c_fm_bound_(m, COLLECT_C_FLATMAP_INTERNAL_base_(m), m->v.size, p_key, true);
+}
+
+void
+collect_c_flatmap_equal_range(
+    collect_c_flatmap_t const*  m
+,   void const*                 p_key
+,   size_t*                     index_first
+,   size_t*                     index_last
+)
+{
+    assert(NULL != m);
+    assert(NULL != m->pfn_compare);
+    assert(NULL != p_key);
+    assert(NULL != index_first);
+    assert(NULL != index_last);
+
+    {
+        char const* const   base    =   COLLECT_C_FLATMAP_INTERNAL_base_(m);
+        size_t const        ix      =   clc_c_fm_bound_(m, base, m->v.size, p_key, false);
+
+        *index_first    =   ix;
+        *index_last     =   ix + (m->v.size != ix && 0 == COLLECT_C_FLATMAP_INTERNAL_compare_(m, base + (ix * m->v.el_size), p_key));
+    }
+}
+
+int
+collect_c_flatmap_find_by_ref(
+    collect_c_flatmap_t const*  m
+,   void const*                 p_key
+,   void**                      p_entry
+)
+{
+    assert(NULL != m);
+    assert(NULL != m->pfn_compare);
+    assert(NULL != p_key);
+
+    {
+        char* const     base    =   COLLECT_C_FLATMAP_INTERNAL_base_(m);
+        size_t const    ix      =   clc_c_fm_bound_(m, base, m->v.size, p_key, false);
+        void*           dummy;
+
+        if (NULL == p_entry)
+        {
+            p_entry = &dummy;
+        }
+
+        if (m->v.size == ix ||
+            0 != COLLECT_C_FLATMAP_INTERNAL_compare_(m, base + (ix * m->v.el_size), p_key))
+        {
+            return ENOENT;
+        }
+
+        *p_entry = base + (ix * m->v.el_size);
+
+        return 0;
+    }
+}
+
+int
+collect_c_flatmap_insert_by_ref(
+    collect_c_flatmap_t*    m
+,   void const*             p_key
+,   void const*             p_value
+)
+{
+    assert(NULL != m);
+    assert(NULL != m->pfn_compare);
+    assert(NULL != p_key);
+
+    {
+        size_t const    el_size =   m->v.el_size;
+        size_t const    size    =   m->v.size;
+        size_t const    ix      =   clc_c_fm_bound_(m, COLLECT_C_FLATMAP_INTERNAL_base_(m), size, p_key, false);
+
+        if (size != ix &&
+            0 == COLLECT_C_FLATMAP_INTERNAL_compare_(m, COLLECT_C_FLATMAP_INTERNAL_base_(m) + (ix * el_size), p_key))
+        {
+            return EEXIST;
+        }
+
+        if (NULL == m->v.storage ||
+            m->v.capacity - m->v.offset == size)
+        {
+            size_t const    n_grown =   size + (size / 2);
+            int const       r       =   collect_c_vec_reserve(&m->v, (n_grown < COLLECT_C_FLATMAP_INTERNAL_INITIAL_CAPACITY_) ? COLLECT_C_FLATMAP_INTERNAL_INITIAL_CAPACITY_ : n_grown, 0);
+
+            if (0 != r)
+            {
+                return r;
+            }
+        }
+
+        {
+            char* const p_entry = COLLECT_C_FLATMAP_INTERNAL_base_(m) + (ix * el_size);
+
+            memmove(p_entry + el_size, p_entry, (size - ix) * el_size);
+
+            memset(p_entry, 0, el_size);
+            memcpy(p_entry, p_key, m->key_size);
+
+            if (0 != m->value_size &&
+                NULL != p_value)
+            {
+                memcpy(p_entry + m->value_offset, p_value, m->value_size);
+            }
+
+            ++m->v.size;
+        }
+
+        return 0;
+    }
+}
+
+int
+collect_c_flatmap_insert_n_by_ref(
+    collect_c_flatmap_t*    m
+,   size_t                  num_entries
+,   void const*             p_entries
+,   size_t*                 num_inserted
+)
+{
+    assert(NULL != m);
+    assert(NULL != m->pfn_compare);
+    assert(0 == num_entries || NULL != p_entries);
+
+    {
+        size_t dummy;
+
+        if (NULL == num_inserted)
+        {
+            num_inserted = &dummy;
+        }
+
+        *num_inserted = 0;
+
+        if (0 == num_entries)
+        {
+            return 0;
+        }
+        else
+        {
+            size_t const    el_size =   m->v.el_size;
+            size_t const    size    =   m->v.size;
+            size_t const    cb      =   2 * num_entries * el_size;
+            char* const     delta   =   collect_c_mem_alloc(m->v.allocator, cb);
+            size_t          n_new   =   0;
+
+            if (NULL == delta)
+            {
+                return ENOMEM;
+            }
+
+            memcpy(delta, p_entries, num_entries * el_size);
+
+            {
+                size_t const    n_uniq  =   clc_c_fm_sort_unique_(m, delta, delta + (num_entries * el_size), num_entries);
+
+                /* room is reserved for all the (unique) delta entries,
+                 * since those already in the map are not known until
+                 * the merge
+                 */
+                int const       r       =   collect_c_vec_reserve(&m->v, size + n_uniq, 0);
+
+                if (0 != r)
+                {
+                    collect_c_mem_free(m->v.allocator, delta, cb);
+
+                    return r;
+                }
+                else
+                {
+                    char* const base    =   COLLECT_C_FLATMAP_INTERNAL_base_(m);
+                    size_t      i       =   size;
+                    size_t      j       =   n_uniq;
+                    size_t      k       =   size + n_uniq;
+
+                    /* merge from the back, in a single pass, so that each
+                     * entry is moved at most once; delta entries already
+                     * in the map are dropped, the existing entries
+                     * retaining their values
+                     */
+                    for (; 0 != j; )
+                    {
+                        char const* const   p_entry =   delta + ((j - 1) * el_size);
+                        int const           cmp     =   (0 == i) ? -1 : COLLECT_C_FLATMAP_INTERNAL_compare_(m, base + ((i - 1) * el_size), p_entry);
+
+                        /* k is above i while any delta entries remain, so
+                         * no entry is copied onto itself
+                         */
+                        if (cmp < 0)
+                        {
+                            memcpy(base + (--k * el_size), p_entry, el_size);
+                            ++n_new;
+                        }
+                        else
+                        {
+                            --i;
+                            memcpy(base + (--k * el_size), base + (i * el_size), el_size);
+                        }
+
+                        if (cmp <= 0)
+                        {
+                            --j;
+                        }
+                    }
+
+                    /* the merged entries are above a gap the size of the
+                     * number dropped, which is now closed
+                     */
+                    if (n_uniq != n_new)
+                    {
+                        memmove(base + (i * el_size), base + (k * el_size), (size + n_uniq - k) * el_size);
+                    }
+
+                    m->v.size = size + n_new;
+                }
+            }
+
+            collect_c_mem_free(m->v.allocator, delta, cb);
+
+            *num_inserted = n_new;
+
+            return 0;
+        }
+    }
+}
+
+int
+collect_c_flatmap_assign_n_by_ref(
+    collect_c_flatmap_t*    m
+,   size_t                  num_entries
+,   void const*             p_entries
+)
+{
+    assert(NULL != m);
+    assert(NULL != m->pfn_compare);
+    assert(0 == num_entries || NULL != p_entries);
+
+    if (0 == num_entries)
+    {
+        return collect_c_flatmap_clear(m, NULL, NULL, NULL);
+    }
+    else
+    {
+        size_t const    el_size =   m->v.el_size;
+        size_t const    cb      =   num_entries * el_size;
+        char* const     scratch =   collect_c_mem_alloc(m->v.allocator, cb);
+
+        if (NULL == scratch)
+        {
+            return ENOMEM;
+        }
+        else
+        {
+            int const r = collect_c_vec_reserve(&m->v, num_entries, 0);
+
+            if (0 != r)
+            {
+                collect_c_mem_free(m->v.allocator, scratch, cb);
+
+                return r;
+            }
+        }
+
+        collect_c_flatmap_clear(m, NULL, NULL, NULL);
+
+        {
+            char* const base = COLLECT_C_FLATMAP_INTERNAL_base_(m);
+
+            memcpy(base, p_entries, cb);
+
+            m->v.size = clc_c_fm_sort_unique_(m, base, scratch, num_entries);
+        }
+
+        collect_c_mem_free(m->v.allocator, scratch, cb);
+
+        return 0;
+    }
+}
+
+int
+collect_c_flatmap_erase_by_ref(
+    collect_c_flatmap_t*    m
+,   void const*             p_key
+)
+{
+    assert(NULL != m);
+    assert(NULL != m->pfn_compare);
+    assert(NULL != p_key);
+
+    {
+        char* const     base    =   COLLECT_C_FLATMAP_INTERNAL_base_(m);
+        size_t const    ix      =   clc_c_fm_bound_(m, base, m->v.size, p_key, false);
+
+        if (m->v.size == ix ||
+            0 != COLLECT_C_FLATMAP_INTERNAL_compare_(m, base + (ix * m->v.el_size), p_key))
+        {
+            return ENOENT;
+        }
+
+        return collect_c_v_erase_range(&m->v, ix, ix + 1, NULL);
+    }
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
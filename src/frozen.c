@@ -0,0 +1,360 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    src/frozen.c
+ *
+ * Purpose: Frozen (static) sorted array, in a cache-friendly layout.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/frozen.h>
+
+#include "allocator.h"
+
+#include <assert.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions and macros
+ */
+
+#define COLLECT_C_FROZEN_INTERNAL_compare_(z, p_el, p_key)  ((*(z)->pfn_compare)((z), (p_el), (p_key)))
+
+/* The number of elements in a B-tree block: as many as fit in a cache line,
+ * but at least 2.
+ */
+static
+size_t
+clc_c_fz_btree_block_size_(
+    size_t  el_size
+)
+{
+    size_t const n = COLLECT_C_FROZEN_CACHE_LINE_SIZE / el_size;
+
+    return (n < 2) ? 2 : n;
+}
+
+/* The number of Eytzinger descendants, of a given node, that are
+ * prefetched: those 2^L at L levels below, where 2^L is the greatest power
+ * of 2 whose elements fit in a cache line, but at least 2 (at the level
+ * below).
+ */
+static
+size_t
+clc_c_fz_eytzinger_prefetch_size_(
+    size_t  el_size
+)
+{
+    size_t n = 2;
+
+    for (; 2 * n * el_size <= COLLECT_C_FROZEN_CACHE_LINE_SIZE; )
+    {
+        n *= 2;
+    }
+
+    return n;
+}
+
+/* Places the (sorted) elements, from *ix_src, into the Eytzinger slots of
+ * the subtree rooted at k, by in-order traversal.
+ */
+static
+void
+clc_c_fz_build_eytzinger_(
+    char const* src
+,   char*       dst
+,   size_t      el_size
+,   size_t      n
+,   size_t*     ix_src
+,   size_t      k
+)
+{
+    if (k <= n)
+    {
+        clc_c_fz_build_eytzinger_(src, dst, el_size, n, ix_src, 2 * k);
+
+        memcpy(dst + (k * el_size), src + (*ix_src * el_size), el_size);
+        ++*ix_src;
+
+        clc_c_fz_build_eytzinger_(src, dst, el_size, n, ix_src, (2 * k) + 1);
+    }
+}
+
+/* Places the (sorted) elements, from *ix_src, into the slots of the
+ * B-tree subtree rooted at block k, by in-order traversal. Slots that
+ * remain once all elements are placed take copies of the last, so that
+ * every block is full and the slots are in order.
+ */
+static
+void
+clc_c_fz_build_btree_(
+    char const* src
+,   char*       dst
+,   size_t      el_size
+,   size_t      n
+,   size_t      block_size
+,   size_t      num_blocks
+,   size_t*     ix_src
+,   size_t      k
+)
+{
+    if (k < num_blocks)
+    {
+        size_t const first_child = (k * (block_size + 1)) + 1;
+
+        for (size_t j = 0; block_size != j; ++j)
+        {
+            clc_c_fz_build_btree_(src, dst, el_size, n, block_size, num_blocks, ix_src, first_child + j);
+
+            {
+                size_t const ix = (*ix_src < n) ? (*ix_src)++ : (n - 1);
+
+                memcpy(dst + (((k * block_size) + j) * el_size), src + (ix * el_size), el_size);
+            }
+        }
+
+        clc_c_fz_build_btree_(src, dst, el_size, n, block_size, num_blocks, ix_src, first_child + block_size);
+    }
+}
+
+static
+void const*
+clc_c_fz_lower_bound_eytzinger_(
+    collect_c_frozen_t const*   z
+,   void const*                 p_key
+)
+{
+    char const* const   base    =   (char const*)z->storage;
+    size_t const        el_size =   z->el_size;
+    size_t const        n       =   z->size;
+    size_t const        n_pf    =   z->block_size;
+    size_t              k       =   1;
+    size_t              res     =   0;
+
+    for (; k <= n; )
+    {
+        int const c = COLLECT_C_FROZEN_INTERNAL_compare_(z, base + (k * el_size), p_key);
+
+        /* the descendants of k at L levels below are slots
+         * [k * 2^L, (k + 1) * 2^L), which are in one line when the
+         * elements are a power of 2 in size
+         */
+        COLLECT_C_UTIL_PREFETCH_(base + ((k * n_pf) * el_size));
+        COLLECT_C_UTIL_PREFETCH_(base + ((((k + 1) * n_pf) - 1) * el_size));
+
+        /* the result is the last node at which the search went left */
+        res = (c >= 0) ? k : res;
+        k   = (2 * k) + (c < 0);
+    }
+
+    return (0 == res) ? NULL : (base + (res * el_size));
+}
+
+static
+void const*
+clc_c_fz_lower_bound_btree_(
+    collect_c_frozen_t const*   z
+,   void const*                 p_key
+)
+{
+    char const* const   base        =   (char const*)z->storage;
+    size_t const        el_size     =   z->el_size;
+    size_t const        block_size  =   z->block_size;
+    size_t const        num_blocks  =   z->num_slots / block_size;
+    size_t              k           =   0;
+    char const*         res         =   NULL;
+
+    for (; k < num_blocks; )
+    {
+        char const* const   block   =   base + ((k * block_size) * el_size);
+        size_t              lo      =   0;
+        size_t              len     =   block_size;
+
+        /* the (full) block is searched branchlessly, as in the flat map */
+        for (; len > 1; )
+        {
+            size_t const half = len / 2;
+
+            lo  +=  (COLLECT_C_FROZEN_INTERNAL_compare_(z, block + ((lo + half) * el_size), p_key) < 0) ? half : 0;
+            len -=  half;
+        }
+
+        lo += (COLLECT_C_FROZEN_INTERNAL_compare_(z, block + (lo * el_size), p_key) < 0);
+
+        res = (lo < block_size) ? (block + (lo * el_size)) : res;
+        k   = (k * (block_size + 1)) + lo + 1;
+    }
+
+    return res;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+uint32_t
+collect_c_frozen_version(void)
+{
+    return COLLECT_C_FROZEN_VER;
+}
+
+void
+collect_c_frozen_free_storage(
+    collect_c_frozen_t* z
+)
+{
+    assert(NULL != z);
+
+    if (NULL != z->allocation)
+    {
+        collect_c_mem_free(z->allocator, z->allocation, z->cb_allocation);
+    }
+
+    z->size             =   0;
+    z->storage          =   NULL;
+    z->num_slots        =   0;
+    z->allocation       =   NULL;
+    z->cb_allocation    =   0;
+}
+
+int
+collect_c_frozen_freeze(
+    collect_c_frozen_t*     z
+,   collect_c_vec_t const*  v
+,   int32_t                 flags
+)
+{
+    assert(NULL != z);
+    assert(NULL != v);
+    assert(z->el_size == v->el_size);
+    assert(COLLECT_C_FROZEN_F_EYTZINGER == flags || COLLECT_C_FROZEN_F_BTREE == flags);
+
+    if (0 == v->size)
+    {
+        collect_c_frozen_free_storage(z);
+
+        z->flags = flags;
+
+        return 0;
+    }
+    else
+    {
+        size_t const        el_size     =   z->el_size;
+        size_t const        n           =   v->size;
+        bool const          is_btree    =   COLLECT_C_FROZEN_F_BTREE == flags;
+        size_t const        block_size  =   is_btree ? clc_c_fz_btree_block_size_(el_size) : clc_c_fz_eytzinger_prefetch_size_(el_size);
+        size_t const        num_blocks  =   is_btree ? ((n + (block_size - 1)) / block_size) : 0;
+        size_t const        num_slots   =   is_btree ? (num_blocks * block_size) : (n + 1);
+        size_t const        cb          =   (num_slots * el_size) + (COLLECT_C_FROZEN_CACHE_LINE_SIZE - 1);
+        void* const         allocation  =   collect_c_mem_alloc(z->allocator, cb);
+        char const* const   src         =   ((char const*)v->storage) + (v->offset * el_size);
+
+        if (NULL == allocation)
+        {
+            return ENOMEM;
+        }
+        else
+        {
+            uintptr_t const a       =   (uintptr_t)allocation;
+            char* const     dst     =   (char*)allocation + ((COLLECT_C_FROZEN_CACHE_LINE_SIZE - (a % COLLECT_C_FROZEN_CACHE_LINE_SIZE)) % COLLECT_C_FROZEN_CACHE_LINE_SIZE);
+            size_t          ix_src  =   0;
+
+            if (is_btree)
+            {
+                clc_c_fz_build_btree_(src, dst, el_size, n, block_size, num_blocks, &ix_src, 0);
+            }
+            else
+            {
+                /* slot 0 is unused */
+                memset(dst, 0, el_size);
+
+                clc_c_fz_build_eytzinger_(src, dst, el_size, n, &ix_src, 1);
+            }
+
+            assert(n == ix_src);
+
+            collect_c_frozen_free_storage(z);
+
+            z->size             =   n;
+            z->flags            =   flags;
+            z->storage          =   dst;
+            z->num_slots        =   num_slots;
+            z->block_size       =   block_size;
+            z->allocation       =   allocation;
+            z->cb_allocation    =   cb;
+
+            return 0;
+        }
+    }
+}
+
+void const*
+collect_c_frozen_lower_bound(
+    collect_c_frozen_t const*   z
+,   void const*                 p_key
+)
+{
+    assert(NULL != z);
+    assert(NULL != z->pfn_compare);
+    assert(NULL != p_key);
+
+    if (0 == z->size)
+    {
+        return NULL;
+    }
+    else if (COLLECT_C_FROZEN_F_BTREE == z->flags)
+    {
+        return clc_c_fz_lower_bound_btree_(z, p_key);
+    }
+    else
+    {
+        return clc_c_fz_lower_bound_eytzinger_(z, p_key);
+    }
+}
+
+int
+collect_c_frozen_find_by_ref(
+    collect_c_frozen_t const*   z
+,   void const*                 p_key
+,   void const**                p_el
+)
+{
+    assert(NULL != z);
+    assert(NULL != z->pfn_compare);
+    assert(NULL != p_key);
+
+    {
+        void const* const   p_lb    =   collect_c_frozen_lower_bound(z, p_key);
+        void const*         dummy;
+
+        if (NULL == p_el)
+        {
+            p_el = &dummy;
+        }
+
+        if (NULL == p_lb ||
+            0 != COLLECT_C_FROZEN_INTERNAL_compare_(z, p_lb, p_key))
+        {
+            return ENOENT;
+        }
+
+        *p_el = p_lb;
+
+        return 0;
+    }
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
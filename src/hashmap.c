@@ -0,0 +1,525 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    src/hashmap.c
+ *
+ * Purpose: Hash map container.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/hashmap.h>
+
+#include "allocator.h"
+#include "swiss.h"
+
+#include <assert.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions and macros
+ */
+
+#define COLLECT_C_HASHMAP_INTERNAL_NOT_FOUND_               COLLECT_C_SWISS_NO_SLOT
+
+#define COLLECT_C_HASHMAP_INTERNAL_entry_(m, ix)            ((void*)(((char*)(m)->entries) + ((ix) * (m)->entry_size)))
+
+/* The control bytes and the entries are held in a single block, the
+ * entries following the control bytes; as the capacity is a multiple of
+ * the group width, the entries are suitably aligned.
+ */
+#define COLLECT_C_HASHMAP_INTERNAL_block_size_(m, capacity) ((capacity) + ((capacity) * (m)->entry_size))
+
+static
+inline
+size_t
+clc_c_hm_hash_(
+    collect_c_hashmap_t const*  m
+,   void const*                 p_key
+)
+{
+    if (NULL == m->pfn_hash)
+    {
+        return collect_c_swiss_hash_key(p_key, m->key_size);
+    }
+    else
+    {
+        return (*m->pfn_hash)(m, p_key);
+    }
+}
+
+static
+inline
+bool
+clc_c_hm_keys_equal_(
+    collect_c_hashmap_t const*  m
+,   void const*                 p_lhs
+,   void const*                 p_rhs
+)
+{
+    if (NULL == m->pfn_compare)
+    {
+        return collect_c_swiss_keys_equal(p_lhs, p_rhs, m->key_size);
+    }
+    else
+    {
+        return 0 == (*m->pfn_compare)(m, p_lhs, p_rhs);
+    }
+}
+
+static
+void
+clc_c_hm_free_entry_(
+    collect_c_hashmap_t const*  m
+,   void*                       entry
+)
+{
+    if (NULL != m->pfn_element_free)
+    {
+        (*m->pfn_element_free)(m->entry_size, 0, entry, m->param_element_free);
+    }
+}
+
+/* Obtains the index of the slot holding the given key, or
+ * COLLECT_C_HASHMAP_INTERNAL_NOT_FOUND_.
+ */
+static
+size_t
+clc_c_hm_find_(
+    collect_c_hashmap_t const*  m
+,   void const*                 p_key
+,   size_t                      hash
+)
+{
+    if (0 != m->capacity)
+    {
+        int8_t const    h2      =   COLLECT_C_SWISS_h2_(hash);
+        size_t const    mask    =   (m->capacity / COLLECT_C_SWISS_GROUP_WIDTH) - 1;
+        size_t          g       =   COLLECT_C_SWISS_h1_(hash) & mask;
+
+        /* groups are visited by triangular probing, which visits each
+         * group once, and a search ends at a group with an empty slot
+         */
+        for (size_t i = 0;; )
+        {
+            int8_t const* const group = m->ctrl + (g * COLLECT_C_SWISS_GROUP_WIDTH);
+
+            for (uint32_t matches = collect_c_swiss_match_h2(group, h2); 0 != matches; matches &= matches - 1)
+            {
+                size_t const ix = (g * COLLECT_C_SWISS_GROUP_WIDTH) + collect_c_swiss_lowest(matches);
+
+                if (clc_c_hm_keys_equal_(m, p_key, COLLECT_C_HASHMAP_INTERNAL_entry_(m, ix)))
+                {
+                    return ix;
+                }
+            }
+
+            if (0 != collect_c_swiss_match_empty(group))
+            {
+                break;
+            }
+
+            g = (g + ++i) & mask;
+        }
+    }
+
+    return COLLECT_C_HASHMAP_INTERNAL_NOT_FOUND_;
+}
+
+static
+size_t
+clc_c_hm_hash_entry_(
+    void const* param
+,   void const* entry
+)
+{
+    /* the key is at the start of the entry */
+    return clc_c_hm_hash_((collect_c_hashmap_t const*)param, entry);
+}
+
+/* Obtains a view of the table's bookkeeping fields, by which the
+ * operations of swiss.h act on the map.
+ */
+static
+inline
+collect_c_swiss_table_t
+clc_c_hm_table_(
+    collect_c_hashmap_t*    m
+)
+{
+    collect_c_swiss_table_t const t =
+    {
+        .size           =   &m->size,
+        .capacity       =   &m->capacity,
+        .growth_left    =   &m->growth_left,
+        .num_deleted    =   &m->num_deleted,
+        .ctrl           =   &m->ctrl,
+        .slots          =   &m->entries,
+        .slot_size      =   m->entry_size,
+        .allocator      =   m->allocator,
+        .pfn_hash       =   clc_c_hm_hash_entry_,
+        .param_hash     =   m,
+    };
+
+    return t;
+}
+
+static
+int
+clc_c_hm_resize_(
+    collect_c_hashmap_t*    m
+,   size_t                  new_capacity
+)
+{
+    collect_c_swiss_table_t const t = clc_c_hm_table_(m);
+
+    return collect_c_swiss_resize(&t, new_capacity);
+}
+
+/* Claims a slot for a new entry of the given hash, rehashing if required,
+ * and returns its index, or COLLECT_C_HASHMAP_INTERNAL_NOT_FOUND_ if
+ * memory is exhausted.
+ */
+static
+size_t
+clc_c_hm_prepare_insert_(
+    collect_c_hashmap_t*    m
+,   size_t                  hash
+)
+{
+    collect_c_swiss_table_t const t = clc_c_hm_table_(m);
+
+    return collect_c_swiss_prepare_insert(&t, hash);
+}
+
+static
+void
+clc_c_hm_erase_at_(
+    collect_c_hashmap_t*    m
+,   size_t                  ix
+)
+{
+    collect_c_swiss_table_t const t = clc_c_hm_table_(m);
+
+    collect_c_swiss_erase_at(&t, ix);
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+uint32_t
+collect_c_hashmap_version(void)
+{
+    return COLLECT_C_HASHMAP_VER;
+}
+
+size_t
+collect_c_hashmap_hash_bytes(
+    void const* p
+,   size_t      cb
+)
+{
+    assert(NULL != p || 0 == cb);
+
+    return collect_c_swiss_hash_bytes(p, cb);
+}
+
+int
+collect_c_hashmap_free_storage(
+    collect_c_hashmap_t*    m
+)
+{
+    assert(NULL != m);
+
+    if (NULL != m->ctrl)
+    {
+        if (NULL != m->pfn_element_free)
+        {
+            for (size_t ix = 0; m->capacity != ix; ++ix)
+            {
+                if (m->ctrl[ix] >= 0)
+                {
+                    clc_c_hm_free_entry_(m, COLLECT_C_HASHMAP_INTERNAL_entry_(m, ix));
+                }
+            }
+        }
+
+        collect_c_mem_free(m->allocator, m->ctrl, COLLECT_C_HASHMAP_INTERNAL_block_size_(m, m->capacity));
+    }
+
+    m->size         =   0;
+    m->capacity     =   0;
+    m->growth_left  =   0;
+    m->num_deleted  =   0;
+    m->ctrl         =   NULL;
+    m->entries      =   NULL;
+
+    return 0;
+}
+
+int
+collect_c_hashmap_clear(
+    collect_c_hashmap_t*    m
+,   void*                   reserved0
+,   void*                   reserved1
+,   size_t*                 num_dropped
+)
+{
+    ((void)&reserved0);
+    ((void)&reserved1);
+
+    assert(NULL != m);
+    assert(NULL == reserved0);
+    assert(NULL == reserved1);
+
+    {
+        size_t dummy;
+
+        if (NULL == num_dropped)
+        {
+            num_dropped = &dummy;
+        }
+
+        *num_dropped = m->size;
+
+        if (0 != m->capacity)
+        {
+            if (NULL != m->pfn_element_free)
+            {
+                for (size_t ix = 0; m->capacity != ix; ++ix)
+                {
+                    if (m->ctrl[ix] >= 0)
+                    {
+                        clc_c_hm_free_entry_(m, COLLECT_C_HASHMAP_INTERNAL_entry_(m, ix));
+                    }
+                }
+            }
+
+            memset(m->ctrl, COLLECT_C_SWISS_CTRL_EMPTY, m->capacity);
+
+            m->size         =   0;
+            m->growth_left  =   COLLECT_C_SWISS_max_load_(m->capacity);
+            m->num_deleted  =   0;
+        }
+
+        return 0;
+    }
+}
+
+int
+collect_c_hashmap_reserve(
+    collect_c_hashmap_t*    m
+,   size_t                  num_entries
+)
+{
+    assert(NULL != m);
+
+    if (num_entries <= m->size + m->growth_left)
+    {
+        return 0;
+    }
+    else
+    {
+        size_t const required = collect_c_swiss_capacity_for(num_entries);
+
+        /* if the capacity suffices, then rehashing removes tombstones */
+        return clc_c_hm_resize_(m, (required < m->capacity) ? m->capacity : required);
+    }
+}
+
+int
+collect_c_hashmap_find_by_ref(
+    collect_c_hashmap_t const*  m
+,   void const*                 p_key
+,   void**                      p_value
+)
+{
+    assert(NULL != m);
+    assert(NULL != p_key);
+
+    {
+        size_t const ix = clc_c_hm_find_(m, p_key, clc_c_hm_hash_(m, p_key));
+
+        if (COLLECT_C_HASHMAP_INTERNAL_NOT_FOUND_ == ix)
+        {
+            return ENOENT;
+        }
+        else
+        {
+            if (NULL != p_value)
+            {
+                *p_value = ((char*)COLLECT_C_HASHMAP_INTERNAL_entry_(m, ix)) + m->value_offset;
+            }
+
+            return 0;
+        }
+    }
+}
+
+int
+collect_c_hashmap_insert_by_ref(
+    collect_c_hashmap_t*    m
+,   void const*             p_key
+,   void const*             p_value
+,   void**                  p_entry_value
+)
+{
+    assert(NULL != m);
+    assert(NULL != p_key);
+
+    {
+        void*           dummy;
+        size_t const    hash    =   clc_c_hm_hash_(m, p_key);
+        size_t          ix      =   clc_c_hm_find_(m, p_key, hash);
+
+        if (NULL == p_entry_value)
+        {
+            p_entry_value = &dummy;
+        }
+
+        if (COLLECT_C_HASHMAP_INTERNAL_NOT_FOUND_ != ix)
+        {
+            *p_entry_value = ((char*)COLLECT_C_HASHMAP_INTERNAL_entry_(m, ix)) + m->value_offset;
+
+            return EEXIST;
+        }
+        else if (COLLECT_C_HASHMAP_INTERNAL_NOT_FOUND_ == (ix = clc_c_hm_prepare_insert_(m, hash)))
+        {
+            return ENOMEM;
+        }
+        else
+        {
+            char* const entry = COLLECT_C_HASHMAP_INTERNAL_entry_(m, ix);
+
+            memcpy(entry, p_key, m->key_size);
+
+            if (NULL == p_value)
+            {
+                memset(entry + m->value_offset, 0, m->value_size);
+            }
+            else
+            {
+                memcpy(entry + m->value_offset, p_value, m->value_size);
+            }
+
+            *p_entry_value = entry + m->value_offset;
+
+            return 0;
+        }
+    }
+}
+
+int
+collect_c_hashmap_insert_or_assign_by_ref(
+    collect_c_hashmap_t*    m
+,   void const*             p_key
+,   void const*             p_value
+)
+{
+    assert(NULL != m);
+    assert(NULL != p_key);
+    assert(NULL != p_value);
+
+    {
+        size_t const    hash    =   clc_c_hm_hash_(m, p_key);
+        size_t          ix      =   clc_c_hm_find_(m, p_key, hash);
+
+        if (COLLECT_C_HASHMAP_INTERNAL_NOT_FOUND_ != ix)
+        {
+            clc_c_hm_free_entry_(m, COLLECT_C_HASHMAP_INTERNAL_entry_(m, ix));
+        }
+        else if (COLLECT_C_HASHMAP_INTERNAL_NOT_FOUND_ == (ix = clc_c_hm_prepare_insert_(m, hash)))
+        {
+            return ENOMEM;
+        }
+
+        {
+            char* const entry = COLLECT_C_HASHMAP_INTERNAL_entry_(m, ix);
+
+            memcpy(entry, p_key, m->key_size);
+            memcpy(entry + m->value_offset, p_value, m->value_size);
+        }
+
+        return 0;
+    }
+}
+
+int
+collect_c_hashmap_erase_by_ref(
+    collect_c_hashmap_t*    m
+,   void const*             p_key
+)
+{
+    assert(NULL != m);
+    assert(NULL != p_key);
+
+    {
+        size_t const ix = clc_c_hm_find_(m, p_key, clc_c_hm_hash_(m, p_key));
+
+        if (COLLECT_C_HASHMAP_INTERNAL_NOT_FOUND_ == ix)
+        {
+            return ENOENT;
+        }
+        else
+        {
+            clc_c_hm_free_entry_(m, COLLECT_C_HASHMAP_INTERNAL_entry_(m, ix));
+
+            clc_c_hm_erase_at_(m, ix);
+
+            return 0;
+        }
+    }
+}
+
+int
+collect_c_hashmap_next_entry(
+    collect_c_hashmap_t const*  m
+,   size_t*                     cursor
+,   void const**                p_key
+,   void**                      p_value
+)
+{
+    assert(NULL != m);
+    assert(NULL != cursor);
+
+    for (size_t ix = *cursor; ix < m->capacity; ++ix)
+    {
+        if (m->ctrl[ix] >= 0)
+        {
+            char* const entry = COLLECT_C_HASHMAP_INTERNAL_entry_(m, ix);
+
+            if (NULL != p_key)
+            {
+                *p_key = entry;
+            }
+
+            if (NULL != p_value)
+            {
+                *p_value = entry + m->value_offset;
+            }
+
+            *cursor = ix + 1;
+
+            return 0;
+        }
+    }
+
+    *cursor = m->capacity;
+
+    return ENOENT;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
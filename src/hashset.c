@@ -0,0 +1,528 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    src/hashset.c
+ *
+ * Purpose: Hash set container.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/hashset.h>
+
+#include "allocator.h"
+#include "swiss.h"
+
+#include <assert.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions and macros
+ */
+
+#define COLLECT_C_HASHSET_INTERNAL_NOT_FOUND_               COLLECT_C_SWISS_NO_SLOT
+
+/* The number of keys whose hashes are computed, and whose probe groups
+ * are prefetched, ahead of their being probed by the bulk operations.
+ */
+#define COLLECT_C_HASHSET_INTERNAL_BATCH_SIZE_              (16)
+
+#define COLLECT_C_HASHSET_INTERNAL_key_(s, ix, key_size)    ((void*)(((char*)(s)->keys) + ((ix) * (key_size))))
+
+/* The control bytes and the keys are held in a single block, the keys
+ * following the control bytes.
+ */
+#define COLLECT_C_HASHSET_INTERNAL_block_size_(s, capacity) ((capacity) + ((capacity) * (s)->key_size))
+
+/* Obtains the index of the slot holding the given key, or
+ * COLLECT_C_HASHSET_INTERNAL_NOT_FOUND_.
+ */
+static
+COLLECT_C_UTIL_FORCE_INLINE_
+size_t
+clc_c_hs_find_(
+    collect_c_hashset_t const*  s
+,   void const*                 p_key
+,   size_t                      hash
+,   size_t                      key_size
+)
+{
+    if (0 != s->capacity)
+    {
+        int8_t const    h2      =   COLLECT_C_SWISS_h2_(hash);
+        size_t const    mask    =   (s->capacity / COLLECT_C_SWISS_GROUP_WIDTH) - 1;
+        size_t          g       =   COLLECT_C_SWISS_h1_(hash) & mask;
+
+        for (size_t i = 0;; )
+        {
+            int8_t const* const group = s->ctrl + (g * COLLECT_C_SWISS_GROUP_WIDTH);
+
+            for (uint32_t matches = collect_c_swiss_match_h2(group, h2); 0 != matches; matches &= matches - 1)
+            {
+                size_t const ix = (g * COLLECT_C_SWISS_GROUP_WIDTH) + collect_c_swiss_lowest(matches);
+
+                if (collect_c_swiss_keys_equal(p_key, COLLECT_C_HASHSET_INTERNAL_key_(s, ix, key_size), key_size))
+                {
+                    return ix;
+                }
+            }
+
+            if (0 != collect_c_swiss_match_empty(group))
+            {
+                break;
+            }
+
+            g = (g + ++i) & mask;
+        }
+    }
+
+    return COLLECT_C_HASHSET_INTERNAL_NOT_FOUND_;
+}
+
+/* Prefetches the control bytes and the keys of the first group on the
+ * probe sequence of the given hash.
+ */
+static
+COLLECT_C_UTIL_FORCE_INLINE_
+void
+clc_c_hs_prefetch_(
+    collect_c_hashset_t const*  s
+,   size_t                      hash
+,   size_t                      key_size
+)
+{
+    if (0 != s->capacity)
+    {
+        size_t const g = COLLECT_C_SWISS_h1_(hash) & ((s->capacity / COLLECT_C_SWISS_GROUP_WIDTH) - 1);
+
+        COLLECT_C_UTIL_PREFETCH_(s->ctrl + (g * COLLECT_C_SWISS_GROUP_WIDTH));
+        COLLECT_C_UTIL_PREFETCH_(COLLECT_C_HASHSET_INTERNAL_key_(s, g * COLLECT_C_SWISS_GROUP_WIDTH, key_size));
+    }
+}
+
+static
+size_t
+clc_c_hs_hash_key_(
+    void const* param
+,   void const* key
+)
+{
+    return collect_c_swiss_hash_key(key, ((collect_c_hashset_t const*)param)->key_size);
+}
+
+/* Obtains a view of the table's bookkeeping fields, by which the
+ * operations of swiss.h act on the set.
+ */
+static
+inline
+collect_c_swiss_table_t
+clc_c_hs_table_(
+    collect_c_hashset_t*    s
+)
+{
+    collect_c_swiss_table_t const t =
+    {
+        .size           =   &s->size,
+        .capacity       =   &s->capacity,
+        .growth_left    =   &s->growth_left,
+        .num_deleted    =   &s->num_deleted,
+        .ctrl           =   &s->ctrl,
+        .slots          =   &s->keys,
+        .slot_size      =   s->key_size,
+        .allocator      =   s->allocator,
+        .pfn_hash       =   clc_c_hs_hash_key_,
+        .param_hash     =   s,
+    };
+
+    return t;
+}
+
+static
+COLLECT_C_UTIL_FORCE_INLINE_
+int
+clc_c_hs_insert_(
+    collect_c_hashset_t*    s
+,   void const*             p_key
+,   size_t                  hash
+,   size_t                  key_size
+)
+{
+    collect_c_swiss_table_t const   t   =   clc_c_hs_table_(s);
+    size_t                          ix  =   clc_c_hs_find_(s, p_key, hash, key_size);
+
+    if (COLLECT_C_HASHSET_INTERNAL_NOT_FOUND_ != ix)
+    {
+        return EEXIST;
+    }
+    else if (COLLECT_C_HASHSET_INTERNAL_NOT_FOUND_ == (ix = collect_c_swiss_prepare_insert(&t, hash)))
+    {
+        return ENOMEM;
+    }
+    else
+    {
+        memcpy(COLLECT_C_HASHSET_INTERNAL_key_(s, ix, key_size), p_key, key_size);
+
+        return 0;
+    }
+}
+
+static
+COLLECT_C_UTIL_FORCE_INLINE_
+int
+clc_c_hs_find_one_(
+    collect_c_hashset_t const*  s
+,   void const*                 p_key
+,   size_t                      key_size
+)
+{
+    return (COLLECT_C_HASHSET_INTERNAL_NOT_FOUND_ == clc_c_hs_find_(s, p_key, collect_c_swiss_hash_key(p_key, key_size), key_size)) ? ENOENT : 0;
+}
+
+static
+COLLECT_C_UTIL_FORCE_INLINE_
+int
+clc_c_hs_insert_one_(
+    collect_c_hashset_t*    s
+,   void const*             p_key
+,   size_t                  key_size
+)
+{
+    return clc_c_hs_insert_(s, p_key, collect_c_swiss_hash_key(p_key, key_size), key_size);
+}
+
+static
+COLLECT_C_UTIL_FORCE_INLINE_
+int
+clc_c_hs_erase_one_(
+    collect_c_hashset_t*    s
+,   void const*             p_key
+,   size_t                  key_size
+)
+{
+    size_t const ix = clc_c_hs_find_(s, p_key, collect_c_swiss_hash_key(p_key, key_size), key_size);
+
+    if (COLLECT_C_HASHSET_INTERNAL_NOT_FOUND_ == ix)
+    {
+        return ENOENT;
+    }
+
+    {
+        collect_c_swiss_table_t const t = clc_c_hs_table_(s);
+
+        collect_c_swiss_erase_at(&t, ix);
+
+        return 0;
+    }
+}
+
+static
+COLLECT_C_UTIL_FORCE_INLINE_
+size_t
+clc_c_hs_find_n_(
+    collect_c_hashset_t const*  s
+,   size_t                      num_keys
+,   char const*                 keys
+,   unsigned char*              found
+,   size_t                      key_size
+)
+{
+    size_t  num_found = 0;
+    size_t  hashes[COLLECT_C_HASHSET_INTERNAL_BATCH_SIZE_];
+
+    for (size_t i = 0; i < num_keys; i += COLLECT_C_HASHSET_INTERNAL_BATCH_SIZE_)
+    {
+        size_t const        n       =   (num_keys - i < COLLECT_C_HASHSET_INTERNAL_BATCH_SIZE_) ? (num_keys - i) : COLLECT_C_HASHSET_INTERNAL_BATCH_SIZE_;
+        char const* const   batch   =   keys + (i * key_size);
+
+        for (size_t j = 0; n != j; ++j)
+        {
+            hashes[j] = collect_c_swiss_hash_key(batch + (j * key_size), key_size);
+
+            clc_c_hs_prefetch_(s, hashes[j], key_size);
+        }
+
+        for (size_t j = 0; n != j; ++j)
+        {
+            bool const b = COLLECT_C_HASHSET_INTERNAL_NOT_FOUND_ != clc_c_hs_find_(s, batch + (j * key_size), hashes[j], key_size);
+
+            if (NULL != found)
+            {
+                found[i + j] = b;
+            }
+
+            num_found += b;
+        }
+    }
+
+    return num_found;
+}
+
+static
+COLLECT_C_UTIL_FORCE_INLINE_
+int
+clc_c_hs_insert_n_(
+    collect_c_hashset_t*    s
+,   size_t                  num_keys
+,   char const*             keys
+,   size_t*                 num_inserted
+,   size_t                  key_size
+)
+{
+    size_t hashes[COLLECT_C_HASHSET_INTERNAL_BATCH_SIZE_];
+
+    for (size_t i = 0; i < num_keys; i += COLLECT_C_HASHSET_INTERNAL_BATCH_SIZE_)
+    {
+        size_t const        n       =   (num_keys - i < COLLECT_C_HASHSET_INTERNAL_BATCH_SIZE_) ? (num_keys - i) : COLLECT_C_HASHSET_INTERNAL_BATCH_SIZE_;
+        char const* const   batch   =   keys + (i * key_size);
+
+        for (size_t j = 0; n != j; ++j)
+        {
+            hashes[j] = collect_c_swiss_hash_key(batch + (j * key_size), key_size);
+
+            clc_c_hs_prefetch_(s, hashes[j], key_size);
+        }
+
+        /* an insertion may rehash, after which the remaining prefetches
+         * are merely wasted
+         */
+        for (size_t j = 0; n != j; ++j)
+        {
+            switch (clc_c_hs_insert_(s, batch + (j * key_size), hashes[j], key_size))
+            {
+            case 0:
+
+                ++*num_inserted;
+                break;
+            case EEXIST:
+
+                break;
+            default:
+
+                return ENOMEM;
+            }
+        }
+    }
+
+    return 0;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+uint32_t
+collect_c_hashset_version(void)
+{
+    return COLLECT_C_HASHSET_VER;
+}
+
+int
+collect_c_hashset_free_storage(
+    collect_c_hashset_t*    s
+)
+{
+    assert(NULL != s);
+
+    if (NULL != s->ctrl)
+    {
+        collect_c_mem_free(s->allocator, s->ctrl, COLLECT_C_HASHSET_INTERNAL_block_size_(s, s->capacity));
+    }
+
+    s->size         =   0;
+    s->capacity     =   0;
+    s->growth_left  =   0;
+    s->num_deleted  =   0;
+    s->ctrl         =   NULL;
+    s->keys         =   NULL;
+
+    return 0;
+}
+
+int
+collect_c_hashset_clear(
+    collect_c_hashset_t*    s
+,   void*                   reserved0
+,   void*                   reserved1
+,   size_t*                 num_dropped
+)
+{
+    ((void)&reserved0);
+    ((void)&reserved1);
+
+    assert(NULL != s);
+    assert(NULL == reserved0);
+    assert(NULL == reserved1);
+
+    {
+        size_t dummy;
+
+        if (NULL == num_dropped)
+        {
+            num_dropped = &dummy;
+        }
+
+        *num_dropped = s->size;
+
+        if (0 != s->capacity)
+        {
+            memset(s->ctrl, COLLECT_C_SWISS_CTRL_EMPTY, s->capacity);
+
+            s->size         =   0;
+            s->growth_left  =   COLLECT_C_SWISS_max_load_(s->capacity);
+            s->num_deleted  =   0;
+        }
+
+        return 0;
+    }
+}
+
+int
+collect_c_hashset_reserve(
+    collect_c_hashset_t*    s
+,   size_t                  num_keys
+)
+{
+    assert(NULL != s);
+
+    if (num_keys <= s->size + s->growth_left)
+    {
+        return 0;
+    }
+    else
+    {
+        collect_c_swiss_table_t const   t           =   clc_c_hs_table_(s);
+        size_t const                    required    =   collect_c_swiss_capacity_for(num_keys);
+
+        /* if the capacity suffices, then rehashing removes tombstones */
+        return collect_c_swiss_resize(&t, (required < s->capacity) ? s->capacity : required);
+    }
+}
+
+int
+collect_c_hashset_find_by_ref(
+    collect_c_hashset_t const*  s
+,   void const*                 p_key
+)
+{
+    assert(NULL != s);
+    assert(NULL != p_key);
+
+    return COLLECT_C_UTIL_DISPATCH_SIZE_(s->key_size, clc_c_hs_find_one_, s, p_key);
+}
+
+int
+collect_c_hashset_find_n_by_ref(
+    collect_c_hashset_t const*  s
+,   size_t                      num_keys
+,   void const*                 p_keys
+,   unsigned char*              found
+,   size_t*                     num_found
+)
+{
+    assert(NULL != s);
+    assert(NULL != p_keys || 0 == num_keys);
+
+    {
+        size_t const n = COLLECT_C_UTIL_DISPATCH_SIZE_(s->key_size, clc_c_hs_find_n_, s, num_keys, (char const*)p_keys, found);
+
+        if (NULL != num_found)
+        {
+            *num_found = n;
+        }
+
+        return 0;
+    }
+}
+
+int
+collect_c_hashset_insert_by_ref(
+    collect_c_hashset_t*    s
+,   void const*             p_key
+)
+{
+    assert(NULL != s);
+    assert(NULL != p_key);
+
+    return COLLECT_C_UTIL_DISPATCH_SIZE_(s->key_size, clc_c_hs_insert_one_, s, p_key);
+}
+
+int
+collect_c_hashset_insert_n_by_ref(
+    collect_c_hashset_t*    s
+,   size_t                  num_keys
+,   void const*             p_keys
+,   size_t*                 num_inserted
+)
+{
+    assert(NULL != s);
+    assert(NULL != p_keys || 0 == num_keys);
+
+    {
+        size_t dummy;
+
+        if (NULL == num_inserted)
+        {
+            num_inserted = &dummy;
+        }
+
+        *num_inserted = 0;
+
+        return COLLECT_C_UTIL_DISPATCH_SIZE_(s->key_size, clc_c_hs_insert_n_, s, num_keys, (char const*)p_keys, num_inserted);
+    }
+}
+
+int
+collect_c_hashset_erase_by_ref(
+    collect_c_hashset_t*    s
+,   void const*             p_key
+)
+{
+    assert(NULL != s);
+    assert(NULL != p_key);
+
+    return COLLECT_C_UTIL_DISPATCH_SIZE_(s->key_size, clc_c_hs_erase_one_, s, p_key);
+}
+
+int
+collect_c_hashset_next_key(
+    collect_c_hashset_t const*  s
+,   size_t*                     cursor
+,   void const**                p_key
+)
+{
+    assert(NULL != s);
+    assert(NULL != cursor);
+
+    for (size_t ix = *cursor; ix < s->capacity; ++ix)
+    {
+        if (s->ctrl[ix] >= 0)
+        {
+            if (NULL != p_key)
+            {
+                *p_key = COLLECT_C_HASHSET_INTERNAL_key_(s, ix, s->key_size);
+            }
+
+            *cursor = ix + 1;
+
+            return 0;
+        }
+    }
+
+    *cursor = s->capacity;
+
+    return ENOENT;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
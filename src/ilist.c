@@ -0,0 +1,553 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    src/ilist.c
+ *
+ * Purpose: Index-linked list container.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/ilist.h>
+
+#include <errno.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * local types
+ */
+
+typedef collect_c_ilist_link_t                              link_t;
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions and macros
+ */
+
+#define COLLECT_C_ILIST_INTERNAL_link_(l, ix)               (((link_t*)(l)->links.storage)[(ix)])
+#define COLLECT_C_ILIST_INTERNAL_el_ptr_(l, ix)             ((void*)(((char*)(l)->data.storage) + ((ix) * (l)->el_size)))
+
+/* NOTE: the vector growth requires a capacity of at least 2 */
+#define COLLECT_C_ILIST_INTERNAL_MIN_CAPACITY_              (2)
+
+static
+void
+clc_c_il_reset_(
+    collect_c_ilist_t*  l
+)
+{
+    l->size         =   0;
+    l->head         =   COLLECT_C_ILIST_NIL;
+    l->tail         =   COLLECT_C_ILIST_NIL;
+    l->free_head    =   COLLECT_C_ILIST_NIL;
+    l->num_free     =   0;
+
+    l->data.size    =   0;
+    l->links.size   =   0;
+}
+
+static
+void
+clc_c_il_free_elements_(
+    collect_c_ilist_t*  l
+,   size_t*             num_dropped
+)
+{
+    if (NULL != l->pfn_element_free)
+    {
+        for (uint32_t ix = l->head; COLLECT_C_ILIST_NIL != ix; ix = COLLECT_C_ILIST_INTERNAL_link_(l, ix).next)
+        {
+            (*l->pfn_element_free)(l->el_size, ix, COLLECT_C_ILIST_INTERNAL_el_ptr_(l, ix), l->param_element_free);
+        }
+    }
+
+    *num_dropped = l->size;
+}
+
+/* Obtains a node - from the free chain, if possible, otherwise by appending
+ * to the arrays - and copies the new element into it. The node is not
+ * linked.
+ */
+static
+int
+clc_c_il_acquire_node_(
+    collect_c_ilist_t*  l
+,   void const*         ptr_new_el
+,   uint32_t*           new_index
+)
+{
+    if (COLLECT_C_ILIST_NIL != l->free_head)
+    {
+        uint32_t const ix = l->free_head;
+
+        l->free_head = COLLECT_C_ILIST_INTERNAL_link_(l, ix).next;
+        --l->num_free;
+
+        memcpy(COLLECT_C_ILIST_INTERNAL_el_ptr_(l, ix), ptr_new_el, l->el_size);
+
+        *new_index = ix;
+
+        return 0;
+    }
+    else
+    {
+        if (NULL == l->data.storage)
+        {
+            int const r = collect_c_ilist_allocate_storage(l, COLLECT_C_ILIST_DEFAULT_INITIAL_CAPACITY);
+
+            if (0 != r)
+            {
+                return r;
+            }
+        }
+
+        assert(l->data.size == l->links.size);
+
+        if (l->links.size >= COLLECT_C_ILIST_NIL)
+        {
+            return ENOSPC;
+        }
+        else
+        {
+            link_t const    lnk =   { COLLECT_C_ILIST_NIL, COLLECT_C_ILIST_NIL };
+            int             r;
+
+            if (0 != (r = collect_c_v_push_back_by_ref(&l->data, ptr_new_el)))
+            {
+                return r;
+            }
+
+            if (0 != (r = collect_c_v_push_back_by_ref(&l->links, &lnk)))
+            {
+                --l->data.size;
+
+                return r;
+            }
+
+            *new_index = (uint32_t)(l->links.size - 1);
+
+            return 0;
+        }
+    }
+}
+
+static
+void
+clc_c_il_link_after_(
+    collect_c_ilist_t*  l
+,   uint32_t            ref
+,   uint32_t            ix
+)
+{
+    link_t* const lnk = &COLLECT_C_ILIST_INTERNAL_link_(l, ix);
+
+    lnk->prev = ref;
+
+    if (COLLECT_C_ILIST_NIL == ref)
+    {
+        lnk->next = l->head;
+
+        l->head = ix;
+    }
+    else
+    {
+        lnk->next = COLLECT_C_ILIST_INTERNAL_link_(l, ref).next;
+
+        COLLECT_C_ILIST_INTERNAL_link_(l, ref).next = ix;
+    }
+
+    if (COLLECT_C_ILIST_NIL != lnk->next)
+    {
+        COLLECT_C_ILIST_INTERNAL_link_(l, lnk->next).prev = ix;
+    }
+    else
+    {
+        l->tail = ix;
+    }
+
+    ++l->size;
+}
+
+static
+int
+clc_c_il_insert_after_(
+    collect_c_ilist_t*  l
+,   uint32_t            ref
+,   void const*         ptr_new_el
+,   uint32_t*           new_index
+)
+{
+    uint32_t    dummy;
+    int         r;
+
+    if (NULL == new_index)
+    {
+        new_index = &dummy;
+    }
+
+    if (0 != (r = clc_c_il_acquire_node_(l, ptr_new_el, new_index)))
+    {
+        return r;
+    }
+
+    clc_c_il_link_after_(l, ref, *new_index);
+
+    return 0;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+uint32_t
+collect_c_ilist_version(void)
+{
+    return COLLECT_C_ILIST_VER;
+}
+
+int
+collect_c_ilist_allocate_storage(
+    collect_c_ilist_t*  l
+,   size_t              initial_capacity
+)
+{
+    assert(NULL != l);
+    assert(NULL == l->data.storage);
+    assert(NULL == l->links.storage);
+
+    assert(l->el_size == l->data.el_size);
+    assert(l->allocator == l->data.allocator);
+    assert(l->allocator == l->links.allocator);
+
+    if (initial_capacity < COLLECT_C_ILIST_INTERNAL_MIN_CAPACITY_)
+    {
+        initial_capacity = COLLECT_C_ILIST_INTERNAL_MIN_CAPACITY_;
+    }
+
+    {
+        int r;
+
+        if (0 != (r = collect_c_vec_allocate_storage(&l->data, initial_capacity)))
+        {
+            return r;
+        }
+
+        if (0 != (r = collect_c_vec_allocate_storage(&l->links, initial_capacity)))
+        {
+            collect_c_vec_free_storage(&l->data);
+
+            return r;
+        }
+
+        return 0;
+    }
+}
+
+void
+collect_c_ilist_free_storage(
+    collect_c_ilist_t*  l
+)
+{
+    assert(NULL != l);
+
+    {
+        size_t num_dropped;
+
+        clc_c_il_free_elements_(l, &num_dropped);
+
+        if (NULL != l->data.storage)
+        {
+            collect_c_vec_free_storage(&l->data);
+            collect_c_vec_free_storage(&l->links);
+        }
+
+        clc_c_il_reset_(l);
+    }
+}
+
+int
+collect_c_ilist_clear(
+    collect_c_ilist_t*  l
+,   void*               reserved0
+,   void*               reserved1
+,   size_t*             num_dropped
+)
+{
+    ((void)&reserved0);
+    ((void)&reserved1);
+
+    assert(NULL != l);
+    assert(NULL == reserved0);
+    assert(NULL == reserved1);
+
+    {
+        size_t dummy;
+
+        if (NULL == num_dropped)
+        {
+            num_dropped = &dummy;
+        }
+
+        clc_c_il_free_elements_(l, num_dropped);
+
+        clc_c_il_reset_(l);
+
+        return 0;
+    }
+}
+
+int
+collect_c_ilist_copy(
+    collect_c_ilist_t*          dst
+,   collect_c_ilist_t const*    src
+)
+{
+    assert(NULL != dst);
+    assert(NULL == dst->data.storage);
+    assert(NULL != src);
+    assert(dst->el_size == src->el_size);
+
+    if (NULL != src->data.storage)
+    {
+        int const r = collect_c_ilist_allocate_storage(dst, src->links.size);
+
+        if (0 != r)
+        {
+            return r;
+        }
+
+        memcpy(dst->data.storage, src->data.storage, src->data.size * src->el_size);
+        memcpy(dst->links.storage, src->links.storage, src->links.size * sizeof(link_t));
+
+        dst->data.size  =   src->data.size;
+        dst->links.size =   src->links.size;
+    }
+
+    dst->size       =   src->size;
+    dst->head       =   src->head;
+    dst->tail       =   src->tail;
+    dst->free_head  =   src->free_head;
+    dst->num_free   =   src->num_free;
+
+    return 0;
+}
+
+int
+collect_c_ilist_erase(
+    collect_c_ilist_t*  l
+,   uint32_t            index
+)
+{
+    assert(NULL != l);
+    assert(index < l->links.size);
+
+    {
+        link_t* const lnk = &COLLECT_C_ILIST_INTERNAL_link_(l, index);
+
+        if (NULL != l->pfn_element_free)
+        {
+            (*l->pfn_element_free)(l->el_size, index, COLLECT_C_ILIST_INTERNAL_el_ptr_(l, index), l->param_element_free);
+        }
+
+        if (COLLECT_C_ILIST_NIL != lnk->prev)
+        {
+            COLLECT_C_ILIST_INTERNAL_link_(l, lnk->prev).next = lnk->next;
+        }
+        else
+        {
+            l->head = lnk->next;
+        }
+
+        if (COLLECT_C_ILIST_NIL != lnk->next)
+        {
+            COLLECT_C_ILIST_INTERNAL_link_(l, lnk->next).prev = lnk->prev;
+        }
+        else
+        {
+            l->tail = lnk->prev;
+        }
+
+        if (0 == --l->size)
+        {
+            /* nothing is live, so start again at the base of the arrays */
+
+            clc_c_il_reset_(l);
+        }
+        else
+        {
+            lnk->prev = COLLECT_C_ILIST_NIL;
+            lnk->next = l->free_head;
+
+            l->free_head = index;
+            ++l->num_free;
+        }
+
+        return 0;
+    }
+}
+
+int
+collect_c_ilist_find(
+    collect_c_ilist_t const*        l
+,   collect_c_ilist_pfn_compare_t   pfn
+,   void const*                     p_lhs
+,   size_t                          skip_count
+,   uint32_t*                       index
+,   size_t*                         num_searched
+)
+{
+    assert(NULL != l);
+    assert(NULL != pfn);
+    assert(NULL != p_lhs);
+    assert(NULL != index);
+
+    {
+        size_t dummy;
+
+        if (NULL == num_searched)
+        {
+            num_searched = &dummy;
+        }
+
+        *num_searched = 0;
+
+        for (uint32_t ix = l->head; COLLECT_C_ILIST_NIL != ix; ix = COLLECT_C_ILIST_INTERNAL_link_(l, ix).next)
+        {
+            int const r = (*pfn)(l, p_lhs, COLLECT_C_ILIST_INTERNAL_el_ptr_(l, ix));
+
+            ++*num_searched;
+
+            if (0 == r)
+            {
+                if (0 == skip_count--)
+                {
+                    *index = ix;
+
+                    return 0;
+                }
+            }
+        }
+
+        *index = COLLECT_C_ILIST_NIL;
+
+        return ENOENT;
+    }
+}
+
+int
+collect_c_ilist_rfind(
+    collect_c_ilist_t const*        l
+,   collect_c_ilist_pfn_compare_t   pfn
+,   void const*                     p_lhs
+,   size_t                          skip_count
+,   uint32_t*                       index
+,   size_t*                         num_searched
+)
+{
+    assert(NULL != l);
+    assert(NULL != pfn);
+    assert(NULL != p_lhs);
+    assert(NULL != index);
+
+    {
+        size_t dummy;
+
+        if (NULL == num_searched)
+        {
+            num_searched = &dummy;
+        }
+
+        *num_searched = 0;
+
+        for (uint32_t ix = l->tail; COLLECT_C_ILIST_NIL != ix; ix = COLLECT_C_ILIST_INTERNAL_link_(l, ix).prev)
+        {
+            int const r = (*pfn)(l, p_lhs, COLLECT_C_ILIST_INTERNAL_el_ptr_(l, ix));
+
+            ++*num_searched;
+
+            if (0 == r)
+            {
+                if (0 == skip_count--)
+                {
+                    *index = ix;
+
+                    return 0;
+                }
+            }
+        }
+
+        *index = COLLECT_C_ILIST_NIL;
+
+        return ENOENT;
+    }
+}
+
+int
+collect_c_ilist_insert_after(
+    collect_c_ilist_t*  l
+,   uint32_t            ref
+,   void const*         ptr_new_el
+,   uint32_t*           new_index
+)
+{
+    assert(NULL != l);
+    assert(ref < l->links.size);
+    assert(NULL != ptr_new_el);
+
+    return clc_c_il_insert_after_(l, ref, ptr_new_el, new_index);
+}
+
+int
+collect_c_ilist_insert_before(
+    collect_c_ilist_t*  l
+,   uint32_t            ref
+,   void const*         ptr_new_el
+,   uint32_t*           new_index
+)
+{
+    assert(NULL != l);
+    assert(ref < l->links.size);
+    assert(NULL != ptr_new_el);
+
+    return clc_c_il_insert_after_(l, COLLECT_C_ILIST_INTERNAL_link_(l, ref).prev, ptr_new_el, new_index);
+}
+
+int
+collect_c_ilist_push_back_by_ref(
+    collect_c_ilist_t*  l
+,   void const*         ptr_new_el
+,   uint32_t*           new_index
+)
+{
+    assert(NULL != l);
+    assert(NULL != ptr_new_el);
+
+    return clc_c_il_insert_after_(l, l->tail, ptr_new_el, new_index);
+}
+
+int
+collect_c_ilist_push_front_by_ref(
+    collect_c_ilist_t*  l
+,   void const*         ptr_new_el
+,   uint32_t*           new_index
+)
+{
+    assert(NULL != l);
+    assert(NULL != ptr_new_el);
+
+    return clc_c_il_insert_after_(l, COLLECT_C_ILIST_NIL, ptr_new_el, new_index);
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,505 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    src/lru.c
+ *
+ * Purpose: Hash-indexed LRU cache container.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/lru.h>
+
+#include "allocator.h"
+
+#include <errno.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * local types
+ */
+
+typedef collect_c_dlist_node_t                              node_t;
+typedef collect_c_lru_slot_t                                slot_t;
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions and macros
+ */
+
+#define COLLECT_C_LRU_INTERNAL_MIN_SLOTS_                   (16)
+
+#define COLLECT_C_LRU_INTERNAL_node_data_(n)                ((void*)&(n)->data->data[0])
+
+static
+size_t
+clc_c_lru_num_slots_for_(
+    size_t  num_els
+)
+{
+    /* maintain a load factor of no more than 1/2 */
+
+    size_t n = COLLECT_C_LRU_INTERNAL_MIN_SLOTS_;
+
+    for (; n / 2 < num_els; n *= 2)
+    {}
+
+    return n;
+}
+
+static
+int
+clc_c_lru_rehash_(
+    collect_c_lru_t*    c
+,   size_t              num_slots
+)
+{
+    slot_t* const   slots   =   collect_c_mem_alloc(c->allocator, num_slots * sizeof(slot_t));
+    size_t const    mask    =   num_slots - 1;
+
+    if (NULL == slots)
+    {
+        return ENOMEM;
+    }
+
+    memset(slots, 0, num_slots * sizeof(slot_t));
+
+    for (size_t i = 0; c->num_slots != i; ++i)
+    {
+        slot_t const* const s = &c->slots[i];
+
+        if (NULL != s->node)
+        {
+            size_t j = s->hash & mask;
+
+            for (; NULL != slots[j].node; j = (j + 1) & mask)
+            {}
+
+            slots[j] = *s;
+        }
+    }
+
+    collect_c_mem_free(c->allocator, c->slots, c->num_slots * sizeof(slot_t));
+
+    c->slots        =   slots;
+    c->num_slots    =   num_slots;
+
+    return 0;
+}
+
+static
+size_t
+clc_c_lru_find_slot_of_node_(
+    collect_c_lru_t const*  c
+,   node_t const*           node
+)
+{
+    size_t const    mask    =   c->num_slots - 1;
+    size_t const    hash    =   (*c->pfn_hash)(&c->list, &node->data->data[0]);
+    size_t          i       =   hash & mask;
+
+    for (; node != c->slots[i].node; i = (i + 1) & mask)
+    {
+        assert(NULL != c->slots[i].node);
+    }
+
+    return i;
+}
+
+/* Empties the given slot, using backward-shift deletion so that no
+ * tombstones are required.
+ */
+static
+void
+clc_c_lru_remove_slot_(
+    collect_c_lru_t*    c
+,   size_t              i
+)
+{
+    size_t const    mask    =   c->num_slots - 1;
+    size_t          j       =   i;
+
+    for (;;)
+    {
+        j = (j + 1) & mask;
+
+        if (NULL == c->slots[j].node)
+        {
+            break;
+        }
+        else
+        {
+            size_t const    k       =   c->slots[j].hash & mask;
+            bool const      stays   =   (i <= j) ? (i < k && k <= j) : (i < k || k <= j);
+
+            if (!stays)
+            {
+                c->slots[i] = c->slots[j];
+
+                i = j;
+            }
+        }
+    }
+
+    c->slots[i].node = NULL;
+}
+
+static
+void
+clc_c_lru_unlink_(
+    collect_c_dlist_t*  l
+,   node_t*             node
+)
+{
+    if (NULL != node->prev)
+    {
+        node->prev->next = node->next;
+    }
+    else
+    {
+        l->head = node->next;
+    }
+
+    if (NULL != node->next)
+    {
+        node->next->prev = node->prev;
+    }
+    else
+    {
+        l->tail = node->prev;
+    }
+}
+
+static
+void
+clc_c_lru_link_at_head_(
+    collect_c_dlist_t*  l
+,   node_t*             node
+)
+{
+    node->prev  =   NULL;
+    node->next  =   l->head;
+
+    if (NULL != l->head)
+    {
+        l->head->prev = node;
+    }
+    else
+    {
+        l->tail = node;
+    }
+
+    l->head = node;
+}
+
+static
+void
+clc_c_lru_free_elements_(
+    collect_c_lru_t*    c
+,   size_t*             num_dropped
+)
+{
+    collect_c_dlist_t* const l = &c->list;
+
+    for (node_t* n = l->head; NULL != n; n = n->next)
+    {
+        if (NULL != l->pfn_element_free)
+        {
+            (*l->pfn_element_free)(l->el_size, 0, COLLECT_C_LRU_INTERNAL_node_data_(n), l->param_element_free);
+        }
+
+        ++*num_dropped;
+    }
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+uint32_t
+collect_c_lru_version(void)
+{
+    return COLLECT_C_LRU_VER;
+}
+
+int
+collect_c_lru_free_storage(
+    collect_c_lru_t*    c
+)
+{
+    assert(NULL != c);
+
+    {
+        size_t num_dropped = 0;
+
+        clc_c_lru_free_elements_(c, &num_dropped);
+
+        collect_c_mem_free(c->allocator, c->slots, c->num_slots * sizeof(slot_t));
+
+        c->slots        =   NULL;
+        c->num_slots    =   0;
+
+        return clc_dlist_free_storage(&c->list);
+    }
+}
+
+int
+collect_c_lru_clear(
+    collect_c_lru_t*    c
+,   void*               reserved0
+,   void*               reserved1
+,   size_t*             num_dropped
+)
+{
+    ((void)&reserved0);
+    ((void)&reserved1);
+
+    assert(NULL != c);
+    assert(NULL == reserved0);
+    assert(NULL == reserved1);
+
+    {
+        size_t dummy;
+
+        if (NULL == num_dropped)
+        {
+            num_dropped = &dummy;
+        }
+
+        *num_dropped = 0;
+
+        clc_c_lru_free_elements_(c, num_dropped);
+
+        if (NULL != c->slots)
+        {
+            memset(c->slots, 0, c->num_slots * sizeof(slot_t));
+        }
+
+        return collect_c_dlist_clear(&c->list, NULL, NULL, NULL);
+    }
+}
+
+static
+void
+clc_c_lru_remap_node_(
+    collect_c_dlist_t const*        l
+,   collect_c_dlist_node_t const*   old_node
+,   collect_c_dlist_node_t*         new_node
+,   void*                           param_remap
+)
+{
+    collect_c_lru_t* const  c   =   (collect_c_lru_t*)param_remap;
+    size_t const            i   =   clc_c_lru_find_slot_of_node_(c, old_node);
+
+    ((void)&l);
+
+    c->slots[i].node = new_node;
+}
+
+int
+collect_c_lru_compact(
+    collect_c_lru_t*    c
+)
+{
+    assert(NULL != c);
+
+    return collect_c_dlist_compact(&c->list, clc_c_lru_remap_node_, c);
+}
+
+int
+collect_c_lru_erase_node(
+    collect_c_lru_t*        c
+,   collect_c_dlist_node_t* node
+)
+{
+    assert(NULL != c);
+    assert(NULL != node);
+
+    /* the index entry must be removed before the element is "destructed",
+     * since the hash function depends on its value
+     */
+
+    clc_c_lru_remove_slot_(c, clc_c_lru_find_slot_of_node_(c, node));
+
+    return collect_c_dlist_erase_node(&c->list, node);
+}
+
+int
+collect_c_lru_find_node(
+    collect_c_lru_t const*      c
+,   void const*                 p_key
+,   collect_c_dlist_node_t**    node
+)
+{
+    assert(NULL != c);
+    assert(NULL != c->pfn_hash);
+    assert(NULL != c->pfn_compare);
+    assert(NULL != p_key);
+    assert(NULL != node);
+
+    *node = NULL;
+
+    if (0 != c->num_slots)
+    {
+        size_t const    mask    =   c->num_slots - 1;
+        size_t const    hash    =   (*c->pfn_hash)(&c->list, p_key);
+
+        for (size_t i = hash & mask; NULL != c->slots[i].node; i = (i + 1) & mask)
+        {
+            slot_t const* const s = &c->slots[i];
+
+            if (hash == s->hash &&
+                0 == (*c->pfn_compare)(&c->list, p_key, &s->node->data->data[0]))
+            {
+                *node = s->node;
+
+                return 0;
+            }
+        }
+    }
+
+    return ENOENT;
+}
+
+int
+collect_c_lru_lookup(
+    collect_c_lru_t*            c
+,   void const*                 p_key
+,   collect_c_dlist_node_t**    node
+)
+{
+    int const r = collect_c_lru_find_node(c, p_key, node);
+
+    if (0 == r)
+    {
+        collect_c_lru_touch_node(c, *node);
+    }
+
+    return r;
+}
+
+int
+collect_c_lru_touch_node(
+    collect_c_lru_t*        c
+,   collect_c_dlist_node_t* node
+)
+{
+    assert(NULL != c);
+    assert(NULL != node);
+
+    if (c->list.head != node)
+    {
+        clc_c_lru_unlink_(&c->list, node);
+        clc_c_lru_link_at_head_(&c->list, node);
+    }
+
+    return 0;
+}
+
+int
+collect_c_lru_insert_by_ref(
+    collect_c_lru_t*            c
+,   void const*                 ptr_new_el
+,   collect_c_dlist_node_t**    new_node
+)
+{
+    assert(NULL != c);
+    assert(NULL != c->pfn_hash);
+    assert(NULL != c->pfn_compare);
+    assert(c->allocator == c->list.allocator);
+    assert(NULL != ptr_new_el);
+
+    {
+        collect_c_dlist_t* const    l   =   &c->list;
+        collect_c_dlist_node_t*     dummy;
+
+        if (NULL == new_node)
+        {
+            new_node = &dummy;
+        }
+
+        /* 1. replace any existing matching element */
+
+        if (0 == collect_c_lru_find_node(c, ptr_new_el, new_node))
+        {
+            if (NULL != l->pfn_element_free)
+            {
+                (*l->pfn_element_free)(l->el_size, 0, COLLECT_C_LRU_INTERNAL_node_data_(*new_node), l->param_element_free);
+            }
+
+            memcpy(COLLECT_C_LRU_INTERNAL_node_data_(*new_node), ptr_new_el, l->el_size);
+
+            return collect_c_lru_touch_node(c, *new_node);
+        }
+
+        /* 2. ensure index capacity, before any change is made; the index
+         * is sized from the number of elements, rather than from max_size,
+         * and so (since the number of slots is a power of 2) grows
+         * geometrically until max_size is reached
+         */
+
+        {
+            size_t const num_els = (0 != c->max_size && l->size >= c->max_size) ? l->size : l->size + 1;
+
+            if (c->num_slots / 2 < num_els)
+            {
+                size_t const    num_slots   =   clc_c_lru_num_slots_for_(num_els);
+                int const       r           =   clc_c_lru_rehash_(c, num_slots);
+
+                if (0 != r)
+                {
+                    return r;
+                }
+            }
+        }
+
+        /* 3. evict the least-recently used, if at maximum size */
+
+        if (0 != c->max_size &&
+            l->size >= c->max_size)
+        {
+            collect_c_lru_erase_node(c, l->tail);
+        }
+
+        /* 4. add as most-recently used (which reuses an evicted node) */
+
+        {
+            int const r = collect_c_dlist_push_front_by_ref(l, ptr_new_el);
+
+            if (0 != r)
+            {
+                return r;
+            }
+            else
+            {
+                size_t const    mask    =   c->num_slots - 1;
+                size_t const    hash    =   (*c->pfn_hash)(l, ptr_new_el);
+                size_t          i       =   hash & mask;
+
+                for (; NULL != c->slots[i].node; i = (i + 1) & mask)
+                {}
+
+                c->slots[i].hash    =   hash;
+                c->slots[i].node    =   l->head;
+
+                *new_node = l->head;
+
+                return 0;
+            }
+        }
+    }
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,1047 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    src/par.c
+ *
+ * Purpose: Work-stealing thread pool, and parallel algorithms over vector
+ *          storage.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+# define _GNU_SOURCE /* for _SC_NPROCESSORS_ONLN */
+#endif
+
+#include <collect-c/par.h>
+
+#include "allocator.h"
+
+#include <assert.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__unix__) || \
+    defined(__unix) || \
+    defined(unix) || \
+    (   defined(__APPLE__) && \
+        defined(__MACH__))
+# define COLLECT_C_PAR_INTERNAL_USE_PTHREADS_
+#endif
+
+#ifdef COLLECT_C_PAR_INTERNAL_USE_PTHREADS_
+# include <pthread.h>
+# include <sched.h>
+# include <stdatomic.h>
+# include <unistd.h>
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions and macros
+ */
+
+/* The number of elements in the output of a merge below which it is not
+ * divided among tasks.
+ */
+#define COLLECT_C_PAR_INTERNAL_MERGE_GRAIN_SIZE_            (4 * COLLECT_C_PAR_GRAIN_SIZE)
+
+#define COLLECT_C_PAR_INTERNAL_el_ptr_(v, ix)               (((char*)(v)->storage) + (((v)->offset + (ix)) * (v)->el_size))
+#define COLLECT_C_PAR_INTERNAL_compare_(v, pfn, p_lhs, p_rhs)   ((*(pfn))((v), (p_lhs), (p_rhs)))
+
+
+#ifdef COLLECT_C_PAR_INTERNAL_USE_PTHREADS_
+
+/* The capacity of each deque. The depth of a deque grows by (at most)
+ * log2(num_tasks) per (nested) collect_c_par_pool_run(), and a task that
+ * cannot be pushed is carried out without splitting, so the capacity
+ * limits only the parallelism of deep nesting.
+ */
+# define COLLECT_C_PAR_INTERNAL_DEQUE_CAPACITY_             (128)
+
+/* The number of (failed) rounds of searching for work after which a
+ * worker sleeps.
+ */
+# define COLLECT_C_PAR_INTERNAL_SPIN_LIMIT_                 (64)
+
+struct clc_c_par_job_t_
+{
+    collect_c_par_pfn_task_t    pfn;
+    void*                       param;
+    atomic_size_t               num_pending;
+};
+typedef struct clc_c_par_job_t_                             clc_c_par_job_t_;
+
+/* A range [lo, hi) of the task indexes of a job. */
+struct clc_c_par_range_t_
+{
+    clc_c_par_job_t_*   job;
+    size_t              lo;
+    size_t              hi;
+};
+typedef struct clc_c_par_range_t_                           clc_c_par_range_t_;
+
+/* The deque of a worker: its owner pushes and pops at the back, and
+ * thieves take from the front. Operations are under a mutex, since they
+ * are few (each range is split in halves) relative to the work.
+ */
+struct clc_c_par_deque_t_
+{
+    pthread_mutex_t         mx;
+    size_t                  head;
+    size_t                  tail;
+    atomic_size_t           size;           /* approximate, for checking without the lock */
+    collect_c_par_pool_t*   pool;
+    size_t                  index;
+    clc_c_par_range_t_      items[COLLECT_C_PAR_INTERNAL_DEQUE_CAPACITY_];
+};
+typedef struct clc_c_par_deque_t_                           clc_c_par_deque_t_;
+#endif /* COLLECT_C_PAR_INTERNAL_USE_PTHREADS_ */
+
+struct collect_c_par_pool_t
+{
+    size_t                          num_threads;
+    collect_c_allocator_t const*    allocator;
+    size_t                          cb_allocation;
+#ifdef COLLECT_C_PAR_INTERNAL_USE_PTHREADS_
+
+    /* deque 0 is shared by all threads that are not workers of the pool;
+     * deque i (0 < i < num_threads) is that of worker i
+     */
+    clc_c_par_deque_t_*             deques;
+    pthread_t*                      threads;
+    size_t                          num_started;
+    pthread_mutex_t                 mx_sleep;
+    pthread_cond_t                  cv_sleep;
+    atomic_size_t                   num_sleeping;
+    atomic_size_t                   num_queued;
+    atomic_bool                     stop;
+#endif
+};
+
+
+#ifdef COLLECT_C_PAR_INTERNAL_USE_PTHREADS_
+
+/* The pool of which the current thread is a worker, if any, and its
+ * index in that pool.
+ */
+static _Thread_local collect_c_par_pool_t*  s_clc_c_par_tls_pool_;
+static _Thread_local size_t                 s_clc_c_par_tls_index_;
+
+static
+size_t
+clc_c_par_self_index_(
+    collect_c_par_pool_t const* pool
+)
+{
+    return (pool == s_clc_c_par_tls_pool_) ? s_clc_c_par_tls_index_ : 0;
+}
+
+static
+bool
+clc_c_par_push_(
+    collect_c_par_pool_t*       pool
+,   size_t                      ix_self
+,   clc_c_par_range_t_ const*   r
+)
+{
+    clc_c_par_deque_t_* const   d   =   &pool->deques[ix_self];
+    bool                        pushed;
+
+    pthread_mutex_lock(&d->mx);
+
+    if (COLLECT_C_PAR_INTERNAL_DEQUE_CAPACITY_ == d->tail - d->head)
+    {
+        pushed = false;
+    }
+    else
+    {
+        d->items[d->tail % COLLECT_C_PAR_INTERNAL_DEQUE_CAPACITY_] = *r;
+        ++d->tail;
+
+        atomic_store(&d->size, d->tail - d->head);
+        atomic_fetch_add(&pool->num_queued, 1);
+
+        pushed = true;
+    }
+
+    pthread_mutex_unlock(&d->mx);
+
+    if (pushed)
+    {
+        /* a sleeper, having incremented num_sleeping, checks num_queued
+         * under mx_sleep before waiting, so the signal cannot be lost
+         */
+        if (0 != atomic_load(&pool->num_sleeping))
+        {
+            pthread_mutex_lock(&pool->mx_sleep);
+            pthread_cond_signal(&pool->cv_sleep);
+            pthread_mutex_unlock(&pool->mx_sleep);
+        }
+    }
+
+    return pushed;
+}
+
+static
+bool
+clc_c_par_take_(
+    collect_c_par_pool_t*   pool
+,   size_t                  ix
+,   bool                    from_back
+,   clc_c_par_range_t_*     r
+)
+{
+    clc_c_par_deque_t_* const   d   =   &pool->deques[ix];
+    bool                        taken;
+
+    if (0 == atomic_load_explicit(&d->size, memory_order_relaxed))
+    {
+        return false;
+    }
+
+    pthread_mutex_lock(&d->mx);
+
+    if (d->tail == d->head)
+    {
+        taken = false;
+    }
+    else
+    {
+        if (from_back)
+        {
+            --d->tail;
+
+            *r = d->items[d->tail % COLLECT_C_PAR_INTERNAL_DEQUE_CAPACITY_];
+        }
+        else
+        {
+            *r = d->items[d->head % COLLECT_C_PAR_INTERNAL_DEQUE_CAPACITY_];
+
+            ++d->head;
+        }
+
+        atomic_store(&d->size, d->tail - d->head);
+        atomic_fetch_sub(&pool->num_queued, 1);
+
+        taken = true;
+    }
+
+    pthread_mutex_unlock(&d->mx);
+
+    return taken;
+}
+
+/* Obtains a range from the back of the thread's own deque or, failing
+ * that, steals one from the front of another's.
+ */
+static
+bool
+clc_c_par_find_(
+    collect_c_par_pool_t*   pool
+,   size_t                  ix_self
+,   clc_c_par_range_t_*     r
+)
+{
+    size_t const n = pool->num_threads;
+
+    if (clc_c_par_take_(pool, ix_self, true, r))
+    {
+        return true;
+    }
+
+    for (size_t i = 1; n != i; ++i)
+    {
+        if (clc_c_par_take_(pool, (ix_self + i) % n, false, r))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/* Carries out a range, splitting off its upper half, to the thread's own
+ * deque, for as long as it is longer than 1 and there is room.
+ */
+static
+void
+clc_c_par_execute_(
+    collect_c_par_pool_t*       pool
+,   size_t                      ix_self
+,   clc_c_par_range_t_ const*   r
+)
+{
+    clc_c_par_job_t_* const job =   r->job;
+    size_t const            lo  =   r->lo;
+    size_t                  hi  =   r->hi;
+
+    for (; hi - lo > 1; )
+    {
+        size_t const                mid     =   lo + ((hi - lo) / 2);
+        clc_c_par_range_t_ const    upper   =   { job, mid, hi };
+
+        if (!clc_c_par_push_(pool, ix_self, &upper))
+        {
+            break;
+        }
+
+        hi = mid;
+    }
+
+    for (size_t i = lo; hi != i; ++i)
+    {
+        (*job->pfn)(i, job->param);
+    }
+
+    atomic_fetch_sub_explicit(&job->num_pending, hi - lo, memory_order_release);
+}
+
+static
+void*
+clc_c_par_worker_(
+    void*   arg
+)
+{
+    clc_c_par_deque_t_* const   d       =   (clc_c_par_deque_t_*)arg;
+    collect_c_par_pool_t* const pool    =   d->pool;
+    size_t const                ix_self =   d->index;
+    size_t                      spins   =   0;
+
+    s_clc_c_par_tls_pool_   =   pool;
+    s_clc_c_par_tls_index_  =   ix_self;
+
+    for (; !atomic_load(&pool->stop); )
+    {
+        clc_c_par_range_t_ r;
+
+        if (clc_c_par_find_(pool, ix_self, &r))
+        {
+            clc_c_par_execute_(pool, ix_self, &r);
+
+            spins = 0;
+        }
+        else if (++spins < COLLECT_C_PAR_INTERNAL_SPIN_LIMIT_)
+        {
+            sched_yield();
+        }
+        else
+        {
+            pthread_mutex_lock(&pool->mx_sleep);
+
+            atomic_fetch_add(&pool->num_sleeping, 1);
+
+            if (0 == atomic_load(&pool->num_queued) &&
+                !atomic_load(&pool->stop))
+            {
+                pthread_cond_wait(&pool->cv_sleep, &pool->mx_sleep);
+            }
+
+            atomic_fetch_sub(&pool->num_sleeping, 1);
+
+            pthread_mutex_unlock(&pool->mx_sleep);
+
+            spins = 0;
+        }
+    }
+
+    return NULL;
+}
+
+static
+void
+clc_c_par_stop_workers_(
+    collect_c_par_pool_t*   pool
+)
+{
+    pthread_mutex_lock(&pool->mx_sleep);
+
+    atomic_store(&pool->stop, true);
+
+    pthread_cond_broadcast(&pool->cv_sleep);
+    pthread_mutex_unlock(&pool->mx_sleep);
+
+    for (size_t i = 0; pool->num_started != i; ++i)
+    {
+        pthread_join(pool->threads[i], NULL);
+    }
+
+    pool->num_started = 0;
+}
+#endif /* COLLECT_C_PAR_INTERNAL_USE_PTHREADS_ */
+
+/* The number of chunks into which a range of n elements is divided, which
+ * depends on n alone.
+ */
+static
+size_t
+clc_c_par_num_chunks_(
+    size_t  n
+)
+{
+    size_t const k = (n + (COLLECT_C_PAR_GRAIN_SIZE - 1)) / COLLECT_C_PAR_GRAIN_SIZE;
+
+    return (k < 1) ? 1 : (k > COLLECT_C_PAR_MAX_CHUNKS) ? COLLECT_C_PAR_MAX_CHUNKS : k;
+}
+
+/* The offset, within a range of n elements, of the start of chunk i of
+ * k.
+ */
+static
+size_t
+clc_c_par_chunk_begin_(
+    size_t  n
+,   size_t  k
+,   size_t  i
+)
+{
+    return (size_t)(((uint64_t)n * i) / k);
+}
+
+
+/* for-each */
+
+struct clc_c_par_for_each_ctxt_t_
+{
+    collect_c_vec_t*                v;
+    size_t                          first;
+    size_t                          n;
+    size_t                          num_chunks;
+    collect_c_par_pfn_for_each_t    pfn;
+    void*                           param;
+};
+
+static
+void
+clc_c_par_for_each_task_(
+    size_t  index
+,   void*   param
+)
+{
+    struct clc_c_par_for_each_ctxt_t_* const ctxt = (struct clc_c_par_for_each_ctxt_t_*)param;
+
+    size_t const    lo  =   ctxt->first + clc_c_par_chunk_begin_(ctxt->n, ctxt->num_chunks, index);
+    size_t const    hi  =   ctxt->first + clc_c_par_chunk_begin_(ctxt->n, ctxt->num_chunks, index + 1);
+
+    for (size_t ix = lo; hi != ix; ++ix)
+    {
+        (*ctxt->pfn)(ctxt->v, ix, COLLECT_C_PAR_INTERNAL_el_ptr_(ctxt->v, ix), ctxt->param);
+    }
+}
+
+
+/* transform */
+
+struct clc_c_par_transform_ctxt_t_
+{
+    collect_c_vec_t const*          v;
+    size_t                          first;
+    size_t                          n;
+    size_t                          num_chunks;
+    collect_c_vec_t*                v_dst;
+    collect_c_par_pfn_transform_t   pfn;
+    void*                           param;
+};
+
+static
+void
+clc_c_par_transform_task_(
+    size_t  index
+,   void*   param
+)
+{
+    struct clc_c_par_transform_ctxt_t_* const ctxt = (struct clc_c_par_transform_ctxt_t_*)param;
+
+    size_t const    lo  =   ctxt->first + clc_c_par_chunk_begin_(ctxt->n, ctxt->num_chunks, index);
+    size_t const    hi  =   ctxt->first + clc_c_par_chunk_begin_(ctxt->n, ctxt->num_chunks, index + 1);
+
+    for (size_t ix = lo; hi != ix; ++ix)
+    {
+        (*ctxt->pfn)(ctxt->v, ix, COLLECT_C_PAR_INTERNAL_el_ptr_(ctxt->v, ix), COLLECT_C_PAR_INTERNAL_el_ptr_(ctxt->v_dst, ix), ctxt->param);
+    }
+}
+
+
+/* reduce */
+
+struct clc_c_par_reduce_ctxt_t_
+{
+    collect_c_vec_t const*          v;
+    size_t                          first;
+    size_t                          n;
+    size_t                          num_chunks;
+    size_t                          cb_result;
+    void const*                     p_identity;
+    collect_c_par_pfn_accumulate_t  pfn_accumulate;
+    void*                           param;
+    char*                           accumulators;
+};
+
+static
+void
+clc_c_par_reduce_task_(
+    size_t  index
+,   void*   param
+)
+{
+    struct clc_c_par_reduce_ctxt_t_* const ctxt = (struct clc_c_par_reduce_ctxt_t_*)param;
+
+    size_t const    lo      =   ctxt->first + clc_c_par_chunk_begin_(ctxt->n, ctxt->num_chunks, index);
+    size_t const    hi      =   ctxt->first + clc_c_par_chunk_begin_(ctxt->n, ctxt->num_chunks, index + 1);
+    void* const     p_acc   =   ctxt->accumulators + (index * ctxt->cb_result);
+
+    memcpy(p_acc, ctxt->p_identity, ctxt->cb_result);
+
+    for (size_t ix = lo; hi != ix; ++ix)
+    {
+        (*ctxt->pfn_accumulate)(ctxt->v, p_acc, COLLECT_C_PAR_INTERNAL_el_ptr_(ctxt->v, ix), ctxt->param);
+    }
+}
+
+
+/* sort */
+
+struct clc_c_par_sort_ctxt_t_
+{
+    collect_c_vec_t*            v;
+    size_t                      first;
+    size_t                      n;
+    size_t                      num_chunks;
+    collect_c_vec_pfn_compare   pfn_compare;
+
+    /* merge rounds */
+    char*                       src;
+    char*                       dst;
+    size_t                      width;              /* the number of chunks in each run */
+    size_t                      pieces_per_pair;
+};
+
+static
+void
+clc_c_par_sort_chunk_task_(
+    size_t  index
+,   void*   param
+)
+{
+    struct clc_c_par_sort_ctxt_t_* const ctxt = (struct clc_c_par_sort_ctxt_t_*)param;
+
+    size_t const    lo  =   ctxt->first + clc_c_par_chunk_begin_(ctxt->n, ctxt->num_chunks, index);
+    size_t const    hi  =   ctxt->first + clc_c_par_chunk_begin_(ctxt->n, ctxt->num_chunks, index + 1);
+
+    collect_c_vec_sort_range(ctxt->v, lo, hi, ctxt->pfn_compare);
+}
+
+/* Obtains the number of elements of a that precede position k in the
+ * (stable) merge of a and b, in which elements of a precede equivalent
+ * elements of b.
+ */
+static
+size_t
+clc_c_par_co_rank_(
+    collect_c_vec_t const*      v
+,   collect_c_vec_pfn_compare   pfn
+,   char const*                 a
+,   size_t                      n_a
+,   char const*                 b
+,   size_t                      n_b
+,   size_t                      k
+,   size_t                      el_size
+)
+{
+    size_t lo = (k > n_b) ? (k - n_b) : 0;
+    size_t hi = (k < n_a) ? k : n_a;
+
+    for (; lo < hi; )
+    {
+        size_t const i = lo + ((hi - lo) / 2);
+
+        /* a[i] is in the first k if it is not after b[k - i - 1] */
+        if (COLLECT_C_PAR_INTERNAL_compare_(v, pfn, a + (i * el_size), b + ((k - i - 1) * el_size)) <= 0)
+        {
+            lo = i + 1;
+        }
+        else
+        {
+            hi = i;
+        }
+    }
+
+    return lo;
+}
+
+static
+COLLECT_C_UTIL_FORCE_INLINE_
+void
+clc_c_par_merge_(
+    collect_c_vec_t const*      v
+,   collect_c_vec_pfn_compare   pfn
+,   char const*                 a
+,   char const*                 a_end
+,   char const*                 b
+,   char const*                 b_end
+,   char*                       out
+,   size_t                      el_size
+)
+{
+    for (; a != a_end && b != b_end; out += el_size)
+    {
+        if (COLLECT_C_PAR_INTERNAL_compare_(v, pfn, b, a) < 0)
+        {
+            memcpy(out, b, el_size);
+            b += el_size;
+        }
+        else
+        {
+            memcpy(out, a, el_size);
+            a += el_size;
+        }
+    }
+
+    memcpy(out, a, (size_t)(a_end - a));
+    out += a_end - a;
+    memcpy(out, b, (size_t)(b_end - b));
+}
+
+/* Carries out one piece of the merge of a pair of runs, or (for the last
+ * run of an odd number) the copy of a single run.
+ */
+static
+void
+clc_c_par_sort_merge_task_(
+    size_t  index
+,   void*   param
+)
+{
+    struct clc_c_par_sort_ctxt_t_* const ctxt = (struct clc_c_par_sort_ctxt_t_*)param;
+
+    size_t const        el_size =   ctxt->v->el_size;
+    size_t const        pair    =   index / ctxt->pieces_per_pair;
+    size_t const        piece   =   index % ctxt->pieces_per_pair;
+    size_t const        c_lo    =   pair * 2 * ctxt->width;
+    size_t const        c_mid   =   (c_lo + ctxt->width < ctxt->num_chunks) ? (c_lo + ctxt->width) : ctxt->num_chunks;
+    size_t const        c_hi    =   (c_mid + ctxt->width < ctxt->num_chunks) ? (c_mid + ctxt->width) : ctxt->num_chunks;
+    size_t const        lo      =   clc_c_par_chunk_begin_(ctxt->n, ctxt->num_chunks, c_lo);
+    size_t const        mid     =   clc_c_par_chunk_begin_(ctxt->n, ctxt->num_chunks, c_mid);
+    size_t const        hi      =   clc_c_par_chunk_begin_(ctxt->n, ctxt->num_chunks, c_hi);
+    size_t const        len     =   hi - lo;
+    size_t const        k0      =   (size_t)(((uint64_t)len * piece) / ctxt->pieces_per_pair);
+    size_t const        k1      =   (size_t)(((uint64_t)len * (piece + 1)) / ctxt->pieces_per_pair);
+    char const* const   a       =   ctxt->src + (lo * el_size);
+    char const* const   b       =   ctxt->src + (mid * el_size);
+    size_t const        i0      =   clc_c_par_co_rank_(ctxt->v, ctxt->pfn_compare, a, mid - lo, b, hi - mid, k0, el_size);
+    size_t const        i1      =   clc_c_par_co_rank_(ctxt->v, ctxt->pfn_compare, a, mid - lo, b, hi - mid, k1, el_size);
+    char* const         out     =   ctxt->dst + ((lo + k0) * el_size);
+
+    COLLECT_C_UTIL_DISPATCH_SIZE_(el_size, clc_c_par_merge_, ctxt->v, ctxt->pfn_compare, a + (i0 * el_size), a + (i1 * el_size), b + ((k0 - i0) * el_size), b + ((k1 - i1) * el_size), out);
+}
+
+static
+void
+clc_c_par_sort_copy_task_(
+    size_t  index
+,   void*   param
+)
+{
+    struct clc_c_par_sort_ctxt_t_* const ctxt = (struct clc_c_par_sort_ctxt_t_*)param;
+
+    size_t const    el_size =   ctxt->v->el_size;
+    size_t const    lo      =   clc_c_par_chunk_begin_(ctxt->n, ctxt->num_chunks, index);
+    size_t const    hi      =   clc_c_par_chunk_begin_(ctxt->n, ctxt->num_chunks, index + 1);
+
+    memcpy(ctxt->dst + (lo * el_size), ctxt->src + (lo * el_size), (hi - lo) * el_size);
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+uint32_t
+collect_c_par_version(void)
+{
+    return COLLECT_C_PAR_VER;
+}
+
+int
+collect_c_par_pool_create(
+    size_t                          num_threads
+,   collect_c_allocator_t const*    allocator
+,   collect_c_par_pool_t**          p_pool
+)
+{
+    assert(NULL != p_pool);
+
+#ifdef COLLECT_C_PAR_INTERNAL_USE_PTHREADS_
+
+    if (0 == num_threads)
+    {
+        long const r = sysconf(_SC_NPROCESSORS_ONLN);
+
+        num_threads = (r > 0) ? (size_t)r : 1;
+    }
+
+    {
+        /* the pool, its deques, and its threads, in one allocation */
+        size_t const            cb_pool     =   ((sizeof(collect_c_par_pool_t) + (sizeof(max_align_t) - 1)) / sizeof(max_align_t)) * sizeof(max_align_t);
+        size_t const            cb_deques   =   ((num_threads * sizeof(clc_c_par_deque_t_) + (sizeof(max_align_t) - 1)) / sizeof(max_align_t)) * sizeof(max_align_t);
+        size_t const            cb          =   cb_pool + cb_deques + (num_threads * sizeof(pthread_t));
+        collect_c_par_pool_t*   pool        =   (collect_c_par_pool_t*)collect_c_mem_alloc(allocator, cb);
+
+        if (NULL == pool)
+        {
+            return ENOMEM;
+        }
+
+        memset(pool, 0, cb);
+
+        pool->num_threads   =   num_threads;
+        pool->allocator     =   allocator;
+        pool->cb_allocation =   cb;
+        pool->deques        =   (clc_c_par_deque_t_*)((char*)pool + cb_pool);
+        pool->threads       =   (pthread_t*)((char*)pool + cb_pool + cb_deques);
+        pool->num_started   =   0;
+
+        pthread_mutex_init(&pool->mx_sleep, NULL);
+        pthread_cond_init(&pool->cv_sleep, NULL);
+        atomic_init(&pool->num_sleeping, 0);
+        atomic_init(&pool->num_queued, 0);
+        atomic_init(&pool->stop, false);
+
+        for (size_t i = 0; num_threads != i; ++i)
+        {
+            clc_c_par_deque_t_* const d = &pool->deques[i];
+
+            pthread_mutex_init(&d->mx, NULL);
+            atomic_init(&d->size, 0);
+
+            d->pool     =   pool;
+            d->index    =   i;
+        }
+
+        for (size_t i = 1; num_threads != i; ++i)
+        {
+            int const r = pthread_create(&pool->threads[i - 1], NULL, clc_c_par_worker_, &pool->deques[i]);
+
+            if (0 != r)
+            {
+                collect_c_par_pool_destroy(pool);
+
+                return r;
+            }
+
+            ++pool->num_started;
+        }
+
+        *p_pool = pool;
+
+        return 0;
+    }
+#else /* ? COLLECT_C_PAR_INTERNAL_USE_PTHREADS_ */
+
+    ((void)&num_threads);
+
+    {
+        collect_c_par_pool_t* const pool = (collect_c_par_pool_t*)collect_c_mem_alloc(allocator, sizeof(collect_c_par_pool_t));
+
+        if (NULL == pool)
+        {
+            return ENOMEM;
+        }
+
+        pool->num_threads   =   1;
+        pool->allocator     =   allocator;
+        pool->cb_allocation =   sizeof(collect_c_par_pool_t);
+
+        *p_pool = pool;
+
+        return 0;
+    }
+#endif /* COLLECT_C_PAR_INTERNAL_USE_PTHREADS_ */
+}
+
+void
+collect_c_par_pool_destroy(
+    collect_c_par_pool_t*   pool
+)
+{
+    if (NULL != pool)
+    {
+#ifdef COLLECT_C_PAR_INTERNAL_USE_PTHREADS_
+
+        clc_c_par_stop_workers_(pool);
+
+        for (size_t i = 0; pool->num_threads != i; ++i)
+        {
+            pthread_mutex_destroy(&pool->deques[i].mx);
+        }
+
+        pthread_cond_destroy(&pool->cv_sleep);
+        pthread_mutex_destroy(&pool->mx_sleep);
+#endif
+
+        collect_c_mem_free(pool->allocator, pool, pool->cb_allocation);
+    }
+}
+
+size_t
+collect_c_par_pool_num_threads(
+    collect_c_par_pool_t const* pool
+)
+{
+    return (NULL == pool) ? 1 : pool->num_threads;
+}
+
+void
+collect_c_par_pool_run(
+    collect_c_par_pool_t*       pool
+,   size_t                      num_tasks
+,   collect_c_par_pfn_task_t    pfn
+,   void*                       param
+)
+{
+    assert(NULL != pfn);
+
+#ifdef COLLECT_C_PAR_INTERNAL_USE_PTHREADS_
+
+    if (NULL != pool &&
+        pool->num_threads > 1 &&
+        num_tasks > 1)
+    {
+        size_t const        ix_self =   clc_c_par_self_index_(pool);
+        clc_c_par_job_t_    job;
+
+        job.pfn     =   pfn;
+        job.param   =   param;
+        atomic_init(&job.num_pending, num_tasks);
+
+        {
+            clc_c_par_range_t_ const r = { &job, 0, num_tasks };
+
+            clc_c_par_execute_(pool, ix_self, &r);
+        }
+
+        /* help, with this job's or any other's tasks, until those of this
+         * job that were stolen are complete
+         */
+        for (; 0 != atomic_load_explicit(&job.num_pending, memory_order_acquire); )
+        {
+            clc_c_par_range_t_ r;
+
+            if (clc_c_par_find_(pool, ix_self, &r))
+            {
+                clc_c_par_execute_(pool, ix_self, &r);
+            }
+            else
+            {
+                sched_yield();
+            }
+        }
+
+        return;
+    }
+#else /* ? COLLECT_C_PAR_INTERNAL_USE_PTHREADS_ */
+
+    ((void)&pool);
+#endif /* COLLECT_C_PAR_INTERNAL_USE_PTHREADS_ */
+
+    for (size_t i = 0; num_tasks != i; ++i)
+    {
+        (*pfn)(i, param);
+    }
+}
+
+void
+collect_c_par_for_each(
+    collect_c_par_pool_t*           pool
+,   collect_c_vec_t*                v
+,   size_t                          first
+,   size_t                          last
+,   collect_c_par_pfn_for_each_t    pfn
+,   void*                           param
+)
+{
+    assert(NULL != v);
+    assert(first <= last);
+    assert(last <= v->size);
+    assert(NULL != pfn);
+
+    {
+        size_t const                        n       =   last - first;
+        struct clc_c_par_for_each_ctxt_t_   ctxt    =   { v, first, n, clc_c_par_num_chunks_(n), pfn, param };
+
+        collect_c_par_pool_run(pool, ctxt.num_chunks, clc_c_par_for_each_task_, &ctxt);
+    }
+}
+
+void
+collect_c_par_transform(
+    collect_c_par_pool_t*           pool
+,   collect_c_vec_t const*          v
+,   size_t                          first
+,   size_t                          last
+,   collect_c_vec_t*                v_dst
+,   collect_c_par_pfn_transform_t   pfn
+,   void*                           param
+)
+{
+    assert(NULL != v);
+    assert(first <= last);
+    assert(last <= v->size);
+    assert(NULL != v_dst);
+    assert(last <= v_dst->size);
+    assert(NULL != pfn);
+
+    {
+        size_t const                        n       =   last - first;
+        struct clc_c_par_transform_ctxt_t_  ctxt    =   { v, first, n, clc_c_par_num_chunks_(n), v_dst, pfn, param };
+
+        collect_c_par_pool_run(pool, ctxt.num_chunks, clc_c_par_transform_task_, &ctxt);
+    }
+}
+
+int
+collect_c_par_reduce(
+    collect_c_par_pool_t*           pool
+,   collect_c_vec_t const*          v
+,   size_t                          first
+,   size_t                          last
+,   size_t                          cb_result
+,   void const*                     p_identity
+,   collect_c_par_pfn_accumulate_t  pfn_accumulate
+,   collect_c_par_pfn_combine_t     pfn_combine
+,   void*                           param
+,   void*                           p_result
+)
+{
+    assert(NULL != v);
+    assert(first <= last);
+    assert(last <= v->size);
+    assert(0 != cb_result);
+    assert(NULL != p_identity);
+    assert(NULL != pfn_accumulate);
+    assert(NULL != pfn_combine);
+    assert(NULL != p_result);
+
+    {
+        size_t const    n           =   last - first;
+        size_t const    num_chunks  =   clc_c_par_num_chunks_(n);
+        size_t const    cb          =   num_chunks * cb_result;
+        char* const     accs        =   (char*)collect_c_mem_alloc(v->allocator, cb);
+
+        if (NULL == accs)
+        {
+            return ENOMEM;
+        }
+        else
+        {
+            struct clc_c_par_reduce_ctxt_t_ ctxt = { v, first, n, num_chunks, cb_result, p_identity, pfn_accumulate, param, accs };
+
+            collect_c_par_pool_run(pool, num_chunks, clc_c_par_reduce_task_, &ctxt);
+
+            /* the accumulators are combined in order, by this thread, so
+             * that the result does not depend on the scheduling
+             */
+            for (size_t i = 1; num_chunks != i; ++i)
+            {
+                (*pfn_combine)(v, accs, accs + (i * cb_result), param);
+            }
+
+            memcpy(p_result, accs, cb_result);
+
+            collect_c_mem_free(v->allocator, accs, cb);
+
+            return 0;
+        }
+    }
+}
+
+int
+collect_c_par_sort(
+    collect_c_par_pool_t*       pool
+,   collect_c_vec_t*            v
+,   size_t                      first
+,   size_t                      last
+,   collect_c_vec_pfn_compare   pfn_compare
+)
+{
+    assert(NULL != v);
+    assert(first <= last);
+    assert(last <= v->size);
+    assert(NULL != pfn_compare);
+
+    {
+        size_t const    n           =   last - first;
+        size_t const    num_chunks  =   clc_c_par_num_chunks_(n);
+
+        if (1 == num_chunks)
+        {
+            collect_c_vec_sort_range(v, first, last, pfn_compare);
+
+            return 0;
+        }
+        else
+        {
+            size_t const    cb      =   n * v->el_size;
+            char* const     scratch =   (char*)collect_c_mem_alloc(v->allocator, cb);
+
+            if (NULL == scratch)
+            {
+                return ENOMEM;
+            }
+            else
+            {
+                char* const                     base    =   COLLECT_C_PAR_INTERNAL_el_ptr_(v, first);
+                struct clc_c_par_sort_ctxt_t_   ctxt;
+
+                memset(&ctxt, 0, sizeof(ctxt));
+
+                ctxt.v              =   v;
+                ctxt.first          =   first;
+                ctxt.n              =   n;
+                ctxt.num_chunks     =   num_chunks;
+                ctxt.pfn_compare    =   pfn_compare;
+
+                collect_c_par_pool_run(pool, num_chunks, clc_c_par_sort_chunk_task_, &ctxt);
+
+                ctxt.src = base;
+                ctxt.dst = scratch;
+
+                for (ctxt.width = 1; ctxt.width < num_chunks; ctxt.width *= 2)
+                {
+                    size_t const    num_pairs   =   (num_chunks + ((2 * ctxt.width) - 1)) / (2 * ctxt.width);
+                    size_t const    len_pair    =   clc_c_par_chunk_begin_(n, num_chunks, 2 * ctxt.width);
+                    char* const     src         =   ctxt.dst;
+
+                    ctxt.pieces_per_pair = (len_pair + (COLLECT_C_PAR_INTERNAL_MERGE_GRAIN_SIZE_ - 1)) / COLLECT_C_PAR_INTERNAL_MERGE_GRAIN_SIZE_;
+
+                    collect_c_par_pool_run(pool, num_pairs * ctxt.pieces_per_pair, clc_c_par_sort_merge_task_, &ctxt);
+
+                    ctxt.dst = ctxt.src;
+                    ctxt.src = src;
+                }
+
+                if (ctxt.src != base)
+                {
+                    ctxt.dst = base;
+
+                    collect_c_par_pool_run(pool, num_chunks, clc_c_par_sort_copy_task_, &ctxt);
+                }
+
+                collect_c_mem_free(v->allocator, scratch, cb);
+
+                return 0;
+            }
+        }
+    }
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,412 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    src/pool.c
+ *
+ * Purpose: Fixed-size object pool.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/pool.h>
+
+#include "allocator.h"
+
+#include <assert.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * local types
+ */
+
+struct collect_c_pool_block_t
+{
+    struct collect_c_pool_block_t*  next;
+    size_t                          num_slots;
+};
+typedef struct collect_c_pool_block_t                       block_t;
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions and macros
+ */
+
+#define COLLECT_C_POOL_INTERNAL_ALIGNMENT_                  (_Alignof(max_align_t))
+
+#define COLLECT_C_POOL_INTERNAL_header_size_()              ((sizeof(block_t) + (COLLECT_C_POOL_INTERNAL_ALIGNMENT_ - 1)) & ~(size_t)(COLLECT_C_POOL_INTERNAL_ALIGNMENT_ - 1))
+
+#define COLLECT_C_POOL_INTERNAL_block_size_(p, n)           (COLLECT_C_POOL_INTERNAL_header_size_() + ((n) * (p)->slot_size))
+
+#define COLLECT_C_POOL_INTERNAL_next_(slot)                 (*(void**)(slot))
+
+_Static_assert(sizeof(atomic_int_least32_t) == sizeof(int32_t), "atomic 32-bit integer must be of the same size as int32_t");
+
+static
+void
+clc_c_pl_lock_(
+    collect_c_pool_t*   p
+)
+{
+    if (0 != (COLLECT_C_POOL_F_SYNCHRONISED & p->flags))
+    {
+        atomic_int_least32_t* const lock = (atomic_int_least32_t*)&p->lock;
+
+        for (;;)
+        {
+            if (0 == atomic_exchange_explicit(lock, 1, memory_order_acquire))
+            {
+                break;
+            }
+
+            /* spin on a plain load, to avoid contending for the line */
+            while (0 != atomic_load_explicit(lock, memory_order_relaxed))
+            {}
+        }
+    }
+}
+
+static
+void
+clc_c_pl_unlock_(
+    collect_c_pool_t*   p
+)
+{
+    if (0 != (COLLECT_C_POOL_F_SYNCHRONISED & p->flags))
+    {
+        atomic_store_explicit((atomic_int_least32_t*)&p->lock, 0, memory_order_release);
+    }
+}
+
+/* Acquires a slot; the pool must be locked. */
+static
+void*
+clc_c_pl_acquire_(
+    collect_c_pool_t*   p
+)
+{
+    void* slot;
+
+    if (NULL != p->free_list)
+    {
+        slot = p->free_list;
+
+        p->free_list = COLLECT_C_POOL_INTERNAL_next_(slot);
+    }
+    else
+    {
+        if (0 == p->num_unused)
+        {
+            size_t const    num_slots   =   (0 == p->slots_per_block) ? COLLECT_C_POOL_DEFAULT_SLOTS_PER_BLOCK : p->slots_per_block;
+            block_t* const  b           =   collect_c_mem_alloc(p->backing, COLLECT_C_POOL_INTERNAL_block_size_(p, num_slots));
+
+            if (NULL == b)
+            {
+                return NULL;
+            }
+
+            b->next         =   p->blocks;
+            b->num_slots    =   num_slots;
+            p->blocks       =   b;
+
+            /* slots are carved from the block as required, rather than all
+             * being linked into the free list now
+             */
+            p->unused       =   ((char*)b) + COLLECT_C_POOL_INTERNAL_header_size_();
+            p->num_unused   =   num_slots;
+
+            ++p->stats.num_blocks;
+            p->stats.num_slots += num_slots;
+        }
+
+        slot = p->unused;
+
+        p->unused = ((char*)p->unused) + p->slot_size;
+        --p->num_unused;
+    }
+
+    ++p->stats.num_acquires;
+    if (++p->stats.num_in_use > p->stats.peak_in_use)
+    {
+        p->stats.peak_in_use = p->stats.num_in_use;
+    }
+
+    return slot;
+}
+
+/* Releases the chain of n slots from head to tail; the pool must be
+ * locked.
+ */
+static
+void
+clc_c_pl_release_chain_(
+    collect_c_pool_t*   p
+,   void*               head
+,   void*               tail
+,   size_t              n
+)
+{
+    assert(p->stats.num_in_use >= n);
+
+    COLLECT_C_POOL_INTERNAL_next_(tail) = p->free_list;
+    p->free_list = head;
+
+    p->stats.num_in_use -= n;
+    p->stats.num_releases += n;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+uint32_t
+collect_c_pool_version(void)
+{
+    return COLLECT_C_POOL_VER;
+}
+
+void
+collect_c_pool_free_storage(
+    collect_c_pool_t*   p
+)
+{
+    assert(NULL != p);
+
+    for (block_t* b = p->blocks; NULL != b; )
+    {
+        block_t* const b2 = b;
+
+        b = b->next;
+
+        collect_c_mem_free(p->backing, b2, COLLECT_C_POOL_INTERNAL_block_size_(p, b2->num_slots));
+    }
+
+    p->free_list    =   NULL;
+    p->unused       =   NULL;
+    p->num_unused   =   0;
+    p->blocks       =   NULL;
+
+    memset(&p->stats, 0, sizeof(p->stats));
+}
+
+void*
+collect_c_pool_acquire(
+    collect_c_pool_t*   p
+)
+{
+    assert(NULL != p);
+
+    {
+        void* slot;
+
+        clc_c_pl_lock_(p);
+
+        slot = clc_c_pl_acquire_(p);
+
+        clc_c_pl_unlock_(p);
+
+        return slot;
+    }
+}
+
+void
+collect_c_pool_release(
+    collect_c_pool_t*   p
+,   void*               ptr
+)
+{
+    assert(NULL != p);
+
+    if (NULL != ptr)
+    {
+        clc_c_pl_lock_(p);
+
+        clc_c_pl_release_chain_(p, ptr, ptr, 1);
+
+        clc_c_pl_unlock_(p);
+    }
+}
+
+void
+collect_c_pool_get_stats(
+    collect_c_pool_t*       p
+,   collect_c_pool_stats_t* stats
+)
+{
+    assert(NULL != p);
+    assert(NULL != stats);
+
+    clc_c_pl_lock_(p);
+
+    *stats = p->stats;
+
+    clc_c_pl_unlock_(p);
+}
+
+void*
+collect_c_pool_cache_acquire(
+    collect_c_pool_cache_t* c
+)
+{
+    assert(NULL != c);
+    assert(NULL != c->pool);
+
+    if (NULL == c->free_list)
+    {
+        /* refill, with a batch, under a single lock */
+
+        collect_c_pool_t* const p           =   c->pool;
+        size_t const            batch_size  =   (0 == c->batch_size) ? COLLECT_C_POOL_DEFAULT_CACHE_BATCH_SIZE : c->batch_size;
+
+        clc_c_pl_lock_(p);
+
+        for (size_t i = 0; batch_size != i; ++i)
+        {
+            void* const slot = clc_c_pl_acquire_(p);
+
+            if (NULL == slot)
+            {
+                break;
+            }
+
+            COLLECT_C_POOL_INTERNAL_next_(slot) = c->free_list;
+            c->free_list = slot;
+            ++c->num_free;
+        }
+
+        clc_c_pl_unlock_(p);
+
+        if (NULL == c->free_list)
+        {
+            return NULL;
+        }
+    }
+
+    {
+        void* const slot = c->free_list;
+
+        c->free_list = COLLECT_C_POOL_INTERNAL_next_(slot);
+        --c->num_free;
+
+        return slot;
+    }
+}
+
+void
+collect_c_pool_cache_release(
+    collect_c_pool_cache_t* c
+,   void*                   ptr
+)
+{
+    assert(NULL != c);
+    assert(NULL != c->pool);
+
+    if (NULL != ptr)
+    {
+        size_t const batch_size = (0 == c->batch_size) ? COLLECT_C_POOL_DEFAULT_CACHE_BATCH_SIZE : c->batch_size;
+
+        COLLECT_C_POOL_INTERNAL_next_(ptr) = c->free_list;
+        c->free_list = ptr;
+        ++c->num_free;
+
+        if (c->num_free >= 2 * batch_size)
+        {
+            /* return a batch, under a single lock, retaining the rest */
+
+            void* const head = c->free_list;
+            void*       tail = head;
+
+            for (size_t i = 1; batch_size != i; ++i)
+            {
+                tail = COLLECT_C_POOL_INTERNAL_next_(tail);
+            }
+
+            c->free_list = COLLECT_C_POOL_INTERNAL_next_(tail);
+            c->num_free -= batch_size;
+
+            clc_c_pl_lock_(c->pool);
+
+            clc_c_pl_release_chain_(c->pool, head, tail, batch_size);
+
+            clc_c_pl_unlock_(c->pool);
+        }
+    }
+}
+
+void
+collect_c_pool_cache_flush(
+    collect_c_pool_cache_t* c
+)
+{
+    assert(NULL != c);
+    assert(NULL != c->pool);
+
+    if (NULL != c->free_list)
+    {
+        void* tail = c->free_list;
+
+        while (NULL != COLLECT_C_POOL_INTERNAL_next_(tail))
+        {
+            tail = COLLECT_C_POOL_INTERNAL_next_(tail);
+        }
+
+        clc_c_pl_lock_(c->pool);
+
+        clc_c_pl_release_chain_(c->pool, c->free_list, tail, c->num_free);
+
+        clc_c_pl_unlock_(c->pool);
+
+        c->free_list    =   NULL;
+        c->num_free     =   0;
+    }
+}
+
+void*
+collect_c_pool_allocator_alloc(
+    void*   context
+,   size_t  cb
+)
+{
+    collect_c_pool_t* const p = (collect_c_pool_t*)context;
+
+    if (cb <= p->el_size)
+    {
+        return collect_c_pool_acquire(p);
+    }
+    else
+    {
+        return collect_c_mem_alloc(p->backing, cb);
+    }
+}
+
+void
+collect_c_pool_allocator_free(
+    void*   context
+,   void*   ptr
+,   size_t  cb
+)
+{
+    collect_c_pool_t* const p = (collect_c_pool_t*)context;
+
+    if (cb <= p->el_size)
+    {
+        collect_c_pool_release(p, ptr);
+    }
+    else
+    {
+        collect_c_mem_free(p->backing, ptr, cb);
+    }
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
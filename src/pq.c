@@ -0,0 +1,416 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    src/pq.c
+ *
+ * Purpose: Priority queue container.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/pq.h>
+
+#include <assert.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions and macros
+ */
+
+#define COLLECT_C_PQ_INTERNAL_base_(q)                      (((char*)(q)->v.storage) + ((q)->v.offset * (q)->v.el_size))
+
+#define COLLECT_C_PQ_INTERNAL_less_(q, p_lhs, p_rhs)        ((*(q)->pfn_compare)((q), (p_lhs), (p_rhs)) < 0)
+
+static
+void
+clc_c_pq_swap_(
+    char*   p_lhs
+,   char*   p_rhs
+,   size_t  el_size
+)
+{
+    unsigned char buff[64];
+
+    for (; 0 != el_size; )
+    {
+        size_t const n = (el_size < sizeof(buff)) ? el_size : sizeof(buff);
+
+        memcpy(buff, p_lhs, n);
+        memcpy(p_lhs, p_rhs, n);
+        memcpy(p_rhs, buff, n);
+
+        p_lhs += n;
+        p_rhs += n;
+        el_size -= n;
+    }
+}
+
+/* Moves the element at the given index up until the heap is restored. */
+static
+void
+clc_c_pq_sift_up_(
+    collect_c_pq_t const*   q
+,   char*                   base
+,   size_t                  ix
+)
+{
+    size_t const el_size = q->v.el_size;
+
+    for (; 0 != ix; )
+    {
+        size_t const    parent  =   (ix - 1) / COLLECT_C_PQ_ARITY;
+        char* const     p_el    =   base + (ix * el_size);
+        char* const     p_par   =   base + (parent * el_size);
+
+        if (!COLLECT_C_PQ_INTERNAL_less_(q, p_el, p_par))
+        {
+            break;
+        }
+
+        clc_c_pq_swap_(p_el, p_par, el_size);
+
+        ix = parent;
+    }
+}
+
+/* Obtains the index of the least child of the element at the given index,
+ * or n if it has none.
+ */
+static
+size_t
+clc_c_pq_least_child_(
+    collect_c_pq_t const*   q
+,   char const*             base
+,   size_t                  n
+,   size_t                  ix
+)
+{
+    size_t const    el_size =   q->v.el_size;
+    size_t const    first   =   (COLLECT_C_PQ_ARITY * ix) + 1;
+
+    if (first >= n)
+    {
+        return n;
+    }
+    else
+    {
+        size_t const    last    =   (n - first < COLLECT_C_PQ_ARITY) ? n : (first + COLLECT_C_PQ_ARITY);
+        size_t          best    =   first;
+
+        for (size_t j = first + 1; last != j; ++j)
+        {
+            if (COLLECT_C_PQ_INTERNAL_less_(q, base + (j * el_size), base + (best * el_size)))
+            {
+                best = j;
+            }
+        }
+
+        return best;
+    }
+}
+
+/* Places the given element, which must not be within the first n, into
+ * the hole at the given index, moving up the least children into the hole
+ * until the heap is restored.
+ */
+static
+void
+clc_c_pq_sift_down_hole_(
+    collect_c_pq_t const*   q
+,   char*                   base
+,   size_t                  n
+,   size_t                  ix
+,   void const*             p_el
+)
+{
+    size_t const el_size = q->v.el_size;
+
+    for (;;)
+    {
+        size_t const best = clc_c_pq_least_child_(q, base, n, ix);
+
+        if (n == best ||
+            !COLLECT_C_PQ_INTERNAL_less_(q, base + (best * el_size), p_el))
+        {
+            break;
+        }
+
+        memcpy(base + (ix * el_size), base + (best * el_size), el_size);
+
+        ix = best;
+    }
+
+    memcpy(base + (ix * el_size), p_el, el_size);
+}
+
+/* Moves the element at the given index down until the heap is restored. */
+static
+void
+clc_c_pq_sift_down_(
+    collect_c_pq_t const*   q
+,   char*                   base
+,   size_t                  n
+,   size_t                  ix
+)
+{
+    size_t const el_size = q->v.el_size;
+
+    for (;;)
+    {
+        size_t const best = clc_c_pq_least_child_(q, base, n, ix);
+
+        if (n == best ||
+            !COLLECT_C_PQ_INTERNAL_less_(q, base + (best * el_size), base + (ix * el_size)))
+        {
+            break;
+        }
+
+        clc_c_pq_swap_(base + (ix * el_size), base + (best * el_size), el_size);
+
+        ix = best;
+    }
+}
+
+/* Appends an element to the vector, allocating its storage if necessary. */
+static
+int
+clc_c_pq_push_back_(
+    collect_c_pq_t* q
+,   void const*     ptr_new_el
+)
+{
+    if (NULL == q->v.storage)
+    {
+        int const r = collect_c_vec_reserve(&q->v, COLLECT_C_PQ_DEFAULT_INITIAL_CAPACITY, 0);
+
+        if (0 != r)
+        {
+            return r;
+        }
+    }
+
+    return collect_c_v_push_back_by_ref(&q->v, ptr_new_el);
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+uint32_t
+collect_c_pq_version(void)
+{
+    return COLLECT_C_PQ_VER;
+}
+
+void
+collect_c_pq_free_storage(
+    collect_c_pq_t* q
+)
+{
+    assert(NULL != q);
+
+    if (NULL != q->v.storage)
+    {
+        collect_c_vec_free_storage(&q->v);
+    }
+}
+
+int
+collect_c_pq_clear(
+    collect_c_pq_t* q
+,   void*           reserved0
+,   void*           reserved1
+,   size_t*         num_dropped
+)
+{
+    ((void)&reserved0);
+    ((void)&reserved1);
+
+    assert(NULL != q);
+    assert(NULL == reserved0);
+    assert(NULL == reserved1);
+
+    {
+        size_t dummy;
+
+        if (NULL == num_dropped)
+        {
+            num_dropped = &dummy;
+        }
+
+        *num_dropped = q->v.size;
+
+        if (NULL != q->v.storage)
+        {
+            collect_c_vec_clear(&q->v, NULL, NULL, NULL);
+        }
+
+        return 0;
+    }
+}
+
+
+int
+collect_c_pq_reserve(
+    collect_c_pq_t* q
+,   size_t          n
+)
+{
+    assert(NULL != q);
+
+    return collect_c_vec_reserve(&q->v, n, 0);
+}
+
+int
+collect_c_pq_push_by_ref(
+    collect_c_pq_t* q
+,   void const*     ptr_new_el
+)
+{
+    assert(NULL != q);
+    assert(NULL != q->pfn_compare);
+    assert(NULL != ptr_new_el);
+
+    {
+        int const r = clc_c_pq_push_back_(q, ptr_new_el);
+
+        if (0 != r)
+        {
+            return r;
+        }
+
+        clc_c_pq_sift_up_(q, COLLECT_C_PQ_INTERNAL_base_(q), q->v.size - 1);
+
+        return 0;
+    }
+}
+
+int
+collect_c_pq_push_n_by_ref(
+    collect_c_pq_t* q
+,   size_t          num_els
+,   void const*     ptr_new_els
+)
+{
+    assert(NULL != q);
+    assert(NULL != q->pfn_compare);
+    assert(0 == num_els || NULL != ptr_new_els);
+
+    if (0 == num_els)
+    {
+        return 0;
+    }
+    else
+    {
+        size_t const    size_0  =   q->v.size;
+        int             r       =   collect_c_vec_reserve(&q->v, size_0 + num_els, 0);
+
+        if (0 != r)
+        {
+            return r;
+        }
+
+        r = collect_c_v_insert_n_by_ref(&q->v, size_0, num_els, ptr_new_els);
+
+        if (0 != r)
+        {
+            return r;
+        }
+
+        /* pushing each is O(num_els) on average, but rebuilding is
+         * O(size_0 + num_els) in the worst case, and has better locality
+         */
+        if (num_els < size_0 / 8)
+        {
+            char* const base = COLLECT_C_PQ_INTERNAL_base_(q);
+
+            for (size_t ix = size_0; q->v.size != ix; ++ix)
+            {
+                clc_c_pq_sift_up_(q, base, ix);
+            }
+        }
+        else
+        {
+            collect_c_pq_heapify(q);
+        }
+
+        return 0;
+    }
+}
+
+int
+collect_c_pq_pop(
+    collect_c_pq_t* q
+,   void*           ptr_el
+)
+{
+    assert(NULL != q);
+    assert(NULL != q->pfn_compare);
+
+    if (0 == q->v.size)
+    {
+        return ENOENT;
+    }
+    else
+    {
+        size_t const    el_size =   q->v.el_size;
+        char* const     base    =   COLLECT_C_PQ_INTERNAL_base_(q);
+        size_t const    n       =   --q->v.size;
+
+        if (NULL != ptr_el)
+        {
+            memcpy(ptr_el, base, el_size);
+        }
+        else if (NULL != q->v.pfn_element_free)
+        {
+            (*q->v.pfn_element_free)(el_size, 0, base, q->v.param_element_free);
+        }
+
+        /* the last element, which is now beyond the heap, fills the hole
+         * at the root
+         */
+        if (0 != n)
+        {
+            clc_c_pq_sift_down_hole_(q, base, n, 0, base + (n * el_size));
+        }
+
+        return 0;
+    }
+}
+
+void
+collect_c_pq_heapify(
+    collect_c_pq_t* q
+)
+{
+    assert(NULL != q);
+    assert(NULL != q->pfn_compare);
+
+    {
+        size_t const n = q->v.size;
+
+        if (n > 1)
+        {
+            char* const base = COLLECT_C_PQ_INTERNAL_base_(q);
+
+            for (size_t ix = ((n - 2) / COLLECT_C_PQ_ARITY) + 1; 0 != ix--; )
+            {
+                clc_c_pq_sift_down_(q, base, n, ix);
+            }
+        }
+    }
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,737 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    src/scan.c
+ *
+ * Purpose: Internal element-search layer, with SIMD kernels.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include "scan.h"
+
+#include <collect-c/common/macros.h>
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if !defined(__STDC_NO_ATOMICS__)
+# define COLLECT_C_SCAN_INTERNAL_USE_ATOMICS_
+# include <stdatomic.h>
+#endif
+
+#if defined(__SSE2__) || \
+    defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# define COLLECT_C_SCAN_INTERNAL_USE_SSE2_
+# include <emmintrin.h>
+#endif
+
+#if defined(COLLECT_C_SCAN_INTERNAL_USE_SSE2_) && \
+    !defined(COLLECT_C_SCAN_NO_AVX2) && \
+    (   defined(__GNUC__) || \
+        defined(__clang__) || \
+        defined(_MSC_VER))
+# define COLLECT_C_SCAN_INTERNAL_USE_AVX2_
+# include <immintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+# include <intrin.h>
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions and macros
+ */
+
+/* The AVX2 kernels are compiled for AVX2 (and POPCNT, which every AVX2
+ * processor has) whatever the target of the rest of the library, and are
+ * called only once CPUID has shown the instructions to be available.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+# define COLLECT_C_SCAN_INTERNAL_TARGET_AVX2_               __attribute__((target("avx2,popcnt")))
+# define COLLECT_C_SCAN_INTERNAL_POPCNT_AVX2_(x)            ((unsigned)__builtin_popcount(x))
+#else
+# define COLLECT_C_SCAN_INTERNAL_TARGET_AVX2_
+# define COLLECT_C_SCAN_INTERNAL_POPCNT_AVX2_(x)            ((unsigned)_mm_popcnt_u32(x))
+#endif
+
+static
+COLLECT_C_UTIL_FORCE_INLINE_
+unsigned
+clc_c_scan_ctz_(
+    uint32_t    x
+)
+{
+    assert(0 != x);
+
+#if defined(__GNUC__) || defined(__clang__)
+
+    return (unsigned)__builtin_ctz(x);
+#elif defined(_MSC_VER)
+
+    unsigned long r;
+
+    _BitScanForward(&r, x);
+
+    return (unsigned)r;
+#else
+
+    unsigned r = 0;
+
+    for (; 0 == (x & 1); x >>= 1)
+    {
+        ++r;
+    }
+
+    return r;
+#endif
+}
+
+/* Reads an element of 1, 2, 4 or 8 bytes, as an integer. */
+static
+COLLECT_C_UTIL_FORCE_INLINE_
+uint64_t
+clc_c_scan_load_(
+    void const* p
+,   size_t      el_size
+)
+{
+    switch (el_size)
+    {
+    case 1:     { uint8_t  x; memcpy(&x, p, 1); return x; }
+    case 2:     { uint16_t x; memcpy(&x, p, 2); return x; }
+    case 4:     { uint32_t x; memcpy(&x, p, 4); return x; }
+    default:    { uint64_t x; memcpy(&x, p, 8); return x; }
+    }
+}
+
+
+/* portable */
+
+static
+COLLECT_C_UTIL_FORCE_INLINE_
+size_t
+clc_c_scan_find_portable_(
+    char const* base
+,   size_t      n
+,   void const* p_key
+,   size_t      el_size
+)
+{
+    if (1 == el_size)
+    {
+        void const* const p = memchr(base, *(unsigned char const*)p_key, n);
+
+        return (NULL == p) ? n : (size_t)((char const*)p - base);
+    }
+    else
+    {
+        uint64_t const key = clc_c_scan_load_(p_key, el_size);
+
+        for (size_t i = 0; n != i; ++i)
+        {
+            if (key == clc_c_scan_load_(base + (i * el_size), el_size))
+            {
+                return i;
+            }
+        }
+
+        return n;
+    }
+}
+
+static
+COLLECT_C_UTIL_FORCE_INLINE_
+size_t
+clc_c_scan_count_portable_(
+    char const* base
+,   size_t      n
+,   void const* p_key
+,   size_t      el_size
+)
+{
+    uint64_t const  key =   clc_c_scan_load_(p_key, el_size);
+    size_t          r   =   0;
+
+    for (size_t i = 0; n != i; ++i)
+    {
+        r += (key == clc_c_scan_load_(base + (i * el_size), el_size));
+    }
+
+    return r;
+}
+
+/* elements of other sizes */
+
+static
+size_t
+clc_c_scan_find_generic_(
+    char const* base
+,   size_t      n
+,   void const* p_key
+,   size_t      el_size
+)
+{
+    for (size_t i = 0; n != i; ++i)
+    {
+        if (0 == memcmp(base + (i * el_size), p_key, el_size))
+        {
+            return i;
+        }
+    }
+
+    return n;
+}
+
+static
+size_t
+clc_c_scan_count_generic_(
+    char const* base
+,   size_t      n
+,   void const* p_key
+,   size_t      el_size
+)
+{
+    size_t r = 0;
+
+    for (size_t i = 0; n != i; ++i)
+    {
+        r += (0 == memcmp(base + (i * el_size), p_key, el_size));
+    }
+
+    return r;
+}
+
+
+/* SSE2 */
+
+#ifdef COLLECT_C_SCAN_INTERNAL_USE_SSE2_
+
+static
+COLLECT_C_UTIL_FORCE_INLINE_
+__m128i
+clc_c_scan_sse2_splat_(
+    void const* p_key
+,   size_t      el_size
+)
+{
+    uint64_t const key = clc_c_scan_load_(p_key, el_size);
+
+    switch (el_size)
+    {
+    case 1:     return _mm_set1_epi8((char)key);
+    case 2:     return _mm_set1_epi16((short)key);
+    case 4:     return _mm_set1_epi32((int)key);
+    default:    return _mm_set1_epi64x((long long)key);
+    }
+}
+
+/* Compares the lanes; each byte of the result is 0xff in each element that
+ * is equal, and 0 otherwise.
+ */
+static
+COLLECT_C_UTIL_FORCE_INLINE_
+__m128i
+clc_c_scan_sse2_eq_(
+    __m128i     x
+,   __m128i     key
+,   size_t      el_size
+)
+{
+    switch (el_size)
+    {
+    case 1:     return _mm_cmpeq_epi8(x, key);
+    case 2:     return _mm_cmpeq_epi16(x, key);
+    case 4:     return _mm_cmpeq_epi32(x, key);
+    default:
+        {
+            /* SSE2 has no 64-bit comparison, so an element is equal when
+             * both of its 32-bit halves are
+             */
+            __m128i const eq32 = _mm_cmpeq_epi32(x, key);
+
+            return _mm_and_si128(eq32, _mm_shuffle_epi32(eq32, _MM_SHUFFLE(2, 3, 0, 1)));
+        }
+    }
+}
+
+static
+COLLECT_C_UTIL_FORCE_INLINE_
+size_t
+clc_c_scan_find_sse2_(
+    char const* base
+,   size_t      n
+,   void const* p_key
+,   size_t      el_size
+)
+{
+    size_t const    per =   16 / el_size;
+    __m128i const   key =   clc_c_scan_sse2_splat_(p_key, el_size);
+    size_t          i   =   0;
+
+    /* four vectors at a time, with a single test of all four */
+    for (; i + (4 * per) <= n; i += 4 * per)
+    {
+        char const* const   p   =   base + (i * el_size);
+        __m128i const       e0  =   clc_c_scan_sse2_eq_(_mm_loadu_si128((__m128i const*)(p +  0)), key, el_size);
+        __m128i const       e1  =   clc_c_scan_sse2_eq_(_mm_loadu_si128((__m128i const*)(p + 16)), key, el_size);
+        __m128i const       e2  =   clc_c_scan_sse2_eq_(_mm_loadu_si128((__m128i const*)(p + 32)), key, el_size);
+        __m128i const       e3  =   clc_c_scan_sse2_eq_(_mm_loadu_si128((__m128i const*)(p + 48)), key, el_size);
+
+        if (0 != _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(e0, e1), _mm_or_si128(e2, e3))))
+        {
+            uint32_t const m0 = (uint32_t)_mm_movemask_epi8(e0);
+            uint32_t const m1 = (uint32_t)_mm_movemask_epi8(e1);
+            uint32_t const m2 = (uint32_t)_mm_movemask_epi8(e2);
+            uint32_t const m3 = (uint32_t)_mm_movemask_epi8(e3);
+
+            if (0 != m0) return i + (0 * per) + (clc_c_scan_ctz_(m0) / el_size);
+            if (0 != m1) return i + (1 * per) + (clc_c_scan_ctz_(m1) / el_size);
+            if (0 != m2) return i + (2 * per) + (clc_c_scan_ctz_(m2) / el_size);
+
+            return i + (3 * per) + (clc_c_scan_ctz_(m3) / el_size);
+        }
+    }
+
+    for (; i + per <= n; i += per)
+    {
+        uint32_t const m = (uint32_t)_mm_movemask_epi8(clc_c_scan_sse2_eq_(_mm_loadu_si128((__m128i const*)(base + (i * el_size))), key, el_size));
+
+        if (0 != m)
+        {
+            return i + (clc_c_scan_ctz_(m) / el_size);
+        }
+    }
+
+    return i + clc_c_scan_find_portable_(base + (i * el_size), n - i, p_key, el_size);
+}
+
+static
+COLLECT_C_UTIL_FORCE_INLINE_
+size_t
+clc_c_scan_count_sse2_(
+    char const* base
+,   size_t      n
+,   void const* p_key
+,   size_t      el_size
+)
+{
+    size_t const    per     =   16 / el_size;
+    __m128i const   key     =   clc_c_scan_sse2_splat_(p_key, el_size);
+    __m128i const   zero    =   _mm_setzero_si128();
+    __m128i         total   =   zero;
+    size_t          i       =   0;
+    uint64_t        lanes[2];
+
+    /* each equal element sets el_size bytes of the comparison to 0xff, and
+     * subtracting these counts them in byte lanes, which are summed (by
+     * psadbw) before they can overflow; this avoids a popcount per vector
+     * on CPUs that lack it
+     */
+    while (i + per <= n)
+    {
+        __m128i acc = zero;
+
+        for (size_t j = 0; 255 != j && i + per <= n; ++j, i += per)
+        {
+            acc = _mm_sub_epi8(acc, clc_c_scan_sse2_eq_(_mm_loadu_si128((__m128i const*)(base + (i * el_size))), key, el_size));
+        }
+
+        total = _mm_add_epi64(total, _mm_sad_epu8(acc, zero));
+    }
+
+    _mm_storeu_si128((__m128i*)lanes, total);
+
+    return (size_t)((lanes[0] + lanes[1]) / el_size) + clc_c_scan_count_portable_(base + (i * el_size), n - i, p_key, el_size);
+}
+#endif /* COLLECT_C_SCAN_INTERNAL_USE_SSE2_ */
+
+
+/* AVX2 */
+
+#ifdef COLLECT_C_SCAN_INTERNAL_USE_AVX2_
+
+static
+COLLECT_C_SCAN_INTERNAL_TARGET_AVX2_
+COLLECT_C_UTIL_FORCE_INLINE_
+__m256i
+clc_c_scan_avx2_splat_(
+    void const* p_key
+,   size_t      el_size
+)
+{
+    uint64_t const key = clc_c_scan_load_(p_key, el_size);
+
+    switch (el_size)
+    {
+    case 1:     return _mm256_set1_epi8((char)key);
+    case 2:     return _mm256_set1_epi16((short)key);
+    case 4:     return _mm256_set1_epi32((int)key);
+    default:    return _mm256_set1_epi64x((long long)key);
+    }
+}
+
+static
+COLLECT_C_SCAN_INTERNAL_TARGET_AVX2_
+COLLECT_C_UTIL_FORCE_INLINE_
+__m256i
+clc_c_scan_avx2_eq_(
+    __m256i     x
+,   __m256i     key
+,   size_t      el_size
+)
+{
+    switch (el_size)
+    {
+    case 1:     return _mm256_cmpeq_epi8(x, key);
+    case 2:     return _mm256_cmpeq_epi16(x, key);
+    case 4:     return _mm256_cmpeq_epi32(x, key);
+    default:    return _mm256_cmpeq_epi64(x, key);
+    }
+}
+
+static
+COLLECT_C_SCAN_INTERNAL_TARGET_AVX2_
+COLLECT_C_UTIL_FORCE_INLINE_
+size_t
+clc_c_scan_find_avx2_(
+    char const* base
+,   size_t      n
+,   void const* p_key
+,   size_t      el_size
+)
+{
+    size_t const    per =   32 / el_size;
+    __m256i const   key =   clc_c_scan_avx2_splat_(p_key, el_size);
+    size_t          i   =   0;
+
+    /* four vectors (two cache lines) at a time, with a single test of all
+     * four
+     */
+    for (; i + (4 * per) <= n; i += 4 * per)
+    {
+        char const* const   p   =   base + (i * el_size);
+        __m256i const       e0  =   clc_c_scan_avx2_eq_(_mm256_loadu_si256((__m256i const*)(p +  0)), key, el_size);
+        __m256i const       e1  =   clc_c_scan_avx2_eq_(_mm256_loadu_si256((__m256i const*)(p + 32)), key, el_size);
+        __m256i const       e2  =   clc_c_scan_avx2_eq_(_mm256_loadu_si256((__m256i const*)(p + 64)), key, el_size);
+        __m256i const       e3  =   clc_c_scan_avx2_eq_(_mm256_loadu_si256((__m256i const*)(p + 96)), key, el_size);
+
+        if (!_mm256_testz_si256(_mm256_or_si256(_mm256_or_si256(e0, e1), _mm256_or_si256(e2, e3)), _mm256_set1_epi8(-1)))
+        {
+            uint32_t const m0 = (uint32_t)_mm256_movemask_epi8(e0);
+            uint32_t const m1 = (uint32_t)_mm256_movemask_epi8(e1);
+            uint32_t const m2 = (uint32_t)_mm256_movemask_epi8(e2);
+            uint32_t const m3 = (uint32_t)_mm256_movemask_epi8(e3);
+
+            if (0 != m0) return i + (0 * per) + (clc_c_scan_ctz_(m0) / el_size);
+            if (0 != m1) return i + (1 * per) + (clc_c_scan_ctz_(m1) / el_size);
+            if (0 != m2) return i + (2 * per) + (clc_c_scan_ctz_(m2) / el_size);
+
+            return i + (3 * per) + (clc_c_scan_ctz_(m3) / el_size);
+        }
+    }
+
+    for (; i + per <= n; i += per)
+    {
+        uint32_t const m = (uint32_t)_mm256_movemask_epi8(clc_c_scan_avx2_eq_(_mm256_loadu_si256((__m256i const*)(base + (i * el_size))), key, el_size));
+
+        if (0 != m)
+        {
+            return i + (clc_c_scan_ctz_(m) / el_size);
+        }
+    }
+
+    return i + clc_c_scan_find_sse2_(base + (i * el_size), n - i, p_key, el_size);
+}
+
+static
+COLLECT_C_SCAN_INTERNAL_TARGET_AVX2_
+COLLECT_C_UTIL_FORCE_INLINE_
+size_t
+clc_c_scan_count_avx2_(
+    char const* base
+,   size_t      n
+,   void const* p_key
+,   size_t      el_size
+)
+{
+    size_t const    per     =   32 / el_size;
+    __m256i const   key     =   clc_c_scan_avx2_splat_(p_key, el_size);
+    size_t          i       =   0;
+    size_t          bits    =   0;
+
+    for (; i + per <= n; i += per)
+    {
+        bits += COLLECT_C_SCAN_INTERNAL_POPCNT_AVX2_((uint32_t)_mm256_movemask_epi8(clc_c_scan_avx2_eq_(_mm256_loadu_si256((__m256i const*)(base + (i * el_size))), key, el_size)));
+    }
+
+    return (bits / el_size) + clc_c_scan_count_sse2_(base + (i * el_size), n - i, p_key, el_size);
+}
+
+/* The entry points, one per element size, into which the kernels are
+ * inlined with a constant el_size.
+ */
+#define COLLECT_C_SCAN_INTERNAL_DEFINE_AVX2_ENTRIES_(cb)                    \
+                                                                            \
+    static                                                                  \
+    COLLECT_C_SCAN_INTERNAL_TARGET_AVX2_                                    \
+    size_t                                                                  \
+    clc_c_scan_find_avx2_ ## cb ## _(                                       \
+        char const* base                                                    \
+    ,   size_t      n                                                       \
+    ,   void const* p_key                                                   \
+    )                                                                       \
+    {                                                                       \
+        return clc_c_scan_find_avx2_(base, n, p_key, cb);                   \
+    }                                                                       \
+                                                                            \
+    static                                                                  \
+    COLLECT_C_SCAN_INTERNAL_TARGET_AVX2_                                    \
+    size_t                                                                  \
+    clc_c_scan_count_avx2_ ## cb ## _(                                      \
+        char const* base                                                    \
+    ,   size_t      n                                                       \
+    ,   void const* p_key                                                   \
+    )                                                                       \
+    {                                                                       \
+        return clc_c_scan_count_avx2_(base, n, p_key, cb);                  \
+    }
+
+COLLECT_C_SCAN_INTERNAL_DEFINE_AVX2_ENTRIES_(1)
+COLLECT_C_SCAN_INTERNAL_DEFINE_AVX2_ENTRIES_(2)
+COLLECT_C_SCAN_INTERNAL_DEFINE_AVX2_ENTRIES_(4)
+COLLECT_C_SCAN_INTERNAL_DEFINE_AVX2_ENTRIES_(8)
+#endif /* COLLECT_C_SCAN_INTERNAL_USE_AVX2_ */
+
+static
+int
+clc_c_scan_detect_level_(void)
+{
+#if defined(COLLECT_C_SCAN_INTERNAL_USE_AVX2_)
+# if defined(_MSC_VER) && \
+     !defined(__clang__)
+
+    int info[4];
+
+    __cpuid(info, 0);
+
+    if (info[0] >= 7)
+    {
+        __cpuid(info, 1);
+
+        /* OSXSAVE and POPCNT, and the OS must save the YMM registers */
+        if (0 != (info[2] & (1 << 27)) &&
+            0 != (info[2] & (1 << 23)) &&
+            6 == (_xgetbv(0) & 6))
+        {
+            __cpuidex(info, 7, 0);
+
+            if (0 != (info[1] & (1 << 5)))
+            {
+                return COLLECT_C_SCAN_LEVEL_AVX2;
+            }
+        }
+    }
+# else
+
+    /* (which checks also that the OS saves the YMM registers) */
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2") &&
+        __builtin_cpu_supports("popcnt"))
+    {
+        return COLLECT_C_SCAN_LEVEL_AVX2;
+    }
+# endif
+#endif
+
+#if defined(COLLECT_C_SCAN_INTERNAL_USE_SSE2_)
+
+    return COLLECT_C_SCAN_LEVEL_SSE2;
+#else
+
+    return COLLECT_C_SCAN_LEVEL_PORTABLE;
+#endif
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * internal functions
+ */
+
+int
+collect_c_scan_level(void)
+{
+    /* Detection is idempotent, so threads that race to it store the same
+     * value, and relaxed ordering suffices.
+     */
+#if defined(COLLECT_C_SCAN_INTERNAL_USE_ATOMICS_)
+
+    static atomic_int s_level = -1;
+
+    int level = atomic_load_explicit(&s_level, memory_order_relaxed);
+
+    if (level < 0)
+    {
+        level = clc_c_scan_detect_level_();
+
+        atomic_store_explicit(&s_level, level, memory_order_relaxed);
+    }
+
+    return level;
+#else
+
+    static int volatile s_level = -1;
+
+    int level = s_level;
+
+    if (level < 0)
+    {
+        level = clc_c_scan_detect_level_();
+
+        s_level = level;
+    }
+
+    return level;
+#endif
+}
+
+size_t
+collect_c_scan_find(
+    void const* base
+,   size_t      n
+,   size_t      el_size
+,   void const* p_key
+)
+{
+    char const* const b = (char const*)base;
+
+    assert(NULL != base || 0 == n);
+    assert(0 != el_size);
+    assert(NULL != p_key);
+
+    if (0 == n)
+    {
+        return 0;
+    }
+
+    switch (el_size)
+    {
+    case 1:
+    case 2:
+    case 4:
+    case 8:
+        break;
+    default:
+        return clc_c_scan_find_generic_(b, n, p_key, el_size);
+    }
+
+#ifdef COLLECT_C_SCAN_INTERNAL_USE_AVX2_
+
+    if (COLLECT_C_SCAN_LEVEL_AVX2 == collect_c_scan_level())
+    {
+        switch (el_size)
+        {
+        case 1:     return clc_c_scan_find_avx2_1_(b, n, p_key);
+        case 2:     return clc_c_scan_find_avx2_2_(b, n, p_key);
+        case 4:     return clc_c_scan_find_avx2_4_(b, n, p_key);
+        default:    return clc_c_scan_find_avx2_8_(b, n, p_key);
+        }
+    }
+#endif
+#ifdef COLLECT_C_SCAN_INTERNAL_USE_SSE2_
+
+    switch (el_size)
+    {
+    case 1:     return clc_c_scan_find_sse2_(b, n, p_key, 1);
+    case 2:     return clc_c_scan_find_sse2_(b, n, p_key, 2);
+    case 4:     return clc_c_scan_find_sse2_(b, n, p_key, 4);
+    default:    return clc_c_scan_find_sse2_(b, n, p_key, 8);
+    }
+#else
+
+    switch (el_size)
+    {
+    case 1:     return clc_c_scan_find_portable_(b, n, p_key, 1);
+    case 2:     return clc_c_scan_find_portable_(b, n, p_key, 2);
+    case 4:     return clc_c_scan_find_portable_(b, n, p_key, 4);
+    default:    return clc_c_scan_find_portable_(b, n, p_key, 8);
+    }
+#endif
+}
+
+size_t
+collect_c_scan_count(
+    void const* base
+,   size_t      n
+,   size_t      el_size
+,   void const* p_key
+)
+{
+    char const* const b = (char const*)base;
+
+    assert(NULL != base || 0 == n);
+    assert(0 != el_size);
+    assert(NULL != p_key);
+
+    if (0 == n)
+    {
+        return 0;
+    }
+
+    switch (el_size)
+    {
+    case 1:
+    case 2:
+    case 4:
+    case 8:
+        break;
+    default:
+        return clc_c_scan_count_generic_(b, n, p_key, el_size);
+    }
+
+#ifdef COLLECT_C_SCAN_INTERNAL_USE_AVX2_
+
+    if (COLLECT_C_SCAN_LEVEL_AVX2 == collect_c_scan_level())
+    {
+        switch (el_size)
+        {
+        case 1:     return clc_c_scan_count_avx2_1_(b, n, p_key);
+        case 2:     return clc_c_scan_count_avx2_2_(b, n, p_key);
+        case 4:     return clc_c_scan_count_avx2_4_(b, n, p_key);
+        default:    return clc_c_scan_count_avx2_8_(b, n, p_key);
+        }
+    }
+#endif
+#ifdef COLLECT_C_SCAN_INTERNAL_USE_SSE2_
+
+    switch (el_size)
+    {
+    case 1:     return clc_c_scan_count_sse2_(b, n, p_key, 1);
+    case 2:     return clc_c_scan_count_sse2_(b, n, p_key, 2);
+    case 4:     return clc_c_scan_count_sse2_(b, n, p_key, 4);
+    default:    return clc_c_scan_count_sse2_(b, n, p_key, 8);
+    }
+#else
+
+    switch (el_size)
+    {
+    case 1:     return clc_c_scan_count_portable_(b, n, p_key, 1);
+    case 2:     return clc_c_scan_count_portable_(b, n, p_key, 2);
+    case 4:     return clc_c_scan_count_portable_(b, n, p_key, 4);
+    default:    return clc_c_scan_count_portable_(b, n, p_key, 8);
+    }
+#endif
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,74 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    src/scan.h
+ *
+ * Purpose: Internal element-search layer, with SIMD kernels.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <stddef.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * constants
+ */
+
+/* The kernels (as returned by collect_c_scan_level()) with which elements
+ * of 1, 2, 4 or 8 bytes are compared. The level is selected, on first
+ * use, as the highest that is both compiled in and supported by the CPU
+ * (and OS), as determined by CPUID; defining COLLECT_C_SCAN_NO_AVX2 when
+ * building the library excludes the AVX2 kernels.
+ */
+#define COLLECT_C_SCAN_LEVEL_PORTABLE                       (0)
+#define COLLECT_C_SCAN_LEVEL_SSE2                           (1)
+#define COLLECT_C_SCAN_LEVEL_AVX2                           (2)
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * internal functions
+ */
+
+/** Obtains the level of the kernels that are in use. */
+int
+collect_c_scan_level(void);
+
+/** Searches n contiguous elements of el_size bytes for the first whose
+ * bytes are equal to those of the key.
+ *
+ * @return The index of the element, or n if there is none.
+ */
+size_t
+collect_c_scan_find(
+    void const* base
+,   size_t      n
+,   size_t      el_size
+,   void const* p_key
+);
+
+/** Counts the elements, of n contiguous elements of el_size bytes, whose
+ * bytes are equal to those of the key.
+ */
+size_t
+collect_c_scan_count(
+    void const* base
+,   size_t      n
+,   size_t      el_size
+,   void const* p_key
+);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#pragma once
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,601 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    src/skiplist.c
+ *
+ * Purpose: Ordered skip-list container.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/skiplist.h>
+
+#include "allocator.h"
+
+#include <errno.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * local types
+ */
+
+typedef collect_c_skiplist_node_t                           node_t;
+typedef collect_c_skiplist_block_t                          block_t;
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions and macros
+ */
+
+#define COLLECT_C_SKIPLIST_INTERNAL_round_up_(n, a)         (((n) + ((a) - 1)) & ~((a) - 1))
+
+/* the offset, within a node, of its links for levels 1+ */
+#define COLLECT_C_SKIPLIST_INTERNAL_links_offset_(el_size)  COLLECT_C_SKIPLIST_INTERNAL_round_up_(offsetof(node_t, data) + (el_size), _Alignof(node_t*))
+
+#define COLLECT_C_SKIPLIST_INTERNAL_sizeof_node_(el_size, height)   \
+                                                            COLLECT_C_SKIPLIST_INTERNAL_round_up_(COLLECT_C_SKIPLIST_INTERNAL_links_offset_(el_size) + (((height) - 1) * sizeof(node_t*)), _Alignof(node_t))
+
+#define COLLECT_C_SKIPLIST_INTERNAL_el_ptr_(n)              ((void*)(&(n)->data->data[0]))
+
+/* Obtains the address of the given node's link at the given level. */
+static
+inline
+node_t**
+clc_c_sl_link_(
+    collect_c_skiplist_t const* sl
+,   node_t*                     node
+,   size_t                      level
+)
+{
+    assert(level < node->height);
+
+    if (0 == level)
+    {
+        return &node->next;
+    }
+    else
+    {
+        return ((node_t**)((char*)node + COLLECT_C_SKIPLIST_INTERNAL_links_offset_(sl->el_size))) + (level - 1);
+    }
+}
+
+/* Obtains a node height, such that each additional level has a
+ * probability of 1/4, using an xorshift generator.
+ */
+static
+size_t
+clc_c_sl_random_height_(
+    collect_c_skiplist_t*   sl
+)
+{
+    uint64_t    x = sl->rng_state;
+    size_t      h = 1;
+
+    if (0 == x)
+    {
+        x = UINT64_C(0x9e3779b97f4a7c15);
+    }
+
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+
+    sl->rng_state = x;
+
+    for (; h < COLLECT_C_SKIPLIST_MAX_HEIGHT && 0 == (x & 3); x >>= 2)
+    {
+        ++h;
+    }
+
+    return h;
+}
+
+/* Obtains a node of the given height, from the height's free-list if
+ * possible, otherwise from the current block, otherwise from a new block.
+ */
+static
+node_t*
+clc_c_sl_make_node_(
+    collect_c_skiplist_t*   sl
+,   size_t                  height
+)
+{
+    node_t* nd;
+
+    assert(0 != height);
+    assert(height <= COLLECT_C_SKIPLIST_MAX_HEIGHT);
+
+    if (NULL != sl->free_lists[height - 1])
+    {
+        nd = sl->free_lists[height - 1];
+
+        sl->free_lists[height - 1] = nd->next;
+    }
+    else
+    {
+        size_t const    cb  =   COLLECT_C_SKIPLIST_INTERNAL_sizeof_node_(sl->el_size, height);
+        block_t*        b   =   sl->blocks;
+
+        if (NULL == b ||
+            b->size - b->num_used < cb)
+        {
+            size_t size = COLLECT_C_SKIPLIST_DEFAULT_BLOCK_SIZE - offsetof(block_t, data);
+
+            if (size < cb)
+            {
+                size = cb;
+            }
+
+            if (NULL == (b = collect_c_mem_alloc(sl->allocator, offsetof(block_t, data) + size)))
+            {
+                return NULL;
+            }
+
+            b->next_block   =   sl->blocks;
+            b->size         =   size;
+            b->num_used     =   0;
+
+            sl->blocks      =   b;
+        }
+
+        nd = (node_t*)(&b->data->data[0] + b->num_used);
+
+        b->num_used += cb;
+    }
+
+    nd->height = height;
+
+    return nd;
+}
+
+static
+void
+clc_c_sl_release_node_(
+    collect_c_skiplist_t*   sl
+,   node_t*                 node
+)
+{
+    node->next = sl->free_lists[node->height - 1];
+
+    sl->free_lists[node->height - 1] = node;
+}
+
+/* Searches for the first node whose element is not less than (or, if
+ * past_equal, is greater than) the given key, optionally recording at each
+ * level in use the address of the link that refers to it.
+ */
+static
+node_t*
+clc_c_sl_search_(
+    collect_c_skiplist_t const* sl
+,   void const*                 p_key
+,   bool                        past_equal
+,   node_t**                    update[]
+)
+{
+    node_t*         x   =   NULL;
+    node_t* const*  pp  =   NULL;
+
+    for (size_t i = sl->height; 0 != i--; )
+    {
+        pp = (NULL == x) ? &sl->heads[i] : clc_c_sl_link_(sl, x, i);
+
+        for (;;)
+        {
+            node_t* const next = *pp;
+
+            if (NULL == next)
+            {
+                break;
+            }
+            else
+            {
+                int const r = (*sl->pfn_compare)(sl, p_key, COLLECT_C_SKIPLIST_INTERNAL_el_ptr_(next));
+
+                if (r < 0 ||
+                    (0 == r && !past_equal))
+                {
+                    break;
+                }
+
+                x   =   next;
+                pp  =   clc_c_sl_link_(sl, x, i);
+            }
+        }
+
+        if (NULL != update)
+        {
+            update[i] = (node_t**)pp;
+        }
+    }
+
+    return (NULL == pp) ? NULL : *pp;
+}
+
+/* Unlinks the given node, whose predecessors' links are given by update,
+ * and retires it to its free-list.
+ */
+static
+void
+clc_c_sl_unlink_(
+    collect_c_skiplist_t*   sl
+,   node_t*                 node
+,   node_t**                update[]
+)
+{
+    for (size_t i = 0; node->height != i; ++i)
+    {
+        assert(node == *update[i]);
+
+        *update[i] = *clc_c_sl_link_(sl, node, i);
+    }
+
+    if (NULL != node->next)
+    {
+        node->next->prev = node->prev;
+    }
+    else
+    {
+        sl->tail = node->prev;
+    }
+
+    for (; 0 != sl->height && NULL == sl->heads[sl->height - 1]; )
+    {
+        --sl->height;
+    }
+
+    --sl->size;
+
+    if (NULL != sl->pfn_element_free)
+    {
+        (*sl->pfn_element_free)(sl->el_size, 0, COLLECT_C_SKIPLIST_INTERNAL_el_ptr_(node), sl->param_element_free);
+    }
+
+    clc_c_sl_release_node_(sl, node);
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+uint32_t
+collect_c_skiplist_version(void)
+{
+    return COLLECT_C_SKIPLIST_VER;
+}
+
+void
+collect_c_skiplist_free_storage(
+    collect_c_skiplist_t*   sl
+)
+{
+    assert(NULL != sl);
+
+    for (node_t* n = sl->heads[0]; NULL != n; n = n->next)
+    {
+        if (NULL != sl->pfn_element_free)
+        {
+            (*sl->pfn_element_free)(sl->el_size, 0, COLLECT_C_SKIPLIST_INTERNAL_el_ptr_(n), sl->param_element_free);
+        }
+    }
+
+    for (block_t* b = sl->blocks; NULL != b; )
+    {
+        block_t* const b2 = b;
+
+        b = b->next_block;
+
+        collect_c_mem_free(sl->allocator, b2, offsetof(block_t, data) + b2->size);
+    }
+
+    memset(sl->heads, 0, sizeof(sl->heads));
+    memset(sl->free_lists, 0, sizeof(sl->free_lists));
+
+    sl->size    =   0;
+    sl->height  =   0;
+    sl->tail    =   NULL;
+    sl->blocks  =   NULL;
+}
+
+int
+collect_c_skiplist_clear(
+    collect_c_skiplist_t*   sl
+,   void*                   reserved0
+,   void*                   reserved1
+,   size_t*                 num_dropped
+)
+{
+    assert(NULL != sl);
+    assert(NULL == reserved0);
+    assert(NULL == reserved1);
+
+    ((void)&reserved0);
+    ((void)&reserved1);
+
+    {
+        size_t dummy;
+
+        if (NULL == num_dropped)
+        {
+            num_dropped = &dummy;
+        }
+
+        *num_dropped = 0;
+
+        for (node_t* n = sl->heads[0]; NULL != n; )
+        {
+            node_t* const n2 = n;
+
+            n = n->next;
+
+            if (NULL != sl->pfn_element_free)
+            {
+                (*sl->pfn_element_free)(sl->el_size, 0, COLLECT_C_SKIPLIST_INTERNAL_el_ptr_(n2), sl->param_element_free);
+            }
+
+            clc_c_sl_release_node_(sl, n2);
+
+            ++*num_dropped;
+        }
+
+        memset(sl->heads, 0, sizeof(sl->heads));
+
+        sl->size    =   0;
+        sl->height  =   0;
+        sl->tail    =   NULL;
+
+        return 0;
+    }
+}
+
+int
+collect_c_skiplist_erase_node(
+    collect_c_skiplist_t*       sl
+,   collect_c_skiplist_node_t*  node
+)
+{
+    assert(NULL != sl);
+    assert(NULL != sl->pfn_compare);
+    assert(NULL != node);
+
+    {
+        node_t**        update[COLLECT_C_SKIPLIST_MAX_HEIGHT];
+        node_t* const   found = clc_c_sl_search_(sl, COLLECT_C_SKIPLIST_INTERNAL_el_ptr_(node), false, update);
+
+        assert(node == found);
+        ((void)&found);
+
+        clc_c_sl_unlink_(sl, node, update);
+
+        return 0;
+    }
+}
+
+int
+collect_c_skiplist_erase_by_key(
+    collect_c_skiplist_t*   sl
+,   void const*             p_key
+)
+{
+    assert(NULL != sl);
+    assert(NULL != sl->pfn_compare);
+    assert(NULL != p_key);
+
+    {
+        node_t**        update[COLLECT_C_SKIPLIST_MAX_HEIGHT];
+        node_t* const   node = clc_c_sl_search_(sl, p_key, false, update);
+
+        if (NULL == node ||
+            0 != (*sl->pfn_compare)(sl, p_key, COLLECT_C_SKIPLIST_INTERNAL_el_ptr_(node)))
+        {
+            return ENOENT;
+        }
+
+        clc_c_sl_unlink_(sl, node, update);
+
+        return 0;
+    }
+}
+
+int
+collect_c_skiplist_find_node(
+    collect_c_skiplist_t const*     sl
+,   void const*                     p_key
+,   collect_c_skiplist_node_t**     node
+)
+{
+    assert(NULL != sl);
+    assert(NULL != sl->pfn_compare);
+    assert(NULL != p_key);
+    assert(NULL != node);
+
+    {
+        node_t* const n = clc_c_sl_search_(sl, p_key, false, NULL);
+
+        if (NULL == n ||
+            0 != (*sl->pfn_compare)(sl, p_key, COLLECT_C_SKIPLIST_INTERNAL_el_ptr_(n)))
+        {
+            *node = NULL;
+
+            return ENOENT;
+        }
+
+        *node = n;
+
+        return 0;
+    }
+}
+
+int
+collect_c_skiplist_lower_bound(
+    collect_c_skiplist_t const*     sl
+,   void const*                     p_key
+,   collect_c_skiplist_node_t**     node
+)
+{
+    assert(NULL != sl);
+    assert(NULL != sl->pfn_compare);
+    assert(NULL != p_key);
+    assert(NULL != node);
+
+    *node = clc_c_sl_search_(sl, p_key, false, NULL);
+
+    return (NULL == *node) ? ENOENT : 0;
+}
+
+int
+collect_c_skiplist_upper_bound(
+    collect_c_skiplist_t const*     sl
+,   void const*                     p_key
+,   collect_c_skiplist_node_t**     node
+)
+{
+    assert(NULL != sl);
+    assert(NULL != sl->pfn_compare);
+    assert(NULL != p_key);
+    assert(NULL != node);
+
+    *node = clc_c_sl_search_(sl, p_key, true, NULL);
+
+    return (NULL == *node) ? ENOENT : 0;
+}
+
+int
+collect_c_skiplist_range(
+    collect_c_skiplist_t const*     sl
+,   void const*                     p_lo
+,   void const*                     p_hi
+,   collect_c_skiplist_node_t**     first
+,   collect_c_skiplist_node_t**     end
+,   size_t*                         num_els
+)
+{
+    assert(NULL != sl);
+    assert(NULL != sl->pfn_compare);
+    assert(NULL != p_lo);
+    assert(NULL != p_hi);
+    assert(NULL != first);
+    assert(NULL != end);
+
+    {
+        size_t dummy;
+
+        if (NULL == num_els)
+        {
+            num_els = &dummy;
+        }
+
+        *num_els = 0;
+
+        *first = clc_c_sl_search_(sl, p_lo, false, NULL);
+
+        if (NULL == *first ||
+            (*sl->pfn_compare)(sl, p_hi, COLLECT_C_SKIPLIST_INTERNAL_el_ptr_(*first)) <= 0)
+        {
+            *end = *first;
+
+            return ENOENT;
+        }
+
+        *end = clc_c_sl_search_(sl, p_hi, false, NULL);
+
+        if (num_els != &dummy)
+        {
+            for (node_t const* n = *first; *end != n; n = n->next)
+            {
+                ++*num_els;
+            }
+        }
+
+        return 0;
+    }
+}
+
+int
+collect_c_skiplist_insert_by_ref(
+    collect_c_skiplist_t*       sl
+,   void const*                 ptr_new_el
+,   collect_c_skiplist_node_t** new_node
+)
+{
+    assert(NULL != sl);
+    assert(NULL != sl->pfn_compare);
+    assert(NULL != ptr_new_el);
+
+    {
+        collect_c_skiplist_node_t*  dummy;
+        node_t**                    update[COLLECT_C_SKIPLIST_MAX_HEIGHT];
+        node_t* const               succ = clc_c_sl_search_(sl, ptr_new_el, false, update);
+
+        if (NULL == new_node)
+        {
+            new_node = &dummy;
+        }
+
+        if (NULL != succ &&
+            0 == (*sl->pfn_compare)(sl, ptr_new_el, COLLECT_C_SKIPLIST_INTERNAL_el_ptr_(succ)))
+        {
+            *new_node = succ;
+
+            return EEXIST;
+        }
+        else
+        {
+            size_t const    height  =   clc_c_sl_random_height_(sl);
+            node_t* const   nd      =   clc_c_sl_make_node_(sl, height);
+
+            if (NULL == nd)
+            {
+                *new_node = NULL;
+
+                return ENOMEM;
+            }
+
+            memcpy(COLLECT_C_SKIPLIST_INTERNAL_el_ptr_(nd), ptr_new_el, sl->el_size);
+
+            for (; sl->height < height; ++sl->height)
+            {
+                update[sl->height] = &sl->heads[sl->height];
+            }
+
+            for (size_t i = 0; height != i; ++i)
+            {
+                node_t** const link = clc_c_sl_link_(sl, nd, i);
+
+                *link       =   *update[i];
+                *update[i]  =   nd;
+            }
+
+            if (NULL != succ)
+            {
+                nd->prev    =   succ->prev;
+                succ->prev  =   nd;
+            }
+            else
+            {
+                nd->prev    =   sl->tail;
+                sl->tail    =   nd;
+            }
+
+            ++sl->size;
+
+            *new_node = nd;
+
+            return 0;
+        }
+    }
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
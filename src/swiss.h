@@ -0,0 +1,548 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    src/swiss.h
+ *
+ * Purpose: Internal control-byte groups for SwissTable-style hash tables.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include "allocator.h"
+
+#include <assert.h>
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__SSE2__) || \
+    defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# define COLLECT_C_SWISS_USE_SSE2_
+# include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+# include <intrin.h>
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * constants
+ */
+
+/* A table's slots are divided into aligned groups, each of which has a
+ * control byte per slot: the high bit is set for an empty or deleted
+ * (tombstone) slot; otherwise the low 7 bits hold the "H2" bits of the
+ * hash of the slot's key. A group is examined by matching all its control
+ * bytes at once: with SSE2 in a single comparison; otherwise byte-wise.
+ */
+
+#define COLLECT_C_SWISS_GROUP_WIDTH                         (16)
+
+#define COLLECT_C_SWISS_CTRL_EMPTY                          ((int8_t)-128)
+#define COLLECT_C_SWISS_CTRL_DELETED                        ((int8_t)-2)
+
+/* The maximum load factor is 7/8. */
+#define COLLECT_C_SWISS_max_load_(capacity)                 ((capacity) - ((capacity) / 8))
+
+#define COLLECT_C_SWISS_h1_(hash)                           ((size_t)(hash) >> 7)
+#define COLLECT_C_SWISS_h2_(hash)                           ((int8_t)((hash) & 0x7f))
+
+/* The index returned by collect_c_swiss_prepare_insert() when memory is
+ * exhausted.
+ */
+#define COLLECT_C_SWISS_NO_SLOT                             (SIZE_MAX)
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+/* Obtains the hash of the key held in the given slot. */
+typedef size_t (*collect_c_swiss_pfn_hash_slot_t)(
+    void const*     param
+,   void const*     slot
+);
+
+/* A view of the bookkeeping fields of a table - a hash map or a hash set -
+ * by which the operations that rehash, claim and erase slots are shared,
+ * so that the accounting of growth_left and num_deleted is the same for
+ * all tables. The control bytes and the slots are held in a single block,
+ * the slots following the control bytes.
+ */
+struct collect_c_swiss_table_t
+{
+    size_t*                             size;
+    size_t*                             capacity;
+    size_t*                             growth_left;
+    size_t*                             num_deleted;
+    int8_t**                            ctrl;
+    void**                              slots;
+    size_t                              slot_size;
+    struct collect_c_allocator_t const* allocator;
+    collect_c_swiss_pfn_hash_slot_t     pfn_hash;
+    void const*                         param_hash;
+};
+typedef struct collect_c_swiss_table_t  collect_c_swiss_table_t;
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * internal functions
+ */
+
+/* Each match function obtains a bit-mask with bit i set if the control
+ * byte of slot i of the group satisfies the criterion.
+ */
+
+static inline
+uint32_t
+collect_c_swiss_match_h2(
+    int8_t const*   group
+,   int8_t          h2
+)
+{
+#ifdef COLLECT_C_SWISS_USE_SSE2_
+
+    __m128i const ctrl = _mm_loadu_si128((__m128i const*)group);
+
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl));
+#else
+
+    uint32_t m = 0;
+
+    for (unsigned i = 0; COLLECT_C_SWISS_GROUP_WIDTH != i; ++i)
+    {
+        m |= (uint32_t)(h2 == group[i]) << i;
+    }
+
+    return m;
+#endif
+}
+
+static inline
+uint32_t
+collect_c_swiss_match_empty(
+    int8_t const*   group
+)
+{
+    return collect_c_swiss_match_h2(group, COLLECT_C_SWISS_CTRL_EMPTY);
+}
+
+static inline
+uint32_t
+collect_c_swiss_match_empty_or_deleted(
+    int8_t const*   group
+)
+{
+#ifdef COLLECT_C_SWISS_USE_SSE2_
+
+    /* the high bit of each byte is exactly the criterion */
+    return (uint32_t)_mm_movemask_epi8(_mm_loadu_si128((__m128i const*)group));
+#else
+
+    uint32_t m = 0;
+
+    for (unsigned i = 0; COLLECT_C_SWISS_GROUP_WIDTH != i; ++i)
+    {
+        m |= (uint32_t)(group[i] < 0) << i;
+    }
+
+    return m;
+#endif
+}
+
+/* The index of the lowest set bit of a non-zero mask. */
+static inline
+unsigned
+collect_c_swiss_lowest(
+    uint32_t        mask
+)
+{
+#if defined(__GNUC__) || \
+    defined(__clang__)
+
+    return (unsigned)__builtin_ctz(mask);
+#elif defined(_MSC_VER)
+
+    unsigned long ix;
+
+    _BitScanForward(&ix, mask);
+
+    return (unsigned)ix;
+#else
+
+    unsigned ix = 0;
+
+    for (; 0 == (mask & 1); mask >>= 1)
+    {
+        ++ix;
+    }
+
+    return ix;
+#endif
+}
+
+/* The built-in hash of an integer, which mixes all bits into both the H1
+ * (high) and H2 (low) bits, as is required for the control bytes to be
+ * discriminating.
+ */
+static inline
+size_t
+collect_c_swiss_hash_u64(
+    uint64_t        v
+)
+{
+    v ^= v >> 33;
+    v *= UINT64_C(0xff51afd7ed558ccd);
+    v ^= v >> 33;
+    v *= UINT64_C(0xc4ceb9fe1a85ec53);
+    v ^= v >> 33;
+
+    return (size_t)v;
+}
+
+/* The built-in hash of a block of bytes, which consumes 8 bytes at a time. */
+static inline
+size_t
+collect_c_swiss_hash_bytes(
+    void const*     p
+,   size_t          cb
+)
+{
+    unsigned char const*    b   =   (unsigned char const*)p;
+    uint64_t                h   =   UINT64_C(0x9e3779b97f4a7c15) ^ ((uint64_t)cb * UINT64_C(0xbf58476d1ce4e5b9));
+
+    for (; cb >= 8; cb -= 8, b += 8)
+    {
+        uint64_t w;
+
+        memcpy(&w, b, 8);
+
+        h ^= w * UINT64_C(0x94d049bb133111eb);
+        h = ((h << 29) | (h >> 35)) * UINT64_C(0xbf58476d1ce4e5b9);
+    }
+
+    if (0 != cb)
+    {
+        uint64_t w = 0;
+
+        memcpy(&w, b, cb);
+
+        h ^= w * UINT64_C(0x94d049bb133111eb);
+    }
+
+    return collect_c_swiss_hash_u64(h);
+}
+
+/* Obtains the built-in hash of a key of the given size. */
+static inline
+size_t
+collect_c_swiss_hash_key(
+    void const*     p_key
+,   size_t          key_size
+)
+{
+    switch (key_size)
+    {
+    case 4:
+        {
+            uint32_t v;
+
+            memcpy(&v, p_key, 4);
+
+            return collect_c_swiss_hash_u64(v);
+        }
+    case 8:
+        {
+            uint64_t v;
+
+            memcpy(&v, p_key, 8);
+
+            return collect_c_swiss_hash_u64(v);
+        }
+    case 16:
+        {
+            uint64_t v[2];
+
+            memcpy(&v, p_key, 16);
+
+            return collect_c_swiss_hash_u64(v[0] ^ collect_c_swiss_hash_u64(v[1] + UINT64_C(0x9e3779b97f4a7c15)));
+        }
+    default:
+
+        return collect_c_swiss_hash_bytes(p_key, key_size);
+    }
+}
+
+/* Determines, bytewise, whether two keys of the given size are equal. */
+static inline
+int
+collect_c_swiss_keys_equal(
+    void const*     p_lhs
+,   void const*     p_rhs
+,   size_t          key_size
+)
+{
+    switch (key_size)
+    {
+    case 4:
+        {
+            uint32_t l, r;
+
+            memcpy(&l, p_lhs, 4);
+            memcpy(&r, p_rhs, 4);
+
+            return l == r;
+        }
+    case 8:
+        {
+            uint64_t l, r;
+
+            memcpy(&l, p_lhs, 8);
+            memcpy(&r, p_rhs, 8);
+
+            return l == r;
+        }
+    case 16:
+        {
+            uint64_t l[2], r[2];
+
+            memcpy(&l, p_lhs, 16);
+            memcpy(&r, p_rhs, 16);
+
+            return 0 == ((l[0] ^ r[0]) | (l[1] ^ r[1]));
+        }
+    default:
+
+        return 0 == memcmp(p_lhs, p_rhs, key_size);
+    }
+}
+
+/* Obtains the index of the first empty or deleted slot on the probe
+ * sequence of the given hash, of which there must be at least one.
+ */
+static inline
+size_t
+collect_c_swiss_find_insert_slot(
+    int8_t const*   ctrl
+,   size_t          capacity
+,   size_t          hash
+)
+{
+    size_t const    mask    =   (capacity / COLLECT_C_SWISS_GROUP_WIDTH) - 1;
+    size_t          g       =   COLLECT_C_SWISS_h1_(hash) & mask;
+
+    for (size_t i = 0;; )
+    {
+        uint32_t const matches = collect_c_swiss_match_empty_or_deleted(ctrl + (g * COLLECT_C_SWISS_GROUP_WIDTH));
+
+        if (0 != matches)
+        {
+            return (g * COLLECT_C_SWISS_GROUP_WIDTH) + collect_c_swiss_lowest(matches);
+        }
+
+        g = (g + ++i) & mask;
+    }
+}
+
+/* Determines whether the slot at the given index, when erased, may be
+ * marked empty rather than as a tombstone. This is so if its group already
+ * has an empty slot, since a group that has ever been full has none
+ * until the table is rehashed, and so no search can have passed through
+ * the group.
+ */
+static inline
+int
+collect_c_swiss_can_erase_to_empty(
+    int8_t const*   ctrl
+,   size_t          ix
+)
+{
+    return 0 != collect_c_swiss_match_empty(ctrl + (ix & ~(size_t)(COLLECT_C_SWISS_GROUP_WIDTH - 1)));
+}
+
+/* Obtains the capacity (a power-of-2 multiple of the group width) required
+ * to hold n elements within the maximum load factor.
+ */
+static inline
+size_t
+collect_c_swiss_capacity_for(
+    size_t          n
+)
+{
+    size_t capacity = COLLECT_C_SWISS_GROUP_WIDTH;
+
+    for (; COLLECT_C_SWISS_max_load_(capacity) < n; capacity *= 2)
+    {}
+
+    return capacity;
+}
+
+/* Obtains the size of the block holding the control bytes and the slots
+ * of a table of the given capacity.
+ */
+static inline
+size_t
+collect_c_swiss_block_size(
+    collect_c_swiss_table_t const*  t
+,   size_t                          capacity
+)
+{
+    return capacity + (capacity * t->slot_size);
+}
+
+/* Moves all slots into new storage of the given capacity, thereby also
+ * removing all tombstones.
+ */
+static inline
+int
+collect_c_swiss_resize(
+    collect_c_swiss_table_t const*  t
+,   size_t                          new_capacity
+)
+{
+    assert(new_capacity >= COLLECT_C_SWISS_GROUP_WIDTH);
+    assert(0 == (new_capacity & (new_capacity - 1)));
+    assert(COLLECT_C_SWISS_max_load_(new_capacity) >= *t->size);
+
+    {
+        int8_t* const       new_ctrl    =   (int8_t*)collect_c_mem_alloc(t->allocator, collect_c_swiss_block_size(t, new_capacity));
+        char*               new_slots;
+        int8_t const* const ctrl        =   *t->ctrl;
+        char const* const   slots       =   (char const*)*t->slots;
+        size_t const        capacity    =   *t->capacity;
+
+        if (NULL == new_ctrl)
+        {
+            return ENOMEM;
+        }
+
+        new_slots = (char*)(new_ctrl + new_capacity);
+
+        memset(new_ctrl, COLLECT_C_SWISS_CTRL_EMPTY, new_capacity);
+
+        for (size_t ix = 0; capacity != ix; ++ix)
+        {
+            if (ctrl[ix] >= 0)
+            {
+                void const* const   slot    =   slots + (ix * t->slot_size);
+                size_t const        hash    =   (*t->pfn_hash)(t->param_hash, slot);
+                size_t const        ix_new  =   collect_c_swiss_find_insert_slot(new_ctrl, new_capacity, hash);
+
+                new_ctrl[ix_new] = COLLECT_C_SWISS_h2_(hash);
+
+                memcpy(new_slots + (ix_new * t->slot_size), slot, t->slot_size);
+            }
+        }
+
+        if (NULL != ctrl)
+        {
+            collect_c_mem_free(t->allocator, *t->ctrl, collect_c_swiss_block_size(t, capacity));
+        }
+
+        *t->ctrl        =   new_ctrl;
+        *t->slots       =   new_slots;
+        *t->capacity    =   new_capacity;
+        *t->growth_left =   COLLECT_C_SWISS_max_load_(new_capacity) - *t->size;
+        *t->num_deleted =   0;
+
+        return 0;
+    }
+}
+
+/* Claims a slot for a new key of the given hash, rehashing if required,
+ * and returns its index, or COLLECT_C_SWISS_NO_SLOT if memory is
+ * exhausted.
+ */
+static inline
+size_t
+collect_c_swiss_prepare_insert(
+    collect_c_swiss_table_t const*  t
+,   size_t                          hash
+)
+{
+    size_t ix;
+
+    if (0 == *t->capacity)
+    {
+        if (0 != collect_c_swiss_resize(t, COLLECT_C_SWISS_GROUP_WIDTH))
+        {
+            return COLLECT_C_SWISS_NO_SLOT;
+        }
+    }
+
+    ix = collect_c_swiss_find_insert_slot(*t->ctrl, *t->capacity, hash);
+
+    if (0 == *t->growth_left &&
+        COLLECT_C_SWISS_CTRL_EMPTY == (*t->ctrl)[ix])
+    {
+        /* if at least half the load is tombstones then rehash in place,
+         * otherwise grow
+         */
+        size_t const new_capacity = (*t->size < COLLECT_C_SWISS_max_load_(*t->capacity) / 2) ? *t->capacity : 2 * *t->capacity;
+
+        if (0 != collect_c_swiss_resize(t, new_capacity))
+        {
+            return COLLECT_C_SWISS_NO_SLOT;
+        }
+
+        ix = collect_c_swiss_find_insert_slot(*t->ctrl, *t->capacity, hash);
+    }
+
+    if (COLLECT_C_SWISS_CTRL_DELETED == (*t->ctrl)[ix])
+    {
+        --*t->num_deleted;
+    }
+    else
+    {
+        --*t->growth_left;
+    }
+
+    (*t->ctrl)[ix] = COLLECT_C_SWISS_h2_(hash);
+    ++*t->size;
+
+    return ix;
+}
+
+/* Erases the slot at the given index, marking it empty if possible,
+ * otherwise as a tombstone.
+ */
+static inline
+void
+collect_c_swiss_erase_at(
+    collect_c_swiss_table_t const*  t
+,   size_t                          ix
+)
+{
+    if (collect_c_swiss_can_erase_to_empty(*t->ctrl, ix))
+    {
+        (*t->ctrl)[ix] = COLLECT_C_SWISS_CTRL_EMPTY;
+
+        ++*t->growth_left;
+    }
+    else
+    {
+        (*t->ctrl)[ix] = COLLECT_C_SWISS_CTRL_DELETED;
+
+        ++*t->num_deleted;
+    }
+
+    --*t->size;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#pragma once
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
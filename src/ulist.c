@@ -0,0 +1,745 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    src/ulist.c
+ *
+ * Purpose: Unrolled linked list container.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/ulist.h>
+
+#include "allocator.h"
+
+#include <errno.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * local types
+ */
+
+typedef collect_c_ulist_node_t                              node_t;
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions and macros
+ */
+
+#define COLLECT_C_ULIST_INTERNAL_sizeof_node_(ul)           (offsetof(collect_c_ulist_node_t, data) + ((ul)->node_capacity * (ul)->el_size))
+
+#define COLLECT_C_ULIST_INTERNAL_el_ptr_(ul, n, ix)         ((void*)(&(n)->data->data[0] + ((ix) * (ul)->el_size)))
+
+static
+node_t*
+clc_c_ul_make_node_(
+    collect_c_ulist_t*  ul
+)
+{
+    node_t* nd;
+
+    assert(0 != ul->node_capacity);
+
+    if (NULL != ul->spare)
+    {
+        nd = ul->spare;
+
+        ul->spare = NULL;
+    }
+    else
+    {
+        if (NULL == (nd = collect_c_mem_alloc(ul->allocator, COLLECT_C_ULIST_INTERNAL_sizeof_node_(ul))))
+        {
+            return NULL;
+        }
+    }
+
+    nd->prev    =   NULL;
+    nd->next    =   NULL;
+    nd->num_els =   0;
+
+    return nd;
+}
+
+static
+void
+clc_c_ul_release_node_(
+    collect_c_ulist_t*  ul
+,   node_t*             nd
+)
+{
+    if (NULL == ul->spare)
+    {
+        ul->spare = nd;
+    }
+    else
+    {
+        collect_c_mem_free(ul->allocator, nd, COLLECT_C_ULIST_INTERNAL_sizeof_node_(ul));
+    }
+}
+
+static
+void
+clc_c_ul_link_after_(
+    collect_c_ulist_t*  ul
+,   node_t*             ref
+,   node_t*             nd
+)
+{
+    nd->prev = ref;
+
+    if (NULL == ref)
+    {
+        nd->next = ul->head;
+
+        ul->head = nd;
+    }
+    else
+    {
+        nd->next = ref->next;
+
+        ref->next = nd;
+    }
+
+    if (NULL != nd->next)
+    {
+        nd->next->prev = nd;
+    }
+    else
+    {
+        ul->tail = nd;
+    }
+
+    ++ul->num_nodes;
+}
+
+static
+void
+clc_c_ul_unlink_(
+    collect_c_ulist_t*  ul
+,   node_t*             nd
+)
+{
+    if (NULL != nd->prev)
+    {
+        nd->prev->next = nd->next;
+    }
+    else
+    {
+        ul->head = nd->next;
+    }
+
+    if (NULL != nd->next)
+    {
+        nd->next->prev = nd->prev;
+    }
+    else
+    {
+        ul->tail = nd->prev;
+    }
+
+    --ul->num_nodes;
+}
+
+/* Obtains the node containing the element at the given index, traversing
+ * from whichever end is nearer, and the offset of the element within it.
+ */
+static
+node_t*
+clc_c_ul_locate_(
+    collect_c_ulist_t const*    ul
+,   size_t                      index
+,   size_t*                     offset
+)
+{
+    assert(index < ul->size);
+
+    if (index < ul->size / 2)
+    {
+        node_t* n = ul->head;
+
+        for (; index >= n->num_els; n = n->next)
+        {
+            index -= n->num_els;
+        }
+
+        *offset = index;
+
+        return n;
+    }
+    else
+    {
+        size_t  rindex  =   ul->size - index;
+        node_t* n       =   ul->tail;
+
+        for (; rindex > n->num_els; n = n->prev)
+        {
+            rindex -= n->num_els;
+        }
+
+        *offset = n->num_els - rindex;
+
+        return n;
+    }
+}
+
+static
+void
+clc_c_ul_free_elements_(
+    collect_c_ulist_t*  ul
+,   size_t*             num_dropped
+)
+{
+    size_t index = 0;
+
+    for (node_t* n = ul->head; NULL != n; n = n->next)
+    {
+        if (NULL != ul->pfn_element_free)
+        {
+            for (size_t i = 0; n->num_els != i; ++i, ++index)
+            {
+                (*ul->pfn_element_free)(ul->el_size, index, COLLECT_C_ULIST_INTERNAL_el_ptr_(ul, n, i), ul->param_element_free);
+            }
+        }
+
+        *num_dropped += n->num_els;
+    }
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+uint32_t
+collect_c_ulist_version(void)
+{
+    return COLLECT_C_ULIST_VER;
+}
+
+void
+collect_c_ulist_free_storage(
+    collect_c_ulist_t*  ul
+)
+{
+    assert(NULL != ul);
+
+    {
+        size_t num_dropped = 0;
+
+        clc_c_ul_free_elements_(ul, &num_dropped);
+
+        for (node_t* n = ul->head; NULL != n; )
+        {
+            node_t* const n2 = n;
+
+            n = n->next;
+
+            collect_c_mem_free(ul->allocator, n2, COLLECT_C_ULIST_INTERNAL_sizeof_node_(ul));
+        }
+
+        collect_c_mem_free(ul->allocator, ul->spare, COLLECT_C_ULIST_INTERNAL_sizeof_node_(ul));
+
+        ul->head = ul->tail = ul->spare = NULL;
+        ul->size = 0;
+        ul->num_nodes = 0;
+    }
+}
+
+int
+collect_c_ulist_clear(
+    collect_c_ulist_t*  ul
+,   void*               reserved0
+,   void*               reserved1
+,   size_t*             num_dropped
+)
+{
+    ((void)&reserved0);
+    ((void)&reserved1);
+
+    assert(NULL != ul);
+    assert(NULL == reserved0);
+    assert(NULL == reserved1);
+
+    {
+        size_t dummy;
+
+        if (NULL == num_dropped)
+        {
+            num_dropped = &dummy;
+        }
+
+        *num_dropped = 0;
+
+        clc_c_ul_free_elements_(ul, num_dropped);
+
+        for (node_t* n = ul->head; NULL != n; )
+        {
+            node_t* const n2 = n;
+
+            n = n->next;
+
+            clc_c_ul_release_node_(ul, n2);
+        }
+
+        ul->head = ul->tail = NULL;
+        ul->size = 0;
+        ul->num_nodes = 0;
+
+        return 0;
+    }
+}
+
+void*
+collect_c_ulist_at(
+    collect_c_ulist_t const*    ul
+,   size_t                      index
+)
+{
+    assert(NULL != ul);
+    assert(index < ul->size);
+
+    {
+        size_t          offset;
+        node_t* const   n = clc_c_ul_locate_(ul, index, &offset);
+
+        return COLLECT_C_ULIST_INTERNAL_el_ptr_(ul, n, offset);
+    }
+}
+
+int
+collect_c_ulist_erase_at(
+    collect_c_ulist_t*  ul
+,   size_t              index
+)
+{
+    assert(NULL != ul);
+    assert(index < ul->size);
+
+    {
+        size_t          offset;
+        node_t* const   n   =   clc_c_ul_locate_(ul, index, &offset);
+        void* const     pe  =   COLLECT_C_ULIST_INTERNAL_el_ptr_(ul, n, offset);
+
+        if (NULL != ul->pfn_element_free)
+        {
+            (*ul->pfn_element_free)(ul->el_size, index, pe, ul->param_element_free);
+        }
+
+        memmove(pe, COLLECT_C_ULIST_INTERNAL_el_ptr_(ul, n, offset + 1), (n->num_els - (offset + 1)) * ul->el_size);
+
+        --n->num_els;
+        --ul->size;
+
+        if (0 == n->num_els)
+        {
+            clc_c_ul_unlink_(ul, n);
+            clc_c_ul_release_node_(ul, n);
+        }
+        else if (n->num_els <= ul->node_capacity / 4)
+        {
+            /* merge with a neighbour, if the combination fits in a node */
+
+            node_t* const next = n->next;
+            node_t* const prev = n->prev;
+
+            if (NULL != next &&
+                n->num_els + next->num_els <= ul->node_capacity)
+            {
+                memcpy(COLLECT_C_ULIST_INTERNAL_el_ptr_(ul, n, n->num_els), COLLECT_C_ULIST_INTERNAL_el_ptr_(ul, next, 0), next->num_els * ul->el_size);
+
+                n->num_els += next->num_els;
+
+                clc_c_ul_unlink_(ul, next);
+                clc_c_ul_release_node_(ul, next);
+            }
+            else
+            if (NULL != prev &&
+                prev->num_els + n->num_els <= ul->node_capacity)
+            {
+                memcpy(COLLECT_C_ULIST_INTERNAL_el_ptr_(ul, prev, prev->num_els), COLLECT_C_ULIST_INTERNAL_el_ptr_(ul, n, 0), n->num_els * ul->el_size);
+
+                prev->num_els += n->num_els;
+
+                clc_c_ul_unlink_(ul, n);
+                clc_c_ul_release_node_(ul, n);
+            }
+        }
+
+        return 0;
+    }
+}
+
+int
+collect_c_ulist_find(
+    collect_c_ulist_t const*        ul
+,   collect_c_ulist_pfn_compare_t   pfn
+,   void const*                     p_lhs
+,   size_t                          skip_count
+,   size_t*                         index
+,   void**                          el_ptr
+,   size_t*                         num_searched
+)
+{
+    assert(NULL != ul);
+    assert(NULL != pfn);
+    assert(NULL != p_lhs);
+    assert(NULL != index);
+
+    {
+        void*   dummy_el;
+        size_t  dummy_n;
+
+        if (NULL == el_ptr)
+        {
+            el_ptr = &dummy_el;
+        }
+
+        if (NULL == num_searched)
+        {
+            num_searched = &dummy_n;
+        }
+
+        *el_ptr = NULL;
+        *num_searched = 0;
+
+        for (node_t const* n = ul->head; NULL != n; n = n->next)
+        {
+            for (size_t i = 0; n->num_els != i; ++i)
+            {
+                void* const pe  =   COLLECT_C_ULIST_INTERNAL_el_ptr_(ul, n, i);
+                int const   r   =   (*pfn)(ul, p_lhs, pe);
+
+                ++*num_searched;
+
+                if (0 == r)
+                {
+                    if (0 == skip_count--)
+                    {
+                        *index = *num_searched - 1;
+                        *el_ptr = pe;
+
+                        return 0;
+                    }
+                }
+            }
+        }
+
+        return ENOENT;
+    }
+}
+
+int
+collect_c_ulist_rfind(
+    collect_c_ulist_t const*        ul
+,   collect_c_ulist_pfn_compare_t   pfn
+,   void const*                     p_lhs
+,   size_t                          skip_count
+,   size_t*                         index
+,   void**                          el_ptr
+,   size_t*                         num_searched
+)
+{
+    assert(NULL != ul);
+    assert(NULL != pfn);
+    assert(NULL != p_lhs);
+    assert(NULL != index);
+
+    {
+        void*   dummy_el;
+        size_t  dummy_n;
+
+        if (NULL == el_ptr)
+        {
+            el_ptr = &dummy_el;
+        }
+
+        if (NULL == num_searched)
+        {
+            num_searched = &dummy_n;
+        }
+
+        *el_ptr = NULL;
+        *num_searched = 0;
+
+        for (node_t const* n = ul->tail; NULL != n; n = n->prev)
+        {
+            for (size_t i = n->num_els; 0 != i; --i)
+            {
+                void* const pe  =   COLLECT_C_ULIST_INTERNAL_el_ptr_(ul, n, i - 1);
+                int const   r   =   (*pfn)(ul, p_lhs, pe);
+
+                ++*num_searched;
+
+                if (0 == r)
+                {
+                    if (0 == skip_count--)
+                    {
+                        *index = ul->size - *num_searched;
+                        *el_ptr = pe;
+
+                        return 0;
+                    }
+                }
+            }
+        }
+
+        return ENOENT;
+    }
+}
+
+int
+collect_c_ulist_insert_at(
+    collect_c_ulist_t*  ul
+,   size_t              index
+,   void const*         ptr_new_el
+)
+{
+    assert(NULL != ul);
+    assert(index <= ul->size);
+    assert(NULL != ptr_new_el);
+
+    if (ul->size == index)
+    {
+        return collect_c_ulist_push_back_by_ref(ul, ptr_new_el);
+    }
+
+    {
+        size_t  offset;
+        node_t* n = clc_c_ul_locate_(ul, index, &offset);
+
+        if (ul->node_capacity == n->num_els)
+        {
+            node_t* const m = clc_c_ul_make_node_(ul);
+
+            if (NULL == m)
+            {
+                return ENOMEM;
+            }
+
+            if (1 == ul->node_capacity)
+            {
+                /* cannot split, so new element goes in its own node */
+
+                clc_c_ul_link_after_(ul, n->prev, m);
+
+                n = m;
+            }
+            else
+            {
+                /* split, moving the upper half into the new node */
+
+                size_t const keep = (ul->node_capacity + 1) / 2;
+
+                m->num_els = n->num_els - keep;
+
+                memcpy(COLLECT_C_ULIST_INTERNAL_el_ptr_(ul, m, 0), COLLECT_C_ULIST_INTERNAL_el_ptr_(ul, n, keep), m->num_els * ul->el_size);
+
+                n->num_els = keep;
+
+                clc_c_ul_link_after_(ul, n, m);
+
+                if (offset > keep)
+                {
+                    n = m;
+                    offset -= keep;
+                }
+            }
+        }
+
+        memmove(COLLECT_C_ULIST_INTERNAL_el_ptr_(ul, n, offset + 1), COLLECT_C_ULIST_INTERNAL_el_ptr_(ul, n, offset), (n->num_els - offset) * ul->el_size);
+        memcpy(COLLECT_C_ULIST_INTERNAL_el_ptr_(ul, n, offset), ptr_new_el, ul->el_size);
+
+        ++n->num_els;
+        ++ul->size;
+
+        return 0;
+    }
+}
+
+int
+collect_c_ulist_push_back_by_ref(
+    collect_c_ulist_t*  ul
+,   void const*         ptr_new_el
+)
+{
+    assert(NULL != ul);
+    assert(NULL != ptr_new_el);
+
+    assert((NULL == ul->head) == (NULL == ul->tail));
+
+    {
+        node_t* n = ul->tail;
+
+        if (NULL == n ||
+            ul->node_capacity == n->num_els)
+        {
+            if (NULL == (n = clc_c_ul_make_node_(ul)))
+            {
+                return ENOMEM;
+            }
+
+            clc_c_ul_link_after_(ul, ul->tail, n);
+        }
+
+        memcpy(COLLECT_C_ULIST_INTERNAL_el_ptr_(ul, n, n->num_els), ptr_new_el, ul->el_size);
+
+        ++n->num_els;
+        ++ul->size;
+
+        return 0;
+    }
+}
+
+int
+collect_c_ulist_push_front_by_ref(
+    collect_c_ulist_t*  ul
+,   void const*         ptr_new_el
+)
+{
+    assert(NULL != ul);
+    assert(NULL != ptr_new_el);
+
+    assert((NULL == ul->head) == (NULL == ul->tail));
+
+    {
+        node_t* n = ul->head;
+
+        if (NULL == n ||
+            ul->node_capacity == n->num_els)
+        {
+            if (NULL == (n = clc_c_ul_make_node_(ul)))
+            {
+                return ENOMEM;
+            }
+
+            clc_c_ul_link_after_(ul, NULL, n);
+        }
+        else
+        {
+            memmove(COLLECT_C_ULIST_INTERNAL_el_ptr_(ul, n, 1), COLLECT_C_ULIST_INTERNAL_el_ptr_(ul, n, 0), n->num_els * ul->el_size);
+        }
+
+        memcpy(COLLECT_C_ULIST_INTERNAL_el_ptr_(ul, n, 0), ptr_new_el, ul->el_size);
+
+        ++n->num_els;
+        ++ul->size;
+
+        return 0;
+    }
+}
+
+int
+collect_c_ulist_pop_from_back_n(
+    collect_c_ulist_t*  ul
+,   size_t              num_to_drop
+,   size_t*             num_dropped
+)
+{
+    assert(NULL != ul);
+
+    {
+        size_t dummy;
+
+        if (NULL == num_dropped)
+        {
+            num_dropped = &dummy;
+        }
+
+        *num_dropped = 0;
+
+        for (; 0 != num_to_drop && NULL != ul->tail; )
+        {
+            node_t* const   n   =   ul->tail;
+            size_t const    k   =   num_to_drop < n->num_els ? num_to_drop : n->num_els;
+
+            if (NULL != ul->pfn_element_free)
+            {
+                for (size_t i = 0; k != i; ++i)
+                {
+                    size_t const ix = n->num_els - (1 + i);
+
+                    (*ul->pfn_element_free)(ul->el_size, ul->size - (1 + i), COLLECT_C_ULIST_INTERNAL_el_ptr_(ul, n, ix), ul->param_element_free);
+                }
+            }
+
+            n->num_els -= k;
+            ul->size -= k;
+            num_to_drop -= k;
+            *num_dropped += k;
+
+            if (0 == n->num_els)
+            {
+                clc_c_ul_unlink_(ul, n);
+                clc_c_ul_release_node_(ul, n);
+            }
+        }
+
+        return 0;
+    }
+}
+
+int
+collect_c_ulist_pop_from_front_n(
+    collect_c_ulist_t*  ul
+,   size_t              num_to_drop
+,   size_t*             num_dropped
+)
+{
+    assert(NULL != ul);
+
+    {
+        size_t dummy;
+
+        if (NULL == num_dropped)
+        {
+            num_dropped = &dummy;
+        }
+
+        *num_dropped = 0;
+
+        for (; 0 != num_to_drop && NULL != ul->head; )
+        {
+            node_t* const   n   =   ul->head;
+            size_t const    k   =   num_to_drop < n->num_els ? num_to_drop : n->num_els;
+
+            if (NULL != ul->pfn_element_free)
+            {
+                for (size_t i = 0; k != i; ++i)
+                {
+                    (*ul->pfn_element_free)(ul->el_size, i, COLLECT_C_ULIST_INTERNAL_el_ptr_(ul, n, i), ul->param_element_free);
+                }
+            }
+
+            n->num_els -= k;
+            ul->size -= k;
+            num_to_drop -= k;
+            *num_dropped += k;
+
+            if (0 == n->num_els)
+            {
+                clc_c_ul_unlink_(ul, n);
+                clc_c_ul_release_node_(ul, n);
+            }
+            else
+            {
+                memmove(COLLECT_C_ULIST_INTERNAL_el_ptr_(ul, n, 0), COLLECT_C_ULIST_INTERNAL_el_ptr_(ul, n, k), n->num_els * ul->el_size);
+            }
+        }
+
+        return 0;
+    }
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -4,7 +4,7 @@
  * Purpose: Vector container.
  *
  * Created: 5th February 2025
- * Updated: 14th February 2025
+ * Updated: 18th October 2026
  *
  * ////////////////////////////////////////////////////////////////////// */
 
@@ -15,9 +15,15 @@
 
 #include <collect-c/vec.h>
 
+#include "allocator.h"
+#include "scan.h"
+#include "vm.h"
+
 #include <errno.h>
 #include <assert.h>
+#include <limits.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -30,390 +36,1815 @@
 
  #define COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, ix)      ((void*)(((char*)(v)->storage) + ((ix) * (v)->el_size)))
 
+#define COLLECT_C_VEC_INTERNAL_SHUFFLE_BY_ONE_MAX_BYTES_    (1024)
 
- /* /////////////////////////////////////////////////////////////////////////
- * API functions
- */
+static
+collect_c_vec_growth_policy_t const clc_c_v_default_growth_policy_ =
+{
+    .factor_numerator   =   3,
+    .factor_denominator =   2,
+    .min_step           =   4,
+    .round_to_bytes     =   0,
+    .front_divisor      =   4,
+    .vm_threshold       =   COLLECT_C_VEC_DEFAULT_VM_THRESHOLD,
+};
 
-uint32_t
-collect_c_vec_version(void)
+#define COLLECT_C_VEC_INTERNAL_uses_huge_pages_(v)         (0 != (COLLECT_C_VEC_F_USE_HUGE_PAGES & (v)->flags))
+
+#define COLLECT_C_VEC_INTERNAL_policy_(v)                   ((NULL != (v)->growth_policy) ? (v)->growth_policy : &clc_c_v_default_growth_policy_)
+
+/* Rounds up the given number of elements such that the allocation size
+ * is a multiple of the policy's round_to_bytes (if any).
+ */
+static
+size_t
+clc_c_v_round_capacity_(
+    collect_c_vec_t const*  v
+,   size_t                  num_els
+)
 {
-    return COLLECT_C_VEC_VER;
+    size_t const round_to_bytes = COLLECT_C_VEC_INTERNAL_policy_(v)->round_to_bytes;
+
+    if (0 != round_to_bytes)
+    {
+        size_t const cb = ((num_els * v->el_size + round_to_bytes - 1) / round_to_bytes) * round_to_bytes;
+
+        return cb / v->el_size;
+    }
+
+    return num_els;
 }
 
-int
-collect_c_vec_allocate_storage(
-    collect_c_vec_t*    v
-,   size_t              initial_capacity
+/* Calculates, according to the growth policy, the total capacity and the
+ * offset of the storage to which the vector must grow to be able to hold
+ * at least size_required elements.
+ */
+static
+void
+clc_c_v_calc_growth_(
+    collect_c_vec_t const*  v
+,   size_t                  size_required
+,   size_t*                 cap_total_new
+,   size_t*                 off_new
 )
 {
-    assert(NULL != v);
-    assert(NULL == v->storage);
+    collect_c_vec_growth_policy_t const* const policy = COLLECT_C_VEC_INTERNAL_policy_(v);
+
+    bool const uses_boo = 0 == (COLLECT_C_VEC_F_NO_BOO & v->flags);
+
+    assert(0 != policy->factor_denominator);
+    assert(0 != policy->min_step);
 
     {
-        bool const uses_stack_array =   0 != (COLLECT_C_VEC_F_USE_STACK_ARRAY & v->flags);
-        bool const uses_boo         =   0 == (COLLECT_C_VEC_F_NO_BOO & v->flags);
+        size_t cap_new = (v->capacity * policy->factor_numerator) / policy->factor_denominator;
 
-        if (uses_stack_array)
+        if (cap_new < v->capacity + policy->min_step)
         {
-            return ENODEV;
+            cap_new = v->capacity + policy->min_step;
         }
-        else
-        {
-            size_t const    offset  =   uses_boo ? initial_capacity / 4 : 0;
-            size_t const    cap_all =   initial_capacity + offset;
-
-            size_t const    cb      =   cap_all * v->el_size;
-
-            if (NULL == (v->storage = malloc(cb)))
-            {
-                return ENOMEM;
-            }
-            else
-            {
-                v->capacity =   cap_all;
-                v->offset   =   offset;
 
-                return 0;
-            }
+        if (cap_new < size_required)
+        {
+            cap_new = size_required;
         }
+
+        *off_new        =   (uses_boo && 0 != policy->front_divisor) ? cap_new / policy->front_divisor : 0;
+        *cap_total_new  =   clc_c_v_round_capacity_(v, cap_new + *off_new);
     }
 }
 
-
-void
-collect_c_vec_free_storage(
-    collect_c_vec_t*    v
+/* Indicates whether storage of the given total capacity is, or is to
+ * be, obtained from the virtual memory layer.
+ */
+static
+bool
+clc_c_v_uses_vm_(
+    collect_c_vec_t const*  v
+,   size_t                  cap_total
 )
 {
-    assert(NULL != v);
-    assert(NULL != v->storage);
-
+    if (0 != (COLLECT_C_VEC_F_VM_STORAGE & v->flags))
     {
-        if (NULL != v->pfn_element_free)
-        {
-            for (size_t i = 0; v->size != i; ++i)
-            {
-                size_t const    ix  =   i + v->offset;
-                void* const     pe  =   COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, ix);
+        return true;
+    }
+    else
+    {
+        size_t const vm_threshold   =   COLLECT_C_VEC_INTERNAL_policy_(v)->vm_threshold;
+        size_t const cb             =   cap_total * v->el_size;
 
-                (*v->pfn_element_free)(v->el_size, ix, pe, v->param_element_free);
-            }
+        if (NULL != v->allocator ||
+            !collect_c_vm_is_supported())
+        {
+            return false;
         }
 
-        if (0 == (COLLECT_C_VEC_F_USE_STACK_ARRAY & v->flags))
+        if (COLLECT_C_VEC_INTERNAL_uses_huge_pages_(v) &&
+            cb >= COLLECT_C_VM_HUGE_PAGE_SIZE)
         {
-            free(v->storage);
-
-            v->storage = NULL;
+            return true;
         }
 
-        v->capacity = 0;
-        v->offset = 0;
-        v->size = 0;
+        return 0 != vm_threshold && cb >= vm_threshold;
     }
 }
 
+/* Resizes the storage to the given total capacity, preserving the
+ * elements in their current positions. Storage is moved to the virtual
+ * memory layer when it reaches the policy's threshold (or the huge page
+ * size, with COLLECT_C_VEC_F_USE_HUGE_PAGES), after which it is resized
+ * by remapping, which does not copy.
+ */
+static
 int
-collect_c_vec_clear(
+clc_c_v_resize_storage_(
     collect_c_vec_t*    v
-,   void*               reserved0
-,   void*               reserved1
-,   size_t*             num_dropped
+,   size_t              cap_total_new
 )
 {
-    ((void)&reserved0);
-    ((void)&reserved1);
-
-    assert(NULL != v);
-    assert(NULL != v->storage);
-    assert(NULL == reserved0);
-    assert(NULL == reserved1);
+    size_t const    cb_new  =   cap_total_new * v->el_size;
+    void*           pv_new  =   NULL;
 
+    if (0 != (COLLECT_C_VEC_F_VM_STORAGE & v->flags))
     {
-        size_t dummy;
-
-        if (NULL == num_dropped)
+        if (NULL == (pv_new = collect_c_vm_reallocate(v->storage, v->capacity * v->el_size, cb_new, COLLECT_C_VEC_INTERNAL_uses_huge_pages_(v))))
         {
-            num_dropped = &dummy;
+            return ENOMEM;
         }
+    }
+    else
+    {
+        if (clc_c_v_uses_vm_(v, cap_total_new) &&
+            NULL != (pv_new = collect_c_vm_allocate(cb_new, COLLECT_C_VEC_INTERNAL_uses_huge_pages_(v))))
+        {
+            if (NULL != v->storage)
+            {
+                memcpy(pv_new, v->storage, (v->offset + v->size) * v->el_size);
 
-        *num_dropped = 0;
+                collect_c_mem_free(v->allocator, v->storage, v->capacity * v->el_size);
+            }
 
-        if (NULL != v->pfn_element_free)
+            v->flags |= COLLECT_C_VEC_F_VM_STORAGE;
+        }
+        else if (NULL == v->storage)
         {
-            for (size_t i = 0; v->size != i; ++i)
+            if (NULL == (pv_new = collect_c_mem_alloc(v->allocator, cb_new)))
             {
-                size_t const    ix  =   i + v->offset;
-                void* const     pe  =   COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, ix);
-
-                (*v->pfn_element_free)(v->el_size, ix, pe, v->param_element_free);
+                return ENOMEM;
             }
         }
         else
         {
-            *num_dropped = v->size;
+            if (NULL == (pv_new = collect_c_mem_realloc(v->allocator, v->storage, v->capacity * v->el_size, cb_new)))
+            {
+                return ENOMEM;
+            }
         }
+    }
 
-        v->offset = 0;
-        v->size = 0;
+    v->capacity =   cap_total_new;
+    v->storage  =   pv_new;
 
-        return 0;
-    }
+    return 0;
 }
 
+/* Moves the elements from the stack array to heap (or virtual memory)
+ * storage of the given total capacity, at the given offset, whereafter
+ * the instance is treated as if its storage had been allocated.
+ */
+static
 int
-collect_c_vec_shrink_to_fit(
+clc_c_v_spill_(
     collect_c_vec_t*    v
+,   size_t              cap_total_new
+,   size_t              off_new
 )
 {
-    assert(NULL != v);
-    assert(NULL != v->storage);
+    void* const     pv_stack    =   v->storage;
+    size_t const    off_stack   =   v->offset;
+
+    assert(0 != (COLLECT_C_VEC_F_USE_STACK_ARRAY & v->flags));
+    assert(0 != (COLLECT_C_VEC_F_SPILL_TO_HEAP & v->flags));
+    assert(off_new + v->size <= cap_total_new);
+
+    v->storage  =   NULL;
+    v->flags    &=  ~COLLECT_C_VEC_F_USE_STACK_ARRAY;
 
     {
-        bool const uses_stack_array =   0 != (COLLECT_C_VEC_F_USE_STACK_ARRAY & v->flags);
-        bool const uses_boo         =   0 == (COLLECT_C_VEC_F_NO_BOO & v->flags);
+        int const r = clc_c_v_resize_storage_(v, cap_total_new);
 
-        if (uses_stack_array)
+        if (0 != r)
         {
-            return ENODEV;
+            v->storage  =   pv_stack;
+            v->flags    |=  COLLECT_C_VEC_F_USE_STACK_ARRAY;
+
+            return r;
         }
         else
         {
-            size_t const    cb_boo  =   uses_boo ? v->size / 4 : 0;
-            size_t const    cb_els  =   v->size * v->el_size;
+            void* const     pe_src  =   ((char*)pv_stack) + (off_stack * v->el_size);
+            void* const     pe_dst  =   COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, off_new);
 
-            size_t const    cb      =   cb_boo + cb_els;
-            void* const     pv_new  =   realloc(v->storage, cb);
+            memcpy(pe_dst, pe_src, v->size * v->el_size);
 
-            if (NULL == pv_new)
-            {
-                return ENOMEM;
-            }
-            else
-            {
-                v->storage = pv_new;
+            v->offset = off_new;
 
-                return 0;
-            }
+            return 0;
         }
     }
 }
 
+/* Reallocates the storage, according to the growth policy, such that it
+ * can hold at least size_required elements, and moves the elements to the
+ * new offset. For growth at the back of virtual memory storage the
+ * elements are left in place, since re-centring would move every element
+ * when the remapping has moved none. A stack array (with
+ * COLLECT_C_VEC_F_SPILL_TO_HEAP) is spilled.
+ */
+static
 int
-collect_c_v_push_back_by_ref(
+clc_c_v_grow_(
     collect_c_vec_t*    v
-,   void const*         ptr_new_el
+,   size_t              size_required
+,   bool                at_front
 )
 {
-    assert(NULL != v);
-    assert(NULL != v->storage);
+    size_t cap_total_new;
+    size_t off_new;
 
+    clc_c_v_calc_growth_(v, size_required, &cap_total_new, &off_new);
+
+    if (0 != (COLLECT_C_VEC_F_USE_STACK_ARRAY & v->flags))
     {
-        bool const uses_stack_array =   0 != (COLLECT_C_VEC_F_USE_STACK_ARRAY & v->flags);
-        bool const uses_boo         =   0 == (COLLECT_C_VEC_F_NO_BOO & v->flags);
+        return clc_c_v_spill_(v, cap_total_new, off_new);
+    }
 
-        assert(!uses_stack_array || 0 == v->offset);
+    {
+        int const r = clc_c_v_resize_storage_(v, cap_total_new);
 
-        if (!COLLECT_C_VEC_spare_back(*v))
+        if (0 != r)
+        {
+            return r;
+        }
+        else
         {
-            if (uses_stack_array)
+            if (!at_front &&
+                0 != (COLLECT_C_VEC_F_VM_STORAGE & v->flags))
             {
-                return ENOSPC;
+                off_new = v->offset;
             }
-            else
-            {
-                /* at this point, we have two possibilities to create space:
-                 *
-                 * (1) if we have front-spare, then we can shuffle all down; or
-                 * (2) we need to realloc;
-                 */
-
-                if (0 != v->offset)
-                {
-                    size_t const    ix_src  =   0 + v->offset;
-                    size_t const    ix_dst  =   0 + --v->offset;
-                    void* const     pe_src  =   ((char*)v->storage) + (ix_src * v->el_size);
-                    void* const     pe_dst  =   ((char*)v->storage) + (ix_dst * v->el_size);
-
-                    memmove(pe_dst, pe_src, v->el_size * v->size);
-                }
-                else
-                {
-                    size_t const    cap_new =   (v->capacity * 3) / 2;
-                    size_t const    off_new =   uses_boo ? cap_new / 4 : 0;
-                    size_t const    cb_new  =   (cap_new + off_new) * v->el_size;
-                    void* const     pv_new  =   realloc(v->storage, cb_new);
-
-                    if (NULL == pv_new)
-                    {
-                        return ENOMEM;
-                    }
-                    else
-                    {
-                        v->capacity =   cb_new / v->el_size;
-                        v->storage  =   pv_new;
 
-                        if (0 != off_new)
-                        {
-                            size_t const    ix_src  =   v->offset;
-                            size_t const    ix_dst  =   off_new;
-                            void* const     pe_src  =   ((char*)v->storage) + (ix_src * v->el_size);
-                            void* const     pe_dst  =   ((char*)v->storage) + (ix_dst * v->el_size);
+            if (off_new != v->offset)
+            {
+                void* const     pe_src  =   COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, v->offset);
+                void* const     pe_dst  =   COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, off_new);
 
-                            memmove(pe_dst, pe_src, v->el_size * v->size);
+                memmove(pe_dst, pe_src, v->size * v->el_size);
 
-                            v->offset = off_new;
-                        }
-                    }
-                }
+                v->offset = off_new;
             }
+
+            return 0;
         }
+    }
+}
 
+/* Invokes the element-free callback (if any) on each of the num_els
+ * elements starting at the (size-relative) position ix_first.
+ */
+static
+void
+clc_c_v_free_range_(
+    collect_c_vec_t*    v
+,   size_t              ix_first
+,   size_t              num_els
+)
+{
+    if (NULL != v->pfn_element_free)
+    {
+        for (size_t i = 0; num_els != i; ++i)
         {
-            size_t const    ix  =   v->offset + v->size;
+            size_t const    ix  =   v->offset + ix_first + i;
             void* const     pe  =   COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, ix);
 
-            memcpy(pe, ptr_new_el, v->el_size);
-
-            ++v->size;
-
-            assert(v->offset + v->size <= v->capacity);
-
-            return 0;
+            (*v->pfn_element_free)(v->el_size, ix, pe, v->param_element_free);
         }
     }
 }
 
-int
-collect_c_v_push_front_by_ref(
-    collect_c_vec_t*    v
-,   void const*         ptr_new_el
+/* Ranges smaller than this are sorted by insertion. */
+#define COLLECT_C_VEC_INTERNAL_SORT_INSERTION_THRESHOLD_    (24)
+/* Ranges larger than this take the pseudo-median of 9 as pivot. */
+#define COLLECT_C_VEC_INTERNAL_SORT_NINTHER_THRESHOLD_      (128)
+/* The number of moves after which a partial insertion sort gives up. */
+#define COLLECT_C_VEC_INTERNAL_SORT_PARTIAL_LIMIT_          (8)
+/* Elements up to this size are moved via a temporary in insertion sort. */
+#define COLLECT_C_VEC_INTERNAL_SORT_MAX_TEMP_               (64)
+
+#define COLLECT_C_VEC_INTERNAL_SORT_at_(base, ix, el_size)  ((base) + ((ix) * (el_size)))
+#define COLLECT_C_VEC_INTERNAL_SORT_less_(v, pfn, p_lhs, p_rhs) \
+                                                            ((*(pfn))((v), (p_lhs), (p_rhs)) < 0)
+
+static
+COLLECT_C_UTIL_FORCE_INLINE_
+void
+clc_c_v_sort_swap_(
+    char*   p_lhs
+,   char*   p_rhs
+,   size_t  el_size
 )
 {
-    assert(NULL != v);
-    assert(NULL != v->storage);
+    unsigned char buff[COLLECT_C_VEC_INTERNAL_SORT_MAX_TEMP_];
 
+    for (; 0 != el_size; )
     {
-        bool const uses_stack_array =   0 != (COLLECT_C_VEC_F_USE_STACK_ARRAY & v->flags);
-        bool const uses_boo         =   0 == (COLLECT_C_VEC_F_NO_BOO & v->flags);
-
-        assert(!uses_stack_array || 0 == v->offset);
-
-        if (0 == v->offset)
-        {
-            if (v->size == v->capacity)
-            {
-                if (uses_stack_array)
-                {
-                    return ENOSPC;
-                }
-                else
-                {
-                    /* reallocate */
+        size_t const n = (el_size < sizeof(buff)) ? el_size : sizeof(buff);
 
-                    // TODO: recalculate this, as leaves nothing at end
+        memcpy(buff, p_lhs, n);
+        memcpy(p_lhs, p_rhs, n);
+        memcpy(p_rhs, buff, n);
 
-                    size_t const    cap_new =   (v->capacity * 3) / 2;
-                    size_t const    off_new =   uses_boo ? cap_new / 4 : 0;
-                    size_t const    cb_new  =   (cap_new + off_new) * v->el_size;
-                    void* const     pv_new  =   realloc(v->storage, cb_new);
+        p_lhs += n;
+        p_rhs += n;
+        el_size -= n;
+    }
+}
 
-                    if (NULL == pv_new)
-                    {
-                        return ENOMEM;
-                    }
-                    else
-                    {
-                        v->capacity =   cb_new / v->el_size;
-                        v->offset   =   off_new;
-                        v->storage  =   pv_new;
+#define COLLECT_C_VEC_INTERNAL_SORT_swap_ix_(base, ix_lhs, ix_rhs, el_size) \
+                                                            clc_c_v_sort_swap_(COLLECT_C_VEC_INTERNAL_SORT_at_(base, ix_lhs, el_size), COLLECT_C_VEC_INTERNAL_SORT_at_(base, ix_rhs, el_size), (el_size))
 
-                        void* const     pe_src          =   COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, 0);
-                        void* const     pe_dst          =   COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, off_new);
+/* Sorts the elements at the three indexes, by at most three swaps. */
+static
+COLLECT_C_UTIL_FORCE_INLINE_
+void
+clc_c_v_sort3_(
+    collect_c_vec_t const*      v
+,   collect_c_vec_pfn_compare   pfn
+,   char*                       base
+,   size_t                      a
+,   size_t                      b
+,   size_t                      c
+,   size_t                      el_size
+)
+{
+    if (COLLECT_C_VEC_INTERNAL_SORT_less_(v, pfn, COLLECT_C_VEC_INTERNAL_SORT_at_(base, b, el_size), COLLECT_C_VEC_INTERNAL_SORT_at_(base, a, el_size)))
+    {
+        COLLECT_C_VEC_INTERNAL_SORT_swap_ix_(base, a, b, el_size);
+    }
+    if (COLLECT_C_VEC_INTERNAL_SORT_less_(v, pfn, COLLECT_C_VEC_INTERNAL_SORT_at_(base, c, el_size), COLLECT_C_VEC_INTERNAL_SORT_at_(base, b, el_size)))
+    {
+        COLLECT_C_VEC_INTERNAL_SORT_swap_ix_(base, b, c, el_size);
 
-                        memmove(pe_dst, pe_src, v->size * v->el_size);
+        if (COLLECT_C_VEC_INTERNAL_SORT_less_(v, pfn, COLLECT_C_VEC_INTERNAL_SORT_at_(base, b, el_size), COLLECT_C_VEC_INTERNAL_SORT_at_(base, a, el_size)))
+        {
+            COLLECT_C_VEC_INTERNAL_SORT_swap_ix_(base, a, b, el_size);
+        }
+    }
+}
 
-                        --v->offset;
-                    }
-                }
-            }
-            else
-            {
-                /* slide-up - but the question is by how much */
+/* Sorts [lo, hi) by insertion. If limit is non-0, gives up - returning
+ * false - once more than limit elements have been moved.
+ */
+static
+COLLECT_C_UTIL_FORCE_INLINE_
+bool
+clc_c_v_sort_insertion_(
+    collect_c_vec_t const*      v
+,   collect_c_vec_pfn_compare   pfn
+,   char*                       base
+,   size_t                      lo
+,   size_t                      hi
+,   size_t                      limit
+,   size_t                      el_size
+)
+{
+    size_t num_moved = 0;
 
-                size_t const    num_spare       =   v->capacity - v->size;
-                size_t const    new_offset      =   num_spare < 4 ? 1 : num_spare / 4;
+    for (size_t ix = lo + 1; ix < hi; ++ix)
+    {
+        size_t jx = ix;
 
-                void* const     pe_src          =   COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, 0);
-                void* const     pe_dst          =   COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, new_offset);
+        if (!COLLECT_C_VEC_INTERNAL_SORT_less_(v, pfn, COLLECT_C_VEC_INTERNAL_SORT_at_(base, ix, el_size), COLLECT_C_VEC_INTERNAL_SORT_at_(base, ix - 1, el_size)))
+        {
+            continue;
+        }
 
-                memmove(pe_dst, pe_src, v->size * v->el_size);
+        if (el_size <= COLLECT_C_VEC_INTERNAL_SORT_MAX_TEMP_)
+        {
+            unsigned char tmp[COLLECT_C_VEC_INTERNAL_SORT_MAX_TEMP_];
 
-                v->offset = new_offset;
+            memcpy(tmp, COLLECT_C_VEC_INTERNAL_SORT_at_(base, ix, el_size), el_size);
 
-                --v->offset;
+            do
+            {
+                memcpy(COLLECT_C_VEC_INTERNAL_SORT_at_(base, jx, el_size), COLLECT_C_VEC_INTERNAL_SORT_at_(base, jx - 1, el_size), el_size);
+                --jx;
             }
+            while (lo != jx && COLLECT_C_VEC_INTERNAL_SORT_less_(v, pfn, tmp, COLLECT_C_VEC_INTERNAL_SORT_at_(base, jx - 1, el_size)));
 
-#if 0
-
+            memcpy(COLLECT_C_VEC_INTERNAL_SORT_at_(base, jx, el_size), tmp, el_size);
+        }
+        else
+        {
+            do
+            {
+                COLLECT_C_VEC_INTERNAL_SORT_swap_ix_(base, jx, jx - 1, el_size);
+                --jx;
+            }
+            while (lo != jx && COLLECT_C_VEC_INTERNAL_SORT_less_(v, pfn, COLLECT_C_VEC_INTERNAL_SORT_at_(base, jx, el_size), COLLECT_C_VEC_INTERNAL_SORT_at_(base, jx - 1, el_size)));
+        }
+
+        num_moved += ix - jx;
+
+        if (0 != limit &&
+            num_moved > limit)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* Moves the element at ix down the max-heap of m elements at b until the
+ * heap is restored.
+ */
+static
+COLLECT_C_UTIL_FORCE_INLINE_
+void
+clc_c_v_sort_sift_down_(
+    collect_c_vec_t const*      v
+,   collect_c_vec_pfn_compare   pfn
+,   char*                       b
+,   size_t                      ix
+,   size_t                      m
+,   size_t                      el_size
+)
+{
+    for (;;)
+    {
+        size_t child = (2 * ix) + 1;
+
+        if (child >= m)
+        {
+            break;
+        }
+        if (child + 1 < m &&
+            COLLECT_C_VEC_INTERNAL_SORT_less_(v, pfn, COLLECT_C_VEC_INTERNAL_SORT_at_(b, child, el_size), COLLECT_C_VEC_INTERNAL_SORT_at_(b, child + 1, el_size)))
+        {
+            ++child;
+        }
+        if (!COLLECT_C_VEC_INTERNAL_SORT_less_(v, pfn, COLLECT_C_VEC_INTERNAL_SORT_at_(b, ix, el_size), COLLECT_C_VEC_INTERNAL_SORT_at_(b, child, el_size)))
+        {
+            break;
+        }
+
+        COLLECT_C_VEC_INTERNAL_SORT_swap_ix_(b, ix, child, el_size);
+
+        ix = child;
+    }
+}
+
+/* Sorts [lo, hi) by heapsort, which is the fallback that bounds the
+ * worst case at O(n log n).
+ */
+static
+COLLECT_C_UTIL_FORCE_INLINE_
+void
+clc_c_v_sort_heap_(
+    collect_c_vec_t const*      v
+,   collect_c_vec_pfn_compare   pfn
+,   char*                       base
+,   size_t                      lo
+,   size_t                      hi
+,   size_t                      el_size
+)
+{
+    char* const     b   =   COLLECT_C_VEC_INTERNAL_SORT_at_(base, lo, el_size);
+    size_t const    n   =   hi - lo;
+
+    for (size_t ix = n / 2; 0 != ix--; )
+    {
+        clc_c_v_sort_sift_down_(v, pfn, b, ix, n, el_size);
+    }
+
+    for (size_t m = n; m > 1; )
+    {
+        --m;
+
+        COLLECT_C_VEC_INTERNAL_SORT_swap_ix_(b, 0, m, el_size);
+
+        clc_c_v_sort_sift_down_(v, pfn, b, 0, m, el_size);
+    }
+}
+
+/* Partitions [lo, hi) about the pivot at lo, with the elements equal to
+ * the pivot to its right, and obtains the final position of the pivot and
+ * whether the range was already partitioned (i.e. no swaps were needed).
+ *
+ * The scans are unguarded (other than the first) because the pivot
+ * selection leaves an element not less than the pivot to its right.
+ */
+static
+COLLECT_C_UTIL_FORCE_INLINE_
+size_t
+clc_c_v_sort_partition_right_(
+    collect_c_vec_t const*      v
+,   collect_c_vec_pfn_compare   pfn
+,   char*                       base
+,   size_t                      lo
+,   size_t                      hi
+,   bool*                       already_partitioned
+,   size_t                      el_size
+)
+{
+    char const* const   p_pivot =   COLLECT_C_VEC_INTERNAL_SORT_at_(base, lo, el_size);
+    size_t              i       =   lo;
+    size_t              j       =   hi;
+
+    for (; COLLECT_C_VEC_INTERNAL_SORT_less_(v, pfn, COLLECT_C_VEC_INTERNAL_SORT_at_(base, ++i, el_size), p_pivot); )
+    {}
+
+    if (i - 1 == lo)
+    {
+        for (; i < j && !COLLECT_C_VEC_INTERNAL_SORT_less_(v, pfn, COLLECT_C_VEC_INTERNAL_SORT_at_(base, --j, el_size), p_pivot); )
+        {}
+    }
+    else
+    {
+        for (; !COLLECT_C_VEC_INTERNAL_SORT_less_(v, pfn, COLLECT_C_VEC_INTERNAL_SORT_at_(base, --j, el_size), p_pivot); )
+        {}
+    }
+
+    *already_partitioned = i >= j;
+
+    for (; i < j; )
+    {
+        COLLECT_C_VEC_INTERNAL_SORT_swap_ix_(base, i, j, el_size);
+
+        for (; COLLECT_C_VEC_INTERNAL_SORT_less_(v, pfn, COLLECT_C_VEC_INTERNAL_SORT_at_(base, ++i, el_size), p_pivot); )
+        {}
+        for (; !COLLECT_C_VEC_INTERNAL_SORT_less_(v, pfn, COLLECT_C_VEC_INTERNAL_SORT_at_(base, --j, el_size), p_pivot); )
+        {}
+    }
+
+    if (i - 1 != lo)
+    {
+        COLLECT_C_VEC_INTERNAL_SORT_swap_ix_(base, lo, i - 1, el_size);
+    }
+
+    return i - 1;
+}
+
+/* Partitions [lo, hi) about the pivot at lo, with the elements equal to
+ * the pivot to its left, and obtains the final position of the pivot. This
+ * is used where the pivot is equal to the element preceding the range, so
+ * that all elements equal to it are thereby placed, and need not be
+ * considered further.
+ */
+static
+COLLECT_C_UTIL_FORCE_INLINE_
+size_t
+clc_c_v_sort_partition_left_(
+    collect_c_vec_t const*      v
+,   collect_c_vec_pfn_compare   pfn
+,   char*                       base
+,   size_t                      lo
+,   size_t                      hi
+,   size_t                      el_size
+)
+{
+    char const* const   p_pivot =   COLLECT_C_VEC_INTERNAL_SORT_at_(base, lo, el_size);
+    size_t              i       =   lo;
+    size_t              j       =   hi;
+
+    for (; COLLECT_C_VEC_INTERNAL_SORT_less_(v, pfn, p_pivot, COLLECT_C_VEC_INTERNAL_SORT_at_(base, --j, el_size)); )
+    {}
+
+    if (j + 1 == hi)
+    {
+        for (; i < j && !COLLECT_C_VEC_INTERNAL_SORT_less_(v, pfn, p_pivot, COLLECT_C_VEC_INTERNAL_SORT_at_(base, ++i, el_size)); )
+        {}
+    }
+    else
+    {
+        for (; !COLLECT_C_VEC_INTERNAL_SORT_less_(v, pfn, p_pivot, COLLECT_C_VEC_INTERNAL_SORT_at_(base, ++i, el_size)); )
+        {}
+    }
+
+    for (; i < j; )
+    {
+        COLLECT_C_VEC_INTERNAL_SORT_swap_ix_(base, i, j, el_size);
+
+        for (; COLLECT_C_VEC_INTERNAL_SORT_less_(v, pfn, p_pivot, COLLECT_C_VEC_INTERNAL_SORT_at_(base, --j, el_size)); )
+        {}
+        for (; !COLLECT_C_VEC_INTERNAL_SORT_less_(v, pfn, p_pivot, COLLECT_C_VEC_INTERNAL_SORT_at_(base, ++i, el_size)); )
+        {}
+    }
+
+    if (j != lo)
+    {
+        COLLECT_C_VEC_INTERNAL_SORT_swap_ix_(base, lo, j, el_size);
+    }
+
+    return j;
+}
+
+/* Sorts the n elements at base by pattern-defeating quicksort (after
+ * Orson Peters' pdqsort), with an explicit stack in place of recursion so
+ * that the whole may be inlined for each element size.
+ *
+ * The larger side of each partition is pushed and the smaller taken next,
+ * so the stack depth is at most log2(n).
+ */
+static
+COLLECT_C_UTIL_FORCE_INLINE_
+int
+clc_c_v_pdqsort_(
+    collect_c_vec_t const*      v
+,   collect_c_vec_pfn_compare   pfn
+,   char*                       base
+,   size_t                      n
+,   size_t                      el_size
+)
+{
+    struct range_t
+    {
+        size_t  lo;
+        size_t  hi;
+        size_t  bad_allowed;
+        bool    leftmost;
+    }           stack[sizeof(size_t) * CHAR_BIT];
+    size_t      depth   =   0;
+    size_t      log2_n  =   0;
+
+    for (size_t m = n; m > 1; m /= 2)
+    {
+        ++log2_n;
+    }
+
+    stack[depth++] = (struct range_t){ 0, n, log2_n, true };
+
+    for (; 0 != depth; )
+    {
+        struct range_t r = stack[--depth];
+
+        for (;;)
+        {
+            size_t const    size    =   r.hi - r.lo;
+            size_t const    s2      =   size / 2;
+            bool            already_partitioned;
+            size_t          pivot;
+
+            if (size < COLLECT_C_VEC_INTERNAL_SORT_INSERTION_THRESHOLD_)
+            {
+                clc_c_v_sort_insertion_(v, pfn, base, r.lo, r.hi, 0, el_size);
+
+                break;
+            }
+
+            /* the pivot - the median of 3, or the pseudo-median of 9 - is
+             * placed at lo
+             */
+            if (size > COLLECT_C_VEC_INTERNAL_SORT_NINTHER_THRESHOLD_)
+            {
+                clc_c_v_sort3_(v, pfn, base, r.lo, r.lo + s2, r.hi - 1, el_size);
+                clc_c_v_sort3_(v, pfn, base, r.lo + 1, r.lo + (s2 - 1), r.hi - 2, el_size);
+                clc_c_v_sort3_(v, pfn, base, r.lo + 2, r.lo + (s2 + 1), r.hi - 3, el_size);
+                clc_c_v_sort3_(v, pfn, base, r.lo + (s2 - 1), r.lo + s2, r.lo + (s2 + 1), el_size);
+
+                COLLECT_C_VEC_INTERNAL_SORT_swap_ix_(base, r.lo, r.lo + s2, el_size);
+            }
+            else
+            {
+                clc_c_v_sort3_(v, pfn, base, r.lo + s2, r.lo, r.hi - 1, el_size);
+            }
+
+            /* if the pivot equals the element preceding the range (itself a
+             * previous pivot) then all elements equal to it are placed on
+             * its left, and need no further sorting
+             */
+            if (!r.leftmost &&
+                !COLLECT_C_VEC_INTERNAL_SORT_less_(v, pfn, COLLECT_C_VEC_INTERNAL_SORT_at_(base, r.lo - 1, el_size), COLLECT_C_VEC_INTERNAL_SORT_at_(base, r.lo, el_size)))
+            {
+                r.lo = clc_c_v_sort_partition_left_(v, pfn, base, r.lo, r.hi, el_size) + 1;
+
+                continue;
+            }
+
+            pivot = clc_c_v_sort_partition_right_(v, pfn, base, r.lo, r.hi, &already_partitioned, el_size);
+
+            {
+                size_t const l_size = pivot - r.lo;
+                size_t const r_size = r.hi - (pivot + 1);
+
+                if (l_size < size / 8 ||
+                    r_size < size / 8)
+                {
+                    /* a highly unbalanced partition: after too many, the
+                     * input is adversarial and heapsort takes over;
+                     * otherwise, some elements are swapped to break
+                     * patterns that would cause it again
+                     */
+                    if (0 == --r.bad_allowed)
+                    {
+                        clc_c_v_sort_heap_(v, pfn, base, r.lo, r.hi, el_size);
+
+                        break;
+                    }
+
+                    if (l_size >= COLLECT_C_VEC_INTERNAL_SORT_INSERTION_THRESHOLD_)
+                    {
+                        COLLECT_C_VEC_INTERNAL_SORT_swap_ix_(base, r.lo, r.lo + (l_size / 4), el_size);
+                        COLLECT_C_VEC_INTERNAL_SORT_swap_ix_(base, pivot - 1, pivot - (l_size / 4), el_size);
+
+                        if (l_size > COLLECT_C_VEC_INTERNAL_SORT_NINTHER_THRESHOLD_)
+                        {
+                            COLLECT_C_VEC_INTERNAL_SORT_swap_ix_(base, r.lo + 1, r.lo + (l_size / 4 + 1), el_size);
+                            COLLECT_C_VEC_INTERNAL_SORT_swap_ix_(base, r.lo + 2, r.lo + (l_size / 4 + 2), el_size);
+                            COLLECT_C_VEC_INTERNAL_SORT_swap_ix_(base, pivot - 2, pivot - (l_size / 4 + 1), el_size);
+                            COLLECT_C_VEC_INTERNAL_SORT_swap_ix_(base, pivot - 3, pivot - (l_size / 4 + 2), el_size);
+                        }
+                    }
+
+                    if (r_size >= COLLECT_C_VEC_INTERNAL_SORT_INSERTION_THRESHOLD_)
+                    {
+                        COLLECT_C_VEC_INTERNAL_SORT_swap_ix_(base, pivot + 1, pivot + (1 + r_size / 4), el_size);
+                        COLLECT_C_VEC_INTERNAL_SORT_swap_ix_(base, r.hi - 1, r.hi - (r_size / 4), el_size);
+
+                        if (r_size > COLLECT_C_VEC_INTERNAL_SORT_NINTHER_THRESHOLD_)
+                        {
+                            COLLECT_C_VEC_INTERNAL_SORT_swap_ix_(base, pivot + 2, pivot + (2 + r_size / 4), el_size);
+                            COLLECT_C_VEC_INTERNAL_SORT_swap_ix_(base, pivot + 3, pivot + (3 + r_size / 4), el_size);
+                            COLLECT_C_VEC_INTERNAL_SORT_swap_ix_(base, r.hi - 2, r.hi - (1 + r_size / 4), el_size);
+                            COLLECT_C_VEC_INTERNAL_SORT_swap_ix_(base, r.hi - 3, r.hi - (2 + r_size / 4), el_size);
+                        }
+                    }
+                }
+                else if (already_partitioned &&
+                         clc_c_v_sort_insertion_(v, pfn, base, r.lo, pivot, COLLECT_C_VEC_INTERNAL_SORT_PARTIAL_LIMIT_, el_size) &&
+                         clc_c_v_sort_insertion_(v, pfn, base, pivot + 1, r.hi, COLLECT_C_VEC_INTERNAL_SORT_PARTIAL_LIMIT_, el_size))
+                {
+                    /* the range was (nearly) sorted already */
+                    break;
+                }
+
+                if (l_size < r_size)
+                {
+                    stack[depth++] = (struct range_t){ pivot + 1, r.hi, r.bad_allowed, false };
+
+                    r.hi = pivot;
+                }
+                else
+                {
+                    stack[depth++] = (struct range_t){ r.lo, pivot, r.bad_allowed, r.leftmost };
+
+                    r.lo        =   pivot + 1;
+                    r.leftmost  =   false;
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
+/* Reads the unsigned integer key of the given size at p. */
+static
+COLLECT_C_UTIL_FORCE_INLINE_
+uint64_t
+clc_c_v_read_key_(
+    void const* p
+,   size_t      key_size
+)
+{
+    switch (key_size)
+    {
+    case 1:
+        {
+            uint8_t k;
+
+            memcpy(&k, p, sizeof(k));
+
+            return k;
+        }
+    case 2:
+        {
+            uint16_t k;
+
+            memcpy(&k, p, sizeof(k));
+
+            return k;
+        }
+    case 4:
+        {
+            uint32_t k;
+
+            memcpy(&k, p, sizeof(k));
+
+            return k;
+        }
+    default:
+        {
+            uint64_t k;
+
+            assert(8 == key_size);
+
+            memcpy(&k, p, sizeof(k));
+
+            return k;
+        }
+    }
+}
+
+/* Sorts the n elements at base by LSD radix sort of a byte per pass, via
+ * the scratch storage of the same size.
+ */
+static
+COLLECT_C_UTIL_FORCE_INLINE_
+int
+clc_c_v_radix_sort_(
+    char*       base
+,   char*       scratch
+,   size_t      n
+,   size_t      key_offset
+,   size_t      key_size
+,   size_t      el_size
+)
+{
+    size_t  counts[8][256];
+    char*   src =   base;
+    char*   dst =   scratch;
+
+    memset(counts, 0, sizeof(counts[0]) * key_size);
+
+    /* the histograms of all digits are taken in a single pass */
+    for (size_t ix = 0; n != ix; ++ix)
+    {
+        uint64_t const key = clc_c_v_read_key_(base + (ix * el_size) + key_offset, key_size);
+
+        for (size_t d = 0; key_size != d; ++d)
+        {
+            ++counts[d][(key >> (8 * d)) & 0xff];
+        }
+    }
+
+    for (size_t d = 0; key_size != d; ++d)
+    {
+        size_t* const   c       =   counts[d];
+        size_t          total   =   0;
+
+        /* a pass in which all keys have the same digit would not move
+         * anything
+         */
+        if (n == c[(clc_c_v_read_key_(src + key_offset, key_size) >> (8 * d)) & 0xff])
+        {
+            continue;
+        }
+
+        for (size_t b = 0; 256 != b; ++b)
+        {
+            size_t const count = c[b];
+
+            c[b] = total;
+            total += count;
+        }
+
+        for (size_t ix = 0; n != ix; ++ix)
+        {
+            char const* const   p_el    =   src + (ix * el_size);
+            uint64_t const      key     =   clc_c_v_read_key_(p_el + key_offset, key_size);
+
+            memcpy(dst + (c[(key >> (8 * d)) & 0xff]++ * el_size), p_el, el_size);
+        }
+
+        {
+            char* const t = src;
+
+            src = dst;
+            dst = t;
+        }
+    }
+
+    if (src != base)
+    {
+        memcpy(base, src, n * el_size);
+    }
+
+    return 0;
+}
+
+
+ /* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+uint32_t
+collect_c_vec_version(void)
+{
+    return COLLECT_C_VEC_VER;
+}
+
+int
+collect_c_vec_allocate_storage(
+    collect_c_vec_t*    v
+,   size_t              initial_capacity
+)
+{
+    assert(NULL != v);
+    assert(NULL == v->storage);
+
+    {
+        bool const uses_stack_array =   0 != (COLLECT_C_VEC_F_USE_STACK_ARRAY & v->flags);
+        bool const uses_boo         =   0 == (COLLECT_C_VEC_F_NO_BOO & v->flags);
+
+        size_t const front_divisor  =   COLLECT_C_VEC_INTERNAL_policy_(v)->front_divisor;
+
+        if (uses_stack_array)
+        {
+            return ENODEV;
+        }
+        else
+        {
+            size_t const    offset  =   (uses_boo && 0 != front_divisor) ? initial_capacity / front_divisor : 0;
+            size_t const    cap_all =   initial_capacity + offset;
+
+            int const       r       =   clc_c_v_resize_storage_(v, cap_all);
+
+            if (0 != r)
+            {
+                return r;
+            }
+            else
+            {
+                v->offset   =   offset;
+
+                return 0;
+            }
+        }
+    }
+}
+
+
+void
+collect_c_vec_free_storage(
+    collect_c_vec_t*    v
+)
+{
+    assert(NULL != v);
+    assert(NULL != v->storage);
+
+    {
+        if (NULL != v->pfn_element_free)
+        {
+            for (size_t i = 0; v->size != i; ++i)
+            {
+                size_t const    ix  =   i + v->offset;
+                void* const     pe  =   COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, ix);
+
+                (*v->pfn_element_free)(v->el_size, ix, pe, v->param_element_free);
+            }
+        }
+
+        if (0 == (COLLECT_C_VEC_F_USE_STACK_ARRAY & v->flags))
+        {
+            if (0 != (COLLECT_C_VEC_F_VM_STORAGE & v->flags))
+            {
+                collect_c_vm_free(v->storage, v->capacity * v->el_size, COLLECT_C_VEC_INTERNAL_uses_huge_pages_(v));
+
+                v->flags &= ~COLLECT_C_VEC_F_VM_STORAGE;
+            }
+            else
+            {
+                collect_c_mem_free(v->allocator, v->storage, v->capacity * v->el_size);
+            }
+
+            v->storage = NULL;
+        }
+
+        v->capacity = 0;
+        v->offset = 0;
+        v->size = 0;
+    }
+}
+
+int
+collect_c_vec_clear(
+    collect_c_vec_t*    v
+,   void*               reserved0
+,   void*               reserved1
+,   size_t*             num_dropped
+)
+{
+    ((void)&reserved0);
+    ((void)&reserved1);
+
+    assert(NULL != v);
+    assert(NULL != v->storage);
+    assert(NULL == reserved0);
+    assert(NULL == reserved1);
+
+    {
+        size_t dummy;
+
+        if (NULL == num_dropped)
+        {
+            num_dropped = &dummy;
+        }
+
+        *num_dropped = 0;
+
+        if (NULL != v->pfn_element_free)
+        {
+            for (size_t i = 0; v->size != i; ++i)
+            {
+                size_t const    ix  =   i + v->offset;
+                void* const     pe  =   COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, ix);
+
+                (*v->pfn_element_free)(v->el_size, ix, pe, v->param_element_free);
+            }
+        }
+        else
+        {
+            *num_dropped = v->size;
+        }
+
+        v->offset = 0;
+        v->size = 0;
+
+        return 0;
+    }
+}
+
+int
+collect_c_vec_reserve(
+    collect_c_vec_t*    v
+,   size_t              n
+,   size_t              front_n
+)
+{
+    assert(NULL != v);
+    assert(0 == front_n || 0 == (COLLECT_C_VEC_F_NO_BOO & v->flags));
+
+    {
+        bool const      uses_stack_array    =   0 != (COLLECT_C_VEC_F_USE_STACK_ARRAY & v->flags);
+        bool const      spills_to_heap      =   0 != (COLLECT_C_VEC_F_SPILL_TO_HEAP & v->flags);
+        size_t const    n_back              =   (n < v->size) ? v->size : n;
+
+        if (NULL != v->storage &&
+            v->offset >= front_n &&
+            v->capacity - v->offset >= n_back)
+        {
+            return 0;
+        }
+
+        if (uses_stack_array)
+        {
+            if (!spills_to_heap)
+            {
+                return ENODEV;
+            }
+            else
+            {
+                return clc_c_v_spill_(v, clc_c_v_round_capacity_(v, front_n + n_back), front_n);
+            }
+        }
+
+        if (NULL == v->storage ||
+            v->capacity < front_n + n_back)
+        {
+            int const r = clc_c_v_resize_storage_(v, clc_c_v_round_capacity_(v, front_n + n_back));
+
+            if (0 != r)
+            {
+                return r;
+            }
+        }
+
+        /* the existing storage (now) suffices, with the elements moved */
+
+        if (front_n != v->offset)
+        {
+            void* const     pe_src  =   COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, v->offset);
+            void* const     pe_dst  =   COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, front_n);
+
+            memmove(pe_dst, pe_src, v->size * v->el_size);
+
+            v->offset = front_n;
+        }
+
+        return 0;
+    }
+}
+
+size_t
+collect_c_vec_huge_page_bytes(
+    collect_c_vec_t const*  v
+)
+{
+    assert(NULL != v);
+
+    if (0 == (COLLECT_C_VEC_F_VM_STORAGE & v->flags))
+    {
+        return 0;
+    }
+    else
+    {
+        return collect_c_vm_huge_page_bytes(v->storage, v->capacity * v->el_size);
+    }
+}
+
+int
+collect_c_vec_shrink_to_fit(
+    collect_c_vec_t*    v
+)
+{
+    assert(NULL != v);
+    assert(NULL != v->storage);
+
+    {
+        bool const uses_stack_array =   0 != (COLLECT_C_VEC_F_USE_STACK_ARRAY & v->flags);
+        bool const uses_boo         =   0 == (COLLECT_C_VEC_F_NO_BOO & v->flags);
+
+        if (uses_stack_array)
+        {
+            return ENODEV;
+        }
+        else if (0 != (COLLECT_C_VEC_F_VM_STORAGE & v->flags))
+        {
+            /* the front-spare is retained, and only the pages beyond the
+             * last element are released
+             */
+
+            return (0 == v->offset + v->size) ? 0 : clc_c_v_resize_storage_(v, v->offset + v->size);
+        }
+        else
+        {
+            /* retain a front-spare of up to a quarter of the size, moving
+             * the elements down to it first (since the resize preserves
+             * only what is at the start of the storage)
+             */
+
+            size_t const    off_max =   uses_boo ? v->size / 4 : 0;
+            size_t const    off_new =   (v->offset < off_max) ? v->offset : off_max;
+
+            if (0 == off_new + v->size)
+            {
+                return 0;
+            }
+
+            if (off_new != v->offset)
+            {
+                void* const     pe_src  =   COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, v->offset);
+                void* const     pe_dst  =   COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, off_new);
+
+                memmove(pe_dst, pe_src, v->size * v->el_size);
+
+                v->offset = off_new;
+            }
+
+            return clc_c_v_resize_storage_(v, off_new + v->size);
+        }
+    }
+}
+
+int
+collect_c_v_push_back_by_ref(
+    collect_c_vec_t*    v
+,   void const*         ptr_new_el
+)
+{
+    assert(NULL != v);
+    assert(NULL != v->storage);
+
+    {
+        bool const uses_stack_array =   0 != (COLLECT_C_VEC_F_USE_STACK_ARRAY & v->flags);
+        bool const spills_to_heap   =   0 != (COLLECT_C_VEC_F_SPILL_TO_HEAP & v->flags);
+
+        assert(!uses_stack_array || 0 == v->offset);
+
+        if (!COLLECT_C_VEC_spare_back(*v))
+        {
+            if (uses_stack_array && !spills_to_heap)
+            {
+                return ENOSPC;
+            }
+            else
+            {
+                /* at this point, we have three possibilities to create
+                 * space:
+                 *
+                 * (1) if we have front-spare and the elements occupy
+                 *     little memory, then we can shuffle all down by one;
+                 * (2) if we have front-spare that is large relative to the
+                 *     size, then we can shuffle all down, retaining a
+                 *     quarter of it (so that the cost is amortised over
+                 *     the subsequent pushes); or
+                 * (3) we need to realloc;
+                 *
+                 * Shuffling a larger vector down by one on every push
+                 * would make filling it quadratic.
+                 */
+
+                if (0 != v->offset &&
+                    v->size * v->el_size <= COLLECT_C_VEC_INTERNAL_SHUFFLE_BY_ONE_MAX_BYTES_)
+                {
+                    size_t const    ix_src  =   0 + v->offset;
+                    size_t const    ix_dst  =   0 + --v->offset;
+                    void* const     pe_src  =   ((char*)v->storage) + (ix_src * v->el_size);
+                    void* const     pe_dst  =   ((char*)v->storage) + (ix_dst * v->el_size);
+
+                    memmove(pe_dst, pe_src, v->el_size * v->size);
+                }
+                else if (0 != v->offset &&
+                         v->offset >= v->size / 2)
+                {
+                    size_t const    ix_src  =   0 + v->offset;
+                    size_t const    ix_dst  =   0 + (v->offset /= 4);
+                    void* const     pe_src  =   ((char*)v->storage) + (ix_src * v->el_size);
+                    void* const     pe_dst  =   ((char*)v->storage) + (ix_dst * v->el_size);
+
+                    memmove(pe_dst, pe_src, v->el_size * v->size);
+                }
+                else
+                {
+                    int const r = clc_c_v_grow_(v, v->size + 1, false);
+
+                    if (0 != r)
+                    {
+                        return r;
+                    }
+                }
+            }
+        }
+
+        {
+            size_t const    ix  =   v->offset + v->size;
+            void* const     pe  =   COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, ix);
+
+            memcpy(pe, ptr_new_el, v->el_size);
+
+            ++v->size;
+
+            assert(v->offset + v->size <= v->capacity);
+
+            return 0;
+        }
+    }
+}
+
+int
+collect_c_v_push_front_by_ref(
+    collect_c_vec_t*    v
+,   void const*         ptr_new_el
+)
+{
+    assert(NULL != v);
+    assert(NULL != v->storage);
+
+    {
+        bool const uses_stack_array =   0 != (COLLECT_C_VEC_F_USE_STACK_ARRAY & v->flags);
+        bool const spills_to_heap   =   0 != (COLLECT_C_VEC_F_SPILL_TO_HEAP & v->flags);
+
+        assert(!uses_stack_array || 0 == v->offset);
+
+        if (0 == v->offset)
+        {
+            if (v->size == v->capacity)
+            {
+                if (uses_stack_array && !spills_to_heap)
+                {
+                    return ENOSPC;
+                }
+                else
+                {
+                    int const r = clc_c_v_grow_(v, v->size + 1, true);
+
+                    if (0 != r)
+                    {
+                        return r;
+                    }
+                }
+            }
+
+            if (0 == v->offset)
+            {
+                /* slide-up - but the question is by how much */
+
+                size_t const    num_spare       =   v->capacity - v->size;
+                size_t const    new_offset      =   num_spare < 4 ? 1 : num_spare / 4;
+
+                void* const     pe_src          =   COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, 0);
+                void* const     pe_dst          =   COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, new_offset);
+
+                memmove(pe_dst, pe_src, v->size * v->el_size);
+
+                v->offset = new_offset;
+            }
+
+            --v->offset;
+
+#if 0
+
+            else
+            {
+                /* at this point, we have two possibilities to create space:
+                 *
+                 * (1) if uses_boo AND we have front-spare, then we can shuffle all down; or
+                 * (2) we need to realloc;
+                 */
+
+                 if (0 != v->offset)
+                 {
+                    size_t const    ix_src  =   0 + v->offset--;
+                     size_t const    ix_dst  =   0 + v->offset;
+                     void* const     pe_src   =   ((char*)v->storage) + (ix_src * v->el_size);
+                     void* const     pe_dst   =   ((char*)v->storage) + (ix_dst * v->el_size);
+
+                     memmove(pe_dst, pe_src, v->el_size * v->size);
+
+                     --v->offset;
+                 }
+                 else
+                 {
+                    size_t const    cap_new =   (v->capacity * 3) / 2;
+                     size_t const    off_new =   uses_boo ? cap_new / 4 : 0;
+                     size_t const    cb_new  =   (cap_new + off_new) * v->el_size;
+                     void* const     pv_new  =   realloc(v->storage, cb_new);
+
+                     if (NULL == pv_new)
+                     {
+                        return ENOMEM;
+                     }
+                     else
+                     {
+                        v->capacity =   cb_new;
+                        v->storage  =   pv_new;
+                     }
+                 }
+             }
+#endif
+        }
+        else
+        {
+            --v->offset;
+        }
+
+        {
+            size_t const    ix  =   v->offset + 0;
+            void* const     pe  =   COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, ix);
+
+            memcpy(pe, ptr_new_el, v->el_size);
+
+            ++v->size;
+
+            return 0;
+        }
+    }
+}
+
+int
+collect_c_v_insert_n_by_ref(
+    collect_c_vec_t*    v
+,   size_t              index
+,   size_t              num_els
+,   void const*         ptr_new_els
+)
+{
+    assert(NULL != v);
+    assert(NULL != v->storage);
+    assert(index <= v->size);
+    assert(0 == num_els || NULL != ptr_new_els);
+
+    {
+        bool const      uses_stack_array    =   0 != (COLLECT_C_VEC_F_USE_STACK_ARRAY & v->flags);
+        bool const      spills_to_heap      =   0 != (COLLECT_C_VEC_F_SPILL_TO_HEAP & v->flags);
+        bool const      uses_boo            =   0 == (COLLECT_C_VEC_F_NO_BOO & v->flags);
+
+        size_t const    num_before          =   index;
+        size_t const    num_after           =   v->size - index;
+        bool const      can_shift_front     =   uses_boo && !uses_stack_array && v->offset >= num_els;
+        bool const      can_shift_back      =   COLLECT_C_VEC_spare_back(*v) >= num_els;
+
+        if (0 == num_els)
+        {
+            return 0;
+        }
+
+        if (can_shift_front && (!can_shift_back || num_before < num_after))
+        {
+            /* move the preceding elements down into the front-spare */
+
+            void* const     pe_src  =   COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, v->offset);
+            void* const     pe_dst  =   COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, v->offset - num_els);
+
+            memmove(pe_dst, pe_src, num_before * v->el_size);
+
+            v->offset -= num_els;
+        }
+        else if (can_shift_back)
+        {
+            /* move the following elements up into the back-spare */
+
+            void* const     pe_src  =   COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, v->offset + index);
+            void* const     pe_dst  =   COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, v->offset + index + num_els);
+
+            memmove(pe_dst, pe_src, num_after * v->el_size);
+        }
+        else if (uses_stack_array && !spills_to_heap)
+        {
+            return ENOSPC;
+        }
+        else
+        {
+            size_t          cap_total_new;
+            size_t          off_new;
+
+            clc_c_v_calc_growth_(v, v->size + num_els, &cap_total_new, &off_new);
+
+            if (!uses_stack_array &&
+                clc_c_v_uses_vm_(v, cap_total_new))
+            {
+                /* grow by remapping, which does not copy, and then move
+                 * the following elements up
+                 */
+
+                if (cap_total_new < v->offset + v->size + num_els)
+                {
+                    cap_total_new = v->offset + v->size + num_els;
+                }
+
+                {
+                    int const r = clc_c_v_resize_storage_(v, cap_total_new);
+
+                    if (0 != r)
+                    {
+                        return r;
+                    }
+                    else
+                    {
+                        void* const     pe_src  =   COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, v->offset + index);
+                        void* const     pe_dst  =   COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, v->offset + index + num_els);
+
+                        memmove(pe_dst, pe_src, num_after * v->el_size);
+                    }
+                }
+            }
             else
             {
-                /* at this point, we have two possibilities to create space:
-                 *
-                 * (1) if uses_boo AND we have front-spare, then we can shuffle all down; or
-                 * (2) we need to realloc;
+                /* allocate new storage and copy each part directly into
+                 * its final position, rather than realloc-ing (which may
+                 * copy the whole) and then moving the following part; this
+                 * is also how a stack array is spilled
                  */
 
-                 if (0 != v->offset)
-                 {
-                    size_t const    ix_src  =   0 + v->offset--;
-                     size_t const    ix_dst  =   0 + v->offset;
-                     void* const     pe_src   =   ((char*)v->storage) + (ix_src * v->el_size);
-                     void* const     pe_dst   =   ((char*)v->storage) + (ix_dst * v->el_size);
+                void* const     pv_new  =   collect_c_mem_alloc(v->allocator, cap_total_new * v->el_size);
 
-                     memmove(pe_dst, pe_src, v->el_size * v->size);
+                if (NULL == pv_new)
+                {
+                    return ENOMEM;
+                }
+                else
+                {
+                    char* const     pb_new  =   (char*)pv_new;
 
-                     --v->offset;
-                 }
-                 else
-                 {
-                    size_t const    cap_new =   (v->capacity * 3) / 2;
-                     size_t const    off_new =   uses_boo ? cap_new / 4 : 0;
-                     size_t const    cb_new  =   (cap_new + off_new) * v->el_size;
-                     void* const     pv_new  =   realloc(v->storage, cb_new);
+                    memcpy(pb_new + (off_new * v->el_size), COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, v->offset), num_before * v->el_size);
+                    memcpy(pb_new + ((off_new + index + num_els) * v->el_size), COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, v->offset + index), num_after * v->el_size);
 
-                     if (NULL == pv_new)
-                     {
-                        return ENOMEM;
-                     }
-                     else
-                     {
-                        v->capacity =   cb_new;
-                        v->storage  =   pv_new;
-                     }
-                 }
-             }
-#endif
+                    if (uses_stack_array)
+                    {
+                        v->flags &= ~COLLECT_C_VEC_F_USE_STACK_ARRAY;
+                    }
+                    else
+                    {
+                        collect_c_mem_free(v->allocator, v->storage, v->capacity * v->el_size);
+                    }
+
+                    v->storage  =   pv_new;
+                    v->capacity =   cap_total_new;
+                    v->offset   =   off_new;
+                }
+            }
+        }
+
+        memcpy(COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, v->offset + index), ptr_new_els, num_els * v->el_size);
+
+        v->size += num_els;
+
+        assert(v->offset + v->size <= v->capacity);
+
+        return 0;
+    }
+}
+
+int
+collect_c_v_erase_range(
+    collect_c_vec_t*    v
+,   size_t              index_first
+,   size_t              index_last
+,   size_t*             num_dropped
+)
+{
+    assert(NULL != v);
+    assert(NULL != v->storage || 0 == v->size);
+    assert(index_first <= index_last);
+    assert(index_last <= v->size);
+
+    {
+        bool const      uses_stack_array    =   0 != (COLLECT_C_VEC_F_USE_STACK_ARRAY & v->flags);
+        bool const      uses_boo            =   0 == (COLLECT_C_VEC_F_NO_BOO & v->flags);
+
+        size_t const    num_els             =   index_last - index_first;
+        size_t const    num_before          =   index_first;
+        size_t const    num_after           =   v->size - index_last;
+
+        size_t dummy;
+
+        if (NULL == num_dropped)
+        {
+            num_dropped = &dummy;
+        }
+
+        clc_c_v_free_range_(v, index_first, num_els);
+
+        if (0 != num_els)
+        {
+            if (uses_boo && !uses_stack_array && num_before < num_after)
+            {
+                /* move the preceding elements up, into the erased range */
+
+                void* const     pe_src  =   COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, v->offset);
+                void* const     pe_dst  =   COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, v->offset + num_els);
+
+                memmove(pe_dst, pe_src, num_before * v->el_size);
+
+                v->offset += num_els;
+            }
+            else
+            {
+                /* move the following elements down, into the erased range */
+
+                void* const     pe_src  =   COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, v->offset + index_last);
+                void* const     pe_dst  =   COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, v->offset + index_first);
+
+                memmove(pe_dst, pe_src, num_after * v->el_size);
+            }
+
+            v->size -= num_els;
+        }
+
+        *num_dropped = num_els;
+
+        return 0;
+    }
+}
+
+int
+collect_c_v_pop_from_back_n(
+    collect_c_vec_t*    v
+,   size_t              num_to_drop
+,   size_t*             num_dropped
+)
+{
+    assert(NULL != v);
+    assert(NULL != v->storage || 0 == v->size);
+
+    {
+        size_t dummy;
+
+        if (NULL == num_dropped)
+        {
+            num_dropped = &dummy;
+        }
+
+        if (num_to_drop > v->size)
+        {
+            num_to_drop = v->size;
+        }
+
+        clc_c_v_free_range_(v, v->size - num_to_drop, num_to_drop);
+
+        v->size -= num_to_drop;
+
+        *num_dropped = num_to_drop;
+
+        return 0;
+    }
+}
+
+int
+collect_c_v_pop_from_front_n(
+    collect_c_vec_t*    v
+,   size_t              num_to_drop
+,   size_t*             num_dropped
+)
+{
+    assert(NULL != v);
+    assert(NULL != v->storage || 0 == v->size);
+
+    {
+        bool const uses_stack_array =   0 != (COLLECT_C_VEC_F_USE_STACK_ARRAY & v->flags);
+        bool const uses_boo         =   0 == (COLLECT_C_VEC_F_NO_BOO & v->flags);
+
+        size_t dummy;
+
+        if (NULL == num_dropped)
+        {
+            num_dropped = &dummy;
+        }
+
+        if (num_to_drop > v->size)
+        {
+            num_to_drop = v->size;
+        }
+
+        clc_c_v_free_range_(v, 0, num_to_drop);
+
+        v->size -= num_to_drop;
+
+        if (uses_boo && !uses_stack_array)
+        {
+            v->offset += num_to_drop;
+
+            /* When the back is full and the front-spare is a significant
+             * proportion of the size - as happens when the vector is used
+             * as a work queue - the elements are moved down, retaining a
+             * quarter of the front-spare, so that subsequent pushes to the
+             * back do not each have to shuffle all elements down by one.
+             */
+            if (0 != v->size &&
+                v->capacity == v->offset + v->size &&
+                v->offset >= v->size / 4)
+            {
+                void* const     pe_src  =   COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, v->offset);
+                void* const     pe_dst  =   COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, v->offset / 4);
+
+                memmove(pe_dst, pe_src, v->size * v->el_size);
+
+                v->offset /= 4;
+            }
+        }
+        else if (0 != num_to_drop && 0 != v->size)
+        {
+            void* const     pe_src  =   COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, v->offset + num_to_drop);
+            void* const     pe_dst  =   COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, v->offset);
+
+            memmove(pe_dst, pe_src, v->size * v->el_size);
+        }
+
+        *num_dropped = num_to_drop;
+
+        return 0;
+    }
+}
+
+int
+collect_c_v_truncate(
+    collect_c_vec_t*    v
+,   size_t              new_size
+,   size_t*             num_dropped
+)
+{
+    assert(NULL != v);
+    assert(NULL != v->storage || 0 == v->size);
+
+    {
+        size_t dummy;
+
+        if (NULL == num_dropped)
+        {
+            num_dropped = &dummy;
+        }
+
+        if (new_size >= v->size)
+        {
+            *num_dropped = 0;
         }
         else
         {
-            --v->offset;
+            *num_dropped = v->size - new_size;
+
+            clc_c_v_free_range_(v, new_size, *num_dropped);
+
+            v->size = new_size;
         }
 
+        return 0;
+    }
+}
+
+void
+collect_c_vec_sort(
+    collect_c_vec_t*            v
+,   collect_c_vec_pfn_compare   pfn_compare
+)
+{
+    assert(NULL != v);
+    assert(NULL != v->storage || 0 == v->size);
+    assert(NULL != pfn_compare);
+
+    collect_c_vec_sort_range(v, 0, v->size, pfn_compare);
+}
+
+void
+collect_c_vec_sort_range(
+    collect_c_vec_t*            v
+,   size_t                      first
+,   size_t                      last
+,   collect_c_vec_pfn_compare   pfn_compare
+)
+{
+    assert(NULL != v);
+    assert(first <= last);
+    assert(last <= v->size);
+    assert(NULL != pfn_compare);
+
+    if (last - first > 1)
+    {
+        char* const base = COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, v->offset + first);
+
+        COLLECT_C_UTIL_DISPATCH_SIZE_(v->el_size, clc_c_v_pdqsort_, v, pfn_compare, base, last - first);
+    }
+}
+
+int
+collect_c_vec_radix_sort(
+    collect_c_vec_t*    v
+,   size_t              key_offset
+,   size_t              key_size
+)
+{
+    assert(NULL != v);
+    assert(NULL != v->storage || 0 == v->size);
+    assert(1 == key_size || 2 == key_size || 4 == key_size || 8 == key_size);
+    assert(key_offset + key_size <= v->el_size);
+
+    if (v->size < 2)
+    {
+        return 0;
+    }
+    else
+    {
+        size_t const    cb      =   v->size * v->el_size;
+        char* const     scratch =   collect_c_mem_alloc(v->allocator, cb);
+
+        if (NULL == scratch)
         {
-            size_t const    ix  =   v->offset + 0;
-            void* const     pe  =   COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, ix);
+            return ENOMEM;
+        }
+        else
+        {
+            char* const base = COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, v->offset);
 
-            memcpy(pe, ptr_new_el, v->el_size);
+            COLLECT_C_UTIL_DISPATCH_SIZE_(v->el_size, clc_c_v_radix_sort_, base, scratch, v->size, key_offset, key_size);
 
-            ++v->size;
+            collect_c_mem_free(v->allocator, scratch, cb);
 
             return 0;
         }
     }
 }
 
+int
+collect_c_vec_find_by_ref(
+    collect_c_vec_t const*  v
+,   void const*             p_key
+,   size_t*                 p_index
+)
+{
+    assert(NULL != v);
+    assert(NULL != p_key);
+
+    {
+        size_t const    ix  =   collect_c_scan_find(COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, v->offset), v->size, v->el_size, p_key);
+        size_t          dummy;
 
-/* ///////////////////////////// end of file //////////////////////////// */
+        if (NULL == p_index)
+        {
+            p_index = &dummy;
+        }
 
+        if (v->size == ix)
+        {
+            return ENOENT;
+        }
+
+        *p_index = ix;
+
+        return 0;
+    }
+}
+
+size_t
+collect_c_vec_count_by_ref(
+    collect_c_vec_t const*  v
+,   void const*             p_key
+)
+{
+    assert(NULL != v);
+    assert(NULL != p_key);
+
+    return collect_c_scan_count(COLLECT_C_VEC_INTERNAL_el_ptr_from_ix_(v, v->offset), v->size, v->el_size, p_key);
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,343 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    src/vm.c
+ *
+ * Purpose: Internal virtual-memory storage layer.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+# define _GNU_SOURCE /* for mremap() */
+#endif
+
+#include "vm.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__linux__)
+# include <stdatomic.h>
+# include <stdio.h>
+# include <sys/mman.h>
+# include <unistd.h>
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions and macros
+ */
+
+#if defined(__linux__)
+
+static
+size_t
+clc_c_vm_round_to_pages_(
+    size_t  cb
+,   bool    huge
+)
+{
+    /* threads that race to obtain the page size store the same value */
+    static atomic_size_t s_page_size;
+
+    size_t page_size = atomic_load_explicit(&s_page_size, memory_order_relaxed);
+
+    if (0 == page_size)
+    {
+        long const r = sysconf(_SC_PAGESIZE);
+
+        page_size = (r > 0) ? (size_t)r : 4096;
+
+        atomic_store_explicit(&s_page_size, page_size, memory_order_relaxed);
+    }
+
+    if (huge)
+    {
+        page_size = COLLECT_C_VM_HUGE_PAGE_SIZE;
+    }
+
+    return ((cb + page_size - 1) / page_size) * page_size;
+}
+
+static
+void
+clc_c_vm_advise_huge_(
+    void*   p
+,   size_t  cb_r
+)
+{
+#if defined(MADV_HUGEPAGE)
+
+    madvise(p, cb_r, MADV_HUGEPAGE);
+#else
+
+    ((void)&p);
+    ((void)&cb_r);
+#endif
+}
+
+/* Maps a region of cb_r bytes aligned to the huge page size, by mapping a
+ * larger region and unmapping its unaligned head and tail.
+ */
+static
+void*
+clc_c_vm_map_huge_(
+    size_t  cb_r
+)
+{
+    size_t const    cb_raw  =   cb_r + COLLECT_C_VM_HUGE_PAGE_SIZE;
+    void* const     raw     =   mmap(NULL, cb_raw, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (MAP_FAILED == raw)
+    {
+        return NULL;
+    }
+    else
+    {
+        uintptr_t const addr    =   ((uintptr_t)raw + COLLECT_C_VM_HUGE_PAGE_SIZE - 1) & ~(uintptr_t)(COLLECT_C_VM_HUGE_PAGE_SIZE - 1);
+        char* const     p       =   (char*)addr;
+        size_t const    cb_head =   (size_t)(p - (char*)raw);
+        size_t const    cb_tail =   COLLECT_C_VM_HUGE_PAGE_SIZE - cb_head;
+
+        if (0 != cb_head)
+        {
+            munmap(raw, cb_head);
+        }
+        if (0 != cb_tail)
+        {
+            munmap(p + cb_r, cb_tail);
+        }
+
+        clc_c_vm_advise_huge_(p, cb_r);
+
+        return p;
+    }
+}
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * internal functions
+ */
+
+bool
+collect_c_vm_is_supported(void)
+{
+#if defined(__linux__)
+
+    return true;
+#else
+
+    return false;
+#endif
+}
+
+void*
+collect_c_vm_allocate(
+    size_t  cb
+,   bool    huge
+)
+{
+#if defined(__linux__)
+
+    size_t const cb_r = clc_c_vm_round_to_pages_(cb, huge);
+
+    if (huge)
+    {
+        return clc_c_vm_map_huge_(cb_r);
+    }
+    else
+    {
+        void* const p = mmap(NULL, cb_r, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+        return (MAP_FAILED == p) ? NULL : p;
+    }
+#else
+
+    ((void)&cb);
+    ((void)&huge);
+
+    return NULL;
+#endif
+}
+
+void*
+collect_c_vm_reallocate(
+    void*   p
+,   size_t  cb_old
+,   size_t  cb_new
+,   bool    huge
+)
+{
+    assert(NULL != p);
+
+#if defined(__linux__)
+
+    {
+        size_t const    cb_old_r    =   clc_c_vm_round_to_pages_(cb_old, huge);
+        size_t const    cb_new_r    =   clc_c_vm_round_to_pages_(cb_new, huge);
+
+        if (cb_old_r == cb_new_r)
+        {
+            return p;
+        }
+        else if (!huge)
+        {
+            void* const p_new = mremap(p, cb_old_r, cb_new_r, MREMAP_MAYMOVE);
+
+            return (MAP_FAILED == p_new) ? NULL : p_new;
+        }
+        else if (cb_new_r < cb_old_r)
+        {
+            munmap((char*)p + cb_new_r, cb_old_r - cb_new_r);
+
+            return p;
+        }
+        else if (MAP_FAILED != mremap(p, cb_old_r, cb_new_r, 0))
+        {
+            /* grown in place */
+
+            clc_c_vm_advise_huge_(p, cb_new_r);
+
+            return p;
+        }
+        else
+        {
+            /* A plain MREMAP_MAYMOVE could leave the mapping unaligned, so
+             * an aligned region is mapped and the existing pages are moved
+             * (not copied) into its start
+             */
+
+            void* const p_new = clc_c_vm_map_huge_(cb_new_r);
+
+            if (NULL == p_new)
+            {
+                return NULL;
+            }
+
+            if (MAP_FAILED == mremap(p, cb_old_r, cb_old_r, MREMAP_MAYMOVE | MREMAP_FIXED, p_new))
+            {
+                munmap(p_new, cb_new_r);
+
+                return NULL;
+            }
+
+            return p_new;
+        }
+    }
+#else
+
+    ((void)&p);
+    ((void)&cb_old);
+    ((void)&cb_new);
+    ((void)&huge);
+
+    return NULL;
+#endif
+}
+
+void
+collect_c_vm_free(
+    void*   p
+,   size_t  cb
+,   bool    huge
+)
+{
+#if defined(__linux__)
+
+    if (NULL != p)
+    {
+        munmap(p, clc_c_vm_round_to_pages_(cb, huge));
+    }
+#else
+
+    ((void)&p);
+    ((void)&cb);
+    ((void)&huge);
+#endif
+}
+
+size_t
+collect_c_vm_huge_page_bytes(
+    void const* p
+,   size_t      cb
+)
+{
+#if defined(__linux__)
+
+    FILE* const f = fopen("/proc/self/smaps", "r");
+
+    if (NULL == f)
+    {
+        return 0;
+    }
+    else
+    {
+        uintptr_t const b       =   (uintptr_t)p;
+        uintptr_t const e       =   b + cb;
+        size_t          total   =   0;
+        size_t          cb_vma  =   0;
+        size_t          overlap =   0;
+        char            line[256];
+
+        for (; NULL != fgets(line, sizeof(line), f); )
+        {
+            unsigned long   vma_b;
+            unsigned long   vma_e;
+            unsigned long   kb;
+
+            if (2 == sscanf(line, "%lx-%lx ", &vma_b, &vma_e))
+            {
+                if (vma_b < e &&
+                    b < vma_e)
+                {
+                    cb_vma  =   vma_e - vma_b;
+                    overlap =   ((e < vma_e) ? e : vma_e) - ((b > vma_b) ? b : vma_b);
+                }
+                else
+                {
+                    overlap =   0;
+                }
+            }
+            else if (0 != overlap &&
+                     1 == sscanf(line, "AnonHugePages: %lu kB", &kb))
+            {
+                /* The kernel merges adjacent anonymous mappings of like
+                 * protections into one VMA, whose figure may then include
+                 * the huge pages of other allocations, so it is scaled to
+                 * the part of the VMA that is in the range.
+                 */
+                size_t const cb_huge = (size_t)kb * 1024;
+
+                total += (overlap == cb_vma) ? cb_huge : (size_t)((double)cb_huge * ((double)overlap / (double)cb_vma));
+            }
+        }
+
+        fclose(f);
+
+        if (total > cb)
+        {
+            total = cb;
+        }
+
+        /* the estimate is of a whole number of huge pages */
+        return total - (total % COLLECT_C_VM_HUGE_PAGE_SIZE);
+    }
+#else
+
+    ((void)&p);
+    ((void)&cb);
+
+    return 0;
+#endif
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
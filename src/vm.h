@@ -0,0 +1,99 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    src/vm.h
+ *
+ * Purpose: Internal virtual-memory storage layer.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * constants
+ */
+
+/** The size, and alignment, of (transparent) huge pages. */
+#define COLLECT_C_VM_HUGE_PAGE_SIZE                         (2 * 1024 * 1024)
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * internal functions
+ */
+
+/** Indicates whether virtual-memory storage - page-aligned anonymous
+ * mappings that may be grown without copying - is supported on the
+ * current platform. When it is not, all other functions fail.
+ */
+bool
+collect_c_vm_is_supported(void);
+
+/** Allocates a page-aligned anonymous mapping of at least cb bytes.
+ *
+ * @param cb The number of bytes required;
+ * @param huge If true, the mapping is aligned to, and sized in multiples
+ *  of, COLLECT_C_VM_HUGE_PAGE_SIZE, and is advised to be backed by
+ *  transparent huge pages;
+ *
+ * @return Pointer to the mapping, or NULL on failure.
+ */
+void*
+collect_c_vm_allocate(
+    size_t  cb
+,   bool    huge
+);
+
+/** Resizes a mapping obtained from collect_c_vm_allocate(), preserving its
+ * contents, and moving it (without copying) if it cannot be grown in
+ * place. A huge mapping remains aligned, and advised, after moving.
+ *
+ * @return Pointer to the (possibly moved) mapping, or NULL on failure, in
+ *  which case the original mapping is unchanged.
+ */
+void*
+collect_c_vm_reallocate(
+    void*   p
+,   size_t  cb_old
+,   size_t  cb_new
+,   bool    huge
+);
+
+/** Releases a mapping obtained from collect_c_vm_allocate() or
+ * collect_c_vm_reallocate().
+ */
+void
+collect_c_vm_free(
+    void*   p
+,   size_t  cb
+,   bool    huge
+);
+
+/** Obtains the number of bytes in the range [p, p + cb) that are
+ * currently backed by (transparent) huge pages, or 0 if this cannot be
+ * determined. Where the range is part of a larger mapping, the mapping's
+ * huge-page bytes are apportioned by the size of the overlap, so the
+ * result is an estimate, of whole huge pages, capped at cb.
+ */
+size_t
+collect_c_vm_huge_page_bytes(
+    void const* p
+,   size_t      cb
+);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#pragma once
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
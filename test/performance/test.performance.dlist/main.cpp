@@ -0,0 +1,656 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test/performance/test.performance.dlist/main.cpp
+ *
+ * Purpose: Performance-test for doubly-linked list.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#define COLLECT_C_DLIST_SUPPRESS_CXX_WARNING
+#include <collect-c/terse/dlist.h>
+#undef COLLECT_C_DLIST_SUPPRESS_CXX_WARNING
+#define COLLECT_C_POOL_SUPPRESS_CXX_WARNING
+#include <collect-c/terse/pool.h>
+#undef COLLECT_C_POOL_SUPPRESS_CXX_WARNING
+
+#include <xtests/terse-api.h>
+
+#include <stlsoft/diagnostics/std_chrono_hrc_stopwatch.hpp>
+#include <stlsoft/conversion/number/grouping_functions.hpp>
+
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+typedef stlsoft::std_chrono_hrc_stopwatch                   stopwatch_t;
+typedef stopwatch_t::interval_type                          interval_t;
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * constants
+ */
+
+namespace {
+
+    const std::size_t NUM_ITERATIONS    =   1000;
+    const std::size_t NUM_WARM_LOOPS    =   2;
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function declarations
+ */
+
+namespace {
+
+    std::uint64_t
+    find_node_in_list(
+        char const*                 function_name
+    ,   collect_c_dlist_t const*    l
+    ,   std::size_t                 num_iterations
+    ,   std::size_t                 num_warm_loops
+    );
+
+    std::uint64_t
+    find_node_by_bytes_in_list(
+        char const*                 function_name
+    ,   collect_c_dlist_t const*    l
+    ,   std::size_t                 num_iterations
+    ,   std::size_t                 num_warm_loops
+    );
+
+    std::uint64_t
+    rfind_node_in_list(
+        char const*                 function_name
+    ,   collect_c_dlist_t const*    l
+    ,   std::size_t                 num_iterations
+    ,   std::size_t                 num_warm_loops
+    );
+
+    std::uint64_t
+    rfind_node_by_bytes_in_list(
+        char const*                 function_name
+    ,   collect_c_dlist_t const*    l
+    ,   std::size_t                 num_iterations
+    ,   std::size_t                 num_warm_loops
+    );
+
+    std::uint64_t
+    push_back_each_into_list(
+        char const*                 function_name
+    ,   std::vector<int> const&     values
+    ,   std::size_t                 num_iterations
+    ,   std::size_t                 num_warm_loops
+    );
+
+    std::uint64_t
+    push_back_n_into_list(
+        char const*                 function_name
+    ,   std::vector<int> const&     values
+    ,   std::size_t                 num_iterations
+    ,   std::size_t                 num_warm_loops
+    );
+
+    std::uint64_t
+    push_back_each_into_pooled_list(
+        char const*                 function_name
+    ,   std::vector<int> const&     values
+    ,   std::size_t                 num_iterations
+    ,   std::size_t                 num_warm_loops
+    );
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions
+ */
+
+namespace {
+
+template <ss_typename_param_k T_integer>
+std::string
+thousands(
+    T_integer const& v
+)
+{
+    char    dest[41];
+    size_t  n = stlsoft::format_thousands(dest, std::size(dest), "3;0", v);
+
+    // NOTE: unfortunately `stlsoft::format_thousands()` return includes 1 for NUL terminator
+
+    return std::string(dest, n - 1);
+}
+
+void
+display_results_title(
+)
+{
+    std::cout
+        << '\t'
+        << std::setw(64) << std::left << "function name"
+        << '\t'
+        << std::setw(16) << std::right << "#iterations"
+        << '\t'
+        << std::setw(12) << std::right << "#actions"
+        << '\t'
+        << std::setw(16) << std::right << "tm (ns)"
+        << '\t'
+        << std::setw(12) << std::right << "tm/iter (ns)"
+        << '\t'
+        << std::setw(16) << std::right << "anchor (⚓)"
+        << std::endl
+        ;
+}
+
+void
+display_results(
+    char const*     function_name
+,   std::size_t     num_iterations
+,   std::size_t     num_actions
+,   interval_t      tm_ns
+,   std::uint64_t   anchor_value
+)
+{
+    ((void)&num_iterations);
+    ((void)&tm_ns);
+
+    std::cout
+        << '\t'
+        << std::setw(64) << std::left << function_name
+        << '\t'
+        << std::setw(16) << std::right << num_iterations
+        << '\t'
+        << std::setw(12) << std::right << num_actions
+        << '\t'
+        << std::setw(16) << std::right << thousands(tm_ns)
+        << '\t'
+        << std::setw(12) << std::right << thousands(tm_ns / (num_iterations * num_actions))
+        << '\t'
+        << std::setw(16) << std::right << anchor_value
+        << std::endl
+        ;
+}
+
+int
+compare_matching_int(
+    collect_c_dlist_t const*    l
+,   void const*                 p_lhs
+,   void const*                 p_rhs
+)
+{
+    ((void)&l);
+
+    int const& lhs = *static_cast<int const*>(p_lhs);
+    int const& rhs = *static_cast<int const*>(p_rhs);
+
+    return (lhs < rhs) ? -1 : (lhs > rhs) ? +1 : 0;
+}
+
+/* Populates the list with the values [0, num_elements). If interleave is
+ * true, the nodes of the list are made to be non-adjacent in memory by
+ * interleaving their allocation with those of another list.
+ */
+int
+populate_list(
+    collect_c_dlist_t*  l
+,   collect_c_dlist_t*  other
+,   std::size_t         num_elements
+,   bool                interleave
+)
+{
+    for (std::size_t i = 0; num_elements != i; ++i)
+    {
+        int const   v   =   static_cast<int>(i);
+        int         r   =   collect_c_dlist_push_back_by_ref(l, &v);
+
+        if (0 != r)
+        {
+            return r;
+        }
+
+        if (interleave)
+        {
+            for (int j = 0; 3 != j; ++j)
+            {
+                if (0 != (r = collect_c_dlist_push_back_by_ref(other, &v)))
+                {
+                    return r;
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char* /*argv*/[])
+{
+    std::uint64_t anchor_value = 0;
+
+    display_results_title();
+
+    /* each search is for a value that is not present, so traverses the
+     * whole list, and all forms of search are conducted on the same list
+     */
+
+    {
+        CLC_DL_define_empty(int, l);
+        CLC_DL_define_empty(int, other);
+
+        if (0 == populate_list(&l, &other, 1000, false))
+        {
+            anchor_value += find_node_in_list("find_node_in_list_of_1000", &l, NUM_ITERATIONS * 10, NUM_WARM_LOOPS);
+            anchor_value += find_node_by_bytes_in_list("find_node_by_bytes_in_list_of_1000", &l, NUM_ITERATIONS * 10, NUM_WARM_LOOPS);
+            anchor_value += rfind_node_in_list("rfind_node_in_list_of_1000", &l, NUM_ITERATIONS * 10, NUM_WARM_LOOPS);
+            anchor_value += rfind_node_by_bytes_in_list("rfind_node_by_bytes_in_list_of_1000", &l, NUM_ITERATIONS * 10, NUM_WARM_LOOPS);
+        }
+
+        clc_dlist_free_storage(&other);
+        clc_dlist_free_storage(&l);
+    }
+
+    {
+        CLC_DL_define_empty(int, l);
+        CLC_DL_define_empty(int, other);
+
+        if (0 == populate_list(&l, &other, 1000000, false))
+        {
+            anchor_value += find_node_in_list("find_node_in_list_of_1000000", &l, NUM_ITERATIONS / 10, NUM_WARM_LOOPS);
+            anchor_value += find_node_by_bytes_in_list("find_node_by_bytes_in_list_of_1000000", &l, NUM_ITERATIONS / 10, NUM_WARM_LOOPS);
+            anchor_value += rfind_node_in_list("rfind_node_in_list_of_1000000", &l, NUM_ITERATIONS / 10, NUM_WARM_LOOPS);
+            anchor_value += rfind_node_by_bytes_in_list("rfind_node_by_bytes_in_list_of_1000000", &l, NUM_ITERATIONS / 10, NUM_WARM_LOOPS);
+        }
+
+        clc_dlist_free_storage(&other);
+        clc_dlist_free_storage(&l);
+    }
+
+    {
+        CLC_DL_define_empty(int, l);
+        CLC_DL_define_empty(int, other);
+
+        if (0 == populate_list(&l, &other, 1000000, true))
+        {
+            anchor_value += find_node_in_list("find_node_in_interleaved_list_of_1000000", &l, NUM_ITERATIONS / 10, NUM_WARM_LOOPS);
+            anchor_value += find_node_by_bytes_in_list("find_node_by_bytes_in_interleaved_list_of_1000000", &l, NUM_ITERATIONS / 10, NUM_WARM_LOOPS);
+            anchor_value += rfind_node_in_list("rfind_node_in_interleaved_list_of_1000000", &l, NUM_ITERATIONS / 10, NUM_WARM_LOOPS);
+            anchor_value += rfind_node_by_bytes_in_list("rfind_node_by_bytes_in_interleaved_list_of_1000000", &l, NUM_ITERATIONS / 10, NUM_WARM_LOOPS);
+        }
+
+        clc_dlist_free_storage(&other);
+        clc_dlist_free_storage(&l);
+    }
+
+    /* bulk loading, element-by-element vs all-at-once */
+
+    {
+        std::vector<int> values(100000);
+
+        for (std::size_t i = 0; values.size() != i; ++i)
+        {
+            values[i] = static_cast<int>(i);
+        }
+
+        anchor_value += push_back_each_into_list("push_back_each_into_list_of_100000", values, NUM_ITERATIONS / 10, NUM_WARM_LOOPS);
+        anchor_value += push_back_n_into_list("push_back_n_into_list_of_100000", values, NUM_ITERATIONS / 10, NUM_WARM_LOOPS);
+        anchor_value += push_back_each_into_pooled_list("push_back_each_into_pooled_list_of_100000", values, NUM_ITERATIONS / 10, NUM_WARM_LOOPS);
+    }
+
+    return (0 == argc && 0 == anchor_value) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace {
+
+    std::uint64_t
+    find_node_in_list(
+        char const*                 function_name
+    ,   collect_c_dlist_t const*    l
+    ,   std::size_t                 num_iterations
+    ,   std::size_t                 num_warm_loops
+    )
+    {
+        std::uint64_t anchor_value = 0;
+
+        {
+            int const   v_missing   =   -1;
+            stopwatch_t sw;
+
+            for (std::size_t w = num_warm_loops; 0 != w; --w)
+            {
+                interval_t tm_ns = 0;
+
+                anchor_value = 0;
+
+                sw.start();
+                for (std::size_t i = 0; num_iterations != i; ++i)
+                {
+                    collect_c_dlist_node_t* node;
+                    size_t                  num_searched;
+
+                    collect_c_dlist_find_node(l, compare_matching_int, &v_missing, 0, &node, &num_searched);
+
+                    anchor_value += num_searched;
+                }
+                sw.stop();
+
+                tm_ns = sw.get_nanoseconds();
+
+                if (1 == w)
+                {
+                    display_results(function_name, num_iterations, l->size, tm_ns, anchor_value);
+                }
+            }
+        }
+
+        return anchor_value;
+    }
+
+    std::uint64_t
+    find_node_by_bytes_in_list(
+        char const*                 function_name
+    ,   collect_c_dlist_t const*    l
+    ,   std::size_t                 num_iterations
+    ,   std::size_t                 num_warm_loops
+    )
+    {
+        std::uint64_t anchor_value = 0;
+
+        {
+            int const   v_missing   =   -1;
+            stopwatch_t sw;
+
+            for (std::size_t w = num_warm_loops; 0 != w; --w)
+            {
+                interval_t tm_ns = 0;
+
+                anchor_value = 0;
+
+                sw.start();
+                for (std::size_t i = 0; num_iterations != i; ++i)
+                {
+                    collect_c_dlist_node_t* node;
+                    size_t                  num_searched;
+
+                    collect_c_dlist_find_node_by_bytes(l, &v_missing, 0, &node, &num_searched);
+
+                    anchor_value += num_searched;
+                }
+                sw.stop();
+
+                tm_ns = sw.get_nanoseconds();
+
+                if (1 == w)
+                {
+                    display_results(function_name, num_iterations, l->size, tm_ns, anchor_value);
+                }
+            }
+        }
+
+        return anchor_value;
+    }
+
+    std::uint64_t
+    rfind_node_in_list(
+        char const*                 function_name
+    ,   collect_c_dlist_t const*    l
+    ,   std::size_t                 num_iterations
+    ,   std::size_t                 num_warm_loops
+    )
+    {
+        std::uint64_t anchor_value = 0;
+
+        {
+            int const   v_missing   =   -1;
+            stopwatch_t sw;
+
+            for (std::size_t w = num_warm_loops; 0 != w; --w)
+            {
+                interval_t tm_ns = 0;
+
+                anchor_value = 0;
+
+                sw.start();
+                for (std::size_t i = 0; num_iterations != i; ++i)
+                {
+                    collect_c_dlist_node_t* node;
+                    size_t                  num_searched;
+
+                    collect_c_dlist_rfind_node(l, compare_matching_int, &v_missing, 0, &node, &num_searched);
+
+                    anchor_value += num_searched;
+                }
+                sw.stop();
+
+                tm_ns = sw.get_nanoseconds();
+
+                if (1 == w)
+                {
+                    display_results(function_name, num_iterations, l->size, tm_ns, anchor_value);
+                }
+            }
+        }
+
+        return anchor_value;
+    }
+
+    std::uint64_t
+    rfind_node_by_bytes_in_list(
+        char const*                 function_name
+    ,   collect_c_dlist_t const*    l
+    ,   std::size_t                 num_iterations
+    ,   std::size_t                 num_warm_loops
+    )
+    {
+        std::uint64_t anchor_value = 0;
+
+        {
+            int const   v_missing   =   -1;
+            stopwatch_t sw;
+
+            for (std::size_t w = num_warm_loops; 0 != w; --w)
+            {
+                interval_t tm_ns = 0;
+
+                anchor_value = 0;
+
+                sw.start();
+                for (std::size_t i = 0; num_iterations != i; ++i)
+                {
+                    collect_c_dlist_node_t* node;
+                    size_t                  num_searched;
+
+                    collect_c_dlist_rfind_node_by_bytes(l, &v_missing, 0, &node, &num_searched);
+
+                    anchor_value += num_searched;
+                }
+                sw.stop();
+
+                tm_ns = sw.get_nanoseconds();
+
+                if (1 == w)
+                {
+                    display_results(function_name, num_iterations, l->size, tm_ns, anchor_value);
+                }
+            }
+        }
+
+        return anchor_value;
+    }
+
+    std::uint64_t
+    push_back_each_into_list(
+        char const*                 function_name
+    ,   std::vector<int> const&     values
+    ,   std::size_t                 num_iterations
+    ,   std::size_t                 num_warm_loops
+    )
+    {
+        std::uint64_t anchor_value = 0;
+
+        {
+            stopwatch_t sw;
+
+            for (std::size_t w = num_warm_loops; 0 != w; --w)
+            {
+                interval_t tm_ns = 0;
+
+                anchor_value = 0;
+
+                sw.start();
+                for (std::size_t i = 0; num_iterations != i; ++i)
+                {
+                    CLC_DL_define_empty(int, l);
+
+                    for (std::size_t j = 0; values.size() != j; ++j)
+                    {
+                        collect_c_dlist_push_back_by_ref(&l, &values[j]);
+                    }
+
+                    anchor_value += l.size;
+
+                    clc_dlist_free_storage(&l);
+                }
+                sw.stop();
+
+                tm_ns = sw.get_nanoseconds();
+
+                if (1 == w)
+                {
+                    display_results(function_name, num_iterations, values.size(), tm_ns, anchor_value);
+                }
+            }
+        }
+
+        return anchor_value;
+    }
+
+    std::uint64_t
+    push_back_n_into_list(
+        char const*                 function_name
+    ,   std::vector<int> const&     values
+    ,   std::size_t                 num_iterations
+    ,   std::size_t                 num_warm_loops
+    )
+    {
+        std::uint64_t anchor_value = 0;
+
+        {
+            stopwatch_t sw;
+
+            for (std::size_t w = num_warm_loops; 0 != w; --w)
+            {
+                interval_t tm_ns = 0;
+
+                anchor_value = 0;
+
+                sw.start();
+                for (std::size_t i = 0; num_iterations != i; ++i)
+                {
+                    CLC_DL_define_empty(int, l);
+
+                    collect_c_dlist_push_back_n_by_ref(&l, values.size(), values.data());
+
+                    anchor_value += l.size;
+
+                    clc_dlist_free_storage(&l);
+                }
+                sw.stop();
+
+                tm_ns = sw.get_nanoseconds();
+
+                if (1 == w)
+                {
+                    display_results(function_name, num_iterations, values.size(), tm_ns, anchor_value);
+                }
+            }
+        }
+
+        return anchor_value;
+    }
+
+    /* as push_back_each_into_list(), but with the nodes obtained from a
+     * pool, whose blocks are retained between iterations
+     */
+    std::uint64_t
+    push_back_each_into_pooled_list(
+        char const*                 function_name
+    ,   std::vector<int> const&     values
+    ,   std::size_t                 num_iterations
+    ,   std::size_t                 num_warm_loops
+    )
+    {
+        std::uint64_t anchor_value = 0;
+
+        CLC_PL_define_by_size(CLC_DL_node_size(int), p, 1024);
+
+        {
+            stopwatch_t sw;
+
+            for (std::size_t w = num_warm_loops; 0 != w; --w)
+            {
+                interval_t tm_ns = 0;
+
+                anchor_value = 0;
+
+                sw.start();
+                for (std::size_t i = 0; num_iterations != i; ++i)
+                {
+                    CLC_DL_define_empty(int, l);
+
+                    l.allocator = CLC_PL_allocator(p);
+
+                    for (std::size_t j = 0; values.size() != j; ++j)
+                    {
+                        collect_c_dlist_push_back_by_ref(&l, &values[j]);
+                    }
+
+                    anchor_value += l.size;
+
+                    clc_dlist_free_storage(&l);
+                }
+                sw.stop();
+
+                tm_ns = sw.get_nanoseconds();
+
+                if (1 == w)
+                {
+                    display_results(function_name, num_iterations, values.size(), tm_ns, anchor_value);
+                }
+            }
+        }
+
+        clc_pl_free_storage(&p);
+
+        return anchor_value;
+    }
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
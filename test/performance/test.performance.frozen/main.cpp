@@ -0,0 +1,310 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test/performance/test.performance.frozen/main.cpp
+ *
+ * Purpose: Performance-test for frozen sorted array.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#define COLLECT_C_FLATMAP_SUPPRESS_CXX_WARNING
+#define COLLECT_C_FROZEN_SUPPRESS_CXX_WARNING
+#define COLLECT_C_VEC_SUPPRESS_CXX_WARNING
+#include <collect-c/terse/flatmap.h>
+#include <collect-c/terse/frozen.h>
+#include <collect-c/terse/vec.h>
+#undef COLLECT_C_FLATMAP_SUPPRESS_CXX_WARNING
+#undef COLLECT_C_FROZEN_SUPPRESS_CXX_WARNING
+#undef COLLECT_C_VEC_SUPPRESS_CXX_WARNING
+
+#include <xtests/terse-api.h>
+
+#include <stlsoft/diagnostics/std_chrono_hrc_stopwatch.hpp>
+#include <stlsoft/conversion/number/grouping_functions.hpp>
+
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+typedef stlsoft::std_chrono_hrc_stopwatch                   stopwatch_t;
+typedef stopwatch_t::interval_type                          interval_t;
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * constants
+ */
+
+namespace {
+
+    const std::size_t NUM_ITERATIONS    =   5;
+    const std::size_t NUM_WARM_LOOPS    =   2;
+    const std::size_t NUM_LOOKUPS       =   1000000;
+
+    /* the layout searched by binary search of the sorted vector, for
+     * comparison with those of collect_c_frozen_t
+     */
+    const std::int32_t LAYOUT_SORTED    =   -1;
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function declarations
+ */
+
+namespace {
+
+    std::uint64_t
+    lookup_random(
+        char const*     function_name
+    ,   std::int32_t    layout
+    ,   std::size_t     num_elements
+    ,   std::size_t     num_lookups
+    ,   std::size_t     num_iterations
+    ,   std::size_t     num_warm_loops
+    );
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions
+ */
+
+namespace {
+
+template <ss_typename_param_k T_integer>
+std::string
+thousands(
+    T_integer const& v
+)
+{
+    char    dest[41];
+    size_t  n = stlsoft::format_thousands(dest, std::size(dest), "3;0", v);
+
+    // NOTE: unfortunately `stlsoft::format_thousands()` return includes 1 for NUL terminator
+
+    return std::string(dest, n - 1);
+}
+
+void
+display_results_title(
+)
+{
+    std::cout
+        << '\t'
+        << std::setw(64) << std::left << "function name"
+        << '\t'
+        << std::setw(16) << std::right << "#iterations"
+        << '\t'
+        << std::setw(12) << std::right << "#actions"
+        << '\t'
+        << std::setw(16) << std::right << "tm (ns)"
+        << '\t'
+        << std::setw(12) << std::right << "tm/iter (ns)"
+        << '\t'
+        << std::setw(16) << std::right << "anchor (⚓)"
+        << std::endl
+        ;
+}
+
+void
+display_results(
+    char const*     function_name
+,   std::size_t     num_iterations
+,   std::size_t     num_actions
+,   interval_t      tm_ns
+,   std::uint64_t   anchor_value
+)
+{
+    ((void)&num_iterations);
+    ((void)&tm_ns);
+
+    std::cout
+        << '\t'
+        << std::setw(64) << std::left << function_name
+        << '\t'
+        << std::setw(16) << std::right << num_iterations
+        << '\t'
+        << std::setw(12) << std::right << num_actions
+        << '\t'
+        << std::setw(16) << std::right << thousands(tm_ns)
+        << '\t'
+        << std::setw(12) << std::right << thousands(tm_ns / (num_iterations * num_actions))
+        << '\t'
+        << std::setw(16) << std::right << anchor_value
+        << std::endl
+        ;
+}
+
+int
+compare_uint32(
+    std::uint32_t   lhs
+,   std::uint32_t   rhs
+)
+{
+    return (lhs > rhs) - (lhs < rhs);
+}
+
+extern "C"
+int
+fn_compare_flatmap(
+    collect_c_flatmap_t const*  m
+,   void const*                 p_lhs
+,   void const*                 p_rhs
+)
+{
+    ((void)&m);
+
+    return compare_uint32(*static_cast<std::uint32_t const*>(p_lhs), *static_cast<std::uint32_t const*>(p_rhs));
+}
+
+extern "C"
+int
+fn_compare_frozen(
+    collect_c_frozen_t const*   z
+,   void const*                 p_el
+,   void const*                 p_key
+)
+{
+    ((void)&z);
+
+    return compare_uint32(*static_cast<std::uint32_t const*>(p_el), *static_cast<std::uint32_t const*>(p_key));
+}
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char* /*argv*/[])
+{
+    std::uint64_t anchor_value = 0;
+
+    display_results_title();
+
+    /* random lookups in a table that fits in L2 cache, and in one that is
+     * far larger than the last-level cache, where a binary search of the
+     * sorted vector takes a cache miss at nearly every step
+     */
+
+    anchor_value += lookup_random("lookup_random_of_65536_SORTED", LAYOUT_SORTED, 65536, NUM_LOOKUPS, NUM_ITERATIONS, NUM_WARM_LOOPS);
+    anchor_value += lookup_random("lookup_random_of_65536_EYTZINGER", CLC_FZ_F_EYTZINGER, 65536, NUM_LOOKUPS, NUM_ITERATIONS, NUM_WARM_LOOPS);
+    anchor_value += lookup_random("lookup_random_of_65536_BTREE", CLC_FZ_F_BTREE, 65536, NUM_LOOKUPS, NUM_ITERATIONS, NUM_WARM_LOOPS);
+
+    anchor_value += lookup_random("lookup_random_of_16777216_SORTED", LAYOUT_SORTED, 16777216, NUM_LOOKUPS, NUM_ITERATIONS, NUM_WARM_LOOPS);
+    anchor_value += lookup_random("lookup_random_of_16777216_EYTZINGER", CLC_FZ_F_EYTZINGER, 16777216, NUM_LOOKUPS, NUM_ITERATIONS, NUM_WARM_LOOPS);
+    anchor_value += lookup_random("lookup_random_of_16777216_BTREE", CLC_FZ_F_BTREE, 16777216, NUM_LOOKUPS, NUM_ITERATIONS, NUM_WARM_LOOPS);
+
+    return (0 == argc && 0 == anchor_value) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace {
+
+    std::uint64_t
+    lookup_random(
+        char const*     function_name
+    ,   std::int32_t    layout
+    ,   std::size_t     num_elements
+    ,   std::size_t     num_lookups
+    ,   std::size_t     num_iterations
+    ,   std::size_t     num_warm_loops
+    )
+    {
+        std::uint64_t anchor_value = 0;
+
+        CLC_FM_define_empty_set(std::uint32_t, m, fn_compare_flatmap);
+        CLC_FZ_define_empty(std::uint32_t, z, fn_compare_frozen);
+
+        /* the even numbers [0, 2 * num_elements), so that half of the
+         * lookups are misses
+         */
+        if (0 != collect_c_vec_reserve(&m.v, num_elements, 0))
+        {
+            return 0;
+        }
+
+        for (std::size_t i = 0; num_elements != i; ++i)
+        {
+            std::uint32_t const key = static_cast<std::uint32_t>(2 * i);
+
+            collect_c_v_push_back_by_ref(&m.v, &key);
+        }
+
+        if (LAYOUT_SORTED != layout &&
+            0 != collect_c_frozen_freeze(&z, &m.v, layout))
+        {
+            collect_c_flatmap_free_storage(&m);
+
+            return 0;
+        }
+
+        {
+            stopwatch_t sw;
+
+            for (std::size_t w = num_warm_loops; 0 != w; --w)
+            {
+                interval_t tm_ns = 0;
+
+                anchor_value = 0;
+
+                sw.start();
+                for (std::size_t i = 0; num_iterations != i; ++i)
+                {
+                    std::uint64_t state = i;
+
+                    for (std::size_t j = 0; num_lookups != j; ++j)
+                    {
+                        /* LCG (from Knuth's MMIX) */
+                        state = state * 6364136223846793005u + 1442695040888963407u;
+
+                        std::uint32_t const key = static_cast<std::uint32_t>((state >> 32) % (2 * num_elements));
+
+                        if (LAYOUT_SORTED == layout)
+                        {
+                            anchor_value += (0 == collect_c_flatmap_find_by_ref(&m, &key, NULL));
+                        }
+                        else
+                        {
+                            anchor_value += (0 == collect_c_frozen_find_by_ref(&z, &key, NULL));
+                        }
+                    }
+                }
+                sw.stop();
+
+                tm_ns = sw.get_nanoseconds();
+
+                if (1 == w)
+                {
+                    display_results(function_name, num_iterations, num_lookups, tm_ns, anchor_value);
+                }
+            }
+        }
+
+        collect_c_frozen_free_storage(&z);
+        collect_c_flatmap_free_storage(&m);
+
+        return anchor_value;
+    }
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
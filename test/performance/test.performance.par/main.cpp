@@ -0,0 +1,415 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test/performance/test.performance.par/main.cpp
+ *
+ * Purpose: Performance-test for parallel algorithms.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#define COLLECT_C_PAR_SUPPRESS_CXX_WARNING
+#define COLLECT_C_VEC_SUPPRESS_CXX_WARNING
+#include <collect-c/terse/par.h>
+#include <collect-c/terse/vec.h>
+#undef COLLECT_C_PAR_SUPPRESS_CXX_WARNING
+#undef COLLECT_C_VEC_SUPPRESS_CXX_WARNING
+
+#include <xtests/terse-api.h>
+
+#include <stlsoft/diagnostics/std_chrono_hrc_stopwatch.hpp>
+#include <stlsoft/conversion/number/grouping_functions.hpp>
+
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+typedef stlsoft::std_chrono_hrc_stopwatch                   stopwatch_t;
+typedef stopwatch_t::interval_type                          interval_t;
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * constants
+ */
+
+namespace {
+
+    const std::size_t NUM_ITERATIONS    =   3;
+    const std::size_t NUM_WARM_LOOPS    =   2;
+    const std::size_t NUM_ELEMENTS      =   4000000;
+
+    /* the number of threads that denotes the serial algorithm, for
+     * comparison with those of a pool
+     */
+    const std::size_t THREADS_SERIAL    =   0;
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function declarations
+ */
+
+namespace {
+
+    std::uint64_t
+    sort_random(
+        char const*     function_name
+    ,   std::size_t     num_threads
+    ,   std::size_t     num_elements
+    ,   std::size_t     num_iterations
+    ,   std::size_t     num_warm_loops
+    );
+
+    std::uint64_t
+    reduce_sum(
+        char const*     function_name
+    ,   std::size_t     num_threads
+    ,   std::size_t     num_elements
+    ,   std::size_t     num_iterations
+    ,   std::size_t     num_warm_loops
+    );
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions
+ */
+
+namespace {
+
+template <ss_typename_param_k T_integer>
+std::string
+thousands(
+    T_integer const& v
+)
+{
+    char    dest[41];
+    size_t  n = stlsoft::format_thousands(dest, std::size(dest), "3;0", v);
+
+    // NOTE: unfortunately `stlsoft::format_thousands()` return includes 1 for NUL terminator
+
+    return std::string(dest, n - 1);
+}
+
+void
+display_results_title(
+)
+{
+    std::cout
+        << '\t'
+        << std::setw(64) << std::left << "function name"
+        << '\t'
+        << std::setw(16) << std::right << "#iterations"
+        << '\t'
+        << std::setw(12) << std::right << "#actions"
+        << '\t'
+        << std::setw(16) << std::right << "tm (ns)"
+        << '\t'
+        << std::setw(12) << std::right << "tm/iter (ns)"
+        << '\t'
+        << std::setw(16) << std::right << "anchor (⚓)"
+        << std::endl
+        ;
+}
+
+void
+display_results(
+    char const*     function_name
+,   std::size_t     num_iterations
+,   std::size_t     num_actions
+,   interval_t      tm_ns
+,   std::uint64_t   anchor_value
+)
+{
+    ((void)&num_iterations);
+    ((void)&tm_ns);
+
+    std::cout
+        << '\t'
+        << std::setw(64) << std::left << function_name
+        << '\t'
+        << std::setw(16) << std::right << num_iterations
+        << '\t'
+        << std::setw(12) << std::right << num_actions
+        << '\t'
+        << std::setw(16) << std::right << thousands(tm_ns)
+        << '\t'
+        << std::setw(12) << std::right << thousands(tm_ns / (num_iterations * num_actions))
+        << '\t'
+        << std::setw(16) << std::right << anchor_value
+        << std::endl
+        ;
+}
+
+extern "C"
+int
+fn_compare_uint64(
+    collect_c_vec_t const*  v
+,   void const*             p_lhs
+,   void const*             p_rhs
+)
+{
+    std::uint64_t const lhs = *static_cast<std::uint64_t const*>(p_lhs);
+    std::uint64_t const rhs = *static_cast<std::uint64_t const*>(p_rhs);
+
+    ((void)&v);
+
+    return (lhs > rhs) - (lhs < rhs);
+}
+
+extern "C"
+void
+fn_accumulate_uint64(
+    collect_c_vec_t const*  v
+,   void*                   p_acc
+,   void const*             p_el
+,   void*                   param
+)
+{
+    ((void)&v);
+    ((void)&param);
+
+    *static_cast<std::uint64_t*>(p_acc) += *static_cast<std::uint64_t const*>(p_el) >> 32;
+}
+
+extern "C"
+void
+fn_combine_uint64(
+    collect_c_vec_t const*  v
+,   void*                   p_acc
+,   void const*             p_other
+,   void*                   param
+)
+{
+    ((void)&v);
+    ((void)&param);
+
+    *static_cast<std::uint64_t*>(p_acc) += *static_cast<std::uint64_t const*>(p_other);
+}
+
+/* fills the vector with pseudo-random values, from the given seed */
+void
+fill_random(
+    collect_c_vec_t*    v
+,   std::uint64_t       seed
+)
+{
+    std::uint64_t* const p = static_cast<std::uint64_t*>(v->storage) + v->offset;
+
+    for (std::size_t i = 0; v->size != i; ++i)
+    {
+        /* LCG (from Knuth's MMIX) */
+        seed = seed * 6364136223846793005u + 1442695040888963407u;
+
+        p[i] = seed;
+    }
+}
+
+int
+create_vec(
+    collect_c_vec_t*    v
+,   std::size_t         num_elements
+)
+{
+    int const r = collect_c_vec_reserve(v, num_elements, 0);
+
+    if (0 == r)
+    {
+        for (std::size_t i = 0; num_elements != i; ++i)
+        {
+            std::uint64_t const el = 0;
+
+            collect_c_v_push_back_by_ref(v, &el);
+        }
+    }
+
+    return r;
+}
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char* /*argv*/[])
+{
+    std::uint64_t anchor_value = 0;
+
+    display_results_title();
+
+    anchor_value += sort_random("sort_random_SERIAL", THREADS_SERIAL, NUM_ELEMENTS, NUM_ITERATIONS, NUM_WARM_LOOPS);
+    anchor_value += sort_random("sort_random_1_THREAD", 1, NUM_ELEMENTS, NUM_ITERATIONS, NUM_WARM_LOOPS);
+    anchor_value += sort_random("sort_random_4_THREADS", 4, NUM_ELEMENTS, NUM_ITERATIONS, NUM_WARM_LOOPS);
+    anchor_value += sort_random("sort_random_ALL_THREADS", ~std::size_t(0), NUM_ELEMENTS, NUM_ITERATIONS, NUM_WARM_LOOPS);
+
+    anchor_value += reduce_sum("reduce_sum_SERIAL", THREADS_SERIAL, NUM_ELEMENTS, NUM_ITERATIONS, NUM_WARM_LOOPS);
+    anchor_value += reduce_sum("reduce_sum_4_THREADS", 4, NUM_ELEMENTS, NUM_ITERATIONS, NUM_WARM_LOOPS);
+    anchor_value += reduce_sum("reduce_sum_ALL_THREADS", ~std::size_t(0), NUM_ELEMENTS, NUM_ITERATIONS, NUM_WARM_LOOPS);
+
+    return (0 == argc && 0 == anchor_value) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace {
+
+    /* creates a pool of the given number of threads, where ~0 denotes all
+     * processors; none for THREADS_SERIAL
+     */
+    collect_c_par_pool_t*
+    create_pool(
+        std::size_t num_threads
+    )
+    {
+        collect_c_par_pool_t* pool = NULL;
+
+        if (THREADS_SERIAL != num_threads)
+        {
+            collect_c_par_pool_create((~std::size_t(0) == num_threads) ? 0 : num_threads, NULL, &pool);
+        }
+
+        return pool;
+    }
+
+    std::uint64_t
+    sort_random(
+        char const*     function_name
+    ,   std::size_t     num_threads
+    ,   std::size_t     num_elements
+    ,   std::size_t     num_iterations
+    ,   std::size_t     num_warm_loops
+    )
+    {
+        std::uint64_t           anchor_value    =   0;
+        collect_c_par_pool_t*   pool            =   create_pool(num_threads);
+
+        CLC_V_define_empty(std::uint64_t, v);
+
+        if (0 != create_vec(&v, num_elements))
+        {
+            collect_c_par_pool_destroy(pool);
+
+            return 0;
+        }
+
+        {
+            stopwatch_t sw;
+
+            for (std::size_t w = num_warm_loops; 0 != w; --w)
+            {
+                interval_t tm_ns = 0;
+
+                anchor_value = 0;
+
+                for (std::size_t i = 0; num_iterations != i; ++i)
+                {
+                    fill_random(&v, i);
+
+                    sw.start();
+                    if (THREADS_SERIAL == num_threads)
+                    {
+                        collect_c_vec_sort(&v, fn_compare_uint64);
+                    }
+                    else
+                    {
+                        collect_c_par_sort(pool, &v, 0, v.size, fn_compare_uint64);
+                    }
+                    sw.stop();
+
+                    tm_ns += sw.get_nanoseconds();
+
+                    anchor_value += static_cast<std::uint64_t const*>(v.storage)[v.size / 2] >> 40;
+                }
+
+                if (1 == w)
+                {
+                    display_results(function_name, num_iterations, num_elements, tm_ns, anchor_value);
+                }
+            }
+        }
+
+        collect_c_vec_free_storage(&v);
+        collect_c_par_pool_destroy(pool);
+
+        return anchor_value;
+    }
+
+    std::uint64_t
+    reduce_sum(
+        char const*     function_name
+    ,   std::size_t     num_threads
+    ,   std::size_t     num_elements
+    ,   std::size_t     num_iterations
+    ,   std::size_t     num_warm_loops
+    )
+    {
+        std::uint64_t           anchor_value    =   0;
+        collect_c_par_pool_t*   pool            =   create_pool(num_threads);
+
+        CLC_V_define_empty(std::uint64_t, v);
+
+        if (0 != create_vec(&v, num_elements))
+        {
+            collect_c_par_pool_destroy(pool);
+
+            return 0;
+        }
+
+        fill_random(&v, 0);
+
+        {
+            stopwatch_t sw;
+
+            for (std::size_t w = num_warm_loops; 0 != w; --w)
+            {
+                interval_t tm_ns = 0;
+
+                anchor_value = 0;
+
+                sw.start();
+                for (std::size_t i = 0; num_iterations != i; ++i)
+                {
+                    std::uint64_t const identity    =   0;
+                    std::uint64_t       sum         =   0;
+
+                    collect_c_par_reduce(pool, &v, 0, v.size, sizeof(std::uint64_t), &identity, fn_accumulate_uint64, fn_combine_uint64, NULL, &sum);
+
+                    anchor_value += sum;
+                }
+                sw.stop();
+
+                tm_ns = sw.get_nanoseconds();
+
+                if (1 == w)
+                {
+                    display_results(function_name, num_iterations, num_elements, tm_ns, anchor_value);
+                }
+            }
+        }
+
+        collect_c_vec_free_storage(&v);
+        collect_c_par_pool_destroy(pool);
+
+        return anchor_value;
+    }
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,708 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test/performance/test.performance.vec/main.cpp
+ *
+ * Purpose: Performance-test for vector.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#define COLLECT_C_VEC_SUPPRESS_CXX_WARNING
+#include <collect-c/terse/vec.h>
+#undef COLLECT_C_VEC_SUPPRESS_CXX_WARNING
+
+#include <xtests/terse-api.h>
+
+#include <stlsoft/diagnostics/std_chrono_hrc_stopwatch.hpp>
+#include <stlsoft/conversion/number/grouping_functions.hpp>
+
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+typedef stlsoft::std_chrono_hrc_stopwatch                   stopwatch_t;
+typedef stopwatch_t::interval_type                          interval_t;
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * constants
+ */
+
+namespace {
+
+    const std::size_t NUM_ITERATIONS    =   100;
+    const std::size_t NUM_WARM_LOOPS    =   2;
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function declarations
+ */
+
+namespace {
+
+    std::uint64_t
+    drain_from_front_by_pop_front(
+        char const*     function_name
+    ,   std::int32_t    flags
+    ,   std::size_t     num_elements
+    ,   std::size_t     num_iterations
+    ,   std::size_t     num_warm_loops
+    );
+
+    std::uint64_t
+    drain_from_front_by_pop_from_front_n(
+        char const*     function_name
+    ,   std::int32_t    flags
+    ,   std::size_t     num_elements
+    ,   std::size_t     num_iterations
+    ,   std::size_t     num_warm_loops
+    );
+
+    std::uint64_t
+    drain_from_back_by_pop_back(
+        char const*     function_name
+    ,   std::int32_t    flags
+    ,   std::size_t     num_elements
+    ,   std::size_t     num_iterations
+    ,   std::size_t     num_warm_loops
+    );
+
+    std::uint64_t
+    run_as_work_queue(
+        char const*     function_name
+    ,   std::int32_t    flags
+    ,   std::size_t     num_elements
+    ,   std::size_t     num_iterations
+    ,   std::size_t     num_warm_loops
+    );
+
+    std::uint64_t
+    push_back_into_large_vec(
+        char const*                             function_name
+    ,   collect_c_vec_growth_policy_t const*    policy
+    ,   std::size_t                             num_elements
+    ,   std::size_t                             num_iterations
+    ,   std::size_t                             num_warm_loops
+    );
+
+    std::uint64_t
+    random_access_large_vec(
+        char const*     function_name
+    ,   std::int32_t    flags
+    ,   std::size_t     num_elements
+    ,   std::size_t     num_accesses
+    ,   std::size_t     num_iterations
+    ,   std::size_t     num_warm_loops
+    );
+
+    std::uint64_t
+    build_small_vec(
+        char const*     function_name
+    ,   bool            on_stack
+    ,   std::size_t     num_elements
+    ,   std::size_t     num_iterations
+    ,   std::size_t     num_warm_loops
+    );
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions
+ */
+
+namespace {
+
+template <ss_typename_param_k T_integer>
+std::string
+thousands(
+    T_integer const& v
+)
+{
+    char    dest[41];
+    size_t  n = stlsoft::format_thousands(dest, std::size(dest), "3;0", v);
+
+    // NOTE: unfortunately `stlsoft::format_thousands()` return includes 1 for NUL terminator
+
+    return std::string(dest, n - 1);
+}
+
+void
+display_results_title(
+)
+{
+    std::cout
+        << '\t'
+        << std::setw(64) << std::left << "function name"
+        << '\t'
+        << std::setw(16) << std::right << "#iterations"
+        << '\t'
+        << std::setw(12) << std::right << "#actions"
+        << '\t'
+        << std::setw(16) << std::right << "tm (ns)"
+        << '\t'
+        << std::setw(12) << std::right << "tm/iter (ns)"
+        << '\t'
+        << std::setw(16) << std::right << "anchor (⚓)"
+        << std::endl
+        ;
+}
+
+void
+display_results(
+    char const*     function_name
+,   std::size_t     num_iterations
+,   std::size_t     num_actions
+,   interval_t      tm_ns
+,   std::uint64_t   anchor_value
+)
+{
+    ((void)&num_iterations);
+    ((void)&tm_ns);
+
+    std::cout
+        << '\t'
+        << std::setw(64) << std::left << function_name
+        << '\t'
+        << std::setw(16) << std::right << num_iterations
+        << '\t'
+        << std::setw(12) << std::right << num_actions
+        << '\t'
+        << std::setw(16) << std::right << thousands(tm_ns)
+        << '\t'
+        << std::setw(12) << std::right << thousands(tm_ns / (num_iterations * num_actions))
+        << '\t'
+        << std::setw(16) << std::right << anchor_value
+        << std::endl
+        ;
+}
+
+/* Populates the vector with the values [0, num_elements). */
+int
+populate_vec(
+    collect_c_vec_t*    v
+,   std::size_t         num_elements
+)
+{
+    for (std::size_t i = 0; num_elements != i; ++i)
+    {
+        int const   value   =   static_cast<int>(i);
+        int const   r       =   collect_c_v_push_back_by_ref(v, &value);
+
+        if (0 != r)
+        {
+            return r;
+        }
+    }
+
+    return 0;
+}
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char* /*argv*/[])
+{
+    std::uint64_t anchor_value = 0;
+
+    display_results_title();
+
+    /* draining a vector from the front, with base-offset optimisation
+     * (which advances the offset) and without (which moves the remaining
+     * elements down, as would a plain memmove-based vector)
+     */
+
+    anchor_value += drain_from_front_by_pop_front("drain_from_front_by_pop_front_of_10000", 0, 10000, NUM_ITERATIONS, NUM_WARM_LOOPS);
+    anchor_value += drain_from_front_by_pop_front("drain_from_front_by_pop_front_of_10000_NO_BOO", CLC_V_F_NO_BOO, 10000, NUM_ITERATIONS, NUM_WARM_LOOPS);
+    anchor_value += drain_from_front_by_pop_from_front_n("drain_from_front_by_pop_from_front_n_of_10000", 0, 10000, NUM_ITERATIONS, NUM_WARM_LOOPS);
+    anchor_value += drain_from_front_by_pop_from_front_n("drain_from_front_by_pop_from_front_n_of_10000_NO_BOO", CLC_V_F_NO_BOO, 10000, NUM_ITERATIONS, NUM_WARM_LOOPS);
+    anchor_value += drain_from_back_by_pop_back("drain_from_back_by_pop_back_of_10000", 0, 10000, NUM_ITERATIONS, NUM_WARM_LOOPS);
+    anchor_value += drain_from_back_by_pop_back("drain_from_back_by_pop_back_of_10000_NO_BOO", CLC_V_F_NO_BOO, 10000, NUM_ITERATIONS, NUM_WARM_LOOPS);
+
+    /* a steady-state work queue, pushing to the back and popping from the
+     * front
+     */
+
+    anchor_value += run_as_work_queue("run_as_work_queue_of_1000", 0, 1000, NUM_ITERATIONS, NUM_WARM_LOOPS);
+    anchor_value += run_as_work_queue("run_as_work_queue_of_1000_NO_BOO", CLC_V_F_NO_BOO, 1000, NUM_ITERATIONS, NUM_WARM_LOOPS);
+
+    /* growing a large vector, with storage from the virtual memory layer
+     * (grown by remapping) and from the heap
+     */
+
+    {
+        collect_c_vec_growth_policy_t const policy_no_vm =
+        {
+            .factor_numerator   =   3,
+            .factor_denominator =   2,
+            .min_step           =   4,
+            .round_to_bytes     =   0,
+            .front_divisor      =   4,
+            .vm_threshold       =   0,
+        };
+
+        anchor_value += push_back_into_large_vec("push_back_into_large_vec_of_50000000", NULL, 50000000, NUM_ITERATIONS / 20, NUM_WARM_LOOPS);
+        anchor_value += push_back_into_large_vec("push_back_into_large_vec_of_50000000_NO_VM", &policy_no_vm, 50000000, NUM_ITERATIONS / 20, NUM_WARM_LOOPS);
+    }
+
+    /* random reads from a large (256MB) vector, with and without
+     * (transparent) huge pages, where the difference is in TLB misses
+     */
+
+    anchor_value += random_access_large_vec("random_access_large_vec_of_67108864", 0, 67108864, 10000000, NUM_ITERATIONS / 20, NUM_WARM_LOOPS);
+    anchor_value += random_access_large_vec("random_access_large_vec_of_67108864_HUGE_PAGES", CLC_V_F_USE_HUGE_PAGES, 67108864, 10000000, NUM_ITERATIONS / 20, NUM_WARM_LOOPS);
+
+    /* building short-lived small vectors, on the heap and in a stack array
+     * that spills to the heap only when full
+     */
+
+    anchor_value += build_small_vec("build_small_vec_of_10", false, 10, NUM_ITERATIONS * 10000, NUM_WARM_LOOPS);
+    anchor_value += build_small_vec("build_small_vec_of_10_ON_STACK_WITH_SPILL", true, 10, NUM_ITERATIONS * 10000, NUM_WARM_LOOPS);
+    anchor_value += build_small_vec("build_small_vec_of_40", false, 40, NUM_ITERATIONS * 10000, NUM_WARM_LOOPS);
+    anchor_value += build_small_vec("build_small_vec_of_40_ON_STACK_WITH_SPILL", true, 40, NUM_ITERATIONS * 10000, NUM_WARM_LOOPS);
+
+    return (0 == argc && 0 == anchor_value) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace {
+
+    std::uint64_t
+    drain_from_front_by_pop_front(
+        char const*     function_name
+    ,   std::int32_t    flags
+    ,   std::size_t     num_elements
+    ,   std::size_t     num_iterations
+    ,   std::size_t     num_warm_loops
+    )
+    {
+        std::uint64_t anchor_value = 0;
+
+        {
+            stopwatch_t sw;
+
+            for (std::size_t w = num_warm_loops; 0 != w; --w)
+            {
+                interval_t tm_ns = 0;
+
+                anchor_value = 0;
+
+                sw.start();
+                for (std::size_t i = 0; num_iterations != i; ++i)
+                {
+                    CLC_V_define_empty(int, v);
+
+                    v.flags = flags;
+
+                    if (0 == collect_c_vec_allocate_storage(&v, num_elements) &&
+                        0 == populate_vec(&v, num_elements))
+                    {
+                        while (0 != v.size)
+                        {
+                            anchor_value += static_cast<int const*>(v.storage)[v.offset];
+
+                            collect_c_v_pop_from_front_n(&v, 1, NULL);
+                        }
+                    }
+
+                    if (NULL != v.storage)
+                    {
+                        collect_c_vec_free_storage(&v);
+                    }
+                }
+                sw.stop();
+
+                tm_ns = sw.get_nanoseconds();
+
+                if (1 == w)
+                {
+                    display_results(function_name, num_iterations, num_elements, tm_ns, anchor_value);
+                }
+            }
+        }
+
+        return anchor_value;
+    }
+
+    std::uint64_t
+    drain_from_front_by_pop_from_front_n(
+        char const*     function_name
+    ,   std::int32_t    flags
+    ,   std::size_t     num_elements
+    ,   std::size_t     num_iterations
+    ,   std::size_t     num_warm_loops
+    )
+    {
+        std::uint64_t anchor_value = 0;
+
+        {
+            stopwatch_t sw;
+
+            for (std::size_t w = num_warm_loops; 0 != w; --w)
+            {
+                interval_t tm_ns = 0;
+
+                anchor_value = 0;
+
+                sw.start();
+                for (std::size_t i = 0; num_iterations != i; ++i)
+                {
+                    CLC_V_define_empty(int, v);
+
+                    v.flags = flags;
+
+                    if (0 == collect_c_vec_allocate_storage(&v, num_elements) &&
+                        0 == populate_vec(&v, num_elements))
+                    {
+                        while (0 != v.size)
+                        {
+                            size_t num_dropped;
+
+                            anchor_value += static_cast<int const*>(v.storage)[v.offset];
+
+                            collect_c_v_pop_from_front_n(&v, 10, &num_dropped);
+                        }
+                    }
+
+                    if (NULL != v.storage)
+                    {
+                        collect_c_vec_free_storage(&v);
+                    }
+                }
+                sw.stop();
+
+                tm_ns = sw.get_nanoseconds();
+
+                if (1 == w)
+                {
+                    display_results(function_name, num_iterations, num_elements, tm_ns, anchor_value);
+                }
+            }
+        }
+
+        return anchor_value;
+    }
+
+    std::uint64_t
+    drain_from_back_by_pop_back(
+        char const*     function_name
+    ,   std::int32_t    flags
+    ,   std::size_t     num_elements
+    ,   std::size_t     num_iterations
+    ,   std::size_t     num_warm_loops
+    )
+    {
+        std::uint64_t anchor_value = 0;
+
+        {
+            stopwatch_t sw;
+
+            for (std::size_t w = num_warm_loops; 0 != w; --w)
+            {
+                interval_t tm_ns = 0;
+
+                anchor_value = 0;
+
+                sw.start();
+                for (std::size_t i = 0; num_iterations != i; ++i)
+                {
+                    CLC_V_define_empty(int, v);
+
+                    v.flags = flags;
+
+                    if (0 == collect_c_vec_allocate_storage(&v, num_elements) &&
+                        0 == populate_vec(&v, num_elements))
+                    {
+                        while (0 != v.size)
+                        {
+                            anchor_value += static_cast<int const*>(v.storage)[v.offset + v.size - 1];
+
+                            collect_c_v_pop_from_back_n(&v, 1, NULL);
+                        }
+                    }
+
+                    if (NULL != v.storage)
+                    {
+                        collect_c_vec_free_storage(&v);
+                    }
+                }
+                sw.stop();
+
+                tm_ns = sw.get_nanoseconds();
+
+                if (1 == w)
+                {
+                    display_results(function_name, num_iterations, num_elements, tm_ns, anchor_value);
+                }
+            }
+        }
+
+        return anchor_value;
+    }
+
+    std::uint64_t
+    run_as_work_queue(
+        char const*     function_name
+    ,   std::int32_t    flags
+    ,   std::size_t     num_elements
+    ,   std::size_t     num_iterations
+    ,   std::size_t     num_warm_loops
+    )
+    {
+        std::uint64_t anchor_value = 0;
+
+        {
+            stopwatch_t sw;
+
+            for (std::size_t w = num_warm_loops; 0 != w; --w)
+            {
+                interval_t tm_ns = 0;
+
+                anchor_value = 0;
+
+                sw.start();
+                for (std::size_t i = 0; num_iterations != i; ++i)
+                {
+                    CLC_V_define_empty(int, v);
+
+                    v.flags = flags;
+
+                    if (0 == collect_c_vec_allocate_storage(&v, num_elements) &&
+                        0 == populate_vec(&v, num_elements))
+                    {
+                        for (std::size_t j = 0; 100000 != j; ++j)
+                        {
+                            int const value = static_cast<int>(j);
+
+                            anchor_value += static_cast<int const*>(v.storage)[v.offset];
+
+                            collect_c_v_pop_from_front_n(&v, 1, NULL);
+                            collect_c_v_push_back_by_ref(&v, &value);
+                        }
+                    }
+
+                    if (NULL != v.storage)
+                    {
+                        collect_c_vec_free_storage(&v);
+                    }
+                }
+                sw.stop();
+
+                tm_ns = sw.get_nanoseconds();
+
+                if (1 == w)
+                {
+                    display_results(function_name, num_iterations, 100000, tm_ns, anchor_value);
+                }
+            }
+        }
+
+        return anchor_value;
+    }
+
+    std::uint64_t
+    push_back_into_large_vec(
+        char const*                             function_name
+    ,   collect_c_vec_growth_policy_t const*    policy
+    ,   std::size_t                             num_elements
+    ,   std::size_t                             num_iterations
+    ,   std::size_t                             num_warm_loops
+    )
+    {
+        std::uint64_t anchor_value = 0;
+
+        {
+            stopwatch_t sw;
+
+            for (std::size_t w = num_warm_loops; 0 != w; --w)
+            {
+                interval_t tm_ns = 0;
+
+                anchor_value = 0;
+
+                sw.start();
+                for (std::size_t i = 0; num_iterations != i; ++i)
+                {
+                    CLC_V_define_empty(int, v);
+
+                    v.growth_policy = policy;
+
+                    if (0 == collect_c_vec_allocate_storage(&v, 16) &&
+                        0 == populate_vec(&v, num_elements))
+                    {
+                        anchor_value += v.size;
+                    }
+
+                    if (NULL != v.storage)
+                    {
+                        collect_c_vec_free_storage(&v);
+                    }
+                }
+                sw.stop();
+
+                tm_ns = sw.get_nanoseconds();
+
+                if (1 == w)
+                {
+                    display_results(function_name, num_iterations, num_elements, tm_ns, anchor_value);
+                }
+            }
+        }
+
+        return anchor_value;
+    }
+
+    std::uint64_t
+    random_access_large_vec(
+        char const*     function_name
+    ,   std::int32_t    flags
+    ,   std::size_t     num_elements
+    ,   std::size_t     num_accesses
+    ,   std::size_t     num_iterations
+    ,   std::size_t     num_warm_loops
+    )
+    {
+        std::uint64_t anchor_value = 0;
+
+        CLC_V_define_empty(int, v);
+
+        v.flags = flags;
+
+        if (0 != collect_c_vec_allocate_storage(&v, num_elements) ||
+            0 != populate_vec(&v, num_elements))
+        {
+            collect_c_vec_free_storage(&v);
+
+            return 0;
+        }
+
+        {
+            stopwatch_t sw;
+
+            for (std::size_t w = num_warm_loops; 0 != w; --w)
+            {
+                interval_t tm_ns = 0;
+
+                anchor_value = 0;
+
+                sw.start();
+                for (std::size_t i = 0; num_iterations != i; ++i)
+                {
+                    int const*      els     =   static_cast<int const*>(v.storage) + v.offset;
+                    std::uint64_t   state   =   i;
+
+                    for (std::size_t j = 0; num_accesses != j; ++j)
+                    {
+                        /* LCG (from Knuth's MMIX) */
+                        state = state * 6364136223846793005u + 1442695040888963407u;
+
+                        anchor_value += static_cast<std::uint64_t>(els[(state >> 32) % num_elements]);
+                    }
+                }
+                sw.stop();
+
+                tm_ns = sw.get_nanoseconds();
+
+                if (1 == w)
+                {
+                    display_results(function_name, num_iterations, num_accesses, tm_ns, anchor_value);
+                }
+            }
+        }
+
+        std::cout
+            << '\t'
+            << "  huge-page bytes: " << thousands(collect_c_vec_huge_page_bytes(&v))
+            << " of " << thousands(v.capacity * v.el_size)
+            << std::endl
+            ;
+
+        collect_c_vec_free_storage(&v);
+
+        return anchor_value;
+    }
+
+    std::uint64_t
+    build_small_vec(
+        char const*     function_name
+    ,   bool            on_stack
+    ,   std::size_t     num_elements
+    ,   std::size_t     num_iterations
+    ,   std::size_t     num_warm_loops
+    )
+    {
+        std::uint64_t anchor_value = 0;
+
+        {
+            stopwatch_t sw;
+
+            for (std::size_t w = num_warm_loops; 0 != w; --w)
+            {
+                interval_t tm_ns = 0;
+
+                anchor_value = 0;
+
+                sw.start();
+                for (std::size_t i = 0; num_iterations != i; ++i)
+                {
+                    int array[16];
+
+                    CLC_V_define_on_stack_with_spill(v, array);
+
+                    if (!on_stack)
+                    {
+                        v.flags     =   0;
+                        v.capacity  =   0;
+                        v.storage   =   NULL;
+
+                        if (0 != collect_c_vec_allocate_storage(&v, 16))
+                        {
+                            continue;
+                        }
+                    }
+
+                    if (0 == populate_vec(&v, num_elements))
+                    {
+                        anchor_value += static_cast<int const*>(v.storage)[v.offset + v.size - 1];
+                    }
+
+                    collect_c_vec_free_storage(&v);
+                }
+                sw.stop();
+
+                tm_ns = sw.get_nanoseconds();
+
+                if (1 == w)
+                {
+                    display_results(function_name, num_iterations, num_elements, tm_ns, anchor_value);
+                }
+            }
+        }
+
+        return anchor_value;
+    }
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,384 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test/unit/test.unit.arena/entry.c
+ *
+ * Purpose: Unit-test for arena allocator.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/terse/arena.h>
+#include <collect-c/terse/circq.h>
+#include <collect-c/terse/dlist.h>
+#include <collect-c/terse/vec.h>
+
+#include <xtests/terse-api.h>
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+static void TEST_define_THEN_free_storage(void);
+static void TEST_allocate_MANY_SMALL(void);
+static void TEST_allocate_LARGER_THAN_CHUNK(void);
+static void TEST_allocate_THEN_reset_THEN_allocate_WITHOUT_NEW_CHUNKS(void);
+static void TEST_mark_THEN_allocate_THEN_rewind(void);
+static void TEST_define_with_backing(void);
+static void TEST_vec_WITH_ARENA_GROWS_IN_PLACE(void);
+static void TEST_dlist_AND_cq_WITH_ARENA_THEN_reset(void);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char* argv[])
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSE_HELP_OR_VERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.arena", verbosity))
+    {
+        XTESTS_RUN_CASE(TEST_define_THEN_free_storage);
+        XTESTS_RUN_CASE(TEST_allocate_MANY_SMALL);
+        XTESTS_RUN_CASE(TEST_allocate_LARGER_THAN_CHUNK);
+        XTESTS_RUN_CASE(TEST_allocate_THEN_reset_THEN_allocate_WITHOUT_NEW_CHUNKS);
+        XTESTS_RUN_CASE(TEST_mark_THEN_allocate_THEN_rewind);
+        XTESTS_RUN_CASE(TEST_define_with_backing);
+        XTESTS_RUN_CASE(TEST_vec_WITH_ARENA_GROWS_IN_PLACE);
+        XTESTS_RUN_CASE(TEST_dlist_AND_cq_WITH_ARENA_THEN_reset);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function definitions
+ */
+
+/* an allocator that counts its invocations, and the bytes outstanding, so
+ * that the sizes passed to it may be verified
+ */
+struct counting_allocator_context_t
+{
+    size_t  num_allocs;
+    size_t  num_frees;
+    size_t  cb_outstanding;
+};
+typedef struct counting_allocator_context_t counting_allocator_context_t;
+
+void* fn_counting_alloc(
+    void*   context
+,   size_t  cb
+)
+{
+    counting_allocator_context_t* const ctxt = (counting_allocator_context_t*)context;
+
+    ++ctxt->num_allocs;
+    ctxt->cb_outstanding += cb;
+
+    return malloc(cb);
+}
+
+void fn_counting_free(
+    void*   context
+,   void*   p
+,   size_t  cb
+)
+{
+    counting_allocator_context_t* const ctxt = (counting_allocator_context_t*)context;
+
+    ++ctxt->num_frees;
+    ctxt->cb_outstanding -= cb;
+
+    free(p);
+}
+
+
+static void TEST_define_THEN_free_storage(void)
+{
+    CLC_AR_define(a, 0);
+
+    TEST_INT_EQ(0, CLC_AR_num_chunks(a));
+    TEST_INT_EQ(0, a.cb_chunks);
+    TEST_PTR_EQ(&a, CLC_AR_allocator(a)->context);
+
+    clc_ar_free_storage(&a);
+
+    TEST_INT_EQ(0, CLC_AR_num_chunks(a));
+}
+
+static void TEST_allocate_MANY_SMALL(void)
+{
+    CLC_AR_define(a, 1024);
+
+    unsigned char* blocks[1000];
+
+    for (size_t i = 0; 1000 != i; ++i)
+    {
+        size_t const cb = 1 + (i % 37);
+
+        blocks[i] = (unsigned char*)clc_ar_allocate(&a, cb);
+
+        TEST_PTR_NE(NULL, blocks[i]);
+        TEST_INT_EQ(0, ((uintptr_t)blocks[i]) % _Alignof(max_align_t));
+
+        memset(blocks[i], (int)(i & 0xff), cb);
+    }
+
+    TEST_INT_GE(2, CLC_AR_num_chunks(a));
+
+    for (size_t i = 0; 1000 != i; ++i)
+    {
+        size_t const cb = 1 + (i % 37);
+
+        for (size_t j = 0; cb != j; ++j)
+        {
+            TEST_INT_EQ((int)(i & 0xff), blocks[i][j]);
+        }
+    }
+
+    clc_ar_free_storage(&a);
+
+    TEST_INT_EQ(0, CLC_AR_num_chunks(a));
+}
+
+static void TEST_allocate_LARGER_THAN_CHUNK(void)
+{
+    CLC_AR_define(a, 256);
+
+    void* const p1 = clc_ar_allocate(&a, 16);
+    void* const p2 = clc_ar_allocate(&a, 10000);
+    void* const p3 = clc_ar_allocate(&a, 16);
+
+    TEST_PTR_NE(NULL, p1);
+    TEST_PTR_NE(NULL, p2);
+    TEST_PTR_NE(NULL, p3);
+
+    /* the large block is given a chunk of its own */
+
+    TEST_INT_EQ(3, CLC_AR_num_chunks(a));
+    TEST_INT_GE(10000 + 2 * 256, a.cb_chunks);
+
+    memset(p2, 0xcc, 10000);
+
+    clc_ar_free_storage(&a);
+}
+
+static void TEST_allocate_THEN_reset_THEN_allocate_WITHOUT_NEW_CHUNKS(void)
+{
+    CLC_AR_define(a, 512);
+
+    void* p_first = NULL;
+
+    for (int i = 0; 100 != i; ++i)
+    {
+        void* const p = clc_ar_allocate(&a, 40);
+
+        if (0 == i)
+        {
+            p_first = p;
+        }
+    }
+
+    {
+        size_t const num_chunks = CLC_AR_num_chunks(a);
+
+        TEST_INT_GE(2, num_chunks);
+
+        for (int n = 0; 3 != n; ++n)
+        {
+            clc_ar_reset(&a);
+
+            TEST_PTR_EQ(p_first, clc_ar_allocate(&a, 40));
+
+            for (int i = 1; 100 != i; ++i)
+            {
+                TEST_PTR_NE(NULL, clc_ar_allocate(&a, 40));
+            }
+
+            TEST_INT_EQ(num_chunks, CLC_AR_num_chunks(a));
+        }
+
+        /* a block too large for the (retained) first chunk */
+
+        clc_ar_reset(&a);
+
+        TEST_PTR_NE(NULL, clc_ar_allocate(&a, 4096));
+        TEST_INT_EQ(num_chunks + 1, CLC_AR_num_chunks(a));
+    }
+
+    clc_ar_free_storage(&a);
+}
+
+static void TEST_mark_THEN_allocate_THEN_rewind(void)
+{
+    CLC_AR_define(a, 256);
+
+    void* const p1 = clc_ar_allocate(&a, 32);
+
+    TEST_PTR_NE(NULL, p1);
+
+    {
+        collect_c_arena_mark_t const    mark    =   clc_ar_mark(&a);
+        void* const                     p2      =   clc_ar_allocate(&a, 32);
+
+        for (int i = 0; 50 != i; ++i)
+        {
+            clc_ar_allocate(&a, 64);
+        }
+
+        TEST_INT_GE(2, CLC_AR_num_chunks(a));
+
+        clc_ar_rewind(&a, mark);
+
+        TEST_PTR_EQ(p2, clc_ar_allocate(&a, 32));
+    }
+
+    /* a mark taken from an empty arena equates to reset */
+    {
+        void* p_first;
+
+        clc_ar_reset(&a);
+
+        {
+            collect_c_arena_mark_t const mark = clc_ar_mark(&a);
+
+            p_first = clc_ar_allocate(&a, 8);
+
+            clc_ar_allocate(&a, 8);
+
+            clc_ar_rewind(&a, mark);
+        }
+
+        TEST_PTR_EQ(p_first, clc_ar_allocate(&a, 8));
+    }
+
+    clc_ar_free_storage(&a);
+}
+
+static void TEST_define_with_backing(void)
+{
+    counting_allocator_context_t    ctxt        =   { 0 };
+    collect_c_allocator_t const     backing     =   { &fn_counting_alloc, NULL, &fn_counting_free, &ctxt };
+
+    {
+        CLC_AR_define_with_backing(a, 1000, &backing);
+
+        for (int i = 0; 100 != i; ++i)
+        {
+            TEST_PTR_NE(NULL, clc_ar_allocate(&a, 100));
+        }
+
+        TEST_INT_EQ(CLC_AR_num_chunks(a), ctxt.num_allocs);
+        TEST_INT_LE(ctxt.cb_outstanding, a.cb_chunks);
+
+        clc_ar_free_storage(&a);
+
+        TEST_INT_EQ(ctxt.num_allocs, ctxt.num_frees);
+        TEST_INT_EQ(0, ctxt.cb_outstanding);
+    }
+}
+
+static void TEST_vec_WITH_ARENA_GROWS_IN_PLACE(void)
+{
+    CLC_AR_define(a, 64 * 1024);
+
+    {
+        CLC_V_define_empty_with_allocator(int, v, CLC_AR_allocator(a));
+
+        TEST_INT_EQ(0, collect_c_vec_allocate_storage(&v, 4));
+
+        {
+            void* const storage = v.storage;
+
+            for (int i = 0; 1000 != i; ++i)
+            {
+                TEST_INT_EQ(0, CLC_V_push_back_by_ref(v, &i));
+            }
+
+            TEST_INT_EQ(1000, CLC_V_len(v));
+            TEST_PTR_EQ(storage, v.storage);
+            TEST_INT_EQ(1, CLC_AR_num_chunks(a));
+
+            for (size_t i = 0; 1000 != i; ++i)
+            {
+                TEST_INT_EQ(i, *CLC_V_cat_t(v, int, i));
+            }
+        }
+
+        /* storage is released with the arena, so free_storage is not called */
+    }
+
+    clc_ar_reset(&a);
+
+    clc_ar_free_storage(&a);
+}
+
+static void TEST_dlist_AND_cq_WITH_ARENA_THEN_reset(void)
+{
+    CLC_AR_define(a, 4096);
+
+    size_t num_chunks = 0;
+
+    for (int n = 0; 3 != n; ++n)
+    {
+        CLC_DL_define_empty_with_allocator(int, l, CLC_AR_allocator(a));
+        CLC_CQ_define_empty_with_allocator(int, q, 64, CLC_AR_allocator(a));
+
+        TEST_INT_EQ(0, clc_cq_allocate_storage(&q));
+
+        for (int i = 0; 200 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_DL_push_back_by_val(l, int, i));
+            TEST_INT_EQ(0, CLC_CQ_push_back_by_ref(q, &i));
+
+            if (64 == CLC_CQ_len(q))
+            {
+                CLC_CQ_pop_front(q);
+            }
+        }
+
+        TEST_INT_EQ(200, CLC_DL_len(l));
+        TEST_INT_EQ(0, *CLC_DL_cfront_t(l, int));
+        TEST_INT_EQ(199, *CC_CQ_cback_t(q, int));
+
+        if (0 == n)
+        {
+            num_chunks = CLC_AR_num_chunks(a);
+        }
+        else
+        {
+            TEST_INT_EQ(num_chunks, CLC_AR_num_chunks(a));
+        }
+
+        /* both containers are released wholesale */
+
+        clc_ar_reset(&a);
+    }
+
+    clc_ar_free_storage(&a);
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
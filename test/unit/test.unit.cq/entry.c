@@ -4,7 +4,7 @@
  * Purpose: Unit-test for circular queue.
  *
  * Created: 5th February 2025
- * Updated: 10th February 2025
+ * Updated: 18th October 2026
  *
  * ////////////////////////////////////////////////////////////////////// */
 
@@ -19,6 +19,7 @@
 
 #include <errno.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 
 
@@ -45,6 +46,10 @@ static void TEST_STACK_AND_collect_c_cq_push_back_n_by_ref_WITH_OVERWRITE(void);
 static void TEST_HEAP_AND_push_by_ref_WITHOUT_WRAP(void);
 static void TEST_HEAP_AND_CALLBACK_INDEXES_1(void);
 static void TEST_HEAP_AND_CALLBACK_INDEXES_2(void);
+static void TEST_HEAP_WITH_F_USE_HUGE_PAGES(void);
+static void TEST_HEAP_WITH_ALLOCATOR(void);
+static void TEST_STACK_AND_find_AND_count_WHEN_WRAPPED(void);
+static void TEST_HEAP_AND_find_AND_count_WHEN_WRAPPED(void);
 
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -79,6 +84,10 @@ int main(int argc, char* argv[])
         XTESTS_RUN_CASE(TEST_HEAP_AND_push_by_ref_WITHOUT_WRAP);
         XTESTS_RUN_CASE(TEST_HEAP_AND_CALLBACK_INDEXES_1);
         XTESTS_RUN_CASE(TEST_HEAP_AND_CALLBACK_INDEXES_2);
+        XTESTS_RUN_CASE(TEST_HEAP_WITH_F_USE_HUGE_PAGES);
+        XTESTS_RUN_CASE(TEST_HEAP_WITH_ALLOCATOR);
+        XTESTS_RUN_CASE(TEST_STACK_AND_find_AND_count_WHEN_WRAPPED);
+        XTESTS_RUN_CASE(TEST_HEAP_AND_find_AND_count_WHEN_WRAPPED);
 
         XTESTS_PRINT_RESULTS();
 
@@ -101,6 +110,61 @@ struct custom_t
 };
 typedef struct custom_t custom_t;
 
+/* an allocator that counts its invocations, and the bytes outstanding, so
+ * that the sizes passed to it may be verified
+ */
+struct counting_allocator_context_t
+{
+    size_t  num_allocs;
+    size_t  num_reallocs;
+    size_t  num_frees;
+    size_t  cb_outstanding;
+};
+typedef struct counting_allocator_context_t counting_allocator_context_t;
+
+void* fn_counting_alloc(
+    void*   context
+,   size_t  cb
+)
+{
+    counting_allocator_context_t* const ctxt = (counting_allocator_context_t*)context;
+
+    ++ctxt->num_allocs;
+    ctxt->cb_outstanding += cb;
+
+    return malloc(cb);
+}
+
+void* fn_counting_realloc(
+    void*   context
+,   void*   p
+,   size_t  cb_old
+,   size_t  cb_new
+)
+{
+    counting_allocator_context_t* const ctxt = (counting_allocator_context_t*)context;
+
+    ++ctxt->num_reallocs;
+    ctxt->cb_outstanding -= cb_old;
+    ctxt->cb_outstanding += cb_new;
+
+    return realloc(p, cb_new);
+}
+
+void fn_counting_free(
+    void*   context
+,   void*   p
+,   size_t  cb
+)
+{
+    counting_allocator_context_t* const ctxt = (counting_allocator_context_t*)context;
+
+    ++ctxt->num_frees;
+    ctxt->cb_outstanding -= cb;
+
+    free(p);
+}
+
 
 static void fn_element_free_accumulate_on_free(
     size_t      el_size
@@ -1778,5 +1842,166 @@ static void TEST_HEAP_AND_CALLBACK_INDEXES_2(void)
 }
 
 
+static void TEST_HEAP_WITH_F_USE_HUGE_PAGES(void)
+{
+    {
+        CLC_CQ_define_empty(int, q, 1024 * 1024);
+
+        q.flags |= CLC_CQ_F_USE_HUGE_PAGES;
+
+        int const r = clc_cq_allocate_storage(&q);
+
+        TEST_INTEGER_EQUAL_ANY_OF2(0, ENOMEM, r);
+
+        if (0 == r)
+        {
+#if defined(__linux__)
+
+            TEST_INT_NE(0, (CLC_CQ_F_VM_STORAGE & q.flags));
+            TEST_INT_EQ(0, ((uintptr_t)q.storage) % (2 * 1024 * 1024));
+#endif
+
+            for (int i = 0; 1024 * 1024 != i; ++i)
+            {
+                TEST_INT_EQ(0, CLC_CQ_push_back_by_ref(q, &i));
+            }
+
+            TEST_INT_EQ(0, CLC_CQ_pop_front(q));
+            TEST_INT_EQ(0, CLC_CQ_push_back_by_value(q, int, -1));
+
+            TEST_INT_EQ(1024 * 1024, CLC_CQ_len(q));
+            TEST_INT_EQ(1, *CLC_CQ_cat_t(q, int, 0));
+            TEST_INT_EQ(-1, *CLC_CQ_cat_t(q, int, 1024 * 1024 - 1));
+
+            /* whether any huge pages are obtained is up to the system, but
+             * none are counted beyond the storage
+             */
+            TEST_INT_EQ(0, collect_c_cq_huge_page_bytes(&q) % (2 * 1024 * 1024));
+            TEST_INT_LE(q.capacity * sizeof(int), collect_c_cq_huge_page_bytes(&q));
+
+            clc_cq_free_storage(&q);
+
+            TEST_INT_EQ(0, (CLC_CQ_F_VM_STORAGE & q.flags));
+        }
+    }
+}
+
+static void TEST_HEAP_WITH_ALLOCATOR(void)
+{
+    counting_allocator_context_t    ctxt        =   { 0 };
+    collect_c_allocator_t const     allocator   =   { &fn_counting_alloc, NULL, &fn_counting_free, &ctxt };
+
+    {
+        CLC_CQ_define_empty_with_allocator(int, q, 32, &allocator);
+
+        TEST_INT_EQ(0, clc_cq_allocate_storage(&q));
+        TEST_INT_EQ(1, ctxt.num_allocs);
+        TEST_INT_EQ(32 * sizeof(int), ctxt.cb_outstanding);
+
+        for (int i = 0; 10 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_CQ_push_back_by_ref(q, &i));
+        }
+
+        TEST_INT_EQ(10, CLC_CQ_len(q));
+        TEST_INT_EQ(9, *CLC_CQ_cat_t(q, int, 9));
+
+        clc_cq_free_storage(&q);
+
+        TEST_INT_EQ(1, ctxt.num_frees);
+        TEST_INT_EQ(0, ctxt.cb_outstanding);
+    }
+}
+
+static void TEST_STACK_AND_find_AND_count_WHEN_WRAPPED(void)
+{
+    int ar[8];
+
+    CLC_CQ_define_on_stack(q, ar);
+
+    size_t ix = 0;
+
+    TEST_INT_EQ(ENOENT, clc_cq_find_by_ref(&q, &ix, &ix));
+    TEST_INT_EQ(0, CLC_CQ_count_by_value(q, int, 0));
+
+    for (int i = 0; 8 != i; ++i)
+    {
+        TEST_INT_EQ(0, CLC_CQ_push_back_by_value(q, int, i));
+    }
+
+    /* drop 0-6, leaving 7 at the end of the storage, and wrap 8-14 */
+
+    TEST_INT_EQ(0, clc_cq_pop_from_front_n(&q, 7, NULL));
+
+    for (int i = 8; 15 != i; ++i)
+    {
+        TEST_INT_EQ(0, CLC_CQ_push_back_by_value(q, int, i));
+    }
+
+    TEST_INT_EQ(8, CLC_CQ_len(q));
+
+    TEST_INT_EQ(0, CLC_CQ_find_by_value(q, int, 7, &ix));
+    TEST_INT_EQ(0, ix);
+    TEST_INT_EQ(0, CLC_CQ_find_by_value(q, int, 8, &ix));
+    TEST_INT_EQ(1, ix);
+    TEST_INT_EQ(0, CLC_CQ_find_by_value(q, int, 14, &ix));
+    TEST_INT_EQ(7, ix);
+
+    /* the dropped elements are no longer found, even though 7 is retained
+     * in the storage
+     */
+
+    TEST_INT_EQ(0, CLC_CQ_pop_front(q));
+
+    TEST_BOOLEAN_FALSE(CLC_CQ_contains_by_value(q, int, 7));
+    TEST_BOOLEAN_FALSE(CLC_CQ_contains_by_value(q, int, 0));
+    TEST_BOOLEAN_TRUE(CLC_CQ_contains_by_value(q, int, 8));
+
+    TEST_INT_EQ(0, CLC_CQ_push_back_by_value(q, int, 10));
+
+    TEST_INT_EQ(2, CLC_CQ_count_by_value(q, int, 10));
+    TEST_INT_EQ(0, CLC_CQ_find_by_value(q, int, 10, &ix));
+    TEST_INT_EQ(2, ix);
+}
+
+static void TEST_HEAP_AND_find_AND_count_WHEN_WRAPPED(void)
+{
+    CLC_CQ_define_empty(uint64_t, q, 1000);
+
+    size_t ix = 0;
+
+    TEST_INT_EQ(0, clc_cq_allocate_storage(&q));
+
+    for (uint64_t i = 0; 1000 != i; ++i)
+    {
+        TEST_INT_EQ(0, CLC_CQ_push_back_by_ref(q, &i));
+    }
+
+    TEST_INT_EQ(0, clc_cq_pop_from_front_n(&q, 300, NULL));
+
+    for (uint64_t i = 1000; 1300 != i; ++i)
+    {
+        TEST_INT_EQ(0, CLC_CQ_push_back_by_value(q, uint64_t, i % 1100));
+    }
+
+    TEST_BOOLEAN_FALSE(CLC_CQ_contains_by_value(q, uint64_t, 299));
+
+    TEST_INT_EQ(0, CLC_CQ_find_by_value(q, uint64_t, 300, &ix));
+    TEST_INT_EQ(0, ix);
+    TEST_INT_EQ(0, CLC_CQ_find_by_value(q, uint64_t, 999, &ix));
+    TEST_INT_EQ(699, ix);
+    TEST_INT_EQ(0, CLC_CQ_find_by_value(q, uint64_t, 1099, &ix));
+    TEST_INT_EQ(799, ix);
+
+    /* 0-199 are both dropped and then pushed again */
+    TEST_INT_EQ(0, CLC_CQ_find_by_value(q, uint64_t, 0, &ix));
+    TEST_INT_EQ(800, ix);
+    TEST_INT_EQ(1, CLC_CQ_count_by_value(q, uint64_t, 199));
+    TEST_INT_EQ(2, CLC_CQ_count_by_value(q, uint64_t, 300) + CLC_CQ_count_by_value(q, uint64_t, 1000));
+
+    clc_cq_free_storage(&q);
+}
+
+
 /* ///////////////////////////// end of file //////////////////////////// */
 
@@ -0,0 +1,490 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test/unit/test.unit.deque/entry.c
+ *
+ * Purpose: Unit-test for double-ended queue.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/terse/deque.h>
+
+#include <xtests/terse-api.h>
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+static void TEST_define_empty(void);
+static void TEST_push_back_1000_ELEMENTS(void);
+static void TEST_push_front_1000_ELEMENTS(void);
+static void TEST_push_back_AND_push_front_INTERLEAVED(void);
+static void TEST_pointers_ARE_STABLE_ACROSS_PUSH_AND_POP(void);
+static void TEST_pop_from_back_n_AND_pop_from_front_n(void);
+static void TEST_fifo_DOES_NOT_GROW(void);
+static void TEST_erase_at(void);
+static void TEST_clear_AND_free_storage_INVOKE_CALLBACK(void);
+static void TEST_define_empty_with_allocator(void);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char* argv[])
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSE_HELP_OR_VERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.deque", verbosity))
+    {
+        XTESTS_RUN_CASE(TEST_define_empty);
+        XTESTS_RUN_CASE(TEST_push_back_1000_ELEMENTS);
+        XTESTS_RUN_CASE(TEST_push_front_1000_ELEMENTS);
+        XTESTS_RUN_CASE(TEST_push_back_AND_push_front_INTERLEAVED);
+        XTESTS_RUN_CASE(TEST_pointers_ARE_STABLE_ACROSS_PUSH_AND_POP);
+        XTESTS_RUN_CASE(TEST_pop_from_back_n_AND_pop_from_front_n);
+        XTESTS_RUN_CASE(TEST_fifo_DOES_NOT_GROW);
+        XTESTS_RUN_CASE(TEST_erase_at);
+        XTESTS_RUN_CASE(TEST_clear_AND_free_storage_INVOKE_CALLBACK);
+        XTESTS_RUN_CASE(TEST_define_empty_with_allocator);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function definitions
+ */
+
+struct big_t
+{
+    int     value;
+    char    padding[600];
+};
+typedef struct big_t big_t;
+
+/* an allocator that counts its invocations, and the bytes outstanding, so
+ * that the sizes passed to it may be verified
+ */
+struct counting_allocator_context_t
+{
+    size_t  num_allocs;
+    size_t  num_reallocs;
+    size_t  num_frees;
+    size_t  cb_outstanding;
+};
+typedef struct counting_allocator_context_t counting_allocator_context_t;
+
+void* fn_counting_alloc(
+    void*   context
+,   size_t  cb
+)
+{
+    counting_allocator_context_t* const ctxt = (counting_allocator_context_t*)context;
+
+    ++ctxt->num_allocs;
+    ctxt->cb_outstanding += cb;
+
+    return malloc(cb);
+}
+
+void* fn_counting_realloc(
+    void*   context
+,   void*   p
+,   size_t  cb_old
+,   size_t  cb_new
+)
+{
+    counting_allocator_context_t* const ctxt = (counting_allocator_context_t*)context;
+
+    ++ctxt->num_reallocs;
+    ctxt->cb_outstanding -= cb_old;
+    ctxt->cb_outstanding += cb_new;
+
+    return realloc(p, cb_new);
+}
+
+void fn_counting_free(
+    void*   context
+,   void*   p
+,   size_t  cb
+)
+{
+    counting_allocator_context_t* const ctxt = (counting_allocator_context_t*)context;
+
+    ++ctxt->num_frees;
+    ctxt->cb_outstanding -= cb;
+
+    free(p);
+}
+
+void
+fn_accumulate_int(
+    size_t  el_size
+,   size_t  el_index
+,   void*   el_ptr
+,   void*   param_element_free
+)
+{
+    ((void)&el_size);
+    ((void)&el_index);
+
+    *(int*)param_element_free += *(int const*)el_ptr;
+}
+
+/* verifies that the elements are first, first + 1, ... */
+bool
+elements_are_ascending_from(
+    collect_c_deque_t const*    dq
+,   int                         first
+)
+{
+    for (size_t i = 0; dq->size != i; ++i)
+    {
+        if (first + (int)i != *(int const*)clc_dq_at(dq, i))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+static void TEST_define_empty(void)
+{
+    {
+        CLC_DQ_define_empty(int, dq);
+
+        TEST_BOOLEAN_TRUE(CLC_DQ_is_empty(dq));
+        TEST_INT_EQ(0, CLC_DQ_len(dq));
+        TEST_INT_EQ(0, CLC_DQ_num_chunks(dq));
+
+        clc_dq_free_storage(&dq);
+    }
+}
+
+static void TEST_push_back_1000_ELEMENTS(void)
+{
+    {
+        CLC_DQ_define_empty(int, dq);
+
+        for (int i = 0; 1000 != i; ++i)
+        {
+            int const r = CLC_DQ_push_back_by_value(dq, int, i);
+
+            TEST_INTEGER_EQUAL_ANY_OF2(0, ENOMEM, r);
+        }
+
+        if (1000 == CLC_DQ_len(dq))
+        {
+            TEST_BOOLEAN_TRUE(elements_are_ascending_from(&dq, 0));
+
+            TEST_INT_EQ(0, *CLC_DQ_cfront_t(dq, int));
+            TEST_INT_EQ(999, *CLC_DQ_cback_t(dq, int));
+            TEST_INT_EQ(500, *CLC_DQ_cat_t(dq, int, 500));
+
+            TEST_INT_GE(1000 / dq.chunk_capacity, CLC_DQ_num_chunks(dq));
+            TEST_INT_LE(1000 / dq.chunk_capacity + 2, CLC_DQ_num_chunks(dq));
+        }
+
+        clc_dq_free_storage(&dq);
+    }
+}
+
+static void TEST_push_front_1000_ELEMENTS(void)
+{
+    {
+        CLC_DQ_define_empty(int, dq);
+
+        for (int i = 0; 1000 != i; ++i)
+        {
+            int const r = CLC_DQ_push_front_by_value(dq, int, 999 - i);
+
+            TEST_INTEGER_EQUAL_ANY_OF2(0, ENOMEM, r);
+        }
+
+        if (1000 == CLC_DQ_len(dq))
+        {
+            TEST_BOOLEAN_TRUE(elements_are_ascending_from(&dq, 0));
+
+            TEST_INT_EQ(0, *CLC_DQ_cfront_t(dq, int));
+            TEST_INT_EQ(999, *CLC_DQ_cback_t(dq, int));
+        }
+
+        clc_dq_free_storage(&dq);
+    }
+}
+
+static void TEST_push_back_AND_push_front_INTERLEAVED(void)
+{
+    {
+        /* large elements, so that there is only 1 element per chunk */
+        CLC_DQ_define_empty(big_t, dq);
+
+        for (int i = 0; 100 != i; ++i)
+        {
+            big_t const el_b = { .value = +i };
+            big_t const el_f = { .value = -i - 1 };
+
+            TEST_INT_EQ(0, CLC_DQ_push_back_by_ref(dq, &el_b));
+            TEST_INT_EQ(0, CLC_DQ_push_front_by_ref(dq, &el_f));
+        }
+
+        TEST_INT_EQ(1, dq.chunk_capacity);
+        TEST_INT_EQ(200, CLC_DQ_len(dq));
+
+        for (size_t i = 0; 200 != i; ++i)
+        {
+            TEST_INT_EQ((int)i - 100, CLC_DQ_cat_t(dq, big_t, i)->value);
+        }
+
+        clc_dq_free_storage(&dq);
+    }
+}
+
+static void TEST_pointers_ARE_STABLE_ACROSS_PUSH_AND_POP(void)
+{
+    {
+        CLC_DQ_define_empty(int, dq);
+
+        TEST_INT_EQ(0, CLC_DQ_push_back_by_value(dq, int, -1));
+
+        {
+            int const* const p = CLC_DQ_cfront_t(dq, int);
+
+            /* many pushes at both ends, forcing the map to grow */
+            for (int i = 0; 10000 != i; ++i)
+            {
+                TEST_INT_EQ(0, CLC_DQ_push_back_by_value(dq, int, i));
+                TEST_INT_EQ(0, CLC_DQ_push_front_by_value(dq, int, i));
+            }
+
+            TEST_INT_GE(20000 / dq.chunk_capacity, dq.map_capacity);
+
+            TEST_INT_EQ(-1, *p);
+            TEST_PTR_EQ(p, CLC_DQ_cat_t(dq, int, 10000));
+
+            TEST_INT_EQ(0, clc_dq_pop_from_front_n(&dq, 10000, NULL));
+            TEST_INT_EQ(0, clc_dq_pop_from_back_n(&dq, 5000, NULL));
+
+            TEST_INT_EQ(-1, *p);
+            TEST_PTR_EQ(p, CLC_DQ_cfront_t(dq, int));
+        }
+
+        clc_dq_free_storage(&dq);
+    }
+}
+
+static void TEST_pop_from_back_n_AND_pop_from_front_n(void)
+{
+    {
+        int total_freed = 0;
+
+        CLC_DQ_define_empty_with_cb(int, dq, fn_accumulate_int, &total_freed);
+
+        for (int i = 0; 1000 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_DQ_push_back_by_value(dq, int, i));
+        }
+
+        {
+            size_t num_dropped;
+
+            TEST_INT_EQ(0, clc_dq_pop_from_front_n(&dq, 10, &num_dropped));
+            TEST_INT_EQ(10, num_dropped);
+            TEST_INT_EQ(45, total_freed);
+        }
+
+        {
+            size_t num_dropped;
+
+            TEST_INT_EQ(0, clc_dq_pop_from_back_n(&dq, 10, &num_dropped));
+            TEST_INT_EQ(10, num_dropped);
+            TEST_INT_EQ(45 + 9945, total_freed);
+        }
+
+        TEST_INT_EQ(980, CLC_DQ_len(dq));
+        TEST_BOOLEAN_TRUE(elements_are_ascending_from(&dq, 10));
+
+        TEST_INT_EQ(0, CLC_DQ_pop_front(dq));
+        TEST_INT_EQ(0, CLC_DQ_pop_back(dq));
+        TEST_INT_EQ(11, *CLC_DQ_cfront_t(dq, int));
+        TEST_INT_EQ(988, *CLC_DQ_cback_t(dq, int));
+
+        {
+            size_t num_dropped;
+
+            TEST_INT_EQ(0, clc_dq_pop_from_back_n(&dq, 10000, &num_dropped));
+            TEST_INT_EQ(978, num_dropped);
+            TEST_BOOLEAN_TRUE(CLC_DQ_is_empty(dq));
+            TEST_INT_EQ(0, CLC_DQ_num_chunks(dq));
+            TEST_INT_EQ(499500, total_freed);
+        }
+
+        clc_dq_free_storage(&dq);
+    }
+}
+
+static void TEST_fifo_DOES_NOT_GROW(void)
+{
+    {
+        CLC_DQ_define_empty(int, dq);
+
+        for (int i = 0; 100 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_DQ_push_back_by_value(dq, int, i));
+        }
+
+        for (int i = 100; 100000 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_DQ_push_back_by_value(dq, int, i));
+            TEST_INT_EQ(0, CLC_DQ_pop_front(dq));
+        }
+
+        TEST_INT_EQ(100, CLC_DQ_len(dq));
+        TEST_BOOLEAN_TRUE(elements_are_ascending_from(&dq, 99900));
+        TEST_INT_LE(100 / dq.chunk_capacity + 2, CLC_DQ_num_chunks(dq));
+        TEST_INT_EQ(COLLECT_C_DEQUE_DEFAULT_MAP_CAPACITY, dq.map_capacity);
+
+        clc_dq_free_storage(&dq);
+    }
+}
+
+static void TEST_erase_at(void)
+{
+    {
+        int total_freed = 0;
+
+        CLC_DQ_define_empty_with_cb(int, dq, fn_accumulate_int, &total_freed);
+
+        for (int i = 0; 1000 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_DQ_push_back_by_value(dq, int, i));
+        }
+
+        /* near the front, so the front side is moved */
+        TEST_INT_EQ(0, CLC_DQ_erase_at(dq, 10));
+        TEST_INT_EQ(10, total_freed);
+        TEST_INT_EQ(0, *CLC_DQ_cfront_t(dq, int));
+        TEST_INT_EQ(11, *CLC_DQ_cat_t(dq, int, 10));
+
+        /* near the back, so the back side is moved */
+        TEST_INT_EQ(0, CLC_DQ_erase_at(dq, 989));
+        TEST_INT_EQ(10 + 990, total_freed);
+        TEST_INT_EQ(991, *CLC_DQ_cat_t(dq, int, 989));
+        TEST_INT_EQ(999, *CLC_DQ_cback_t(dq, int));
+
+        TEST_INT_EQ(998, CLC_DQ_len(dq));
+
+        {
+            int expected = 0;
+
+            for (size_t i = 0; CLC_DQ_len(dq) != i; ++i, ++expected)
+            {
+                if (10 == expected || 990 == expected)
+                {
+                    ++expected;
+                }
+
+                TEST_INT_EQ(expected, *CLC_DQ_cat_t(dq, int, i));
+            }
+        }
+
+        /* down to empty */
+        for (; !CLC_DQ_is_empty(dq); )
+        {
+            TEST_INT_EQ(0, CLC_DQ_erase_at(dq, CLC_DQ_len(dq) / 2));
+        }
+
+        TEST_INT_EQ(499500, total_freed);
+        TEST_INT_EQ(0, CLC_DQ_num_chunks(dq));
+
+        clc_dq_free_storage(&dq);
+    }
+}
+
+static void TEST_clear_AND_free_storage_INVOKE_CALLBACK(void)
+{
+    {
+        int total_freed = 0;
+
+        CLC_DQ_define_empty_with_cb(int, dq, fn_accumulate_int, &total_freed);
+
+        for (int i = 1; 11 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_DQ_push_front_by_value(dq, int, i));
+        }
+
+        {
+            size_t num_dropped;
+
+            TEST_INT_EQ(0, CLC_DQ_clear(dq, &num_dropped));
+            TEST_INT_EQ(10, num_dropped);
+            TEST_INT_EQ(55, total_freed);
+            TEST_BOOLEAN_TRUE(CLC_DQ_is_empty(dq));
+        }
+
+        for (int i = 1; 5 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_DQ_push_back_by_value(dq, int, i));
+        }
+
+        clc_dq_free_storage(&dq);
+
+        TEST_INT_EQ(65, total_freed);
+        TEST_BOOLEAN_TRUE(CLC_DQ_is_empty(dq));
+    }
+}
+
+
+static void TEST_define_empty_with_allocator(void)
+{
+    counting_allocator_context_t    ctxt        =   { 0 };
+    collect_c_allocator_t const     allocator   =   { &fn_counting_alloc, NULL, &fn_counting_free, &ctxt };
+
+    {
+        CLC_DQ_define_empty_with_allocator(int, dq, &allocator);
+
+        for (int i = 0; 10000 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_DQ_push_back_by_value(dq, int, i));
+        }
+
+        TEST_INT_EQ(CLC_DQ_num_chunks(dq) + 1, ctxt.num_allocs - ctxt.num_frees);
+        TEST_BOOLEAN_TRUE(elements_are_ascending_from(&dq, 0));
+
+        for (int i = 0; 5000 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_DQ_pop_front(dq));
+        }
+
+        TEST_BOOLEAN_TRUE(elements_are_ascending_from(&dq, 5000));
+
+        clc_dq_free_storage(&dq);
+
+        TEST_INT_EQ(ctxt.num_allocs, ctxt.num_frees);
+        TEST_INT_EQ(0, ctxt.cb_outstanding);
+    }
+}
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -4,7 +4,7 @@
  * Purpose: Unit-test for doubly-linked list.
  *
  * Created: 7th February 2025
- * Updated: 10th February 2025
+ * Updated: 18th October 2026
  *
  * ////////////////////////////////////////////////////////////////////// */
 
@@ -35,10 +35,16 @@ static void TEST_push_front_1_ELEMENT_THEN_clear(void);
 static void TEST_push_front_9_ELEMENTS_THEN_clear(void);
 static void TEST_push_back_9_ELEMENTS_THEN_find(void);
 static void TEST_push_back_9_ELEMENTS_THEN_rfind(void);
+static void TEST_push_back_9_ELEMENTS_THEN_find_by_bytes_AND_rfind_by_bytes(void);
 static void TEST_push_back_9_ELEMENTS_THEN_find_THEN_erase(void);
 static void TEST_push_back_9_ELEMENTS_THEN_find_THEN_erase_NO_SPARES(void);
+static void TEST_push_back_9_ELEMENTS_THEN_clear_THEN_push_back_REUSES_SPARES(void);
+static void TEST_push_back_9_ELEMENTS_THEN_erase_THEN_compact(void);
+static void TEST_push_back_n_AND_push_front_n_AND_insert_n_after(void);
 static void TEST_push_front_1_ELEMENT_THEN_insert_after_1_ELEMENT(void);
 static void TEST_push_front_1_ELEMENT_THEN_insert_before_1_ELEMENT(void);
+static void TEST_define_empty_with_allocator_THEN_push_back_AND_compact(void);
+static void TEST_define_empty_with_allocator_THEN_push_n_MANY_BLOCKS_THEN_erase_ALL(void);
 
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -63,10 +69,16 @@ int main(int argc, char* argv[])
         XTESTS_RUN_CASE(TEST_push_front_9_ELEMENTS_THEN_clear);
         XTESTS_RUN_CASE(TEST_push_back_9_ELEMENTS_THEN_find);
         XTESTS_RUN_CASE(TEST_push_back_9_ELEMENTS_THEN_rfind);
+        XTESTS_RUN_CASE(TEST_push_back_9_ELEMENTS_THEN_find_by_bytes_AND_rfind_by_bytes);
         XTESTS_RUN_CASE(TEST_push_back_9_ELEMENTS_THEN_find_THEN_erase);
         XTESTS_RUN_CASE(TEST_push_back_9_ELEMENTS_THEN_find_THEN_erase_NO_SPARES);
+        XTESTS_RUN_CASE(TEST_push_back_9_ELEMENTS_THEN_clear_THEN_push_back_REUSES_SPARES);
+        XTESTS_RUN_CASE(TEST_push_back_9_ELEMENTS_THEN_erase_THEN_compact);
+        XTESTS_RUN_CASE(TEST_push_back_n_AND_push_front_n_AND_insert_n_after);
         XTESTS_RUN_CASE(TEST_push_front_1_ELEMENT_THEN_insert_after_1_ELEMENT);
         XTESTS_RUN_CASE(TEST_push_front_1_ELEMENT_THEN_insert_before_1_ELEMENT);
+        XTESTS_RUN_CASE(TEST_define_empty_with_allocator_THEN_push_back_AND_compact);
+        XTESTS_RUN_CASE(TEST_define_empty_with_allocator_THEN_push_n_MANY_BLOCKS_THEN_erase_ALL);
 
         XTESTS_PRINT_RESULTS();
 
@@ -89,6 +101,61 @@ struct custom_t
 };
 typedef struct custom_t custom_t;
 
+/* an allocator that counts its invocations, and the bytes outstanding, so
+ * that the sizes passed to it may be verified
+ */
+struct counting_allocator_context_t
+{
+    size_t  num_allocs;
+    size_t  num_reallocs;
+    size_t  num_frees;
+    size_t  cb_outstanding;
+};
+typedef struct counting_allocator_context_t counting_allocator_context_t;
+
+void* fn_counting_alloc(
+    void*   context
+,   size_t  cb
+)
+{
+    counting_allocator_context_t* const ctxt = (counting_allocator_context_t*)context;
+
+    ++ctxt->num_allocs;
+    ctxt->cb_outstanding += cb;
+
+    return malloc(cb);
+}
+
+void* fn_counting_realloc(
+    void*   context
+,   void*   p
+,   size_t  cb_old
+,   size_t  cb_new
+)
+{
+    counting_allocator_context_t* const ctxt = (counting_allocator_context_t*)context;
+
+    ++ctxt->num_reallocs;
+    ctxt->cb_outstanding -= cb_old;
+    ctxt->cb_outstanding += cb_new;
+
+    return realloc(p, cb_new);
+}
+
+void fn_counting_free(
+    void*   context
+,   void*   p
+,   size_t  cb
+)
+{
+    counting_allocator_context_t* const ctxt = (counting_allocator_context_t*)context;
+
+    ++ctxt->num_frees;
+    ctxt->cb_outstanding -= cb;
+
+    free(p);
+}
+
 int
 accumulate_l2_forward(
     collect_c_dlist_t*  l
@@ -626,6 +693,97 @@ static void TEST_push_back_9_ELEMENTS_THEN_rfind(void)
     }
 }
 
+static void TEST_push_back_9_ELEMENTS_THEN_find_by_bytes_AND_rfind_by_bytes(void)
+{
+    {
+        int const values[] =
+        {
+            1, 2, 3, 4, 5, 4, 3, 2, 1,
+        };
+
+        CLC_DL_define_empty(int, l);
+
+        size_t num_succeeded = 0;
+
+        for (size_t i = 0; STLSOFT_NUM_ELEMENTS(values) != i; ++i)
+        {
+            int const r = CLC_DL_push_back_by_val(l, int, values[i]);
+
+            TEST_INTEGER_EQUAL_ANY_OF2(0, ENOMEM, r);
+
+            if (0 == r)
+            {
+                ++num_succeeded;
+            }
+        }
+
+        if (STLSOFT_NUM_ELEMENTS(values) == num_succeeded)
+        {
+            /* results must be identical to those of the callback forms */
+
+            for (int v = 0; 7 != v; ++v)
+            {
+                for (size_t skip_count = 0; 3 != skip_count; ++skip_count)
+                {
+                    collect_c_dlist_node_t* node_cb;
+                    collect_c_dlist_node_t* node_bb;
+                    size_t                  num_searched_cb;
+                    size_t                  num_searched_bb;
+
+                    int const               r_cb = collect_c_dlist_find_node(&l, compare_matching_int, &v, skip_count, &node_cb, &num_searched_cb);
+                    int const               r_bb = collect_c_dlist_find_node_by_bytes(&l, &v, skip_count, &node_bb, &num_searched_bb);
+
+                    TEST_INT_EQ(r_cb, r_bb);
+                    TEST_PTR_EQ(node_cb, node_bb);
+                    TEST_INT_EQ(num_searched_cb, num_searched_bb);
+                }
+
+                for (size_t skip_count = 0; 3 != skip_count; ++skip_count)
+                {
+                    collect_c_dlist_node_t* node_cb;
+                    collect_c_dlist_node_t* node_bb;
+                    size_t                  num_searched_cb;
+                    size_t                  num_searched_bb;
+
+                    int const               r_cb = collect_c_dlist_rfind_node(&l, compare_matching_int, &v, skip_count, &node_cb, &num_searched_cb);
+                    int const               r_bb = collect_c_dlist_rfind_node_by_bytes(&l, &v, skip_count, &node_bb, &num_searched_bb);
+
+                    TEST_INT_EQ(r_cb, r_bb);
+                    TEST_PTR_EQ(node_cb, node_bb);
+                    TEST_INT_EQ(num_searched_cb, num_searched_bb);
+                }
+            }
+
+            /* find one that exists twice, getting the second one */
+            {
+                int const               v_4 =   4;
+
+                collect_c_dlist_node_t* node;
+                int const               r = collect_c_dlist_find_node_by_bytes(&l, &v_4, 1, &node, NULL);
+
+                TEST_INT_EQ(0, r);
+
+                TEST_PTR_NE(NULL, node);
+                TEST_PTR_EQ(l.head->next->next->next->next->next, node);
+            }
+
+            /* find one that does not exist */
+            {
+                int const               v_6 =   6;
+
+                collect_c_dlist_node_t* node;
+                int const               r = collect_c_dlist_rfind_node_by_bytes(&l, &v_6, 0, &node, NULL);
+
+                TEST_INT_EQ(ENOENT, r);
+
+                TEST_PTR_EQ(NULL, node);
+            }
+        }
+
+        clc_dlist_free_storage(&l);
+    }
+}
+
 static void TEST_push_back_9_ELEMENTS_THEN_find_THEN_erase(void)
 {
     {
@@ -772,6 +930,262 @@ static void TEST_push_back_9_ELEMENTS_THEN_find_THEN_erase_NO_SPARES(void)
     }
 }
 
+static void TEST_push_back_9_ELEMENTS_THEN_clear_THEN_push_back_REUSES_SPARES(void)
+{
+    {
+        int const values[] =
+        {
+            1, 2, 3, 4, 5, 6, 7, 8, 9,
+        };
+
+        CLC_DL_define_empty(int, l);
+
+        size_t num_succeeded = 0;
+
+        for (size_t i = 0; STLSOFT_NUM_ELEMENTS(values) != i; ++i)
+        {
+            int const r = CLC_DL_push_back_by_val(l, int, values[i]);
+
+            TEST_INTEGER_EQUAL_ANY_OF2(0, ENOMEM, r);
+
+            if (0 == r)
+            {
+                ++num_succeeded;
+            }
+        }
+
+        if (STLSOFT_NUM_ELEMENTS(values) == num_succeeded)
+        {
+            TEST_INT_EQ(0, CLC_DL_clear(l));
+
+            TEST_INT_EQ(0, CLC_DL_len(l));
+            TEST_INT_EQ(9, CLC_DL_spare(l));
+
+            for (size_t i = 0; 4 != i; ++i)
+            {
+                int const r = CLC_DL_push_back_by_val(l, int, values[i]);
+
+                TEST_INT_EQ(0, r);
+            }
+
+            TEST_INT_EQ(4, CLC_DL_len(l));
+            TEST_INT_EQ(5, CLC_DL_spare(l));
+
+            TEST_INT_EQ(10, accumulate_l2_forward(&l, 0));
+            TEST_INT_EQ(10, accumulate_l2_backward(&l, 0));
+        }
+
+        clc_dlist_free_storage(&l);
+    }
+}
+
+static
+void
+fn_count_remap(
+    collect_c_dlist_t const*        l
+,   collect_c_dlist_node_t const*   old_node
+,   collect_c_dlist_node_t*         new_node
+,   void*                           param_remap
+)
+{
+    ((void)&l);
+
+    /* old node still valid, so its value can be checked */
+
+    if (*(int const*)&old_node->data->data[0] == *(int const*)&new_node->data->data[0])
+    {
+        ++*(size_t*)param_remap;
+    }
+}
+
+static void TEST_push_back_9_ELEMENTS_THEN_erase_THEN_compact(void)
+{
+    for (int pass = 0; 2 != pass; ++pass)
+    {
+        CLC_DL_define_empty(int, l);
+
+        if (0 != pass)
+        {
+            l.flags |= CLC_DL_F_NO_SPARES;
+        }
+
+        size_t num_succeeded = 0;
+
+        for (int i = 1; 10 != i; ++i)
+        {
+            int const r = CLC_DL_push_back_by_val(l, int, i);
+
+            TEST_INTEGER_EQUAL_ANY_OF2(0, ENOMEM, r);
+
+            if (0 == r)
+            {
+                ++num_succeeded;
+            }
+        }
+
+        if (9 == num_succeeded)
+        {
+            /* erase the even elements */
+            for (int v = 2; v < 10; v += 2)
+            {
+                collect_c_dlist_node_t* node;
+
+                TEST_INT_EQ(0, collect_c_dlist_find_node(&l, compare_matching_int, &v, 0, &node, NULL));
+                TEST_INT_EQ(0, CLC_DL_erase_node(&l, node));
+            }
+
+            TEST_INT_EQ(5, CLC_DL_len(l));
+            TEST_INT_EQ(0 == pass ? 4 : 0, CLC_DL_spare(l));
+
+            {
+                size_t      num_remapped = 0;
+                int const   r = collect_c_dlist_compact(&l, fn_count_remap, &num_remapped);
+
+                TEST_INTEGER_EQUAL_ANY_OF2(0, ENOMEM, r);
+
+                if (0 == r)
+                {
+                    TEST_INT_EQ(5, num_remapped);
+                    TEST_INT_EQ(5, CLC_DL_len(l));
+                    TEST_INT_EQ(0, CLC_DL_spare(l));
+                    TEST_PTR_NE(NULL, l.blocks);
+
+                    TEST_INT_EQ(1, *COLLECT_C_DLIST_cfront_t(l, int));
+                    TEST_INT_EQ(9, *COLLECT_C_DLIST_cback_t(l, int));
+
+                    TEST_INT_EQ(25, accumulate_l2_forward(&l, 0));
+                    TEST_INT_EQ(25, accumulate_l2_backward(&l, 0));
+
+                    /* nodes are now adjacent, in list order */
+                    {
+                        collect_c_dlist_node_t const* prev = l.head;
+
+                        for (collect_c_dlist_node_t const* n = l.head->next; NULL != n; prev = n, n = n->next)
+                        {
+                            TEST_BOOLEAN_TRUE((char const*)prev < (char const*)n);
+                            TEST_BOOLEAN_TRUE((size_t)((char const*)n - (char const*)prev) < 2 * sizeof(collect_c_dlist_node_t) + sizeof(int));
+                        }
+                    }
+
+                    /* erasing block-resident nodes, and adding new ones, is
+                     * still valid
+                     */
+                    {
+                        int const               v_5 = 5;
+                        collect_c_dlist_node_t* node;
+
+                        TEST_INT_EQ(0, collect_c_dlist_find_node(&l, compare_matching_int, &v_5, 0, &node, NULL));
+                        TEST_INT_EQ(0, CLC_DL_erase_node(&l, node));
+                        TEST_INT_EQ(4, CLC_DL_len(l));
+                        TEST_INT_EQ(1, CLC_DL_spare(l));
+                    }
+
+                    TEST_INT_EQ(0, CLC_DL_push_back_by_val(l, int, 10));
+                    TEST_INT_EQ(0, CLC_DL_push_back_by_val(l, int, 11));
+
+                    TEST_INT_EQ(41, accumulate_l2_forward(&l, 0));
+                    TEST_INT_EQ(41, accumulate_l2_backward(&l, 0));
+
+                    /* a second compaction releases the former block */
+                    TEST_INT_EQ(0, collect_c_dlist_compact(&l, NULL, NULL));
+                    TEST_INT_EQ(6, CLC_DL_len(l));
+                    TEST_INT_EQ(41, accumulate_l2_forward(&l, 0));
+                }
+            }
+        }
+
+        clc_dlist_free_storage(&l);
+    }
+}
+
+static void TEST_push_back_n_AND_push_front_n_AND_insert_n_after(void)
+{
+    {
+        int const values[] =
+        {
+            1, 2, 3, 4, 5, 6, 7, 8, 9,
+        };
+
+        CLC_DL_define_empty(int, l);
+
+        TEST_INT_EQ(0, collect_c_dlist_push_back_n_by_ref(&l, 0, NULL));
+        TEST_BOOLEAN_TRUE(CLC_DL_is_empty(l));
+
+        {
+            int const r = collect_c_dlist_push_back_n_by_ref(&l, 4, &values[3]);
+
+            TEST_INTEGER_EQUAL_ANY_OF2(0, ENOMEM, r);
+
+            if (0 == r)
+            {
+                TEST_INT_EQ(4, CLC_DL_len(l));
+                TEST_INT_EQ(4, *COLLECT_C_DLIST_cfront_t(l, int));
+                TEST_INT_EQ(7, *COLLECT_C_DLIST_cback_t(l, int));
+                TEST_INT_EQ(22, accumulate_l2_forward(&l, 0));
+                TEST_INT_EQ(22, accumulate_l2_backward(&l, 0));
+
+                /* erasing one leaves a (block-resident) spare */
+                TEST_INT_EQ(0, CLC_DL_erase_node(&l, l.head->next));
+                TEST_INT_EQ(3, CLC_DL_len(l));
+                TEST_INT_EQ(1, CLC_DL_spare(l));
+            }
+        }
+
+        if (3 == CLC_DL_len(l))
+        {
+            /* 3 elements: 1 from the spare, 2 from a new block */
+            int const r = collect_c_dlist_push_front_n_by_ref(&l, 3, &values[0]);
+
+            TEST_INTEGER_EQUAL_ANY_OF2(0, ENOMEM, r);
+
+            if (0 == r)
+            {
+                TEST_INT_EQ(6, CLC_DL_len(l));
+                TEST_INT_EQ(0, CLC_DL_spare(l));
+                TEST_INT_EQ(1, *COLLECT_C_DLIST_cfront_t(l, int));
+                TEST_INT_EQ(7, *COLLECT_C_DLIST_cback_t(l, int));
+                TEST_INT_EQ(23, accumulate_l2_forward(&l, 0));
+                TEST_INT_EQ(23, accumulate_l2_backward(&l, 0));
+            }
+        }
+
+        if (6 == CLC_DL_len(l))
+        {
+            /* insert 8, 9 after 7, and 5 after 4, then check order */
+            int const               v_4 = 4;
+            int const               v_7 = 7;
+            collect_c_dlist_node_t* node;
+            collect_c_dlist_node_t* first_new_node;
+
+            TEST_INT_EQ(0, collect_c_dlist_find_node(&l, compare_matching_int, &v_7, 0, &node, NULL));
+            TEST_INT_EQ(0, collect_c_dlist_insert_n_after(&l, node, 2, &values[7], &first_new_node));
+            TEST_INT_EQ(8, *(int const*)&first_new_node->data->data[0]);
+
+            TEST_INT_EQ(0, collect_c_dlist_find_node(&l, compare_matching_int, &v_4, 0, &node, NULL));
+            TEST_INT_EQ(0, collect_c_dlist_insert_n_after(&l, node, 1, &values[4], NULL));
+
+            TEST_INT_EQ(9, CLC_DL_len(l));
+            TEST_INT_EQ(9, *COLLECT_C_DLIST_cback_t(l, int));
+
+            {
+                int expected = 1;
+
+                for (collect_c_dlist_node_t const* n = l.head; NULL != n; n = n->next, ++expected)
+                {
+                    TEST_INT_EQ(expected, *(int const*)&n->data->data[0]);
+                }
+
+                for (collect_c_dlist_node_t const* n = l.tail; NULL != n; n = n->prev)
+                {
+                    TEST_INT_EQ(--expected, *(int const*)&n->data->data[0]);
+                }
+            }
+        }
+
+        clc_dlist_free_storage(&l);
+    }
+}
+
 static void TEST_push_front_1_ELEMENT_THEN_insert_after_1_ELEMENT(void)
 {
     {
@@ -915,5 +1329,99 @@ static void TEST_push_front_1_ELEMENT_THEN_insert_before_1_ELEMENT(void)
 }
 
 
-/* ///////////////////////////// end of file //////////////////////////// */
+static void TEST_define_empty_with_allocator_THEN_push_back_AND_compact(void)
+{
+    counting_allocator_context_t    ctxt        =   { 0 };
+    collect_c_allocator_t const     allocator   =   { &fn_counting_alloc, NULL, &fn_counting_free, &ctxt };
+
+    {
+        CLC_DL_define_empty_with_allocator(int, l, &allocator);
+
+        int const els[] = { 10, 11, 12, 13, 14 };
+
+        l.flags |= CLC_DL_F_NO_SPARES;
+
+        for (int i = 1; 10 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_DL_push_back_by_val(l, int, i));
+        }
+
+        TEST_INT_EQ(9, ctxt.num_allocs);
+
+        TEST_INT_EQ(0, collect_c_dlist_push_back_n_by_ref(&l, 5, &els[0]));
+
+        /* a block, and the block index */
+        TEST_INT_EQ(11, ctxt.num_allocs);
+        TEST_INT_EQ(14, CLC_DL_len(l));
+
+        /* erase the first node, which is freed */
+        TEST_INT_EQ(0, CLC_DL_erase_node(&l, l.head));
+        TEST_INT_EQ(1, ctxt.num_frees);
 
+        TEST_INT_EQ(0, collect_c_dlist_compact(&l, NULL, NULL));
+
+        TEST_INT_EQ(13, ctxt.num_allocs);
+        TEST_INT_EQ(11, ctxt.num_frees);
+        TEST_INT_EQ(13, CLC_DL_len(l));
+        TEST_INT_EQ(2, *COLLECT_C_DLIST_cfront_t(l, int));
+        TEST_INT_EQ(14, *COLLECT_C_DLIST_cback_t(l, int));
+
+        clc_dlist_free_storage(&l);
+
+        TEST_INT_EQ(ctxt.num_allocs, ctxt.num_frees);
+        TEST_INT_EQ(0, ctxt.cb_outstanding);
+    }
+}
+
+static void TEST_define_empty_with_allocator_THEN_push_n_MANY_BLOCKS_THEN_erase_ALL(void)
+{
+    counting_allocator_context_t    ctxt        =   { 0 };
+    collect_c_allocator_t const     allocator   =   { &fn_counting_alloc, NULL, &fn_counting_free, &ctxt };
+
+    {
+        CLC_DL_define_empty_with_allocator(int, l, &allocator);
+
+        int const els[] = { 1, 2, 3 };
+
+        l.flags |= CLC_DL_F_NO_SPARES;
+
+        /* interleave individual nodes with many blocks, at both ends */
+        for (int i = 0; 1000 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_DL_push_back_by_val(l, int, 100));
+            TEST_INT_EQ(0, collect_c_dlist_push_back_n_by_ref(&l, 3, &els[0]));
+            TEST_INT_EQ(0, collect_c_dlist_push_front_n_by_ref(&l, 3, &els[0]));
+        }
+
+        TEST_INT_EQ(7000, CLC_DL_len(l));
+        TEST_INT_EQ(2000, l.num_blocks);
+
+        for (size_t i = 1; l.num_blocks != i; ++i)
+        {
+            TEST_BOOLEAN_TRUE((uintptr_t)l.blocks[i - 1] < (uintptr_t)l.blocks[i]);
+        }
+
+        /* erase all: the individual nodes are freed, and the block nodes
+         * become spares
+         */
+        {
+            size_t const num_frees = ctxt.num_frees;
+
+            for (; NULL != l.head; )
+            {
+                TEST_INT_EQ(0, CLC_DL_erase_node(&l, l.head));
+            }
+
+            TEST_INT_EQ(num_frees + 1000, ctxt.num_frees);
+            TEST_INT_EQ(6000, CLC_DL_spare(l));
+        }
+
+        clc_dlist_free_storage(&l);
+
+        TEST_INT_EQ(0, l.num_blocks);
+        TEST_INT_EQ(ctxt.num_allocs, ctxt.num_frees);
+        TEST_INT_EQ(0, ctxt.cb_outstanding);
+    }
+}
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,653 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test/unit/test.unit.flatmap/entry.c
+ *
+ * Purpose: Unit-test for sorted flat map.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/terse/flatmap.h>
+
+#include <xtests/terse-api.h>
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+static void TEST_define_empty(void);
+static void TEST_insert_by_value_THEN_find(void);
+static void TEST_insert_by_value_EXISTING_KEY(void);
+static void TEST_lower_bound_AND_upper_bound_AND_equal_range(void);
+static void TEST_assign_n_by_ref_SMALL_WITH_DUPLICATES(void);
+static void TEST_assign_n_by_ref_LARGE_WITH_DUPLICATES(void);
+static void TEST_insert_n_by_ref_INTO_EMPTY(void);
+static void TEST_insert_n_by_ref_MERGE_WITH_EXISTING(void);
+static void TEST_erase_by_value(void);
+static void TEST_define_empty_set(void);
+static void TEST_LARGE_VALUES(void);
+static void TEST_define_with_callback_AND_clear(void);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char* argv[])
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSE_HELP_OR_VERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.flatmap", verbosity))
+    {
+        XTESTS_RUN_CASE(TEST_define_empty);
+        XTESTS_RUN_CASE(TEST_insert_by_value_THEN_find);
+        XTESTS_RUN_CASE(TEST_insert_by_value_EXISTING_KEY);
+        XTESTS_RUN_CASE(TEST_lower_bound_AND_upper_bound_AND_equal_range);
+        XTESTS_RUN_CASE(TEST_assign_n_by_ref_SMALL_WITH_DUPLICATES);
+        XTESTS_RUN_CASE(TEST_assign_n_by_ref_LARGE_WITH_DUPLICATES);
+        XTESTS_RUN_CASE(TEST_insert_n_by_ref_INTO_EMPTY);
+        XTESTS_RUN_CASE(TEST_insert_n_by_ref_MERGE_WITH_EXISTING);
+        XTESTS_RUN_CASE(TEST_erase_by_value);
+        XTESTS_RUN_CASE(TEST_define_empty_set);
+        XTESTS_RUN_CASE(TEST_LARGE_VALUES);
+        XTESTS_RUN_CASE(TEST_define_with_callback_AND_clear);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function definitions
+ */
+
+struct int_entry_t
+{
+    int     key;
+    int     value;
+};
+typedef struct int_entry_t int_entry_t;
+
+struct record_t
+{
+    uint64_t    id;
+    char        name[48];
+};
+typedef struct record_t record_t;
+
+struct record_entry_t
+{
+    uint32_t    key;
+    record_t    value;
+};
+typedef struct record_entry_t record_entry_t;
+
+static int fn_compare_int(
+    collect_c_flatmap_t const*  m
+,   void const*                 p_lhs
+,   void const*                 p_rhs
+)
+{
+    int const lhs = *(int const*)p_lhs;
+    int const rhs = *(int const*)p_rhs;
+
+    ((void)&m);
+
+    return (lhs > rhs) - (lhs < rhs);
+}
+
+static int fn_compare_uint32(
+    collect_c_flatmap_t const*  m
+,   void const*                 p_lhs
+,   void const*                 p_rhs
+)
+{
+    uint32_t const lhs = *(uint32_t const*)p_lhs;
+    uint32_t const rhs = *(uint32_t const*)p_rhs;
+
+    ((void)&m);
+
+    return (lhs > rhs) - (lhs < rhs);
+}
+
+static void fn_count_on_free(
+    size_t  el_size
+,   size_t  el_index
+,   void*   el_ptr
+,   void*   param_element_free
+)
+{
+    ((void)&el_size);
+    ((void)&el_index);
+    ((void)&el_ptr);
+
+    ++*(int*)param_element_free;
+}
+
+static uint32_t next_random(
+    uint32_t*   state
+)
+{
+    *state = (*state * 1664525u) + 1013904223u;
+
+    return *state >> 8;
+}
+
+/* verifies that the keys of the map of int_entry_t are strictly
+ * ascending
+ */
+static bool is_strictly_ordered(
+    collect_c_flatmap_t const*  m
+)
+{
+    for (size_t i = 1; i < m->v.size; ++i)
+    {
+        int_entry_t const* const prev = CLC_FM_at_v(m, i - 1);
+        int_entry_t const* const curr = CLC_FM_at_v(m, i);
+
+        if (!(prev->key < curr->key))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+static void TEST_define_empty(void)
+{
+    CLC_FM_define_empty(int, int, m, fn_compare_int);
+
+    TEST_INT_EQ(sizeof(int_entry_t), m.v.el_size);
+    TEST_INT_EQ(sizeof(int), m.key_size);
+    TEST_INT_EQ(sizeof(int), m.value_size);
+    TEST_INT_EQ(offsetof(int_entry_t, value), m.value_offset);
+    TEST_BOOLEAN_TRUE(CLC_FM_is_empty(m));
+    TEST_INT_EQ(0, CLC_FM_len(m));
+
+    {
+        int const key = 1;
+
+        TEST_INT_EQ(0, clc_fm_lower_bound(&m, &key));
+        TEST_INT_EQ(0, clc_fm_upper_bound(&m, &key));
+        TEST_INT_EQ(ENOENT, clc_fm_find_by_ref(&m, &key, NULL));
+        TEST_INT_EQ(ENOENT, clc_fm_erase_by_ref(&m, &key));
+        TEST_BOOLEAN_FALSE(CLC_FM_contains_by_value(m, int, 1));
+    }
+
+    {
+        size_t num_dropped = 99;
+
+        TEST_INT_EQ(0, CLC_FM_clear(m, &num_dropped));
+        TEST_INT_EQ(0, num_dropped);
+    }
+
+    clc_fm_free_storage(&m);
+}
+
+static void TEST_insert_by_value_THEN_find(void)
+{
+    CLC_FM_define_empty(int, int, m, fn_compare_int);
+
+    uint32_t    state = 5;
+    size_t      n     = 0;
+
+    for (size_t i = 0; 1000 != i; ++i)
+    {
+        int const   key =   (int)(next_random(&state) % 2000);
+        int const   r   =   CLC_FM_insert_by_value(m, int, key, int, key * 10);
+
+        if (0 == r)
+        {
+            ++n;
+        }
+        else
+        {
+            TEST_INT_EQ(EEXIST, r);
+        }
+    }
+
+    TEST_INT_EQ(n, CLC_FM_len(m));
+    TEST_BOOLEAN_TRUE(is_strictly_ordered(&m));
+
+    for (size_t i = 0; CLC_FM_len(m) != i; ++i)
+    {
+        int_entry_t const* const    e   =   CLC_FM_at_v(m, i);
+        void*                       p_entry;
+
+        TEST_INT_EQ(0, clc_fm_find_by_ref(&m, &e->key, &p_entry));
+        TEST_PTR_EQ(e, p_entry);
+        TEST_INT_EQ(e->key * 10, *(int const*)CLC_FM_entry_value_v(m, p_entry));
+        TEST_INT_EQ(e->key, *(int const*)CLC_FM_entry_key_v(m, p_entry));
+    }
+
+    {
+        int const key = 2000;
+
+        TEST_INT_EQ(ENOENT, clc_fm_find_by_ref(&m, &key, NULL));
+    }
+
+    clc_fm_free_storage(&m);
+}
+
+static void TEST_insert_by_value_EXISTING_KEY(void)
+{
+    CLC_FM_define_empty(int, int, m, fn_compare_int);
+
+    TEST_INT_EQ(0, CLC_FM_insert_by_value(m, int, 3, int, 30));
+    TEST_INT_EQ(0, CLC_FM_insert_by_value(m, int, 1, int, 10));
+    TEST_INT_EQ(EEXIST, CLC_FM_insert_by_value(m, int, 3, int, 99));
+    TEST_INT_EQ(0, clc_fm_insert_by_ref(&m, &(int){ 2 }, NULL));
+
+    TEST_INT_EQ(3, CLC_FM_len(m));
+
+    {
+        int_entry_t const* const e = CLC_FM_at_v(m, 2);
+
+        TEST_INT_EQ(3, e->key);
+        TEST_INT_EQ(30, e->value);
+    }
+
+    {
+        int_entry_t const* const e = CLC_FM_at_v(m, 1);
+
+        TEST_INT_EQ(2, e->key);
+        TEST_INT_EQ(0, e->value);
+    }
+
+    clc_fm_free_storage(&m);
+}
+
+static void TEST_lower_bound_AND_upper_bound_AND_equal_range(void)
+{
+    CLC_FM_define_empty(int, int, m, fn_compare_int);
+
+    int_entry_t entries[1000];
+
+    /* keys 0, 2, 4, ..., 1998 */
+    for (size_t i = 0; 1000 != i; ++i)
+    {
+        entries[i].key      =   (int)(2 * i);
+        entries[i].value    =   (int)i;
+    }
+
+    TEST_INT_EQ(0, clc_fm_assign_n_by_ref(&m, 1000, entries));
+    TEST_INT_EQ(1000, CLC_FM_len(m));
+
+    for (int key = -1; key < 2001; ++key)
+    {
+        size_t const    lb  =   clc_fm_lower_bound(&m, &key);
+        size_t const    ub  =   clc_fm_upper_bound(&m, &key);
+        size_t          first;
+        size_t          last;
+
+        clc_fm_equal_range(&m, &key, &first, &last);
+
+        if (key < 0)
+        {
+            TEST_INT_EQ(0, lb);
+            TEST_INT_EQ(0, ub);
+        }
+        else if (key > 1998)
+        {
+            TEST_INT_EQ(1000, lb);
+            TEST_INT_EQ(1000, ub);
+        }
+        else if (0 == (key % 2))
+        {
+            TEST_INT_EQ((size_t)(key / 2), lb);
+            TEST_INT_EQ((size_t)(key / 2) + 1, ub);
+        }
+        else
+        {
+            TEST_INT_EQ((size_t)(key / 2) + 1, lb);
+            TEST_INT_EQ((size_t)(key / 2) + 1, ub);
+        }
+
+        TEST_INT_EQ(lb, first);
+        TEST_INT_EQ(ub, last);
+    }
+
+    clc_fm_free_storage(&m);
+}
+
+static void TEST_assign_n_by_ref_SMALL_WITH_DUPLICATES(void)
+{
+    CLC_FM_define_empty(int, int, m, fn_compare_int);
+
+    int_entry_t const entries[] =
+    {
+        { 5, 1 }, { 3, 2 }, { 5, 3 }, { 1, 4 }, { 3, 5 }, { 9, 6 }, { 1, 7 },
+    };
+
+    TEST_INT_EQ(0, CLC_FM_insert_by_value(m, int, 100, int, 100));
+
+    TEST_INT_EQ(0, clc_fm_assign_n_by_ref(&m, sizeof(entries) / sizeof(entries[0]), entries));
+    TEST_INT_EQ(4, CLC_FM_len(m));
+    TEST_BOOLEAN_TRUE(is_strictly_ordered(&m));
+
+    /* the first of each set of duplicates is retained */
+    TEST_INT_EQ(4, ((int_entry_t const*)CLC_FM_at_v(m, 0))->value);
+    TEST_INT_EQ(2, ((int_entry_t const*)CLC_FM_at_v(m, 1))->value);
+    TEST_INT_EQ(1, ((int_entry_t const*)CLC_FM_at_v(m, 2))->value);
+    TEST_INT_EQ(6, ((int_entry_t const*)CLC_FM_at_v(m, 3))->value);
+
+    TEST_BOOLEAN_FALSE(CLC_FM_contains_by_value(m, int, 100));
+
+    TEST_INT_EQ(0, clc_fm_assign_n_by_ref(&m, 0, NULL));
+    TEST_BOOLEAN_TRUE(CLC_FM_is_empty(m));
+
+    clc_fm_free_storage(&m);
+}
+
+static void TEST_assign_n_by_ref_LARGE_WITH_DUPLICATES(void)
+{
+    CLC_FM_define_empty(int, int, m, fn_compare_int);
+
+    static int_entry_t  entries[10007];
+    int                 first_value[500];
+    uint32_t            state = 17;
+    size_t              n_distinct = 0;
+
+    for (size_t i = 0; 500 != i; ++i)
+    {
+        first_value[i] = -1;
+    }
+
+    for (size_t i = 0; 10007 != i; ++i)
+    {
+        int const key = (int)(next_random(&state) % 500);
+
+        entries[i].key      =   key;
+        entries[i].value    =   (int)i;
+
+        if (first_value[key] < 0)
+        {
+            first_value[key] = (int)i;
+
+            ++n_distinct;
+        }
+    }
+
+    TEST_INT_EQ(0, clc_fm_assign_n_by_ref(&m, 10007, entries));
+    TEST_INT_EQ(n_distinct, CLC_FM_len(m));
+    TEST_BOOLEAN_TRUE(is_strictly_ordered(&m));
+
+    for (size_t i = 0; CLC_FM_len(m) != i; ++i)
+    {
+        int_entry_t const* const e = CLC_FM_at_v(m, i);
+
+        TEST_INT_EQ(first_value[e->key], e->value);
+    }
+
+    clc_fm_free_storage(&m);
+}
+
+static void TEST_insert_n_by_ref_INTO_EMPTY(void)
+{
+    CLC_FM_define_empty(int, int, m, fn_compare_int);
+
+    int_entry_t entries[300];
+    size_t      num_inserted = 99;
+
+    for (size_t i = 0; 300 != i; ++i)
+    {
+        entries[i].key      =   (int)((i * 7) % 100);
+        entries[i].value    =   (int)i;
+    }
+
+    TEST_INT_EQ(0, clc_fm_insert_n_by_ref(&m, 0, NULL, &num_inserted));
+    TEST_INT_EQ(0, num_inserted);
+
+    TEST_INT_EQ(0, clc_fm_insert_n_by_ref(&m, 300, entries, &num_inserted));
+    TEST_INT_EQ(100, num_inserted);
+    TEST_INT_EQ(100, CLC_FM_len(m));
+    TEST_BOOLEAN_TRUE(is_strictly_ordered(&m));
+
+    for (int key = 0; 100 != key; ++key)
+    {
+        int_entry_t const* const e = CLC_FM_at_v(m, (size_t)key);
+
+        TEST_INT_EQ(key, e->key);
+        TEST_INT_EQ(entries[e->value].key, key);
+        TEST_INT_LE(99, e->value);
+    }
+
+    clc_fm_free_storage(&m);
+}
+
+static void TEST_insert_n_by_ref_MERGE_WITH_EXISTING(void)
+{
+    CLC_FM_define_empty(int, int, m, fn_compare_int);
+
+    static bool         present[20000];
+    static int_entry_t  delta[3000];
+    uint32_t            state = 23;
+
+    memset(present, 0, sizeof(present));
+
+    /* existing keys are the multiples of 3 */
+    for (int key = 0; key < 20000; key += 3)
+    {
+        TEST_INT_EQ(0, CLC_FM_insert_by_value(m, int, key, int, -1));
+
+        present[key] = true;
+    }
+
+    for (size_t round = 0; 5 != round; ++round)
+    {
+        size_t const    n_delta         =   (0 == round) ? 1 : (round * 600);
+        size_t const    size_0          =   CLC_FM_len(m);
+        size_t          num_expected    =   0;
+        size_t          num_inserted;
+
+        for (size_t i = 0; n_delta != i; ++i)
+        {
+            delta[i].key    =   (int)(next_random(&state) % 20000);
+            delta[i].value  =   (int)round;
+        }
+
+        for (size_t i = 0; n_delta != i; ++i)
+        {
+            if (!present[delta[i].key])
+            {
+                present[delta[i].key] = true;
+
+                ++num_expected;
+            }
+        }
+
+        TEST_INT_EQ(0, clc_fm_insert_n_by_ref(&m, n_delta, delta, &num_inserted));
+        TEST_INT_EQ(num_expected, num_inserted);
+        TEST_INT_EQ(size_0 + num_expected, CLC_FM_len(m));
+        TEST_BOOLEAN_TRUE(is_strictly_ordered(&m));
+    }
+
+    {
+        size_t n = 0;
+
+        for (int key = 0; 20000 != key; ++key)
+        {
+            void* p_entry;
+
+            if (present[key])
+            {
+                TEST_INT_EQ(0, clc_fm_find_by_ref(&m, &key, &p_entry));
+
+                /* existing entries retain their values */
+                if (0 == (key % 3))
+                {
+                    TEST_INT_EQ(-1, ((int_entry_t const*)p_entry)->value);
+                }
+
+                ++n;
+            }
+            else
+            {
+                TEST_INT_EQ(ENOENT, clc_fm_find_by_ref(&m, &key, &p_entry));
+            }
+        }
+
+        TEST_INT_EQ(n, CLC_FM_len(m));
+    }
+
+    clc_fm_free_storage(&m);
+}
+
+static void TEST_erase_by_value(void)
+{
+    CLC_FM_define_empty(int, int, m, fn_compare_int);
+
+    for (int key = 0; 100 != key; ++key)
+    {
+        TEST_INT_EQ(0, CLC_FM_insert_by_value(m, int, key, int, key));
+    }
+
+    for (int key = 0; 100 != key; key += 2)
+    {
+        TEST_INT_EQ(0, CLC_FM_erase_by_value(m, int, key));
+    }
+
+    TEST_INT_EQ(ENOENT, CLC_FM_erase_by_value(m, int, 0));
+    TEST_INT_EQ(ENOENT, CLC_FM_erase_by_value(m, int, 100));
+    TEST_INT_EQ(50, CLC_FM_len(m));
+    TEST_BOOLEAN_TRUE(is_strictly_ordered(&m));
+
+    for (int key = 0; 100 != key; ++key)
+    {
+        if (0 != (key % 2))
+        {
+            TEST_BOOLEAN_TRUE(CLC_FM_contains_by_value(m, int, key));
+        }
+        else
+        {
+            TEST_BOOLEAN_FALSE(CLC_FM_contains_by_value(m, int, key));
+        }
+    }
+
+    clc_fm_free_storage(&m);
+}
+
+static void TEST_define_empty_set(void)
+{
+    CLC_FM_define_empty_set(uint32_t, s, fn_compare_uint32);
+
+    uint32_t    keys[1000];
+    uint32_t    state = 31;
+    size_t      num_inserted;
+
+    TEST_INT_EQ(sizeof(uint32_t), s.v.el_size);
+    TEST_INT_EQ(0, s.value_size);
+
+    for (size_t i = 0; 1000 != i; ++i)
+    {
+        keys[i] = next_random(&state) % 1500;
+    }
+
+    TEST_INT_EQ(0, clc_fm_insert_n_by_ref(&s, 500, keys, &num_inserted));
+    TEST_INT_EQ(num_inserted, CLC_FM_len(s));
+    TEST_INT_EQ(0, clc_fm_insert_n_by_ref(&s, 500, keys + 500, NULL));
+    TEST_INT_EQ(EEXIST, CLC_FM_insert_key_by_value(s, uint32_t, keys[0]));
+
+    for (size_t i = 0; 1000 != i; ++i)
+    {
+        TEST_BOOLEAN_TRUE(CLC_FM_contains_by_value(s, uint32_t, keys[i]));
+    }
+
+    for (size_t i = 1; i < CLC_FM_len(s); ++i)
+    {
+        TEST_INT_LE(*(uint32_t const*)CLC_FM_at_v(s, i), *(uint32_t const*)CLC_FM_at_v(s, i - 1));
+    }
+
+    clc_fm_free_storage(&s);
+}
+
+static void TEST_LARGE_VALUES(void)
+{
+    CLC_FM_define_empty(uint32_t, record_t, m, fn_compare_uint32);
+
+    uint32_t state = 41;
+
+    TEST_INT_EQ(sizeof(record_entry_t), m.v.el_size);
+    TEST_INT_EQ(offsetof(record_entry_t, value), m.value_offset);
+
+    for (size_t i = 0; 500 != i; ++i)
+    {
+        uint32_t const  key =   next_random(&state) % 10000;
+        record_t        r;
+
+        r.id = key * 3u;
+        memset(r.name, (int)(key % 26) + 'a', sizeof(r.name));
+
+        TEST_BOOLEAN_TRUE(0 == clc_fm_insert_by_ref(&m, &key, &r) || CLC_FM_contains_by_value(m, uint32_t, key));
+    }
+
+    for (size_t i = 0; CLC_FM_len(m) != i; ++i)
+    {
+        record_entry_t const* const e = CLC_FM_at_v(m, i);
+
+        TEST_INT_EQ(e->key * 3u, e->value.id);
+        TEST_INT_EQ((int)(e->key % 26) + 'a', e->value.name[sizeof(e->value.name) - 1]);
+
+        if (0 != i)
+        {
+            TEST_INT_LE(e->key, ((record_entry_t const*)CLC_FM_at_v(m, i - 1))->key);
+        }
+    }
+
+    clc_fm_free_storage(&m);
+}
+
+static void TEST_define_with_callback_AND_clear(void)
+{
+    CLC_FM_define_empty(int, int, m, fn_compare_int);
+
+    int num_freed = 0;
+
+    m.v.pfn_element_free    =   fn_count_on_free;
+    m.v.param_element_free  =   &num_freed;
+
+    for (int key = 0; 20 != key; ++key)
+    {
+        TEST_INT_EQ(0, CLC_FM_insert_by_value(m, int, key, int, key));
+    }
+
+    TEST_INT_EQ(0, CLC_FM_erase_by_value(m, int, 7));
+    TEST_INT_EQ(1, num_freed);
+
+    {
+        size_t num_dropped;
+
+        TEST_INT_EQ(0, CLC_FM_clear(m, &num_dropped));
+        TEST_INT_EQ(19, num_dropped);
+        TEST_INT_EQ(20, num_freed);
+    }
+
+    TEST_BOOLEAN_TRUE(CLC_FM_is_empty(m));
+
+    clc_fm_free_storage(&m);
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
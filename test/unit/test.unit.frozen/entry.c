@@ -0,0 +1,400 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test/unit/test.unit.frozen/entry.c
+ *
+ * Purpose: Unit-test for frozen sorted array.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/terse/frozen.h>
+#include <collect-c/terse/vec.h>
+
+#include <xtests/terse-api.h>
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+static void TEST_define_empty(void);
+static void TEST_freeze_EMPTY_VECTOR(void);
+static void TEST_lower_bound_ALL_SIZES_EYTZINGER(void);
+static void TEST_lower_bound_ALL_SIZES_BTREE(void);
+static void TEST_find_by_ref_LARGE_EYTZINGER(void);
+static void TEST_find_by_ref_LARGE_BTREE(void);
+static void TEST_LARGE_ELEMENTS(void);
+static void TEST_freeze_AGAIN_WITH_ALLOCATOR(void);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char* argv[])
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSE_HELP_OR_VERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.frozen", verbosity))
+    {
+        XTESTS_RUN_CASE(TEST_define_empty);
+        XTESTS_RUN_CASE(TEST_freeze_EMPTY_VECTOR);
+        XTESTS_RUN_CASE(TEST_lower_bound_ALL_SIZES_EYTZINGER);
+        XTESTS_RUN_CASE(TEST_lower_bound_ALL_SIZES_BTREE);
+        XTESTS_RUN_CASE(TEST_find_by_ref_LARGE_EYTZINGER);
+        XTESTS_RUN_CASE(TEST_find_by_ref_LARGE_BTREE);
+        XTESTS_RUN_CASE(TEST_LARGE_ELEMENTS);
+        XTESTS_RUN_CASE(TEST_freeze_AGAIN_WITH_ALLOCATOR);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function definitions
+ */
+
+/* a prefix-table entry, as might be looked up by address */
+struct range_t
+{
+    uint32_t    first;
+    uint32_t    last;
+    char        name[40];
+};
+typedef struct range_t range_t;
+
+struct counting_allocator_context_t
+{
+    size_t  num_allocs;
+    size_t  num_frees;
+    size_t  cb_outstanding;
+};
+typedef struct counting_allocator_context_t counting_allocator_context_t;
+
+void* fn_counting_alloc(
+    void*   context
+,   size_t  cb
+)
+{
+    counting_allocator_context_t* const ctxt = (counting_allocator_context_t*)context;
+
+    ++ctxt->num_allocs;
+    ctxt->cb_outstanding += cb;
+
+    return malloc(cb);
+}
+
+void fn_counting_free(
+    void*   context
+,   void*   p
+,   size_t  cb
+)
+{
+    counting_allocator_context_t* const ctxt = (counting_allocator_context_t*)context;
+
+    ++ctxt->num_frees;
+    ctxt->cb_outstanding -= cb;
+
+    free(p);
+}
+
+static int fn_compare_uint32(
+    collect_c_frozen_t const*   z
+,   void const*                 p_el
+,   void const*                 p_key
+)
+{
+    uint32_t const el  = *(uint32_t const*)p_el;
+    uint32_t const key = *(uint32_t const*)p_key;
+
+    ((void)&z);
+
+    return (el > key) - (el < key);
+}
+
+/* orders a range after an address that precedes it, so that the lower
+ * bound of an address is the first range whose last is not before it
+ */
+static int fn_compare_range_address(
+    collect_c_frozen_t const*   z
+,   void const*                 p_el
+,   void const*                 p_key
+)
+{
+    range_t const* const    el      =   (range_t const*)p_el;
+    uint32_t const          address =   *(uint32_t const*)p_key;
+
+    ((void)&z);
+
+    if (el->last < address)
+    {
+        return -1;
+    }
+    else if (el->first > address)
+    {
+        return +1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/* checks lower_bound() for every key in, and around, the vector of the
+ * odd numbers 1, 3, ..., 2n - 1
+ */
+static void check_all_sizes(
+    int32_t flags
+)
+{
+    for (size_t n = 0; n < 300; ++n)
+    {
+        CLC_V_define_empty(uint32_t, v);
+        CLC_FZ_define_empty(uint32_t, z, fn_compare_uint32);
+
+        TEST_INT_EQ(0, CLC_V_reserve(v, n + 1, 0));
+
+        for (uint32_t i = 0; n != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_V_push_back_by_value(v, uint32_t, (2 * i) + 1));
+        }
+
+        TEST_INT_EQ(0, clc_fz_freeze(&z, &v, flags));
+        TEST_INT_EQ(n, CLC_FZ_len(z));
+
+        for (uint32_t key = 0; key <= 2 * n; ++key)
+        {
+            uint32_t const* const p = (uint32_t const*)clc_fz_lower_bound(&z, &key);
+
+            if (key >= 2 * n)
+            {
+                TEST_PTR_EQ(NULL, p);
+            }
+            else
+            {
+                uint32_t const expected = (0 == (key % 2)) ? (key + 1) : key;
+
+                TEST_PTR_NE(NULL, p);
+                if (NULL != p)
+                {
+                    TEST_INT_EQ(expected, *p);
+                }
+            }
+
+            if (0 != (key % 2) && key < 2 * n)
+            {
+                TEST_BOOLEAN_TRUE(CLC_FZ_contains_by_ref(z, &key));
+            }
+            else
+            {
+                TEST_BOOLEAN_FALSE(CLC_FZ_contains_by_ref(z, &key));
+            }
+        }
+
+        clc_fz_free_storage(&z);
+        collect_c_vec_free_storage(&v);
+    }
+}
+
+static void check_large(
+    int32_t flags
+)
+{
+    CLC_V_define_empty(uint32_t, v);
+    CLC_FZ_define_empty(uint32_t, z, fn_compare_uint32);
+
+    size_t const n = 100000;
+
+    TEST_INT_EQ(0, CLC_V_reserve(v, n, 0));
+
+    for (uint32_t i = 0; n != i; ++i)
+    {
+        TEST_INT_EQ(0, CLC_V_push_back_by_value(v, uint32_t, i * 10));
+    }
+
+    TEST_INT_EQ(0, clc_fz_freeze(&z, &v, flags));
+
+    /* the storage is aligned to a cache line */
+    TEST_INT_EQ(0, ((uintptr_t)z.storage) % COLLECT_C_FROZEN_CACHE_LINE_SIZE);
+
+    for (uint32_t key = 0; key < 10 * n; key += 7)
+    {
+        void const* p_el;
+
+        if (0 == (key % 10))
+        {
+            TEST_INT_EQ(0, clc_fz_find_by_ref(&z, &key, &p_el));
+            TEST_INT_EQ(key, *(uint32_t const*)p_el);
+        }
+        else
+        {
+            TEST_INT_EQ(ENOENT, clc_fz_find_by_ref(&z, &key, &p_el));
+
+            if ((key / 10) + 1 == n)
+            {
+                TEST_PTR_EQ(NULL, clc_fz_lower_bound(&z, &key));
+            }
+            else
+            {
+                TEST_INT_EQ(((key / 10) + 1) * 10, *(uint32_t const*)clc_fz_lower_bound(&z, &key));
+            }
+        }
+    }
+
+    clc_fz_free_storage(&z);
+    collect_c_vec_free_storage(&v);
+}
+
+
+static void TEST_define_empty(void)
+{
+    CLC_FZ_define_empty(uint32_t, z, fn_compare_uint32);
+
+    uint32_t const key = 0;
+
+    TEST_INT_EQ(sizeof(uint32_t), z.el_size);
+    TEST_BOOLEAN_TRUE(CLC_FZ_is_empty(z));
+    TEST_INT_EQ(0, CLC_FZ_len(z));
+    TEST_PTR_EQ(NULL, clc_fz_lower_bound(&z, &key));
+    TEST_INT_EQ(ENOENT, clc_fz_find_by_ref(&z, &key, NULL));
+
+    clc_fz_free_storage(&z);
+}
+
+static void TEST_freeze_EMPTY_VECTOR(void)
+{
+    CLC_V_define_empty(uint32_t, v);
+    CLC_FZ_define_empty(uint32_t, z, fn_compare_uint32);
+
+    TEST_INT_EQ(0, clc_fz_freeze(&z, &v, COLLECT_C_FROZEN_F_BTREE));
+    TEST_BOOLEAN_TRUE(CLC_FZ_is_empty(z));
+    TEST_BOOLEAN_FALSE(CLC_FZ_contains_by_value(z, uint32_t, 0));
+
+    clc_fz_free_storage(&z);
+}
+
+static void TEST_lower_bound_ALL_SIZES_EYTZINGER(void)
+{
+    check_all_sizes(COLLECT_C_FROZEN_F_EYTZINGER);
+}
+
+static void TEST_lower_bound_ALL_SIZES_BTREE(void)
+{
+    check_all_sizes(COLLECT_C_FROZEN_F_BTREE);
+}
+
+static void TEST_find_by_ref_LARGE_EYTZINGER(void)
+{
+    check_large(COLLECT_C_FROZEN_F_EYTZINGER);
+}
+
+static void TEST_find_by_ref_LARGE_BTREE(void)
+{
+    check_large(COLLECT_C_FROZEN_F_BTREE);
+}
+
+static void TEST_LARGE_ELEMENTS(void)
+{
+    int32_t const layouts[] = { COLLECT_C_FROZEN_F_EYTZINGER, COLLECT_C_FROZEN_F_BTREE };
+
+    for (size_t l = 0; 2 != l; ++l)
+    {
+        CLC_V_define_empty(range_t, v);
+        CLC_FZ_define_empty(range_t, z, fn_compare_range_address);
+
+        TEST_INT_EQ(0, CLC_V_reserve(v, 1000, 0));
+
+        /* ranges [100i, 100i + 49], with gaps between */
+        for (uint32_t i = 0; 1000 != i; ++i)
+        {
+            range_t r;
+
+            r.first = 100 * i;
+            r.last  = r.first + 49;
+            memset(r.name, (int)(i % 26) + 'a', sizeof(r.name));
+
+            TEST_INT_EQ(0, CLC_V_push_back_by_ref(v, &r));
+        }
+
+        TEST_INT_EQ(0, clc_fz_freeze(&z, &v, layouts[l]));
+
+        /* the instance does not refer to the vector */
+        collect_c_vec_free_storage(&v);
+
+        for (uint32_t address = 0; address < 100000; address += 13)
+        {
+            range_t const* p;
+
+            if (address % 100 < 50)
+            {
+                TEST_INT_EQ(0, clc_fz_find_by_ref(&z, &address, (void const**)&p));
+                TEST_INT_EQ(100 * (address / 100), p->first);
+                TEST_INT_EQ((int)((address / 100) % 26) + 'a', p->name[sizeof(p->name) - 1]);
+            }
+            else
+            {
+                TEST_INT_EQ(ENOENT, clc_fz_find_by_ref(&z, &address, NULL));
+            }
+        }
+
+        clc_fz_free_storage(&z);
+    }
+}
+
+static void TEST_freeze_AGAIN_WITH_ALLOCATOR(void)
+{
+    counting_allocator_context_t    ctxt    =   { 0 };
+    collect_c_allocator_t const     a       =   { &fn_counting_alloc, NULL, &fn_counting_free, &ctxt };
+
+    {
+        CLC_V_define_empty(uint32_t, v);
+        CLC_FZ_define_empty_with_allocator(uint32_t, z, fn_compare_uint32, &a);
+
+        TEST_INT_EQ(0, CLC_V_reserve(v, 100, 0));
+
+        for (uint32_t i = 0; 100 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_V_push_back_by_value(v, uint32_t, i));
+        }
+
+        TEST_INT_EQ(0, clc_fz_freeze(&z, &v, COLLECT_C_FROZEN_F_EYTZINGER));
+        TEST_INT_EQ(1, ctxt.num_allocs);
+
+        TEST_INT_EQ(0, CLC_V_push_back_by_value(v, uint32_t, 100));
+
+        TEST_INT_EQ(0, clc_fz_freeze(&z, &v, COLLECT_C_FROZEN_F_BTREE));
+        TEST_INT_EQ(2, ctxt.num_allocs);
+        TEST_INT_EQ(1, ctxt.num_frees);
+        TEST_INT_EQ(101, CLC_FZ_len(z));
+        TEST_BOOLEAN_TRUE(CLC_FZ_contains_by_value(z, uint32_t, 100));
+
+        clc_fz_free_storage(&z);
+        collect_c_vec_free_storage(&v);
+    }
+
+    TEST_INT_EQ(2, ctxt.num_frees);
+    TEST_INT_EQ(0, ctxt.cb_outstanding);
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
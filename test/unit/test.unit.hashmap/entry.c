@@ -0,0 +1,577 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test/unit/test.unit.hashmap/entry.c
+ *
+ * Purpose: Unit-test for hash map.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/terse/hashmap.h>
+
+#include <xtests/terse-api.h>
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+static void TEST_define_empty(void);
+static void TEST_insert_MANY_THEN_find(void);
+static void TEST_insert_EXISTING_THEN_insert_or_assign(void);
+static void TEST_insert_MANY_THEN_erase_HALF_THEN_find(void);
+static void TEST_insert_AND_erase_CHURN_DOES_NOT_GROW(void);
+static void TEST_reserve_THEN_insert_WITHOUT_REHASH(void);
+static void TEST_clear_RETAINS_STORAGE(void);
+static void TEST_next_entry(void);
+static void TEST_BYTE_KEYS(void);
+static void TEST_define_empty_with_functions_STRING_KEYS(void);
+static void TEST_define_empty_with_functions_DEGENERATE_HASH(void);
+static void TEST_define_empty_with_cb(void);
+static void TEST_define_empty_with_allocator(void);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char* argv[])
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSE_HELP_OR_VERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.hashmap", verbosity))
+    {
+        XTESTS_RUN_CASE(TEST_define_empty);
+        XTESTS_RUN_CASE(TEST_insert_MANY_THEN_find);
+        XTESTS_RUN_CASE(TEST_insert_EXISTING_THEN_insert_or_assign);
+        XTESTS_RUN_CASE(TEST_insert_MANY_THEN_erase_HALF_THEN_find);
+        XTESTS_RUN_CASE(TEST_insert_AND_erase_CHURN_DOES_NOT_GROW);
+        XTESTS_RUN_CASE(TEST_reserve_THEN_insert_WITHOUT_REHASH);
+        XTESTS_RUN_CASE(TEST_clear_RETAINS_STORAGE);
+        XTESTS_RUN_CASE(TEST_next_entry);
+        XTESTS_RUN_CASE(TEST_BYTE_KEYS);
+        XTESTS_RUN_CASE(TEST_define_empty_with_functions_STRING_KEYS);
+        XTESTS_RUN_CASE(TEST_define_empty_with_functions_DEGENERATE_HASH);
+        XTESTS_RUN_CASE(TEST_define_empty_with_cb);
+        XTESTS_RUN_CASE(TEST_define_empty_with_allocator);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function definitions
+ */
+
+struct custom_t
+{
+    uint32_t    x;
+    uint32_t    y;
+    uint32_t    z;
+};
+typedef struct custom_t custom_t;
+
+/* an allocator that counts its invocations, and the bytes outstanding, so
+ * that the sizes passed to it may be verified
+ */
+struct counting_allocator_context_t
+{
+    size_t  num_allocs;
+    size_t  num_frees;
+    size_t  cb_outstanding;
+};
+typedef struct counting_allocator_context_t counting_allocator_context_t;
+
+void* fn_counting_alloc(
+    void*   context
+,   size_t  cb
+)
+{
+    counting_allocator_context_t* const ctxt = (counting_allocator_context_t*)context;
+
+    ++ctxt->num_allocs;
+    ctxt->cb_outstanding += cb;
+
+    return malloc(cb);
+}
+
+void fn_counting_free(
+    void*   context
+,   void*   p
+,   size_t  cb
+)
+{
+    counting_allocator_context_t* const ctxt = (counting_allocator_context_t*)context;
+
+    ++ctxt->num_frees;
+    ctxt->cb_outstanding -= cb;
+
+    free(p);
+}
+
+static size_t fn_hash_string(
+    collect_c_hashmap_t const*  m
+,   void const*                 p_key
+)
+{
+    char const* const s = *(char const* const*)p_key;
+
+    ((void)&m);
+
+    return collect_c_hashmap_hash_bytes(s, strlen(s));
+}
+
+static int fn_compare_string(
+    collect_c_hashmap_t const*  m
+,   void const*                 p_lhs
+,   void const*                 p_rhs
+)
+{
+    ((void)&m);
+
+    return strcmp(*(char const* const*)p_lhs, *(char const* const*)p_rhs);
+}
+
+static size_t fn_hash_degenerate(
+    collect_c_hashmap_t const*  m
+,   void const*                 p_key
+)
+{
+    ((void)&m);
+    ((void)&p_key);
+
+    return 12345;
+}
+
+static void fn_count_on_free(
+    size_t  el_size
+,   size_t  el_index
+,   void*   el_ptr
+,   void*   param_element_free
+)
+{
+    ((void)&el_size);
+    ((void)&el_index);
+    ((void)&el_ptr);
+
+    ++*(int*)param_element_free;
+}
+
+
+static void TEST_define_empty(void)
+{
+    CLC_HM_define_empty(int, double, m);
+
+    TEST_INT_EQ(sizeof(int), m.key_size);
+    TEST_INT_EQ(sizeof(double), m.value_size);
+    TEST_INT_EQ(8, m.value_offset);
+    TEST_INT_EQ(16, m.entry_size);
+    TEST_BOOLEAN_TRUE(CLC_HM_is_empty(m));
+    TEST_INT_EQ(0, CLC_HM_len(m));
+    TEST_INT_EQ(0, CLC_HM_capacity(m));
+
+    TEST_INT_EQ(ENOENT, clc_hm_find_by_ref(&m, &(int){ 1 }, NULL));
+    TEST_INT_EQ(ENOENT, CLC_HM_erase_by_value(m, int, 1));
+
+    TEST_INT_EQ(0, clc_hm_free_storage(&m));
+}
+
+static void TEST_insert_MANY_THEN_find(void)
+{
+    CLC_HM_define_empty(int, int, m);
+
+    for (int i = 0; 10000 != i; ++i)
+    {
+        TEST_INT_EQ(0, CLC_HM_insert_by_value(m, int, i * 7, int, -i));
+    }
+
+    TEST_INT_EQ(10000, CLC_HM_len(m));
+    TEST_INT_EQ(0, CLC_HM_capacity(m) & (CLC_HM_capacity(m) - 1));
+    TEST_INT_LE(CLC_HM_capacity(m) - CLC_HM_capacity(m) / 8, CLC_HM_len(m));
+
+    for (int i = 0; 10000 != i; ++i)
+    {
+        int const   k = i * 7;
+        void*       v = NULL;
+
+        TEST_INT_EQ(0, clc_hm_find_by_ref(&m, &k, &v));
+        TEST_PTR_NE(NULL, v);
+        TEST_INT_EQ(-i, *(int*)v);
+
+        TEST_BOOLEAN_FALSE(CLC_HM_contains_by_value(m, int, k + 1));
+    }
+
+    clc_hm_free_storage(&m);
+
+    TEST_INT_EQ(0, CLC_HM_capacity(m));
+}
+
+static void TEST_insert_EXISTING_THEN_insert_or_assign(void)
+{
+    CLC_HM_define_empty(long, double, m);
+
+    long const  k   =   101;
+    void*       v   =   NULL;
+
+    TEST_INT_EQ(0, clc_hm_insert_by_ref(&m, &k, &(double){ 1.5 }, &v));
+    TEST_PTR_NE(NULL, v);
+
+    {
+        void* v2 = NULL;
+
+        TEST_INT_EQ(EEXIST, clc_hm_insert_by_ref(&m, &k, &(double){ 2.5 }, &v2));
+        TEST_PTR_EQ(v, v2);
+        TEST_BOOLEAN_TRUE(1.5 == *(double*)v2);
+    }
+
+    TEST_INT_EQ(0, CLC_HM_insert_or_assign_by_value(m, long, 101, double, 3.5));
+    TEST_INT_EQ(1, CLC_HM_len(m));
+    TEST_BOOLEAN_TRUE(3.5 == *(double*)v);
+
+    TEST_INT_EQ(0, CLC_HM_insert_or_assign_by_value(m, long, 102, double, 4.5));
+    TEST_INT_EQ(2, CLC_HM_len(m));
+
+    /* a NULL value is zeroed */
+    {
+        void* v3 = NULL;
+
+        TEST_INT_EQ(0, clc_hm_insert_by_ref(&m, &(long){ 103 }, NULL, &v3));
+        TEST_BOOLEAN_TRUE(0.0 == *(double*)v3);
+    }
+
+    clc_hm_free_storage(&m);
+}
+
+static void TEST_insert_MANY_THEN_erase_HALF_THEN_find(void)
+{
+    CLC_HM_define_empty(uint64_t, uint32_t, m);
+
+    for (uint64_t i = 0; 5000 != i; ++i)
+    {
+        TEST_INT_EQ(0, CLC_HM_insert_by_value(m, uint64_t, i << 20, uint32_t, (uint32_t)i));
+    }
+
+    for (uint64_t i = 0; 5000 != i; i += 2)
+    {
+        TEST_INT_EQ(0, CLC_HM_erase_by_value(m, uint64_t, i << 20));
+    }
+
+    TEST_INT_EQ(2500, CLC_HM_len(m));
+
+    for (uint64_t i = 0; 5000 != i; ++i)
+    {
+        uint64_t const  k   =   i << 20;
+        void*           v   =   NULL;
+        int const       r   =   clc_hm_find_by_ref(&m, &k, &v);
+
+        if (0 == (i % 2))
+        {
+            TEST_INT_EQ(ENOENT, r);
+        }
+        else
+        {
+            TEST_INT_EQ(0, r);
+            TEST_INT_EQ(i, *(uint32_t*)v);
+        }
+    }
+
+    /* reinsert the erased, reusing tombstones */
+    for (uint64_t i = 0; 5000 != i; i += 2)
+    {
+        TEST_INT_EQ(0, CLC_HM_insert_by_value(m, uint64_t, i << 20, uint32_t, (uint32_t)i));
+    }
+
+    TEST_INT_EQ(5000, CLC_HM_len(m));
+
+    for (uint64_t i = 0; 5000 != i; ++i)
+    {
+        TEST_BOOLEAN_TRUE(CLC_HM_contains_by_value(m, uint64_t, i << 20));
+    }
+
+    clc_hm_free_storage(&m);
+}
+
+static void TEST_insert_AND_erase_CHURN_DOES_NOT_GROW(void)
+{
+    CLC_HM_define_empty(int, int, m);
+
+    for (int i = 0; 100 != i; ++i)
+    {
+        TEST_INT_EQ(0, CLC_HM_insert_by_value(m, int, i, int, i));
+    }
+
+    {
+        size_t const capacity = CLC_HM_capacity(m);
+
+        /* a sliding window of 100 keys, which leaves many tombstones that
+         * are cleared by rehashing in place, after at most one growth
+         */
+        for (int i = 100; 100000 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_HM_erase_by_value(m, int, i - 100));
+            TEST_INT_EQ(0, CLC_HM_insert_by_value(m, int, i, int, i));
+        }
+
+        TEST_INT_EQ(100, CLC_HM_len(m));
+        TEST_INT_GE(CLC_HM_capacity(m), 2 * capacity);
+
+        for (int i = 100000 - 100; 100000 != i; ++i)
+        {
+            TEST_BOOLEAN_TRUE(CLC_HM_contains_by_value(m, int, i));
+        }
+    }
+
+    clc_hm_free_storage(&m);
+}
+
+static void TEST_reserve_THEN_insert_WITHOUT_REHASH(void)
+{
+    CLC_HM_define_empty(int, int, m);
+
+    TEST_INT_EQ(0, clc_hm_reserve(&m, 1000));
+    TEST_INT_EQ(2048, CLC_HM_capacity(m));
+
+    {
+        int8_t* const ctrl = m.ctrl;
+
+        for (int i = 0; 1000 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_HM_insert_by_value(m, int, i, int, i));
+        }
+
+        TEST_PTR_EQ(ctrl, m.ctrl);
+    }
+
+    /* reserve does not shrink */
+    TEST_INT_EQ(0, clc_hm_reserve(&m, 10));
+    TEST_INT_EQ(2048, CLC_HM_capacity(m));
+
+    clc_hm_free_storage(&m);
+}
+
+static void TEST_clear_RETAINS_STORAGE(void)
+{
+    CLC_HM_define_empty(int, int, m);
+
+    for (int i = 0; 100 != i; ++i)
+    {
+        TEST_INT_EQ(0, CLC_HM_insert_by_value(m, int, i, int, i));
+    }
+
+    {
+        size_t const    capacity    =   CLC_HM_capacity(m);
+        size_t          num_dropped =   0;
+
+        TEST_INT_EQ(0, CLC_HM_clear(m, &num_dropped));
+        TEST_INT_EQ(100, num_dropped);
+        TEST_INT_EQ(0, CLC_HM_len(m));
+        TEST_INT_GE(CLC_HM_capacity(m), 2 * capacity);
+        TEST_BOOLEAN_FALSE(CLC_HM_contains_by_value(m, int, 1));
+
+        TEST_INT_EQ(0, CLC_HM_insert_by_value(m, int, 1, int, 1));
+        TEST_BOOLEAN_TRUE(CLC_HM_contains_by_value(m, int, 1));
+    }
+
+    clc_hm_free_storage(&m);
+}
+
+static void TEST_next_entry(void)
+{
+    CLC_HM_define_empty(int, int, m);
+
+    {
+        size_t cursor = 0;
+
+        TEST_INT_EQ(ENOENT, clc_hm_next_entry(&m, &cursor, NULL, NULL));
+    }
+
+    for (int i = 1; 101 != i; ++i)
+    {
+        TEST_INT_EQ(0, CLC_HM_insert_by_value(m, int, i, int, i * 2));
+    }
+
+    {
+        size_t      cursor      =   0;
+        size_t      num_entries =   0;
+        int         sum_keys    =   0;
+        int         sum_values  =   0;
+        void const* k;
+        void*       v;
+
+        for (; 0 == clc_hm_next_entry(&m, &cursor, &k, &v); ++num_entries)
+        {
+            TEST_INT_EQ(*(int const*)k * 2, *(int*)v);
+
+            sum_keys += *(int const*)k;
+            sum_values += *(int*)v;
+        }
+
+        TEST_INT_EQ(100, num_entries);
+        TEST_INT_EQ(5050, sum_keys);
+        TEST_INT_EQ(10100, sum_values);
+    }
+
+    clc_hm_free_storage(&m);
+}
+
+static void TEST_BYTE_KEYS(void)
+{
+    CLC_HM_define_empty(custom_t, int, m);
+
+    TEST_INT_EQ(12, m.value_offset);
+    TEST_INT_EQ(16, m.entry_size);
+
+    for (uint32_t i = 0; 1000 != i; ++i)
+    {
+        custom_t const k = { i, i + 1, i + 2 };
+
+        TEST_INT_EQ(0, clc_hm_insert_by_ref(&m, &k, &(int){ (int)i }, NULL));
+    }
+
+    for (uint32_t i = 0; 1000 != i; ++i)
+    {
+        custom_t const  k1  =   { i, i + 1, i + 2 };
+        custom_t const  k2  =   { i, i + 1, i + 3 };
+        void*           v   =   NULL;
+
+        TEST_INT_EQ(0, clc_hm_find_by_ref(&m, &k1, &v));
+        TEST_INT_EQ(i, *(int*)v);
+        TEST_INT_EQ(ENOENT, clc_hm_find_by_ref(&m, &k2, NULL));
+    }
+
+    clc_hm_free_storage(&m);
+}
+
+static void TEST_define_empty_with_functions_STRING_KEYS(void)
+{
+    CLC_HM_define_empty_with_functions(char const*, int, m, fn_hash_string, fn_compare_string);
+
+    char const* const   words[]     =   { "abc", "def", "ghi", "a much longer string, of more than 8 bytes", "" };
+    char                buff[64];
+
+    for (size_t i = 0; sizeof(words) / sizeof(words[0]) != i; ++i)
+    {
+        TEST_INT_EQ(0, clc_hm_insert_by_ref(&m, &words[i], &(int){ (int)i }, NULL));
+    }
+
+    /* a distinct copy of a key finds the entry */
+    strcpy(buff, "a much longer string, of more than 8 bytes");
+
+    {
+        char const* const   k   =   buff;
+        void*               v   =   NULL;
+
+        TEST_INT_EQ(0, clc_hm_find_by_ref(&m, &k, &v));
+        TEST_INT_EQ(3, *(int*)v);
+    }
+
+    {
+        char const* const k = "xyz";
+
+        TEST_INT_EQ(ENOENT, clc_hm_find_by_ref(&m, &k, NULL));
+    }
+
+    clc_hm_free_storage(&m);
+}
+
+static void TEST_define_empty_with_functions_DEGENERATE_HASH(void)
+{
+    CLC_HM_define_empty_with_functions(int, int, m, fn_hash_degenerate, NULL);
+
+    for (int i = 0; 200 != i; ++i)
+    {
+        TEST_INT_EQ(0, CLC_HM_insert_by_value(m, int, i, int, i));
+    }
+
+    for (int i = 0; i < 200; i += 3)
+    {
+        TEST_INT_EQ(0, CLC_HM_erase_by_value(m, int, i));
+    }
+
+    for (int i = 0; 200 != i; ++i)
+    {
+        TEST_INT_EQ(0 != (i % 3), CLC_HM_contains_by_value(m, int, i));
+    }
+
+    clc_hm_free_storage(&m);
+}
+
+static void TEST_define_empty_with_cb(void)
+{
+    int num_freed = 0;
+
+    {
+        CLC_HM_define_empty_with_cb(int, int, m, NULL, NULL, fn_count_on_free, &num_freed);
+
+        for (int i = 0; 10 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_HM_insert_by_value(m, int, i, int, i));
+        }
+
+        TEST_INT_EQ(0, num_freed);
+
+        TEST_INT_EQ(EEXIST, CLC_HM_insert_by_value(m, int, 1, int, 1));
+        TEST_INT_EQ(0, num_freed);
+
+        TEST_INT_EQ(0, CLC_HM_insert_or_assign_by_value(m, int, 1, int, 11));
+        TEST_INT_EQ(1, num_freed);
+
+        TEST_INT_EQ(0, CLC_HM_erase_by_value(m, int, 2));
+        TEST_INT_EQ(2, num_freed);
+
+        TEST_INT_EQ(0, CLC_HM_clear(m));
+        TEST_INT_EQ(11, num_freed);
+
+        TEST_INT_EQ(0, CLC_HM_insert_by_value(m, int, 1, int, 1));
+        TEST_INT_EQ(0, CLC_HM_insert_by_value(m, int, 2, int, 2));
+
+        clc_hm_free_storage(&m);
+        TEST_INT_EQ(13, num_freed);
+    }
+}
+
+static void TEST_define_empty_with_allocator(void)
+{
+    counting_allocator_context_t    ctxt        =   { 0 };
+    collect_c_allocator_t const     allocator   =   { &fn_counting_alloc, NULL, &fn_counting_free, &ctxt };
+
+    {
+        CLC_HM_define_empty_with_allocator(int, int, m, &allocator);
+
+        for (int i = 0; 1000 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_HM_insert_by_value(m, int, i, int, i));
+        }
+
+        TEST_INT_EQ(ctxt.num_allocs, ctxt.num_frees + 1);
+        TEST_INT_EQ(CLC_HM_capacity(m) * (1 + m.entry_size), ctxt.cb_outstanding);
+
+        clc_hm_free_storage(&m);
+
+        TEST_INT_EQ(ctxt.num_allocs, ctxt.num_frees);
+        TEST_INT_EQ(0, ctxt.cb_outstanding);
+    }
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,438 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test/unit/test.unit.hashset/entry.c
+ *
+ * Purpose: Unit-test for hash set.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/terse/hashset.h>
+
+#include <xtests/terse-api.h>
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+static void TEST_define_empty(void);
+static void TEST_insert_MANY_4_BYTE_KEYS(void);
+static void TEST_insert_MANY_8_BYTE_KEYS_THEN_erase(void);
+static void TEST_insert_MANY_16_BYTE_KEYS(void);
+static void TEST_insert_MANY_ODD_SIZED_KEYS(void);
+static void TEST_insert_n_WITH_DUPLICATES(void);
+static void TEST_find_n(void);
+static void TEST_reserve_THEN_insert_n_WITHOUT_REHASH(void);
+static void TEST_clear_THEN_next_key(void);
+static void TEST_define_empty_with_allocator(void);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char* argv[])
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSE_HELP_OR_VERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.hashset", verbosity))
+    {
+        XTESTS_RUN_CASE(TEST_define_empty);
+        XTESTS_RUN_CASE(TEST_insert_MANY_4_BYTE_KEYS);
+        XTESTS_RUN_CASE(TEST_insert_MANY_8_BYTE_KEYS_THEN_erase);
+        XTESTS_RUN_CASE(TEST_insert_MANY_16_BYTE_KEYS);
+        XTESTS_RUN_CASE(TEST_insert_MANY_ODD_SIZED_KEYS);
+        XTESTS_RUN_CASE(TEST_insert_n_WITH_DUPLICATES);
+        XTESTS_RUN_CASE(TEST_find_n);
+        XTESTS_RUN_CASE(TEST_reserve_THEN_insert_n_WITHOUT_REHASH);
+        XTESTS_RUN_CASE(TEST_clear_THEN_next_key);
+        XTESTS_RUN_CASE(TEST_define_empty_with_allocator);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function definitions
+ */
+
+struct key16_t
+{
+    uint64_t    lo;
+    uint64_t    hi;
+};
+typedef struct key16_t key16_t;
+
+struct key3_t
+{
+    unsigned char   b[3];
+};
+typedef struct key3_t key3_t;
+
+/* an allocator that counts its invocations, and the bytes outstanding, so
+ * that the sizes passed to it may be verified
+ */
+struct counting_allocator_context_t
+{
+    size_t  num_allocs;
+    size_t  num_frees;
+    size_t  cb_outstanding;
+};
+typedef struct counting_allocator_context_t counting_allocator_context_t;
+
+void* fn_counting_alloc(
+    void*   context
+,   size_t  cb
+)
+{
+    counting_allocator_context_t* const ctxt = (counting_allocator_context_t*)context;
+
+    ++ctxt->num_allocs;
+    ctxt->cb_outstanding += cb;
+
+    return malloc(cb);
+}
+
+void fn_counting_free(
+    void*   context
+,   void*   p
+,   size_t  cb
+)
+{
+    counting_allocator_context_t* const ctxt = (counting_allocator_context_t*)context;
+
+    ++ctxt->num_frees;
+    ctxt->cb_outstanding -= cb;
+
+    free(p);
+}
+
+
+static void TEST_define_empty(void)
+{
+    CLC_HS_define_empty(uint32_t, s);
+
+    TEST_INT_EQ(sizeof(uint32_t), s.key_size);
+    TEST_BOOLEAN_TRUE(CLC_HS_is_empty(s));
+    TEST_INT_EQ(0, CLC_HS_len(s));
+    TEST_INT_EQ(0, CLC_HS_capacity(s));
+
+    TEST_BOOLEAN_FALSE(CLC_HS_contains_by_value(s, uint32_t, 0));
+    TEST_INT_EQ(ENOENT, CLC_HS_erase_by_value(s, uint32_t, 0));
+
+    TEST_INT_EQ(0, clc_hs_free_storage(&s));
+}
+
+static void TEST_insert_MANY_4_BYTE_KEYS(void)
+{
+    CLC_HS_define_empty(uint32_t, s);
+
+    for (uint32_t i = 0; 10000 != i; ++i)
+    {
+        TEST_INT_EQ(0, CLC_HS_insert_by_value(s, uint32_t, i * 3));
+    }
+
+    TEST_INT_EQ(EEXIST, CLC_HS_insert_by_value(s, uint32_t, 0));
+    TEST_INT_EQ(EEXIST, CLC_HS_insert_by_value(s, uint32_t, 29997));
+
+    TEST_INT_EQ(10000, CLC_HS_len(s));
+    TEST_INT_EQ(16384, CLC_HS_capacity(s));
+
+    for (uint32_t i = 0; 30000 != i; ++i)
+    {
+        TEST_INT_EQ(0 == (i % 3), CLC_HS_contains_by_value(s, uint32_t, i));
+    }
+
+    clc_hs_free_storage(&s);
+}
+
+static void TEST_insert_MANY_8_BYTE_KEYS_THEN_erase(void)
+{
+    CLC_HS_define_empty(uint64_t, s);
+
+    for (uint64_t i = 0; 5000 != i; ++i)
+    {
+        TEST_INT_EQ(0, CLC_HS_insert_by_value(s, uint64_t, i << 32));
+    }
+
+    for (uint64_t i = 0; 5000 != i; i += 2)
+    {
+        TEST_INT_EQ(0, CLC_HS_erase_by_value(s, uint64_t, i << 32));
+    }
+
+    TEST_INT_EQ(ENOENT, CLC_HS_erase_by_value(s, uint64_t, 0));
+    TEST_INT_EQ(2500, CLC_HS_len(s));
+
+    for (uint64_t i = 0; 5000 != i; ++i)
+    {
+        TEST_INT_EQ(0 != (i % 2), CLC_HS_contains_by_value(s, uint64_t, i << 32));
+    }
+
+    /* a sliding window, which leaves many tombstones */
+    {
+        size_t const capacity = CLC_HS_capacity(s);
+
+        for (uint64_t i = 1; i < 100000; i += 2)
+        {
+            TEST_INT_EQ(0, CLC_HS_erase_by_value(s, uint64_t, i << 32));
+            TEST_INT_EQ(0, CLC_HS_insert_by_value(s, uint64_t, (i + 5000) << 32));
+        }
+
+        TEST_INT_EQ(2500, CLC_HS_len(s));
+        TEST_INT_GE(CLC_HS_capacity(s), 2 * capacity);
+    }
+
+    clc_hs_free_storage(&s);
+}
+
+static void TEST_insert_MANY_16_BYTE_KEYS(void)
+{
+    CLC_HS_define_empty(key16_t, s);
+
+    for (uint64_t i = 0; 1000 != i; ++i)
+    {
+        key16_t const k = { i, ~i };
+
+        TEST_INT_EQ(0, clc_hs_insert_by_ref(&s, &k));
+    }
+
+    for (uint64_t i = 0; 1000 != i; ++i)
+    {
+        key16_t const k1 = { i, ~i };
+        key16_t const k2 = { i, i };
+
+        TEST_INT_EQ(0, clc_hs_find_by_ref(&s, &k1));
+        TEST_INT_EQ(ENOENT, clc_hs_find_by_ref(&s, &k2));
+        TEST_INT_EQ(EEXIST, clc_hs_insert_by_ref(&s, &k1));
+    }
+
+    TEST_INT_EQ(1000, CLC_HS_len(s));
+
+    clc_hs_free_storage(&s);
+}
+
+static void TEST_insert_MANY_ODD_SIZED_KEYS(void)
+{
+    CLC_HS_define_empty(key3_t, s);
+
+    TEST_INT_EQ(3, s.key_size);
+
+    for (unsigned i = 0; 4096 != i; ++i)
+    {
+        key3_t const k = {{ (unsigned char)i, (unsigned char)(i >> 8), 0x7f }};
+
+        TEST_INT_EQ(0, clc_hs_insert_by_ref(&s, &k));
+    }
+
+    for (unsigned i = 0; 4096 != i; ++i)
+    {
+        key3_t const k1 = {{ (unsigned char)i, (unsigned char)(i >> 8), 0x7f }};
+        key3_t const k2 = {{ (unsigned char)i, (unsigned char)(i >> 8), 0x7e }};
+
+        TEST_INT_EQ(0, clc_hs_find_by_ref(&s, &k1));
+        TEST_INT_EQ(ENOENT, clc_hs_find_by_ref(&s, &k2));
+    }
+
+    clc_hs_free_storage(&s);
+}
+
+static void TEST_insert_n_WITH_DUPLICATES(void)
+{
+    CLC_HS_define_empty(uint32_t, s);
+
+    uint32_t    keys[1000];
+    size_t      num_inserted;
+
+    /* each of 250 values, 4 times */
+    for (size_t i = 0; 1000 != i; ++i)
+    {
+        keys[i] = (uint32_t)(i % 250) * 101;
+    }
+
+    TEST_INT_EQ(0, clc_hs_insert_n_by_ref(&s, 1000, keys, &num_inserted));
+    TEST_INT_EQ(250, num_inserted);
+    TEST_INT_EQ(250, CLC_HS_len(s));
+
+    /* none are new */
+    TEST_INT_EQ(0, clc_hs_insert_n_by_ref(&s, 17, keys + 3, &num_inserted));
+    TEST_INT_EQ(0, num_inserted);
+
+    TEST_INT_EQ(0, clc_hs_insert_n_by_ref(&s, 0, NULL, &num_inserted));
+    TEST_INT_EQ(0, num_inserted);
+
+    TEST_INT_EQ(0, clc_hs_insert_n_by_ref(&s, 1, &(uint32_t){ 1 }, NULL));
+    TEST_INT_EQ(251, CLC_HS_len(s));
+
+    for (uint32_t i = 0; 250 != i; ++i)
+    {
+        TEST_BOOLEAN_TRUE(CLC_HS_contains_by_value(s, uint32_t, i * 101));
+    }
+
+    clc_hs_free_storage(&s);
+}
+
+static void TEST_find_n(void)
+{
+    CLC_HS_define_empty(uint64_t, s);
+
+    uint64_t        keys[100];
+    unsigned char   found[100];
+    size_t          num_found;
+
+    for (size_t i = 0; 100 != i; ++i)
+    {
+        keys[i] = i;
+    }
+
+    /* empty set */
+    memset(found, 0xff, sizeof(found));
+
+    TEST_INT_EQ(0, clc_hs_find_n_by_ref(&s, 100, keys, found, &num_found));
+    TEST_INT_EQ(0, num_found);
+
+    for (size_t i = 0; 100 != i; ++i)
+    {
+        TEST_INT_EQ(0, found[i]);
+    }
+
+    for (uint64_t i = 0; i < 100; i += 3)
+    {
+        TEST_INT_EQ(0, CLC_HS_insert_by_value(s, uint64_t, i));
+    }
+
+    TEST_INT_EQ(0, clc_hs_find_n_by_ref(&s, 100, keys, found, &num_found));
+    TEST_INT_EQ(34, num_found);
+
+    for (size_t i = 0; 100 != i; ++i)
+    {
+        TEST_INT_EQ(0 == (i % 3), found[i]);
+    }
+
+    TEST_INT_EQ(0, clc_hs_find_n_by_ref(&s, 7, keys, NULL, &num_found));
+    TEST_INT_EQ(3, num_found);
+
+    TEST_INT_EQ(0, clc_hs_find_n_by_ref(&s, 7, keys, NULL, NULL));
+
+    clc_hs_free_storage(&s);
+}
+
+static void TEST_reserve_THEN_insert_n_WITHOUT_REHASH(void)
+{
+    CLC_HS_define_empty(uint32_t, s);
+
+    uint32_t keys[5000];
+
+    for (size_t i = 0; 5000 != i; ++i)
+    {
+        keys[i] = (uint32_t)(i * 2654435761u);
+    }
+
+    TEST_INT_EQ(0, clc_hs_reserve(&s, 5000));
+    TEST_INT_EQ(8192, CLC_HS_capacity(s));
+
+    {
+        int8_t* const   ctrl            =   s.ctrl;
+        size_t          num_inserted    =   0;
+
+        TEST_INT_EQ(0, clc_hs_insert_n_by_ref(&s, 5000, keys, &num_inserted));
+        TEST_INT_EQ(5000, num_inserted);
+
+        TEST_PTR_EQ(ctrl, s.ctrl);
+    }
+
+    /* reserve does not shrink */
+    TEST_INT_EQ(0, clc_hs_reserve(&s, 10));
+    TEST_INT_EQ(8192, CLC_HS_capacity(s));
+
+    clc_hs_free_storage(&s);
+}
+
+static void TEST_clear_THEN_next_key(void)
+{
+    CLC_HS_define_empty(int, s);
+
+    for (int i = 1; 101 != i; ++i)
+    {
+        TEST_INT_EQ(0, CLC_HS_insert_by_value(s, int, i));
+    }
+
+    {
+        size_t      cursor      =   0;
+        size_t      num_keys    =   0;
+        int         sum         =   0;
+        void const* k;
+
+        for (; 0 == clc_hs_next_key(&s, &cursor, &k); ++num_keys)
+        {
+            sum += *(int const*)k;
+        }
+
+        TEST_INT_EQ(100, num_keys);
+        TEST_INT_EQ(5050, sum);
+    }
+
+    {
+        size_t const    capacity    =   CLC_HS_capacity(s);
+        size_t          num_dropped =   0;
+
+        TEST_INT_EQ(0, CLC_HS_clear(s, &num_dropped));
+        TEST_INT_EQ(100, num_dropped);
+        TEST_BOOLEAN_TRUE(CLC_HS_is_empty(s));
+        TEST_INT_EQ(capacity, CLC_HS_capacity(s));
+    }
+
+    {
+        size_t cursor = 0;
+
+        TEST_INT_EQ(ENOENT, clc_hs_next_key(&s, &cursor, NULL));
+    }
+
+    clc_hs_free_storage(&s);
+}
+
+static void TEST_define_empty_with_allocator(void)
+{
+    counting_allocator_context_t    ctxt        =   { 0 };
+    collect_c_allocator_t const     allocator   =   { &fn_counting_alloc, NULL, &fn_counting_free, &ctxt };
+
+    {
+        CLC_HS_define_empty_with_allocator(uint64_t, s, &allocator);
+
+        for (uint64_t i = 0; 1000 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_HS_insert_by_value(s, uint64_t, i));
+        }
+
+        TEST_INT_EQ(ctxt.num_allocs, ctxt.num_frees + 1);
+        TEST_INT_EQ(CLC_HS_capacity(s) * (1 + sizeof(uint64_t)), ctxt.cb_outstanding);
+
+        clc_hs_free_storage(&s);
+
+        TEST_INT_EQ(ctxt.num_allocs, ctxt.num_frees);
+        TEST_INT_EQ(0, ctxt.cb_outstanding);
+    }
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,542 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test/unit/test.unit.ilist/entry.c
+ *
+ * Purpose: Unit-test for index-linked list.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/terse/ilist.h>
+
+#include <xtests/terse-api.h>
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+static void TEST_define_empty(void);
+static void TEST_push_back_1000_ELEMENTS(void);
+static void TEST_push_front_AND_insert(void);
+static void TEST_erase_THEN_REUSE_FREE_NODES(void);
+static void TEST_find_AND_rfind(void);
+static void TEST_copy(void);
+static void TEST_clear_AND_free_storage_INVOKE_CALLBACK(void);
+static void TEST_define_empty_with_allocator_THEN_push_back_THEN_copy(void);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char* argv[])
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSE_HELP_OR_VERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.ilist", verbosity))
+    {
+        XTESTS_RUN_CASE(TEST_define_empty);
+        XTESTS_RUN_CASE(TEST_push_back_1000_ELEMENTS);
+        XTESTS_RUN_CASE(TEST_push_front_AND_insert);
+        XTESTS_RUN_CASE(TEST_erase_THEN_REUSE_FREE_NODES);
+        XTESTS_RUN_CASE(TEST_find_AND_rfind);
+        XTESTS_RUN_CASE(TEST_copy);
+        XTESTS_RUN_CASE(TEST_clear_AND_free_storage_INVOKE_CALLBACK);
+        XTESTS_RUN_CASE(TEST_define_empty_with_allocator_THEN_push_back_THEN_copy);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function definitions
+ */
+
+int
+compare_int(
+    collect_c_ilist_t const*    l
+,   void const*                 p_lhs
+,   void const*                 p_rhs
+)
+{
+    int const i_lhs = *(int const*)p_lhs;
+    int const i_rhs = *(int const*)p_rhs;
+
+    ((void)&l);
+
+    return (i_lhs < i_rhs) ? -1 : (i_lhs > i_rhs) ? +1 : 0;
+}
+
+void
+fn_accumulate_int(
+    size_t  el_size
+,   size_t  el_index
+,   void*   el_ptr
+,   void*   param_element_free
+)
+{
+    ((void)&el_size);
+    ((void)&el_index);
+
+    *(int*)param_element_free += *(int const*)el_ptr;
+}
+
+/* forms a decimal number from the elements, in forward order, and checks
+ * that the reverse links agree
+ */
+int
+accumulate_ints(
+    collect_c_ilist_t const*    l
+)
+{
+    int         r       =   0;
+    int         r_rev   =   0;
+    int         mul     =   1;
+    uint32_t    prev    =   CLC_IL_NIL;
+
+    for (uint32_t ix = CLC_IL_head(*l); CLC_IL_NIL != ix; ix = CLC_IL_next(*l, ix))
+    {
+        if (prev != CLC_IL_prev(*l, ix))
+        {
+            return -1;
+        }
+
+        r = (r * 10) + *CLC_IL_cat_t(*l, int, ix);
+
+        prev = ix;
+    }
+
+    if (prev != CLC_IL_tail(*l))
+    {
+        return -1;
+    }
+
+    for (uint32_t ix = CLC_IL_tail(*l); CLC_IL_NIL != ix; ix = CLC_IL_prev(*l, ix), mul *= 10)
+    {
+        r_rev += mul * *CLC_IL_cat_t(*l, int, ix);
+    }
+
+    return (r == r_rev) ? r : -1;
+}
+
+
+/* an allocator that counts its invocations, and the bytes outstanding, so
+ * that the sizes passed to it may be verified
+ */
+struct counting_allocator_context_t
+{
+    size_t  num_allocs;
+    size_t  num_reallocs;
+    size_t  num_frees;
+    size_t  cb_outstanding;
+};
+typedef struct counting_allocator_context_t counting_allocator_context_t;
+
+void* fn_counting_alloc(
+    void*   context
+,   size_t  cb
+)
+{
+    counting_allocator_context_t* const ctxt = (counting_allocator_context_t*)context;
+
+    ++ctxt->num_allocs;
+    ctxt->cb_outstanding += cb;
+
+    return malloc(cb);
+}
+
+void* fn_counting_realloc(
+    void*   context
+,   void*   p
+,   size_t  cb_old
+,   size_t  cb_new
+)
+{
+    counting_allocator_context_t* const ctxt = (counting_allocator_context_t*)context;
+
+    ++ctxt->num_reallocs;
+    ctxt->cb_outstanding -= cb_old;
+    ctxt->cb_outstanding += cb_new;
+
+    return realloc(p, cb_new);
+}
+
+void fn_counting_free(
+    void*   context
+,   void*   p
+,   size_t  cb
+)
+{
+    counting_allocator_context_t* const ctxt = (counting_allocator_context_t*)context;
+
+    ++ctxt->num_frees;
+    ctxt->cb_outstanding -= cb;
+
+    free(p);
+}
+
+static void TEST_define_empty(void)
+{
+    {
+        CLC_IL_define_empty(int, l);
+
+        TEST_BOOLEAN_TRUE(CLC_IL_is_empty(l));
+        TEST_INT_EQ(0, CLC_IL_len(l));
+        TEST_INT_EQ(0, CLC_IL_num_free(l));
+        TEST_INT_EQ(CLC_IL_NIL, CLC_IL_head(l));
+        TEST_INT_EQ(CLC_IL_NIL, CLC_IL_tail(l));
+
+        clc_il_free_storage(&l);
+    }
+
+    {
+        CLC_IL_define_empty(int, l);
+
+        TEST_INT_EQ(0, clc_il_allocate_storage(&l, 100));
+
+        TEST_BOOLEAN_TRUE(CLC_IL_is_empty(l));
+        TEST_INT_EQ(100, l.links.capacity);
+
+        clc_il_free_storage(&l);
+    }
+}
+
+static void TEST_push_back_1000_ELEMENTS(void)
+{
+    {
+        CLC_IL_define_empty(int, l);
+
+        for (int i = 0; 1000 != i; ++i)
+        {
+            uint32_t ix;
+
+            TEST_INT_EQ(0, clc_il_push_back_by_ref(&l, &i, &ix));
+            TEST_INT_EQ(i, ix);
+        }
+
+        TEST_INT_EQ(1000, CLC_IL_len(l));
+        TEST_INT_EQ(0, *CLC_IL_cfront_t(l, int));
+        TEST_INT_EQ(999, *CLC_IL_cback_t(l, int));
+
+        {
+            int expected = 0;
+
+            for (uint32_t ix = CLC_IL_head(l); CLC_IL_NIL != ix; ix = CLC_IL_next(l, ix), ++expected)
+            {
+                TEST_INT_EQ(expected, *CLC_IL_cat_t(l, int, ix));
+            }
+
+            TEST_INT_EQ(1000, expected);
+        }
+
+        clc_il_free_storage(&l);
+    }
+}
+
+static void TEST_push_front_AND_insert(void)
+{
+    {
+        CLC_IL_define_empty(int, l);
+
+        TEST_INT_EQ(0, CLC_IL_push_front_by_value(l, int, 3));
+        TEST_INT_EQ(0, CLC_IL_push_front_by_value(l, int, 1));
+        TEST_INT_EQ(0, CLC_IL_push_back_by_value(l, int, 5));
+
+        TEST_INT_EQ(135, accumulate_ints(&l));
+
+        {
+            int const   v2  =   2;
+            int const   v4  =   4;
+            uint32_t    ix_3;
+            size_t      num_searched;
+
+            TEST_INT_EQ(0, clc_il_find(&l, compare_int, &(int){ 3 }, 0, &ix_3, &num_searched));
+            TEST_INT_EQ(0, ix_3);
+            TEST_INT_EQ(2, num_searched);
+
+            TEST_INT_EQ(0, CLC_IL_insert_before(l, ix_3, &v2));
+            TEST_INT_EQ(0, CLC_IL_insert_after(l, ix_3, &v4));
+        }
+
+        TEST_INT_EQ(5, CLC_IL_len(l));
+        TEST_INT_EQ(12345, accumulate_ints(&l));
+
+        {
+            int const   v0  =   0;
+            int const   v6  =   6;
+
+            TEST_INT_EQ(0, CLC_IL_insert_before(l, CLC_IL_head(l), &v0));
+            TEST_INT_EQ(0, CLC_IL_insert_after(l, CLC_IL_tail(l), &v6));
+        }
+
+        TEST_INT_EQ(7, CLC_IL_len(l));
+        TEST_INT_EQ(123456, accumulate_ints(&l));
+        TEST_INT_EQ(0, *CLC_IL_cfront_t(l, int));
+        TEST_INT_EQ(6, *CLC_IL_cback_t(l, int));
+
+        clc_il_free_storage(&l);
+    }
+}
+
+static void TEST_erase_THEN_REUSE_FREE_NODES(void)
+{
+    {
+        int total_freed = 0;
+
+        CLC_IL_define_empty_with_cb(int, l, fn_accumulate_int, &total_freed);
+
+        for (int i = 1; 10 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_IL_push_back_by_ref(l, &i));
+        }
+
+        TEST_INT_EQ(123456789, accumulate_ints(&l));
+
+        /* nodes 1, 4, and 8 hold 2, 5, and 9 */
+        TEST_INT_EQ(0, CLC_IL_erase(l, 1));
+        TEST_INT_EQ(0, CLC_IL_erase(l, 4));
+        TEST_INT_EQ(0, CLC_IL_erase(l, 8));
+
+        TEST_INT_EQ(6, CLC_IL_len(l));
+        TEST_INT_EQ(3, CLC_IL_num_free(l));
+        TEST_INT_EQ(2 + 5 + 9, total_freed);
+        TEST_INT_EQ(134678, accumulate_ints(&l));
+        TEST_INT_EQ(7, CLC_IL_tail(l));
+
+        /* free nodes are reused, most-recently freed first */
+        {
+            uint32_t ix;
+
+            TEST_INT_EQ(0, clc_il_push_front_by_ref(&l, &(int){ 9 }, &ix));
+            TEST_INT_EQ(8, ix);
+
+            TEST_INT_EQ(0, clc_il_push_back_by_ref(&l, &(int){ 2 }, &ix));
+            TEST_INT_EQ(4, ix);
+
+            TEST_INT_EQ(0, clc_il_push_back_by_ref(&l, &(int){ 5 }, &ix));
+            TEST_INT_EQ(1, ix);
+
+            TEST_INT_EQ(0, CLC_IL_num_free(l));
+            TEST_INT_EQ(913467825, accumulate_ints(&l));
+
+            TEST_INT_EQ(0, clc_il_push_back_by_ref(&l, &(int){ 0 }, &ix));
+            TEST_INT_EQ(9, ix);
+        }
+
+        TEST_INT_EQ(10, CLC_IL_len(l));
+        TEST_INT_EQ(0, *CLC_IL_cback_t(l, int));
+
+        /* erasing everything resets to the base of the arrays */
+
+        for (; !CLC_IL_is_empty(l); )
+        {
+            TEST_INT_EQ(0, CLC_IL_erase(l, CLC_IL_head(l)));
+        }
+
+        TEST_INT_EQ(0, CLC_IL_num_free(l));
+        TEST_INT_EQ(0, l.links.size);
+        TEST_INT_EQ(2 + 5 + 9 + 45, total_freed);
+
+        {
+            uint32_t ix;
+
+            TEST_INT_EQ(0, clc_il_push_back_by_ref(&l, &(int){ 7 }, &ix));
+            TEST_INT_EQ(0, ix);
+        }
+
+        clc_il_free_storage(&l);
+    }
+}
+
+static void TEST_find_AND_rfind(void)
+{
+    {
+        CLC_IL_define_empty(int, l);
+
+        for (int i = 0; 20 != i; ++i)
+        {
+            int const v = i % 5;
+
+            TEST_INT_EQ(0, CLC_IL_push_back_by_ref(l, &v));
+        }
+
+        {
+            int const   v   =   3;
+            uint32_t    ix;
+            size_t      num_searched;
+
+            TEST_INT_EQ(0, clc_il_find(&l, compare_int, &v, 0, &ix, &num_searched));
+            TEST_INT_EQ(3, ix);
+            TEST_INT_EQ(4, num_searched);
+
+            TEST_INT_EQ(0, clc_il_find(&l, compare_int, &v, 3, &ix, &num_searched));
+            TEST_INT_EQ(18, ix);
+            TEST_INT_EQ(19, num_searched);
+
+            TEST_INT_EQ(ENOENT, clc_il_find(&l, compare_int, &v, 4, &ix, &num_searched));
+            TEST_INT_EQ(CLC_IL_NIL, ix);
+            TEST_INT_EQ(20, num_searched);
+
+            TEST_INT_EQ(0, clc_il_rfind(&l, compare_int, &v, 0, &ix, &num_searched));
+            TEST_INT_EQ(18, ix);
+            TEST_INT_EQ(2, num_searched);
+
+            TEST_INT_EQ(0, clc_il_rfind(&l, compare_int, &v, 1, &ix, NULL));
+            TEST_INT_EQ(13, ix);
+        }
+
+        {
+            int const   v   =   5;
+            uint32_t    ix;
+
+            TEST_INT_EQ(ENOENT, clc_il_find(&l, compare_int, &v, 0, &ix, NULL));
+            TEST_INT_EQ(ENOENT, clc_il_rfind(&l, compare_int, &v, 0, &ix, NULL));
+        }
+
+        clc_il_free_storage(&l);
+    }
+}
+
+static void TEST_copy(void)
+{
+    {
+        CLC_IL_define_empty(int, src);
+        CLC_IL_define_empty(int, dst);
+
+        TEST_INT_EQ(0, clc_il_copy(&dst, &src));
+        TEST_BOOLEAN_TRUE(CLC_IL_is_empty(dst));
+
+        clc_il_free_storage(&dst);
+        clc_il_free_storage(&src);
+    }
+
+    {
+        CLC_IL_define_empty(int, src);
+        CLC_IL_define_empty(int, dst);
+
+        for (int i = 1; 7 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_IL_push_front_by_ref(src, &i));
+        }
+
+        TEST_INT_EQ(0, CLC_IL_erase(src, 2));
+
+        TEST_INT_EQ(65421, accumulate_ints(&src));
+
+        TEST_INT_EQ(0, clc_il_copy(&dst, &src));
+
+        TEST_INT_EQ(5, CLC_IL_len(dst));
+        TEST_INT_EQ(1, CLC_IL_num_free(dst));
+        TEST_INT_EQ(65421, accumulate_ints(&dst));
+        TEST_PTR_NE(src.data.storage, dst.data.storage);
+
+        /* the copy is independent of the original */
+
+        clc_il_free_storage(&src);
+
+        {
+            uint32_t ix;
+
+            TEST_INT_EQ(0, clc_il_push_back_by_ref(&dst, &(int){ 3 }, &ix));
+            TEST_INT_EQ(2, ix);
+        }
+
+        TEST_INT_EQ(654213, accumulate_ints(&dst));
+
+        clc_il_free_storage(&dst);
+    }
+}
+
+static void TEST_clear_AND_free_storage_INVOKE_CALLBACK(void)
+{
+    {
+        int total_freed = 0;
+
+        CLC_IL_define_empty_with_cb(int, l, fn_accumulate_int, &total_freed);
+
+        for (int i = 0; 100 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_IL_push_back_by_ref(l, &i));
+        }
+
+        {
+            size_t num_dropped;
+
+            TEST_INT_EQ(0, CLC_IL_clear(l, &num_dropped));
+            TEST_INT_EQ(100, num_dropped);
+            TEST_INT_EQ((99 * 100) / 2, total_freed);
+            TEST_BOOLEAN_TRUE(CLC_IL_is_empty(l));
+            TEST_PTR_NE(NULL, l.data.storage);
+        }
+
+        total_freed = 0;
+
+        for (int i = 0; 10 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_IL_push_front_by_ref(l, &i));
+        }
+
+        clc_il_free_storage(&l);
+
+        TEST_INT_EQ(45, total_freed);
+        TEST_PTR_EQ(NULL, l.data.storage);
+    }
+}
+
+static void TEST_define_empty_with_allocator_THEN_push_back_THEN_copy(void)
+{
+    counting_allocator_context_t    ctxt        =   { 0 };
+    collect_c_allocator_t const     allocator   =   { &fn_counting_alloc, &fn_counting_realloc, &fn_counting_free, &ctxt };
+
+    {
+        CLC_IL_define_empty_with_allocator(int, src, &allocator);
+        CLC_IL_define_empty_with_allocator(int, dst, &allocator);
+
+        TEST_PTR_EQ(&allocator, src.data.allocator);
+        TEST_PTR_EQ(&allocator, src.links.allocator);
+
+        for (int i = 0; 1000 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_IL_push_back_by_ref(src, &i));
+        }
+
+        /* the elements and the links, and their growth */
+        TEST_INT_EQ(2, ctxt.num_allocs);
+        TEST_INT_GE(2, ctxt.num_reallocs);
+
+        TEST_INT_EQ(0, clc_il_copy(&dst, &src));
+
+        TEST_INT_EQ(4, ctxt.num_allocs);
+        TEST_INT_EQ(1000, CLC_IL_len(dst));
+        TEST_INT_EQ(0, memcmp(src.data.storage, dst.data.storage, 1000 * sizeof(int)));
+
+        clc_il_free_storage(&src);
+        clc_il_free_storage(&dst);
+
+        TEST_INT_EQ(ctxt.num_allocs, ctxt.num_frees);
+        TEST_INT_EQ(0, ctxt.cb_outstanding);
+    }
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
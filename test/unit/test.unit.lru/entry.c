@@ -0,0 +1,637 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test/unit/test.unit.lru/entry.c
+ *
+ * Purpose: Unit-test for LRU cache.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/terse/lru.h>
+
+#include <xtests/terse-api.h>
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+static void TEST_define_empty(void);
+static void TEST_insert_3_ELEMENTS_THEN_find(void);
+static void TEST_insert_3_ELEMENTS_THEN_lookup_MOVES_TO_FRONT(void);
+static void TEST_insert_DUPLICATE_REPLACES(void);
+static void TEST_insert_BEYOND_max_size_EVICTS_LRU(void);
+static void TEST_insert_WITH_LARGE_max_size_GROWS_INDEX_GEOMETRICALLY(void);
+static void TEST_insert_3_ELEMENTS_THEN_erase_node(void);
+static void TEST_insert_1000_ELEMENTS_UNBOUNDED_THEN_find_ALL(void);
+static void TEST_insert_1000_ELEMENTS_BOUNDED_THEN_clear(void);
+static void TEST_insert_100_ELEMENTS_THEN_erase_THEN_compact(void);
+static void TEST_define_empty_with_allocator_THEN_insert_BEYOND_max_size_THEN_compact(void);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char* argv[])
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSE_HELP_OR_VERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.lru", verbosity))
+    {
+        XTESTS_RUN_CASE(TEST_define_empty);
+        XTESTS_RUN_CASE(TEST_insert_3_ELEMENTS_THEN_find);
+        XTESTS_RUN_CASE(TEST_insert_3_ELEMENTS_THEN_lookup_MOVES_TO_FRONT);
+        XTESTS_RUN_CASE(TEST_insert_DUPLICATE_REPLACES);
+        XTESTS_RUN_CASE(TEST_insert_BEYOND_max_size_EVICTS_LRU);
+        XTESTS_RUN_CASE(TEST_insert_WITH_LARGE_max_size_GROWS_INDEX_GEOMETRICALLY);
+        XTESTS_RUN_CASE(TEST_insert_3_ELEMENTS_THEN_erase_node);
+        XTESTS_RUN_CASE(TEST_insert_1000_ELEMENTS_UNBOUNDED_THEN_find_ALL);
+        XTESTS_RUN_CASE(TEST_insert_1000_ELEMENTS_BOUNDED_THEN_clear);
+        XTESTS_RUN_CASE(TEST_insert_100_ELEMENTS_THEN_erase_THEN_compact);
+        XTESTS_RUN_CASE(TEST_define_empty_with_allocator_THEN_insert_BEYOND_max_size_THEN_compact);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function definitions
+ */
+
+struct entry_t
+{
+    int         key;
+    int         value;
+};
+typedef struct entry_t entry_t;
+
+size_t
+hash_entry(
+    collect_c_dlist_t const*    l
+,   void const*                 p_el
+)
+{
+    ((void)&l);
+
+    /* deliberately poor, to exercise collisions */
+
+    return (size_t)((entry_t const*)p_el)->key % 7;
+}
+
+int
+compare_entry(
+    collect_c_dlist_t const*    l
+,   void const*                 p_lhs
+,   void const*                 p_rhs
+)
+{
+    int const k_lhs = ((entry_t const*)p_lhs)->key;
+    int const k_rhs = ((entry_t const*)p_rhs)->key;
+
+    ((void)&l);
+
+    return (k_lhs < k_rhs) ? -1 : (k_lhs > k_rhs) ? +1 : 0;
+}
+
+void
+fn_accumulate_value(
+    size_t  el_size
+,   size_t  el_index
+,   void*   el_ptr
+,   void*   param_element_free
+)
+{
+    ((void)&el_size);
+    ((void)&el_index);
+
+    *(int*)param_element_free += ((entry_t const*)el_ptr)->value;
+}
+
+int
+insert_entry(
+    collect_c_lru_t*    c
+,   int                 key
+,   int                 value
+)
+{
+    entry_t const el = { key, value };
+
+    return CLC_LRU_insert_by_ref(c, &el);
+}
+
+int
+accumulate_values_mru_to_lru(
+    collect_c_lru_t const*  c
+)
+{
+    int r = 0;
+
+    for (collect_c_dlist_node_t const* n = c->list.head; NULL != n; n = n->next)
+    {
+        r = (r * 10) + ((entry_t const*)&n->data->data[0])->value;
+    }
+
+    return r;
+}
+
+
+/* an allocator that counts its invocations, and the bytes outstanding, so
+ * that the sizes passed to it may be verified
+ */
+struct counting_allocator_context_t
+{
+    size_t  num_allocs;
+    size_t  num_frees;
+    size_t  cb_outstanding;
+};
+typedef struct counting_allocator_context_t counting_allocator_context_t;
+
+void* fn_counting_alloc(
+    void*   context
+,   size_t  cb
+)
+{
+    counting_allocator_context_t* const ctxt = (counting_allocator_context_t*)context;
+
+    ++ctxt->num_allocs;
+    ctxt->cb_outstanding += cb;
+
+    return malloc(cb);
+}
+
+void fn_counting_free(
+    void*   context
+,   void*   p
+,   size_t  cb
+)
+{
+    counting_allocator_context_t* const ctxt = (counting_allocator_context_t*)context;
+
+    ++ctxt->num_frees;
+    ctxt->cb_outstanding -= cb;
+
+    free(p);
+}
+
+static void TEST_define_empty(void)
+{
+    {
+        CLC_LRU_define_empty(entry_t, c, 0, hash_entry, compare_entry);
+
+        TEST_BOOLEAN_TRUE(CLC_LRU_is_empty(c));
+        TEST_INT_EQ(0, CLC_LRU_len(c));
+        TEST_INT_EQ(0, CLC_LRU_max_size(c));
+
+        {
+            entry_t const           key =   { 1, 0 };
+            collect_c_dlist_node_t* node;
+            int const               r   =   clc_lru_find_node(&c, &key, &node);
+
+            TEST_INT_EQ(ENOENT, r);
+            TEST_PTR_EQ(NULL, node);
+        }
+
+        clc_lru_free_storage(&c);
+    }
+
+    {
+        CLC_LRU_define_empty(entry_t, c, 10, hash_entry, compare_entry);
+
+        TEST_BOOLEAN_TRUE(CLC_LRU_is_empty(c));
+        TEST_INT_EQ(0, CLC_LRU_len(c));
+        TEST_INT_EQ(10, CLC_LRU_max_size(c));
+
+        clc_lru_free_storage(&c);
+    }
+}
+
+static void TEST_insert_3_ELEMENTS_THEN_find(void)
+{
+    {
+        CLC_LRU_define_empty(entry_t, c, 0, hash_entry, compare_entry);
+
+        TEST_INT_EQ(0, insert_entry(&c, 1, 1));
+        TEST_INT_EQ(0, insert_entry(&c, 8, 2));
+        TEST_INT_EQ(0, insert_entry(&c, 15, 3));
+
+        TEST_INT_EQ(3, CLC_LRU_len(c));
+        TEST_INT_EQ(321, accumulate_values_mru_to_lru(&c));
+
+        /* find (which does not affect recency) */
+        {
+            entry_t const           key =   { 8, 0 };
+            collect_c_dlist_node_t* node;
+            int const               r   =   clc_lru_find_node(&c, &key, &node);
+
+            TEST_INT_EQ(0, r);
+            TEST_PTR_NE(NULL, node);
+            TEST_INT_EQ(2, ((entry_t const*)&node->data->data[0])->value);
+
+            TEST_INT_EQ(321, accumulate_values_mru_to_lru(&c));
+        }
+
+        /* find one that does not exist (but whose hash collides) */
+        {
+            entry_t const           key =   { 22, 0 };
+            collect_c_dlist_node_t* node;
+            int const               r   =   clc_lru_find_node(&c, &key, &node);
+
+            TEST_INT_EQ(ENOENT, r);
+            TEST_PTR_EQ(NULL, node);
+        }
+
+        clc_lru_free_storage(&c);
+    }
+}
+
+static void TEST_insert_3_ELEMENTS_THEN_lookup_MOVES_TO_FRONT(void)
+{
+    {
+        CLC_LRU_define_empty(entry_t, c, 0, hash_entry, compare_entry);
+
+        TEST_INT_EQ(0, insert_entry(&c, 1, 1));
+        TEST_INT_EQ(0, insert_entry(&c, 2, 2));
+        TEST_INT_EQ(0, insert_entry(&c, 3, 3));
+
+        TEST_INT_EQ(321, accumulate_values_mru_to_lru(&c));
+
+        {
+            entry_t const           key =   { 1, 0 };
+            collect_c_dlist_node_t* node;
+            int const               r   =   clc_lru_lookup(&c, &key, &node);
+
+            TEST_INT_EQ(0, r);
+            TEST_INT_EQ(132, accumulate_values_mru_to_lru(&c));
+
+            TEST_INT_EQ(1, CLC_LRU_cmru_t(c, entry_t)->value);
+            TEST_INT_EQ(2, CLC_LRU_clru_t(c, entry_t)->value);
+        }
+
+        {
+            entry_t const           key =   { 3, 0 };
+            collect_c_dlist_node_t* node;
+            int const               r   =   clc_lru_lookup(&c, &key, &node);
+
+            TEST_INT_EQ(0, r);
+            TEST_INT_EQ(312, accumulate_values_mru_to_lru(&c));
+        }
+
+        {
+            entry_t const           key =   { 2, 0 };
+            collect_c_dlist_node_t* node;
+            int const               r   =   clc_lru_lookup(&c, &key, &node);
+
+            TEST_INT_EQ(0, r);
+            TEST_INT_EQ(231, accumulate_values_mru_to_lru(&c));
+
+            TEST_INT_EQ(0, CLC_LRU_touch_node(c, c.list.tail));
+            TEST_INT_EQ(123, accumulate_values_mru_to_lru(&c));
+        }
+
+        clc_lru_free_storage(&c);
+    }
+}
+
+static void TEST_insert_DUPLICATE_REPLACES(void)
+{
+    {
+        int total_freed = 0;
+
+        CLC_LRU_define_empty_with_cb(entry_t, c, 0, hash_entry, compare_entry, fn_accumulate_value, &total_freed);
+
+        TEST_INT_EQ(0, insert_entry(&c, 1, 1));
+        TEST_INT_EQ(0, insert_entry(&c, 2, 2));
+        TEST_INT_EQ(0, insert_entry(&c, 1, 7));
+
+        TEST_INT_EQ(2, CLC_LRU_len(c));
+        TEST_INT_EQ(72, accumulate_values_mru_to_lru(&c));
+        TEST_INT_EQ(1, total_freed);
+
+        clc_lru_free_storage(&c);
+
+        TEST_INT_EQ(10, total_freed);
+    }
+}
+
+static void TEST_insert_BEYOND_max_size_EVICTS_LRU(void)
+{
+    {
+        int total_freed = 0;
+
+        CLC_LRU_define_empty_with_cb(entry_t, c, 3, hash_entry, compare_entry, fn_accumulate_value, &total_freed);
+
+        TEST_INT_EQ(0, insert_entry(&c, 1, 1));
+        TEST_INT_EQ(0, insert_entry(&c, 2, 2));
+        TEST_INT_EQ(0, insert_entry(&c, 3, 3));
+
+        TEST_INT_EQ(3, CLC_LRU_len(c));
+        TEST_INT_EQ(0, total_freed);
+
+        /* touch 1, so that 2 becomes least-recently used */
+        {
+            entry_t const           key =   { 1, 0 };
+            collect_c_dlist_node_t* node;
+
+            TEST_INT_EQ(0, clc_lru_lookup(&c, &key, &node));
+        }
+
+        TEST_INT_EQ(0, insert_entry(&c, 4, 4));
+
+        TEST_INT_EQ(3, CLC_LRU_len(c));
+        TEST_INT_EQ(2, total_freed);
+        TEST_INT_EQ(413, accumulate_values_mru_to_lru(&c));
+
+        /* evicted node is reused */
+        TEST_INT_EQ(0, COLLECT_C_DLIST_spare(c.list));
+
+        {
+            entry_t const           key =   { 2, 0 };
+            collect_c_dlist_node_t* node;
+
+            TEST_INT_EQ(ENOENT, clc_lru_find_node(&c, &key, &node));
+        }
+
+        TEST_INT_EQ(0, insert_entry(&c, 5, 5));
+
+        TEST_INT_EQ(3, CLC_LRU_len(c));
+        TEST_INT_EQ(5, total_freed);
+        TEST_INT_EQ(541, accumulate_values_mru_to_lru(&c));
+
+        clc_lru_free_storage(&c);
+
+        TEST_INT_EQ(15, total_freed);
+    }
+}
+
+static void TEST_insert_WITH_LARGE_max_size_GROWS_INDEX_GEOMETRICALLY(void)
+{
+    /* the index is sized from the number of elements, not from max_size */
+    {
+        CLC_LRU_define_empty(entry_t, c, 100000000, hash_entry, compare_entry);
+
+        TEST_INT_EQ(0, insert_entry(&c, 1, 1));
+
+        TEST_INT_EQ(1, CLC_LRU_len(c));
+        TEST_INT_EQ(16, c.num_slots);
+
+        for (int i = 2; 1000 >= i; ++i)
+        {
+            TEST_INT_EQ(0, insert_entry(&c, i, i));
+        }
+
+        TEST_INT_EQ(1000, CLC_LRU_len(c));
+        TEST_INT_EQ(2048, c.num_slots);
+
+        clc_lru_free_storage(&c);
+    }
+
+    /* ... and stops growing once max_size is reached */
+    {
+        CLC_LRU_define_empty(entry_t, c, 10, hash_entry, compare_entry);
+
+        for (int i = 0; 1000 != i; ++i)
+        {
+            TEST_INT_EQ(0, insert_entry(&c, i, i));
+        }
+
+        TEST_INT_EQ(10, CLC_LRU_len(c));
+        TEST_INT_EQ(32, c.num_slots);
+
+        clc_lru_free_storage(&c);
+    }
+}
+
+static void TEST_insert_3_ELEMENTS_THEN_erase_node(void)
+{
+    {
+        int total_freed = 0;
+
+        CLC_LRU_define_empty_with_cb(entry_t, c, 0, hash_entry, compare_entry, fn_accumulate_value, &total_freed);
+
+        TEST_INT_EQ(0, insert_entry(&c, 1, 1));
+        TEST_INT_EQ(0, insert_entry(&c, 8, 2));
+        TEST_INT_EQ(0, insert_entry(&c, 15, 3));
+
+        {
+            entry_t const           key =   { 1, 0 };
+            collect_c_dlist_node_t* node;
+
+            TEST_INT_EQ(0, clc_lru_find_node(&c, &key, &node));
+
+            TEST_INT_EQ(0, CLC_LRU_erase_node(c, node));
+
+            TEST_INT_EQ(2, CLC_LRU_len(c));
+            TEST_INT_EQ(1, total_freed);
+            TEST_INT_EQ(32, accumulate_values_mru_to_lru(&c));
+
+            TEST_INT_EQ(ENOENT, clc_lru_find_node(&c, &key, &node));
+        }
+
+        /* remaining colliding elements are still found */
+        {
+            entry_t const           key_8   =   { 8, 0 };
+            entry_t const           key_15  =   { 15, 0 };
+            collect_c_dlist_node_t* node;
+
+            TEST_INT_EQ(0, clc_lru_find_node(&c, &key_8, &node));
+            TEST_INT_EQ(0, clc_lru_find_node(&c, &key_15, &node));
+        }
+
+        clc_lru_free_storage(&c);
+    }
+}
+
+static void TEST_insert_1000_ELEMENTS_UNBOUNDED_THEN_find_ALL(void)
+{
+    {
+        CLC_LRU_define_empty(entry_t, c, 0, hash_entry, compare_entry);
+
+        for (int i = 0; 1000 != i; ++i)
+        {
+            entry_t const el = { i, i };
+
+            TEST_INT_EQ(0, clc_lru_insert_by_ref(&c, &el, NULL));
+        }
+
+        TEST_INT_EQ(1000, CLC_LRU_len(c));
+        TEST_INT_EQ(999, CLC_LRU_cmru_t(c, entry_t)->value);
+        TEST_INT_EQ(0, CLC_LRU_clru_t(c, entry_t)->value);
+
+        for (int i = 0; 1000 != i; ++i)
+        {
+            entry_t const           key =   { i, 0 };
+            collect_c_dlist_node_t* node;
+            int const               r   =   clc_lru_find_node(&c, &key, &node);
+
+            TEST_INT_EQ(0, r);
+
+            if (0 == r)
+            {
+                TEST_INT_EQ(i, ((entry_t const*)&node->data->data[0])->value);
+            }
+        }
+
+        clc_lru_free_storage(&c);
+    }
+}
+
+static void TEST_insert_1000_ELEMENTS_BOUNDED_THEN_clear(void)
+{
+    {
+        int total_freed = 0;
+
+        CLC_LRU_define_empty_with_cb(entry_t, c, 100, hash_entry, compare_entry, fn_accumulate_value, &total_freed);
+
+        for (int i = 0; 1000 != i; ++i)
+        {
+            entry_t const el = { i, 1 };
+
+            TEST_INT_EQ(0, clc_lru_insert_by_ref(&c, &el, NULL));
+        }
+
+        TEST_INT_EQ(100, CLC_LRU_len(c));
+        TEST_INT_EQ(900, total_freed);
+
+        for (int i = 0; 1000 != i; ++i)
+        {
+            entry_t const           key =   { i, 0 };
+            collect_c_dlist_node_t* node;
+            int const               r   =   clc_lru_find_node(&c, &key, &node);
+
+            TEST_INT_EQ(i < 900 ? ENOENT : 0, r);
+        }
+
+        {
+            size_t      num_dropped;
+            int const   r = CLC_LRU_clear(c, &num_dropped);
+
+            TEST_INT_EQ(0, r);
+            TEST_INT_EQ(100, num_dropped);
+            TEST_INT_EQ(1000, total_freed);
+
+            TEST_BOOLEAN_TRUE(CLC_LRU_is_empty(c));
+        }
+
+        {
+            entry_t const           key =   { 999, 0 };
+            collect_c_dlist_node_t* node;
+
+            TEST_INT_EQ(ENOENT, clc_lru_find_node(&c, &key, &node));
+        }
+
+        clc_lru_free_storage(&c);
+
+        TEST_INT_EQ(1000, total_freed);
+    }
+}
+
+
+static void TEST_insert_100_ELEMENTS_THEN_erase_THEN_compact(void)
+{
+    {
+        CLC_LRU_define_empty(entry_t, c, 0, hash_entry, compare_entry);
+
+        for (int i = 0; 100 != i; ++i)
+        {
+            entry_t const el = { i, i };
+
+            TEST_INT_EQ(0, clc_lru_insert_by_ref(&c, &el, NULL));
+        }
+
+        for (int i = 0; i < 100; i += 3)
+        {
+            entry_t const           key =   { i, 0 };
+            collect_c_dlist_node_t* node;
+
+            TEST_INT_EQ(0, clc_lru_find_node(&c, &key, &node));
+            TEST_INT_EQ(0, clc_lru_erase_node(&c, node));
+        }
+
+        TEST_INT_EQ(66, CLC_LRU_len(c));
+
+        {
+            int const r = clc_lru_compact(&c);
+
+            TEST_INTEGER_EQUAL_ANY_OF2(0, ENOMEM, r);
+        }
+
+        TEST_INT_EQ(66, CLC_LRU_len(c));
+        TEST_INT_EQ(98, CLC_LRU_cmru_t(c, entry_t)->value);
+        TEST_INT_EQ(1, CLC_LRU_clru_t(c, entry_t)->value);
+
+        for (int i = 0; 100 != i; ++i)
+        {
+            entry_t const           key =   { i, 0 };
+            collect_c_dlist_node_t* node;
+            int const               r   =   clc_lru_find_node(&c, &key, &node);
+
+            TEST_INT_EQ((0 == i % 3) ? ENOENT : 0, r);
+
+            if (0 == r)
+            {
+                TEST_INT_EQ(i, ((entry_t const*)&node->data->data[0])->value);
+
+                /* the index must refer to the relocated nodes */
+                TEST_INT_EQ(0, clc_lru_touch_node(&c, node));
+            }
+        }
+
+        clc_lru_free_storage(&c);
+    }
+}
+
+static void TEST_define_empty_with_allocator_THEN_insert_BEYOND_max_size_THEN_compact(void)
+{
+    counting_allocator_context_t    ctxt        =   { 0 };
+    collect_c_allocator_t const     allocator   =   { &fn_counting_alloc, NULL, &fn_counting_free, &ctxt };
+
+    {
+        CLC_LRU_define_empty_with_allocator(entry_t, c, 100, hash_entry, compare_entry, &allocator);
+
+        TEST_PTR_EQ(&allocator, c.allocator);
+        TEST_PTR_EQ(&allocator, c.list.allocator);
+
+        for (int i = 0; 1000 != i; ++i)
+        {
+            TEST_INT_EQ(0, insert_entry(&c, i, i));
+        }
+
+        TEST_INT_EQ(100, CLC_LRU_len(c));
+
+        /* the nodes, and each size of the index */
+        TEST_INT_GE(100 + 1, ctxt.num_allocs);
+
+        TEST_INT_EQ(0, clc_lru_compact(&c));
+
+        TEST_INT_EQ(100, CLC_LRU_len(c));
+        TEST_INT_EQ(999, CLC_LRU_cmru_t(c, entry_t)->value);
+        TEST_INT_EQ(900, CLC_LRU_clru_t(c, entry_t)->value);
+
+        clc_lru_free_storage(&c);
+
+        TEST_INT_EQ(ctxt.num_allocs, ctxt.num_frees);
+        TEST_INT_EQ(0, ctxt.cb_outstanding);
+    }
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
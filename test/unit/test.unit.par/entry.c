@@ -0,0 +1,663 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test/unit/test.unit.par/entry.c
+ *
+ * Purpose: Unit-test for thread pool and parallel algorithms.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/terse/par.h>
+#include <collect-c/terse/vec.h>
+
+#include <xtests/terse-api.h>
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+static void TEST_pool_create_AND_destroy(void);
+static void TEST_pool_run_EACH_TASK_ONCE(void);
+static void TEST_pool_run_NESTED(void);
+static void TEST_for_each_SUBRANGE(void);
+static void TEST_transform_TO_OTHER_ELEMENT_SIZE(void);
+static void TEST_reduce_INTEGER_SUM(void);
+static void TEST_reduce_FLOATING_POINT_IS_DETERMINISTIC(void);
+static void TEST_sort_MATCHES_SERIAL_SORT(void);
+static void TEST_sort_IS_DETERMINISTIC(void);
+static void TEST_sort_WITH_FAILING_ALLOCATOR(void);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char* argv[])
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSE_HELP_OR_VERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.par", verbosity))
+    {
+        XTESTS_RUN_CASE(TEST_pool_create_AND_destroy);
+        XTESTS_RUN_CASE(TEST_pool_run_EACH_TASK_ONCE);
+        XTESTS_RUN_CASE(TEST_pool_run_NESTED);
+        XTESTS_RUN_CASE(TEST_for_each_SUBRANGE);
+        XTESTS_RUN_CASE(TEST_transform_TO_OTHER_ELEMENT_SIZE);
+        XTESTS_RUN_CASE(TEST_reduce_INTEGER_SUM);
+        XTESTS_RUN_CASE(TEST_reduce_FLOATING_POINT_IS_DETERMINISTIC);
+        XTESTS_RUN_CASE(TEST_sort_MATCHES_SERIAL_SORT);
+        XTESTS_RUN_CASE(TEST_sort_IS_DETERMINISTIC);
+        XTESTS_RUN_CASE(TEST_sort_WITH_FAILING_ALLOCATOR);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function definitions
+ */
+
+/* a record, sorted by key, whose seq identifies its original position */
+struct record_t
+{
+    uint32_t    key;
+    uint32_t    seq;
+    uint64_t    payload;
+};
+typedef struct record_t record_t;
+
+static uint32_t next_random(
+    uint32_t*   state
+)
+{
+    *state = (*state * 1664525u) + 1013904223u;
+
+    return *state >> 8;
+}
+
+static int fn_compare_uint32(
+    collect_c_vec_t const*  v
+,   void const*             p_lhs
+,   void const*             p_rhs
+)
+{
+    uint32_t const lhs = *(uint32_t const*)p_lhs;
+    uint32_t const rhs = *(uint32_t const*)p_rhs;
+
+    ((void)&v);
+
+    return (lhs > rhs) - (lhs < rhs);
+}
+
+static int fn_compare_record(
+    collect_c_vec_t const*  v
+,   void const*             p_lhs
+,   void const*             p_rhs
+)
+{
+    record_t const* const lhs = (record_t const*)p_lhs;
+    record_t const* const rhs = (record_t const*)p_rhs;
+
+    ((void)&v);
+
+    return (lhs->key > rhs->key) - (lhs->key < rhs->key);
+}
+
+static void* fn_failing_alloc(
+    void*   context
+,   size_t  cb
+)
+{
+    ((void)&context);
+    ((void)&cb);
+
+    return NULL;
+}
+
+static void fn_task_increment(
+    size_t  index
+,   void*   param
+)
+{
+    int* const counts = (int*)param;
+
+    ++counts[index];
+}
+
+struct nested_param_t
+{
+    collect_c_par_pool_t*   pool;
+    int*                    counts;
+};
+
+static void fn_task_inner(
+    size_t  index
+,   void*   param
+)
+{
+    int* const counts = (int*)param;
+
+    ++counts[index];
+}
+
+static void fn_task_outer(
+    size_t  index
+,   void*   param
+)
+{
+    struct nested_param_t const* const np = (struct nested_param_t const*)param;
+
+    clc_par_pool_run(np->pool, 100, fn_task_inner, np->counts + (index * 100));
+}
+
+static void fn_for_each_add(
+    collect_c_vec_t const*  v
+,   size_t                  index
+,   void*                   p_el
+,   void*                   param
+)
+{
+    ((void)&v);
+    ((void)&index);
+
+    *(uint32_t*)p_el += *(uint32_t const*)param;
+}
+
+static void fn_transform_square(
+    collect_c_vec_t const*  v
+,   size_t                  index
+,   void const*             p_src
+,   void*                   p_dst
+,   void*                   param
+)
+{
+    uint32_t const x = *(uint32_t const*)p_src;
+
+    ((void)&v);
+    ((void)&index);
+    ((void)&param);
+
+    *(uint64_t*)p_dst = (uint64_t)x * x;
+}
+
+static void fn_accumulate_uint64(
+    collect_c_vec_t const*  v
+,   void*                   p_acc
+,   void const*             p_el
+,   void*                   param
+)
+{
+    ((void)&v);
+    ((void)&param);
+
+    *(uint64_t*)p_acc += *(uint32_t const*)p_el;
+}
+
+static void fn_combine_uint64(
+    collect_c_vec_t const*  v
+,   void*                   p_acc
+,   void const*             p_other
+,   void*                   param
+)
+{
+    ((void)&v);
+    ((void)&param);
+
+    *(uint64_t*)p_acc += *(uint64_t const*)p_other;
+}
+
+static void fn_accumulate_double(
+    collect_c_vec_t const*  v
+,   void*                   p_acc
+,   void const*             p_el
+,   void*                   param
+)
+{
+    ((void)&v);
+    ((void)&param);
+
+    *(double*)p_acc += *(double const*)p_el;
+}
+
+static void fn_combine_double(
+    collect_c_vec_t const*  v
+,   void*                   p_acc
+,   void const*             p_other
+,   void*                   param
+)
+{
+    ((void)&v);
+    ((void)&param);
+
+    *(double*)p_acc += *(double const*)p_other;
+}
+
+
+static void TEST_pool_create_AND_destroy(void)
+{
+    {
+        collect_c_par_pool_t* pool = NULL;
+
+        TEST_INT_EQ(0, clc_par_pool_create(4, NULL, &pool));
+        TEST_PTR_NE(NULL, pool);
+
+#if defined(__unix__) || defined(__APPLE__)
+
+        TEST_INT_EQ(4, clc_par_pool_num_threads(pool));
+#endif
+
+        clc_par_pool_destroy(pool);
+    }
+
+    {
+        collect_c_par_pool_t* pool = NULL;
+
+        TEST_INT_EQ(0, clc_par_pool_create(0, NULL, &pool));
+        TEST_PTR_NE(NULL, pool);
+
+        TEST_INT_GE(1, clc_par_pool_num_threads(pool));
+
+        clc_par_pool_destroy(pool);
+    }
+
+    {
+        collect_c_allocator_t const allocator = { fn_failing_alloc, NULL, NULL, NULL };
+
+        collect_c_par_pool_t* pool = NULL;
+
+        TEST_INT_EQ(ENOMEM, clc_par_pool_create(4, &allocator, &pool));
+        TEST_PTR_EQ(NULL, pool);
+    }
+
+    TEST_INT_EQ(1, clc_par_pool_num_threads(NULL));
+
+    clc_par_pool_destroy(NULL);
+}
+
+static void TEST_pool_run_EACH_TASK_ONCE(void)
+{
+    size_t const            sizes[] = { 0, 1, 2, 3, 7, 64, 1000, 100000 };
+    collect_c_par_pool_t*   pool    = NULL;
+
+    TEST_INT_EQ(0, clc_par_pool_create(4, NULL, &pool));
+
+    for (size_t is = 0; sizeof(sizes) / sizeof(sizes[0]) != is; ++is)
+    {
+        size_t const    n       =   sizes[is];
+        int* const      counts  =   (int*)calloc(n + 1, sizeof(int));
+
+        clc_par_pool_run(pool, n, fn_task_increment, counts);
+
+        for (size_t i = 0; n != i; ++i)
+        {
+            TEST_INT_EQ(1, counts[i]);
+        }
+
+        clc_par_pool_run(NULL, n, fn_task_increment, counts);
+
+        for (size_t i = 0; n != i; ++i)
+        {
+            TEST_INT_EQ(2, counts[i]);
+        }
+
+        TEST_INT_EQ(0, counts[n]);
+
+        free(counts);
+    }
+
+    clc_par_pool_destroy(pool);
+}
+
+static void TEST_pool_run_NESTED(void)
+{
+    collect_c_par_pool_t*   pool    =   NULL;
+    int* const              counts  =   (int*)calloc(50 * 100, sizeof(int));
+
+    TEST_INT_EQ(0, clc_par_pool_create(3, NULL, &pool));
+
+    {
+        struct nested_param_t np = { pool, counts };
+
+        clc_par_pool_run(pool, 50, fn_task_outer, &np);
+    }
+
+    for (size_t i = 0; 50 * 100 != i; ++i)
+    {
+        TEST_INT_EQ(1, counts[i]);
+    }
+
+    free(counts);
+
+    clc_par_pool_destroy(pool);
+}
+
+static void TEST_for_each_SUBRANGE(void)
+{
+    collect_c_par_pool_t*   pool    =   NULL;
+    uint32_t                addend  =   10;
+
+    CLC_V_define_empty(uint32_t, v);
+
+    TEST_INT_EQ(0, clc_par_pool_create(4, NULL, &pool));
+
+    TEST_INT_EQ(0, CLC_V_reserve(v, 100000, 0));
+
+    for (uint32_t i = 0; 100000 != i; ++i)
+    {
+        TEST_INT_EQ(0, CLC_V_push_back_by_value(v, uint32_t, i));
+    }
+
+    clc_par_for_each(pool, &v, 1000, 90000, fn_for_each_add, &addend);
+
+    for (uint32_t i = 0; 100000 != i; ++i)
+    {
+        uint32_t const expected = (i >= 1000 && i < 90000) ? (i + 10) : i;
+
+        TEST_INT_EQ(expected, *CLC_V_cat_t(v, uint32_t, i));
+    }
+
+    CLC_PAR_for_each(NULL, v, fn_for_each_add, &addend);
+
+    TEST_INT_EQ(10, *CLC_V_cat_t(v, uint32_t, 0));
+    TEST_INT_EQ(1020, *CLC_V_cat_t(v, uint32_t, 1000));
+    TEST_INT_EQ(99999 + 10, *CLC_V_cat_t(v, uint32_t, 99999));
+
+    collect_c_vec_free_storage(&v);
+
+    clc_par_pool_destroy(pool);
+}
+
+static void TEST_transform_TO_OTHER_ELEMENT_SIZE(void)
+{
+    collect_c_par_pool_t* pool = NULL;
+
+    CLC_V_define_empty(uint32_t, v);
+    CLC_V_define_empty(uint64_t, v_dst);
+
+    TEST_INT_EQ(0, clc_par_pool_create(4, NULL, &pool));
+
+    TEST_INT_EQ(0, CLC_V_reserve(v, 50000, 0));
+    TEST_INT_EQ(0, CLC_V_reserve(v_dst, 50000, 0));
+
+    for (uint32_t i = 0; 50000 != i; ++i)
+    {
+        TEST_INT_EQ(0, CLC_V_push_back_by_value(v, uint32_t, i + 100000));
+        TEST_INT_EQ(0, CLC_V_push_back_by_value(v_dst, uint64_t, 0));
+    }
+
+    clc_par_transform(pool, &v, 0, 50000, &v_dst, fn_transform_square, NULL);
+
+    for (uint32_t i = 0; 50000 != i; ++i)
+    {
+        uint64_t const x = i + 100000;
+
+        TEST_BOOLEAN_TRUE(x * x == *CLC_V_cat_t(v_dst, uint64_t, i));
+    }
+
+    collect_c_vec_free_storage(&v_dst);
+    collect_c_vec_free_storage(&v);
+
+    clc_par_pool_destroy(pool);
+}
+
+static void TEST_reduce_INTEGER_SUM(void)
+{
+    collect_c_par_pool_t* pool = NULL;
+
+    CLC_V_define_empty(uint32_t, v);
+
+    TEST_INT_EQ(0, clc_par_pool_create(4, NULL, &pool));
+
+    /* empty range yields the identity */
+    {
+        uint64_t const  identity    =   0;
+        uint64_t        sum         =   999;
+
+        TEST_INT_EQ(0, clc_par_reduce(pool, &v, 0, 0, sizeof(uint64_t), &identity, fn_accumulate_uint64, fn_combine_uint64, NULL, &sum));
+        TEST_INT_EQ(0, sum);
+    }
+
+    TEST_INT_EQ(0, CLC_V_reserve(v, 200000, 0));
+
+    for (uint32_t i = 0; 200000 != i; ++i)
+    {
+        TEST_INT_EQ(0, CLC_V_push_back_by_value(v, uint32_t, i));
+    }
+
+    {
+        uint64_t const  identity    =   0;
+        uint64_t        sum         =   0;
+
+        TEST_INT_EQ(0, clc_par_reduce(pool, &v, 0, 200000, sizeof(uint64_t), &identity, fn_accumulate_uint64, fn_combine_uint64, NULL, &sum));
+        TEST_BOOLEAN_TRUE((uint64_t)199999 * 200000 / 2 == sum);
+
+        TEST_INT_EQ(0, clc_par_reduce(pool, &v, 10, 20, sizeof(uint64_t), &identity, fn_accumulate_uint64, fn_combine_uint64, NULL, &sum));
+        TEST_INT_EQ(145, sum);
+    }
+
+    /* the result may be the identity */
+    {
+        uint64_t sum = 5;
+
+        TEST_INT_EQ(0, clc_par_reduce(pool, &v, 0, 3, sizeof(uint64_t), &sum, fn_accumulate_uint64, fn_combine_uint64, NULL, &sum));
+        TEST_INT_EQ(8, sum);
+    }
+
+    collect_c_vec_free_storage(&v);
+
+    clc_par_pool_destroy(pool);
+}
+
+static void TEST_reduce_FLOATING_POINT_IS_DETERMINISTIC(void)
+{
+    size_t const    thread_counts[] = { 2, 3, 8 };
+    double const    identity        = 0.0;
+    double          expected        = 0.0;
+    uint32_t        state           = 1;
+
+    CLC_V_define_empty(double, v);
+
+    TEST_INT_EQ(0, CLC_V_reserve(v, 300000, 0));
+
+    /* values of widely differing magnitude, whose sum depends on order */
+    for (size_t i = 0; 300000 != i; ++i)
+    {
+        double const x = (double)next_random(&state) * ((0 == i % 7) ? 1.0e10 : 1.0e-3);
+
+        TEST_INT_EQ(0, CLC_V_push_back_by_value(v, double, x));
+    }
+
+    TEST_INT_EQ(0, clc_par_reduce(NULL, &v, 0, 300000, sizeof(double), &identity, fn_accumulate_double, fn_combine_double, NULL, &expected));
+
+    for (size_t it = 0; sizeof(thread_counts) / sizeof(thread_counts[0]) != it; ++it)
+    {
+        collect_c_par_pool_t* pool = NULL;
+
+        TEST_INT_EQ(0, clc_par_pool_create(thread_counts[it], NULL, &pool));
+
+        for (int rep = 0; 3 != rep; ++rep)
+        {
+            double sum = 0.0;
+
+            TEST_INT_EQ(0, clc_par_reduce(pool, &v, 0, 300000, sizeof(double), &identity, fn_accumulate_double, fn_combine_double, NULL, &sum));
+            TEST_INT_EQ(0, memcmp(&expected, &sum, sizeof(double)));
+        }
+
+        clc_par_pool_destroy(pool);
+    }
+
+    collect_c_vec_free_storage(&v);
+}
+
+static void TEST_sort_MATCHES_SERIAL_SORT(void)
+{
+    size_t const            sizes[] = { 0, 1, 2, 4096, 4097, 10000, 123457, 400000 };
+    collect_c_par_pool_t*   pool    = NULL;
+
+    TEST_INT_EQ(0, clc_par_pool_create(4, NULL, &pool));
+
+    for (size_t is = 0; sizeof(sizes) / sizeof(sizes[0]) != is; ++is)
+    {
+        size_t const    n       =   sizes[is];
+        uint32_t        state   =   (uint32_t)n;
+
+        CLC_V_define_empty(uint32_t, v);
+        CLC_V_define_empty(uint32_t, v_expected);
+
+        TEST_INT_EQ(0, CLC_V_reserve(v, n + 2, 0));
+        TEST_INT_EQ(0, CLC_V_reserve(v_expected, n, 0));
+
+        /* sentinels either side of the range */
+        TEST_INT_EQ(0, CLC_V_push_back_by_value(v, uint32_t, 0xffffffff));
+
+        for (size_t i = 0; n != i; ++i)
+        {
+            uint32_t const x = next_random(&state) % (uint32_t)(n / 3 + 1);
+
+            TEST_INT_EQ(0, CLC_V_push_back_by_value(v, uint32_t, x));
+            TEST_INT_EQ(0, CLC_V_push_back_by_value(v_expected, uint32_t, x));
+        }
+
+        TEST_INT_EQ(0, CLC_V_push_back_by_value(v, uint32_t, 0));
+
+        TEST_INT_EQ(0, clc_par_sort(pool, &v, 1, n + 1, fn_compare_uint32));
+        CLC_V_sort(v_expected, fn_compare_uint32);
+
+        TEST_INT_EQ(0xffffffff, *CLC_V_cat_t(v, uint32_t, 0));
+        TEST_INT_EQ(0, *CLC_V_cat_t(v, uint32_t, n + 1));
+
+        for (size_t i = 0; n != i; ++i)
+        {
+            TEST_INT_EQ(*CLC_V_cat_t(v_expected, uint32_t, i), *CLC_V_cat_t(v, uint32_t, i + 1));
+        }
+
+        collect_c_vec_free_storage(&v_expected);
+        collect_c_vec_free_storage(&v);
+    }
+
+    clc_par_pool_destroy(pool);
+}
+
+static void TEST_sort_IS_DETERMINISTIC(void)
+{
+    size_t const    n               = 250000;
+    size_t const    thread_counts[] = { 2, 5, 8 };
+    uint32_t        state           = 7;
+
+    CLC_V_define_empty(record_t, v_source);
+    CLC_V_define_empty(record_t, v_expected);
+
+    TEST_INT_EQ(0, CLC_V_reserve(v_source, n, 0));
+    TEST_INT_EQ(0, CLC_V_reserve(v_expected, n, 0));
+
+    /* few distinct keys, so that the order of equivalent records shows */
+    for (uint32_t i = 0; n != i; ++i)
+    {
+        record_t const r = { next_random(&state) % 100, i, (uint64_t)i * 3 };
+
+        TEST_INT_EQ(0, CLC_V_push_back_by_ref(v_source, &r));
+        TEST_INT_EQ(0, CLC_V_push_back_by_ref(v_expected, &r));
+    }
+
+    TEST_INT_EQ(0, clc_par_sort(NULL, &v_expected, 0, n, fn_compare_record));
+
+    for (size_t i = 0; n != i; ++i)
+    {
+        record_t const* const r = CLC_V_cat_t(v_expected, record_t, i);
+
+        TEST_BOOLEAN_TRUE((uint64_t)r->seq * 3 == r->payload);
+
+        if (0 != i)
+        {
+            TEST_INT_LE(r->key, CLC_V_cat_t(v_expected, record_t, i - 1)->key);
+        }
+    }
+
+    for (size_t it = 0; sizeof(thread_counts) / sizeof(thread_counts[0]) != it; ++it)
+    {
+        collect_c_par_pool_t* pool = NULL;
+
+        CLC_V_define_empty(record_t, v);
+
+        TEST_INT_EQ(0, clc_par_pool_create(thread_counts[it], NULL, &pool));
+
+        TEST_INT_EQ(0, CLC_V_reserve(v, n, 0));
+
+        for (size_t i = 0; n != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_V_push_back_by_ref(v, CLC_V_cat_t(v_source, record_t, i)));
+        }
+
+        TEST_INT_EQ(0, CLC_PAR_sort(pool, v, fn_compare_record));
+
+        TEST_INT_EQ(0, memcmp(v_expected.storage, v.storage, n * sizeof(record_t)));
+
+        collect_c_vec_free_storage(&v);
+
+        clc_par_pool_destroy(pool);
+    }
+
+    collect_c_vec_free_storage(&v_expected);
+    collect_c_vec_free_storage(&v_source);
+}
+
+static void TEST_sort_WITH_FAILING_ALLOCATOR(void)
+{
+    collect_c_allocator_t const allocator   =   { fn_failing_alloc, NULL, NULL, NULL };
+    collect_c_par_pool_t*       pool        =   NULL;
+    uint32_t                    state       =   3;
+
+    CLC_V_define_empty(uint32_t, v);
+
+    TEST_INT_EQ(0, clc_par_pool_create(2, NULL, &pool));
+
+    TEST_INT_EQ(0, CLC_V_reserve(v, 20000, 0));
+
+    for (size_t i = 0; 20000 != i; ++i)
+    {
+        TEST_INT_EQ(0, CLC_V_push_back_by_value(v, uint32_t, next_random(&state)));
+    }
+
+    /* the allocator is used only for the scratch storage */
+    v.allocator = &allocator;
+
+    {
+        uint32_t const first = *CLC_V_cat_t(v, uint32_t, 0);
+
+        TEST_INT_EQ(ENOMEM, clc_par_sort(pool, &v, 0, 20000, fn_compare_uint32));
+        TEST_INT_EQ(first, *CLC_V_cat_t(v, uint32_t, 0));
+    }
+
+    /* a range of a single chunk needs no scratch storage */
+    TEST_INT_EQ(0, clc_par_sort(pool, &v, 0, 100, fn_compare_uint32));
+
+    v.allocator = NULL;
+
+    collect_c_vec_free_storage(&v);
+
+    clc_par_pool_destroy(pool);
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,379 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test/unit/test.unit.pool/entry.c
+ *
+ * Purpose: Unit-test for object pool.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/terse/dlist.h>
+#include <collect-c/terse/pool.h>
+
+#include <xtests/terse-api.h>
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+static void TEST_define_THEN_free_storage(void);
+static void TEST_acquire_MANY_THEN_release_ALL_THEN_acquire_WITHOUT_NEW_BLOCKS(void);
+static void TEST_acquire_AND_release_IS_LIFO(void);
+static void TEST_define_by_size_SMALLER_THAN_POINTER(void);
+static void TEST_define_with_backing(void);
+static void TEST_CACHE_acquire_AND_release_IN_BATCHES(void);
+static void TEST_WITH_F_SYNCHRONISED(void);
+static void TEST_dlist_WITH_POOL(void);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char* argv[])
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSE_HELP_OR_VERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.pool", verbosity))
+    {
+        XTESTS_RUN_CASE(TEST_define_THEN_free_storage);
+        XTESTS_RUN_CASE(TEST_acquire_MANY_THEN_release_ALL_THEN_acquire_WITHOUT_NEW_BLOCKS);
+        XTESTS_RUN_CASE(TEST_acquire_AND_release_IS_LIFO);
+        XTESTS_RUN_CASE(TEST_define_by_size_SMALLER_THAN_POINTER);
+        XTESTS_RUN_CASE(TEST_define_with_backing);
+        XTESTS_RUN_CASE(TEST_CACHE_acquire_AND_release_IN_BATCHES);
+        XTESTS_RUN_CASE(TEST_WITH_F_SYNCHRONISED);
+        XTESTS_RUN_CASE(TEST_dlist_WITH_POOL);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function definitions
+ */
+
+struct custom_t
+{
+    uint32_t    x;
+    uint32_t    y;
+    uint64_t    z;
+};
+typedef struct custom_t custom_t;
+
+/* an allocator that counts its invocations, and the bytes outstanding, so
+ * that the sizes passed to it may be verified
+ */
+struct counting_allocator_context_t
+{
+    size_t  num_allocs;
+    size_t  num_frees;
+    size_t  cb_outstanding;
+};
+typedef struct counting_allocator_context_t counting_allocator_context_t;
+
+void* fn_counting_alloc(
+    void*   context
+,   size_t  cb
+)
+{
+    counting_allocator_context_t* const ctxt = (counting_allocator_context_t*)context;
+
+    ++ctxt->num_allocs;
+    ctxt->cb_outstanding += cb;
+
+    return malloc(cb);
+}
+
+void fn_counting_free(
+    void*   context
+,   void*   p
+,   size_t  cb
+)
+{
+    counting_allocator_context_t* const ctxt = (counting_allocator_context_t*)context;
+
+    ++ctxt->num_frees;
+    ctxt->cb_outstanding -= cb;
+
+    free(p);
+}
+
+
+static void TEST_define_THEN_free_storage(void)
+{
+    CLC_PL_define(custom_t, p, 0);
+
+    TEST_INT_EQ(sizeof(custom_t), p.el_size);
+    TEST_INT_EQ(sizeof(custom_t), p.slot_size);
+    TEST_INT_EQ(0, CLC_PL_num_in_use(p));
+    TEST_PTR_EQ(&p, CLC_PL_allocator(p)->context);
+
+    clc_pl_free_storage(&p);
+
+    TEST_INT_EQ(0, p.stats.num_blocks);
+}
+
+static void TEST_acquire_MANY_THEN_release_ALL_THEN_acquire_WITHOUT_NEW_BLOCKS(void)
+{
+    CLC_PL_define(custom_t, p, 16);
+
+    custom_t* els[100];
+
+    for (size_t i = 0; 100 != i; ++i)
+    {
+        els[i] = (custom_t*)clc_pl_acquire(&p);
+
+        TEST_PTR_NE(NULL, els[i]);
+        TEST_INT_EQ(0, ((uintptr_t)els[i]) % _Alignof(custom_t));
+
+        els[i]->x = (uint32_t)i;
+        els[i]->y = (uint32_t)i * 2;
+        els[i]->z = (uint64_t)i * 3;
+    }
+
+    TEST_INT_EQ(100, CLC_PL_num_in_use(p));
+    TEST_INT_EQ(7, p.stats.num_blocks);
+    TEST_INT_EQ(112, p.stats.num_slots);
+
+    for (size_t i = 0; 100 != i; ++i)
+    {
+        TEST_INT_EQ(i, els[i]->x);
+        TEST_INT_EQ(i * 2, els[i]->y);
+        TEST_INT_EQ(i * 3, els[i]->z);
+    }
+
+    for (size_t i = 0; 100 != i; ++i)
+    {
+        clc_pl_release(&p, els[i]);
+    }
+
+    TEST_INT_EQ(0, CLC_PL_num_in_use(p));
+
+    for (size_t i = 0; 112 != i; ++i)
+    {
+        TEST_PTR_NE(NULL, clc_pl_acquire(&p));
+    }
+
+    {
+        collect_c_pool_stats_t stats;
+
+        clc_pl_get_stats(&p, &stats);
+
+        TEST_INT_EQ(7, stats.num_blocks);
+        TEST_INT_EQ(112, stats.num_in_use);
+        TEST_INT_EQ(112, stats.peak_in_use);
+        TEST_INT_EQ(212, stats.num_acquires);
+        TEST_INT_EQ(100, stats.num_releases);
+    }
+
+    clc_pl_free_storage(&p);
+}
+
+static void TEST_acquire_AND_release_IS_LIFO(void)
+{
+    CLC_PL_define(int, p, 0);
+
+    void* const p1 = clc_pl_acquire(&p);
+    void* const p2 = clc_pl_acquire(&p);
+
+    TEST_PTR_NE(p1, p2);
+
+    clc_pl_release(&p, p1);
+    clc_pl_release(&p, p2);
+    clc_pl_release(&p, NULL);
+
+    TEST_PTR_EQ(p2, clc_pl_acquire(&p));
+    TEST_PTR_EQ(p1, clc_pl_acquire(&p));
+
+    TEST_INT_EQ(1, p.stats.num_blocks);
+    TEST_INT_EQ(2, p.stats.peak_in_use);
+
+    clc_pl_free_storage(&p);
+}
+
+static void TEST_define_by_size_SMALLER_THAN_POINTER(void)
+{
+    CLC_PL_define_by_size(1, p, 4);
+
+    TEST_INT_EQ(sizeof(void*), p.slot_size);
+
+    {
+        char* const p1 = (char*)clc_pl_acquire(&p);
+        char* const p2 = (char*)clc_pl_acquire(&p);
+
+        TEST_INT_EQ(sizeof(void*), p2 - p1);
+
+        clc_pl_release(&p, p2);
+        clc_pl_release(&p, p1);
+    }
+
+    clc_pl_free_storage(&p);
+}
+
+static void TEST_define_with_backing(void)
+{
+    counting_allocator_context_t    ctxt        =   { 0 };
+    collect_c_allocator_t const     backing     =   { &fn_counting_alloc, NULL, &fn_counting_free, &ctxt };
+
+    {
+        CLC_PL_define_with_backing(custom_t, p, 10, &backing);
+
+        for (int i = 0; 25 != i; ++i)
+        {
+            TEST_PTR_NE(NULL, clc_pl_acquire(&p));
+        }
+
+        TEST_INT_EQ(3, ctxt.num_allocs);
+
+        clc_pl_free_storage(&p);
+
+        TEST_INT_EQ(3, ctxt.num_frees);
+        TEST_INT_EQ(0, ctxt.cb_outstanding);
+    }
+}
+
+static void TEST_CACHE_acquire_AND_release_IN_BATCHES(void)
+{
+    CLC_PL_define(custom_t, p, 64);
+
+    {
+        CLC_PL_CACHE_define(c, &p, 8);
+
+        void* els[20];
+
+        els[0] = clc_pl_cache_acquire(&c);
+
+        TEST_PTR_NE(NULL, els[0]);
+        TEST_INT_EQ(7, c.num_free);
+        TEST_INT_EQ(8, CLC_PL_num_in_use(p));
+        TEST_INT_EQ(8, p.stats.num_acquires);
+
+        for (size_t i = 1; 20 != i; ++i)
+        {
+            els[i] = clc_pl_cache_acquire(&c);
+
+            TEST_PTR_NE(NULL, els[i]);
+        }
+
+        TEST_INT_EQ(4, c.num_free);
+        TEST_INT_EQ(24, CLC_PL_num_in_use(p));
+
+        /* releasing returns a batch once 16 are held */
+
+        for (size_t i = 0; 12 != i; ++i)
+        {
+            clc_pl_cache_release(&c, els[i]);
+        }
+
+        TEST_INT_EQ(8, c.num_free);
+        TEST_INT_EQ(16, CLC_PL_num_in_use(p));
+        TEST_INT_EQ(8, p.stats.num_releases);
+
+        for (size_t i = 12; 20 != i; ++i)
+        {
+            clc_pl_cache_release(&c, els[i]);
+        }
+
+        TEST_INT_EQ(8, c.num_free);
+        TEST_INT_EQ(8, CLC_PL_num_in_use(p));
+
+        clc_pl_cache_flush(&c);
+
+        TEST_INT_EQ(0, c.num_free);
+        TEST_PTR_EQ(NULL, c.free_list);
+        TEST_INT_EQ(0, CLC_PL_num_in_use(p));
+        TEST_INT_EQ(24, p.stats.num_releases);
+        TEST_INT_EQ(1, p.stats.num_blocks);
+    }
+
+    clc_pl_free_storage(&p);
+}
+
+static void TEST_WITH_F_SYNCHRONISED(void)
+{
+    CLC_PL_define(int, p, 0);
+
+    p.flags |= CLC_PL_F_SYNCHRONISED;
+
+    {
+        CLC_PL_CACHE_define(c, &p, 0);
+
+        int* const p1 = (int*)clc_pl_acquire(&p);
+        int* const p2 = (int*)clc_pl_cache_acquire(&c);
+
+        TEST_PTR_NE(NULL, p1);
+        TEST_PTR_NE(NULL, p2);
+        TEST_INT_EQ(0, p.lock);
+
+        clc_pl_cache_release(&c, p2);
+        clc_pl_cache_flush(&c);
+        clc_pl_release(&p, p1);
+
+        TEST_INT_EQ(0, CLC_PL_num_in_use(p));
+        TEST_INT_EQ(0, p.lock);
+    }
+
+    clc_pl_free_storage(&p);
+}
+
+static void TEST_dlist_WITH_POOL(void)
+{
+    CLC_PL_define_by_size(CLC_DL_node_size(int), p, 32);
+
+    {
+        CLC_DL_define_empty_with_allocator(int, l, CLC_PL_allocator(p));
+
+        for (int i = 0; 100 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_DL_push_back_by_val(l, int, i));
+        }
+
+        TEST_INT_EQ(100, CLC_DL_len(l));
+        TEST_INT_EQ(100, CLC_PL_num_in_use(p));
+        TEST_INT_EQ(4, p.stats.num_blocks);
+        TEST_INT_EQ(0, *CLC_DL_cfront_t(l, int));
+
+        /* cleared nodes are retained by the list as spares, and reused */
+
+        CLC_DL_clear(l);
+
+        for (int i = 0; 100 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_DL_push_back_by_val(l, int, i));
+        }
+
+        TEST_INT_EQ(100, CLC_PL_num_in_use(p));
+        TEST_INT_EQ(100, p.stats.num_acquires);
+
+        clc_dlist_free_storage(&l);
+
+        TEST_INT_EQ(0, CLC_PL_num_in_use(p));
+    }
+
+    clc_pl_free_storage(&p);
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,568 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test/unit/test.unit.pq/entry.c
+ *
+ * Purpose: Unit-test for priority queue.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/terse/pq.h>
+#include <collect-c/terse/vec.h>
+
+#include <xtests/terse-api.h>
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+static void TEST_define_empty(void);
+static void TEST_push_by_value_THEN_pop_IN_ORDER(void);
+static void TEST_push_MANY_RANDOM_THEN_pop_ALL_SORTED(void);
+static void TEST_push_n_by_ref_INTO_EMPTY(void);
+static void TEST_push_n_by_ref_FEW_INTO_LARGE(void);
+static void TEST_heapify_AFTER_DIRECT_MANIPULATION(void);
+static void TEST_LARGE_ELEMENTS(void);
+static void TEST_typed_functions(void);
+static void TEST_typed_functions_AND_generic_functions_INTERLEAVED(void);
+static void TEST_define_with_callback_AND_clear(void);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char* argv[])
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSE_HELP_OR_VERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.pq", verbosity))
+    {
+        XTESTS_RUN_CASE(TEST_define_empty);
+        XTESTS_RUN_CASE(TEST_push_by_value_THEN_pop_IN_ORDER);
+        XTESTS_RUN_CASE(TEST_push_MANY_RANDOM_THEN_pop_ALL_SORTED);
+        XTESTS_RUN_CASE(TEST_push_n_by_ref_INTO_EMPTY);
+        XTESTS_RUN_CASE(TEST_push_n_by_ref_FEW_INTO_LARGE);
+        XTESTS_RUN_CASE(TEST_heapify_AFTER_DIRECT_MANIPULATION);
+        XTESTS_RUN_CASE(TEST_LARGE_ELEMENTS);
+        XTESTS_RUN_CASE(TEST_typed_functions);
+        XTESTS_RUN_CASE(TEST_typed_functions_AND_generic_functions_INTERLEAVED);
+        XTESTS_RUN_CASE(TEST_define_with_callback_AND_clear);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function definitions
+ */
+
+struct task_t
+{
+    uint64_t    deadline;
+    char        name[56];
+};
+typedef struct task_t task_t;
+
+static int fn_compare_int(
+    collect_c_pq_t const*   q
+,   void const*             p_lhs
+,   void const*             p_rhs
+)
+{
+    int const lhs = *(int const*)p_lhs;
+    int const rhs = *(int const*)p_rhs;
+
+    ((void)&q);
+
+    return (lhs > rhs) - (lhs < rhs);
+}
+
+/* orders in reverse, so the queue is a max-queue */
+static int fn_compare_int_reverse(
+    collect_c_pq_t const*   q
+,   void const*             p_lhs
+,   void const*             p_rhs
+)
+{
+    return fn_compare_int(q, p_rhs, p_lhs);
+}
+
+static int fn_compare_task(
+    collect_c_pq_t const*   q
+,   void const*             p_lhs
+,   void const*             p_rhs
+)
+{
+    task_t const* const lhs = (task_t const*)p_lhs;
+    task_t const* const rhs = (task_t const*)p_rhs;
+
+    ((void)&q);
+
+    return (lhs->deadline > rhs->deadline) - (lhs->deadline < rhs->deadline);
+}
+
+static void fn_count_on_free(
+    size_t  el_size
+,   size_t  el_index
+,   void*   el_ptr
+,   void*   param_element_free
+)
+{
+    ((void)&el_size);
+    ((void)&el_index);
+    ((void)&el_ptr);
+
+    ++*(int*)param_element_free;
+}
+
+#define INT_LESS_(p_lhs, p_rhs)                             (*(p_lhs) < *(p_rhs))
+
+CLC_PQ_define_typed_functions(int_pq, int, INT_LESS_)
+
+static bool is_less_task(
+    task_t const*   lhs
+,   task_t const*   rhs
+)
+{
+    return lhs->deadline < rhs->deadline;
+}
+
+CLC_PQ_define_typed_functions(task_pq, task_t, is_less_task)
+
+static uint32_t next_random(
+    uint32_t*   state
+)
+{
+    *state = (*state * 1664525u) + 1013904223u;
+
+    return *state >> 8;
+}
+
+
+static void TEST_define_empty(void)
+{
+    CLC_PQ_define_empty(int, q, fn_compare_int);
+
+    TEST_INT_EQ(sizeof(int), q.v.el_size);
+    TEST_BOOLEAN_TRUE(CLC_PQ_is_empty(q));
+    TEST_INT_EQ(0, CLC_PQ_len(q));
+
+    TEST_INT_EQ(ENOENT, CLC_PQ_pop(q));
+
+    {
+        size_t num_dropped = 99;
+
+        TEST_INT_EQ(0, CLC_PQ_clear(q, &num_dropped));
+        TEST_INT_EQ(0, num_dropped);
+    }
+
+    clc_pq_free_storage(&q);
+}
+
+static void TEST_push_by_value_THEN_pop_IN_ORDER(void)
+{
+    {
+        CLC_PQ_define_empty(int, q, fn_compare_int);
+
+        int const values[] = { 5, 3, 9, 1, 7, 3, 8 };
+        int const sorted[] = { 1, 3, 3, 5, 7, 8, 9 };
+
+        for (size_t i = 0; sizeof(values) / sizeof(values[0]) != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_PQ_push_by_value(q, int, values[i]));
+        }
+
+        TEST_INT_EQ(7, CLC_PQ_len(q));
+        TEST_INT_EQ(1, *CLC_PQ_top_t(q, int));
+
+        for (size_t i = 0; sizeof(sorted) / sizeof(sorted[0]) != i; ++i)
+        {
+            int v;
+
+            TEST_INT_EQ(sorted[i], *CLC_PQ_top_t(q, int));
+            TEST_INT_EQ(0, clc_pq_pop(&q, &v));
+            TEST_INT_EQ(sorted[i], v);
+        }
+
+        TEST_BOOLEAN_TRUE(CLC_PQ_is_empty(q));
+        TEST_INT_EQ(ENOENT, clc_pq_pop(&q, NULL));
+
+        clc_pq_free_storage(&q);
+    }
+
+    {
+        CLC_PQ_define_empty(int, q, fn_compare_int_reverse);
+
+        for (int i = 0; 10 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_PQ_push_by_value(q, int, i));
+        }
+
+        TEST_INT_EQ(9, *CLC_PQ_top_t(q, int));
+
+        clc_pq_free_storage(&q);
+    }
+}
+
+static void TEST_push_MANY_RANDOM_THEN_pop_ALL_SORTED(void)
+{
+    CLC_PQ_define_empty(int, q, fn_compare_int);
+
+    uint32_t state = 12345;
+
+    for (size_t i = 0; 10000 != i; ++i)
+    {
+        TEST_INT_EQ(0, CLC_PQ_push_by_value(q, int, (int)(next_random(&state) % 1000)));
+    }
+
+    {
+        int prev = -1;
+
+        for (size_t i = 0; 10000 != i; ++i)
+        {
+            int v;
+
+            TEST_INT_EQ(0, clc_pq_pop(&q, &v));
+            TEST_INT_GE(prev, v);
+
+            prev = v;
+        }
+    }
+
+    TEST_BOOLEAN_TRUE(CLC_PQ_is_empty(q));
+
+    clc_pq_free_storage(&q);
+}
+
+static void TEST_push_n_by_ref_INTO_EMPTY(void)
+{
+    CLC_PQ_define_empty(int, q, fn_compare_int);
+
+    int         values[1001];
+    uint32_t    state = 1;
+
+    for (size_t i = 0; 1001 != i; ++i)
+    {
+        values[i] = (int)(next_random(&state) % 5000);
+    }
+
+    TEST_INT_EQ(0, clc_pq_push_n_by_ref(&q, 0, NULL));
+    TEST_INT_EQ(0, clc_pq_push_n_by_ref(&q, 1001, values));
+    TEST_INT_EQ(1001, CLC_PQ_len(q));
+
+    {
+        int prev = -1;
+
+        for (; !CLC_PQ_is_empty(q); )
+        {
+            int v;
+
+            TEST_INT_EQ(0, clc_pq_pop(&q, &v));
+            TEST_INT_GE(prev, v);
+
+            prev = v;
+        }
+    }
+
+    clc_pq_free_storage(&q);
+}
+
+static void TEST_push_n_by_ref_FEW_INTO_LARGE(void)
+{
+    CLC_PQ_define_empty(int, q, fn_compare_int);
+
+    for (int i = 1000; 0 != i; --i)
+    {
+        TEST_INT_EQ(0, CLC_PQ_push_by_value(q, int, i * 2));
+    }
+
+    {
+        int const values[] = { 7, 1, 2001, 0 };
+
+        TEST_INT_EQ(0, clc_pq_push_n_by_ref(&q, 4, values));
+        TEST_INT_EQ(1004, CLC_PQ_len(q));
+        TEST_INT_EQ(0, *CLC_PQ_top_t(q, int));
+    }
+
+    {
+        int prev = -1;
+
+        for (; !CLC_PQ_is_empty(q); )
+        {
+            int v;
+
+            TEST_INT_EQ(0, clc_pq_pop(&q, &v));
+            TEST_INT_GE(prev, v);
+
+            prev = v;
+        }
+
+        TEST_INT_EQ(2001, prev);
+    }
+
+    clc_pq_free_storage(&q);
+}
+
+static void TEST_heapify_AFTER_DIRECT_MANIPULATION(void)
+{
+    CLC_PQ_define_empty(int, q, fn_compare_int);
+
+    for (int i = 0; 100 != i; ++i)
+    {
+        TEST_INT_EQ(0, CLC_PQ_push_by_value(q, int, i));
+    }
+
+    /* reverse the priorities of all elements, directly */
+    for (size_t i = 0; 100 != i; ++i)
+    {
+        int* const p = CLC_V_at_t(q.v, int, i);
+
+        *p = 1000 - *p;
+    }
+
+    clc_pq_heapify(&q);
+
+    TEST_INT_EQ(901, *CLC_PQ_top_t(q, int));
+
+    {
+        int prev = -1;
+
+        for (; !CLC_PQ_is_empty(q); )
+        {
+            int v;
+
+            TEST_INT_EQ(0, clc_pq_pop(&q, &v));
+            TEST_INT_GE(prev, v);
+
+            prev = v;
+        }
+    }
+
+    clc_pq_free_storage(&q);
+}
+
+static void TEST_LARGE_ELEMENTS(void)
+{
+    CLC_PQ_define_empty(task_t, q, fn_compare_task);
+
+    uint32_t state = 99;
+
+    for (size_t i = 0; 1000 != i; ++i)
+    {
+        task_t t;
+
+        t.deadline = next_random(&state) % 100000;
+        memset(t.name, (int)(t.deadline % 26) + 'a', sizeof(t.name));
+
+        TEST_INT_EQ(0, clc_pq_push_by_ref(&q, &t));
+    }
+
+    {
+        uint64_t prev = 0;
+
+        for (; !CLC_PQ_is_empty(q); )
+        {
+            task_t t;
+
+            TEST_INT_EQ(0, clc_pq_pop(&q, &t));
+            TEST_INT_GE(prev, t.deadline);
+            TEST_INT_EQ((int)(t.deadline % 26) + 'a', t.name[sizeof(t.name) - 1]);
+
+            prev = t.deadline;
+        }
+    }
+
+    clc_pq_free_storage(&q);
+}
+
+static void TEST_typed_functions(void)
+{
+    {
+        CLC_PQ_define_empty(int, q, NULL);
+
+        uint32_t state = 7;
+
+        TEST_PTR_EQ(NULL, int_pq_top(&q));
+        TEST_INT_EQ(ENOENT, int_pq_pop(&q, NULL));
+
+        for (size_t i = 0; 10000 != i; ++i)
+        {
+            int const v = (int)(next_random(&state) % 1000);
+
+            TEST_INT_EQ(0, int_pq_push(&q, &v));
+        }
+
+        {
+            int prev = -1;
+
+            for (; !CLC_PQ_is_empty(q); )
+            {
+                int v;
+
+                TEST_INT_EQ(*int_pq_top(&q), *CLC_PQ_top_t(q, int));
+                TEST_INT_EQ(0, int_pq_pop(&q, &v));
+                TEST_INT_GE(prev, v);
+
+                prev = v;
+            }
+        }
+
+        clc_pq_free_storage(&q);
+    }
+
+    {
+        CLC_PQ_define_empty(task_t, q, NULL);
+
+        uint32_t state = 3;
+
+        for (size_t i = 0; 1000 != i; ++i)
+        {
+            task_t t = { next_random(&state) % 100000, { 0 } };
+
+            TEST_INT_EQ(0, task_pq_push(&q, &t));
+        }
+
+        TEST_INT_EQ(1000, CLC_PQ_len(q));
+
+        {
+            uint64_t prev = 0;
+
+            for (; !CLC_PQ_is_empty(q); )
+            {
+                task_t t;
+
+                TEST_INT_EQ(0, task_pq_pop(&q, &t));
+                TEST_INT_GE(prev, t.deadline);
+
+                prev = t.deadline;
+            }
+        }
+
+        clc_pq_free_storage(&q);
+    }
+}
+
+static void TEST_typed_functions_AND_generic_functions_INTERLEAVED(void)
+{
+    CLC_PQ_define_empty(int, q, fn_compare_int);
+
+    uint32_t state = 11;
+
+    for (size_t i = 0; 2000 != i; ++i)
+    {
+        int const v = (int)(next_random(&state) % 1000);
+
+        if (0 == (i % 2))
+        {
+            TEST_INT_EQ(0, int_pq_push(&q, &v));
+        }
+        else
+        {
+            TEST_INT_EQ(0, clc_pq_push_by_ref(&q, &v));
+        }
+    }
+
+    /* append directly, then re-establish with the typed heapify */
+    for (int i = 0; 1000 != i; ++i)
+    {
+        int const v = -i;
+
+        TEST_INT_EQ(0, collect_c_v_push_back_by_ref(&q.v, &v));
+    }
+
+    int_pq_heapify(&q);
+
+    TEST_INT_EQ(-999, *int_pq_top(&q));
+
+    {
+        int prev = -1000;
+
+        for (size_t i = 0; !CLC_PQ_is_empty(q); ++i)
+        {
+            int v;
+
+            if (0 == (i % 2))
+            {
+                TEST_INT_EQ(0, int_pq_pop(&q, &v));
+            }
+            else
+            {
+                TEST_INT_EQ(0, clc_pq_pop(&q, &v));
+            }
+            TEST_INT_GE(prev, v);
+
+            prev = v;
+        }
+    }
+
+    clc_pq_free_storage(&q);
+}
+
+static void TEST_define_with_callback_AND_clear(void)
+{
+    int num_freed = 0;
+
+    CLC_PQ_define_empty(int, q, fn_compare_int);
+
+    q.v.pfn_element_free = fn_count_on_free;
+    q.v.param_element_free = &num_freed;
+
+    for (int i = 0; 10 != i; ++i)
+    {
+        TEST_INT_EQ(0, CLC_PQ_push_by_value(q, int, i));
+    }
+
+    /* retrieved elements are not freed */
+    {
+        int v;
+
+        TEST_INT_EQ(0, clc_pq_pop(&q, &v));
+        TEST_INT_EQ(0, v);
+        TEST_INT_EQ(0, num_freed);
+    }
+
+    TEST_INT_EQ(0, CLC_PQ_pop(q));
+    TEST_INT_EQ(1, num_freed);
+
+    TEST_INT_EQ(0, int_pq_pop(&q, NULL));
+    TEST_INT_EQ(2, num_freed);
+
+    {
+        size_t num_dropped;
+
+        TEST_INT_EQ(0, CLC_PQ_clear(q, &num_dropped));
+        TEST_INT_EQ(7, num_dropped);
+        TEST_INT_EQ(9, num_freed);
+    }
+
+    TEST_INT_EQ(0, CLC_PQ_push_by_value(q, int, 1));
+
+    clc_pq_free_storage(&q);
+
+    TEST_INT_EQ(10, num_freed);
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,547 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test/unit/test.unit.skiplist/entry.c
+ *
+ * Purpose: Unit-test for ordered skip-list.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/terse/skiplist.h>
+
+#include <xtests/terse-api.h>
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+static void TEST_define_empty(void);
+static void TEST_insert_1000_ELEMENTS_OUT_OF_ORDER(void);
+static void TEST_insert_DUPLICATE_FAILS_WITH_EEXIST(void);
+static void TEST_find_node_AND_lower_bound_AND_upper_bound(void);
+static void TEST_range(void);
+static void TEST_erase_node_AND_erase_by_key(void);
+static void TEST_erase_THEN_insert_REUSES_NODES(void);
+static void TEST_clear_AND_free_storage_INVOKE_CALLBACK(void);
+static void TEST_define_empty_with_allocator_THEN_insert_THEN_erase(void);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char* argv[])
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSE_HELP_OR_VERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.skiplist", verbosity))
+    {
+        XTESTS_RUN_CASE(TEST_define_empty);
+        XTESTS_RUN_CASE(TEST_insert_1000_ELEMENTS_OUT_OF_ORDER);
+        XTESTS_RUN_CASE(TEST_insert_DUPLICATE_FAILS_WITH_EEXIST);
+        XTESTS_RUN_CASE(TEST_find_node_AND_lower_bound_AND_upper_bound);
+        XTESTS_RUN_CASE(TEST_range);
+        XTESTS_RUN_CASE(TEST_erase_node_AND_erase_by_key);
+        XTESTS_RUN_CASE(TEST_erase_THEN_insert_REUSES_NODES);
+        XTESTS_RUN_CASE(TEST_clear_AND_free_storage_INVOKE_CALLBACK);
+        XTESTS_RUN_CASE(TEST_define_empty_with_allocator_THEN_insert_THEN_erase);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function definitions
+ */
+
+int
+compare_int(
+    collect_c_skiplist_t const* sl
+,   void const*                 p_lhs
+,   void const*                 p_rhs
+)
+{
+    int const i_lhs = *(int const*)p_lhs;
+    int const i_rhs = *(int const*)p_rhs;
+
+    ((void)&sl);
+
+    return (i_lhs < i_rhs) ? -1 : (i_lhs > i_rhs) ? +1 : 0;
+}
+
+void
+fn_accumulate_int(
+    size_t  el_size
+,   size_t  el_index
+,   void*   el_ptr
+,   void*   param_element_free
+)
+{
+    ((void)&el_size);
+    ((void)&el_index);
+
+    *(int*)param_element_free += *(int const*)el_ptr;
+}
+
+/* verifies that the elements are strictly ascending in both directions,
+ * and that their number matches the list's size
+ */
+bool
+elements_are_ordered(
+    collect_c_skiplist_t const* sl
+)
+{
+    size_t n_forward    =   0;
+    size_t n_backward   =   0;
+
+    for (collect_c_skiplist_node_t const* n = sl->heads[0]; NULL != n; n = n->next, ++n_forward)
+    {
+        if (NULL != n->next &&
+            !(*CLC_SL_node_cdata_t(n, int) < *CLC_SL_node_cdata_t(n->next, int)))
+        {
+            return false;
+        }
+    }
+
+    for (collect_c_skiplist_node_t const* n = sl->tail; NULL != n; n = n->prev, ++n_backward)
+    {
+        if (NULL != n->prev &&
+            !(*CLC_SL_node_cdata_t(n->prev, int) < *CLC_SL_node_cdata_t(n, int)))
+        {
+            return false;
+        }
+    }
+
+    return n_forward == sl->size && n_backward == sl->size;
+}
+
+
+/* an allocator that counts its invocations, and the bytes outstanding, so
+ * that the sizes passed to it may be verified
+ */
+struct counting_allocator_context_t
+{
+    size_t  num_allocs;
+    size_t  num_frees;
+    size_t  cb_outstanding;
+};
+typedef struct counting_allocator_context_t counting_allocator_context_t;
+
+void* fn_counting_alloc(
+    void*   context
+,   size_t  cb
+)
+{
+    counting_allocator_context_t* const ctxt = (counting_allocator_context_t*)context;
+
+    ++ctxt->num_allocs;
+    ctxt->cb_outstanding += cb;
+
+    return malloc(cb);
+}
+
+void fn_counting_free(
+    void*   context
+,   void*   p
+,   size_t  cb
+)
+{
+    counting_allocator_context_t* const ctxt = (counting_allocator_context_t*)context;
+
+    ++ctxt->num_frees;
+    ctxt->cb_outstanding -= cb;
+
+    free(p);
+}
+
+static void TEST_define_empty(void)
+{
+    {
+        CLC_SL_define_empty(int, sl, compare_int);
+
+        TEST_BOOLEAN_TRUE(CLC_SL_is_empty(sl));
+        TEST_INT_EQ(0, CLC_SL_len(sl));
+        TEST_PTR_EQ(NULL, CLC_SL_first_node(sl));
+        TEST_PTR_EQ(NULL, CLC_SL_last_node(sl));
+
+        {
+            int const                   key = 0;
+            collect_c_skiplist_node_t*  node;
+
+            TEST_INT_EQ(ENOENT, clc_sl_find_node(&sl, &key, &node));
+            TEST_INT_EQ(ENOENT, clc_sl_lower_bound(&sl, &key, &node));
+            TEST_INT_EQ(ENOENT, clc_sl_upper_bound(&sl, &key, &node));
+            TEST_INT_EQ(ENOENT, clc_sl_erase_by_key(&sl, &key));
+        }
+
+        clc_sl_free_storage(&sl);
+    }
+}
+
+static void TEST_insert_1000_ELEMENTS_OUT_OF_ORDER(void)
+{
+    {
+        CLC_SL_define_empty(int, sl, compare_int);
+
+        /* 7 is coprime with 1000, so this visits each of [0, 1000) once */
+        for (int i = 0; 1000 != i; ++i)
+        {
+            int const r = CLC_SL_insert_by_value(sl, int, (i * 7) % 1000);
+
+            TEST_INTEGER_EQUAL_ANY_OF2(0, ENOMEM, r);
+        }
+
+        if (1000 == CLC_SL_len(sl))
+        {
+            TEST_BOOLEAN_TRUE(elements_are_ordered(&sl));
+
+            TEST_INT_EQ(0, *CLC_SL_cfront_t(sl, int));
+            TEST_INT_EQ(999, *CLC_SL_cback_t(sl, int));
+
+            TEST_INT_GE(2, sl.height);
+            TEST_INT_LE(COLLECT_C_SKIPLIST_MAX_HEIGHT, sl.height);
+        }
+
+        clc_sl_free_storage(&sl);
+    }
+}
+
+static void TEST_insert_DUPLICATE_FAILS_WITH_EEXIST(void)
+{
+    {
+        CLC_SL_define_empty(int, sl, compare_int);
+
+        int const                   v = 10;
+        collect_c_skiplist_node_t*  node1;
+        collect_c_skiplist_node_t*  node2;
+
+        TEST_INT_EQ(0, CLC_SL_insert_by_ref(sl, &v, &node1));
+        TEST_INT_EQ(EEXIST, CLC_SL_insert_by_ref(sl, &v, &node2));
+
+        TEST_PTR_EQ(node1, node2);
+        TEST_INT_EQ(1, CLC_SL_len(sl));
+
+        clc_sl_free_storage(&sl);
+    }
+}
+
+static void TEST_find_node_AND_lower_bound_AND_upper_bound(void)
+{
+    {
+        CLC_SL_define_empty(int, sl, compare_int);
+
+        /* 0, 10, 20, ..., 990 */
+        for (int i = 0; 100 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_SL_insert_by_value(sl, int, ((i * 37) % 100) * 10));
+        }
+
+        for (int key = -5; key < 1005; key += 5)
+        {
+            collect_c_skiplist_node_t*  node;
+            int const                   r_f = clc_sl_find_node(&sl, &key, &node);
+
+            if (0 == key % 10 &&
+                key >= 0 &&
+                key < 1000)
+            {
+                TEST_INT_EQ(0, r_f);
+                TEST_INT_EQ(key, *CLC_SL_node_cdata_t(node, int));
+            }
+            else
+            {
+                TEST_INT_EQ(ENOENT, r_f);
+            }
+
+            {
+                int const r_lb = clc_sl_lower_bound(&sl, &key, &node);
+
+                if (key > 990)
+                {
+                    TEST_INT_EQ(ENOENT, r_lb);
+                }
+                else
+                {
+                    int const expected = (key < 0) ? 0 : ((key + 9) / 10) * 10;
+
+                    TEST_INT_EQ(0, r_lb);
+                    TEST_INT_EQ(expected, *CLC_SL_node_cdata_t(node, int));
+                }
+            }
+
+            {
+                int const r_ub = clc_sl_upper_bound(&sl, &key, &node);
+
+                if (key >= 990)
+                {
+                    TEST_INT_EQ(ENOENT, r_ub);
+                }
+                else
+                {
+                    int const expected = (key < 0) ? 0 : ((key / 10) + 1) * 10;
+
+                    TEST_INT_EQ(0, r_ub);
+                    TEST_INT_EQ(expected, *CLC_SL_node_cdata_t(node, int));
+                }
+            }
+        }
+
+        clc_sl_free_storage(&sl);
+    }
+}
+
+static void TEST_range(void)
+{
+    {
+        CLC_SL_define_empty(int, sl, compare_int);
+
+        for (int i = 0; 100 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_SL_insert_by_value(sl, int, i * 2));
+        }
+
+        /* [10, 21) => 10, 12, ..., 20 */
+        {
+            int const                   lo  =   10;
+            int const                   hi  =   21;
+            collect_c_skiplist_node_t*  first;
+            collect_c_skiplist_node_t*  end;
+            size_t                      num_els;
+            int                         expected = 10;
+
+            TEST_INT_EQ(0, clc_sl_range(&sl, &lo, &hi, &first, &end, &num_els));
+            TEST_INT_EQ(6, num_els);
+
+            for (collect_c_skiplist_node_t const* n = first; end != n; n = n->next, expected += 2)
+            {
+                TEST_INT_EQ(expected, *CLC_SL_node_cdata_t(n, int));
+            }
+
+            TEST_INT_EQ(22, expected);
+            TEST_INT_EQ(22, *CLC_SL_node_cdata_t(end, int));
+        }
+
+        /* [190, 1000) => 190, ..., 198, to the end */
+        {
+            int const                   lo  =   190;
+            int const                   hi  =   1000;
+            collect_c_skiplist_node_t*  first;
+            collect_c_skiplist_node_t*  end;
+            size_t                      num_els;
+
+            TEST_INT_EQ(0, clc_sl_range(&sl, &lo, &hi, &first, &end, &num_els));
+            TEST_INT_EQ(5, num_els);
+            TEST_INT_EQ(190, *CLC_SL_node_cdata_t(first, int));
+            TEST_PTR_EQ(NULL, end);
+        }
+
+        /* [11, 12) is empty */
+        {
+            int const                   lo  =   11;
+            int const                   hi  =   12;
+            collect_c_skiplist_node_t*  first;
+            collect_c_skiplist_node_t*  end;
+            size_t                      num_els;
+
+            TEST_INT_EQ(ENOENT, clc_sl_range(&sl, &lo, &hi, &first, &end, &num_els));
+            TEST_INT_EQ(0, num_els);
+            TEST_PTR_EQ(first, end);
+        }
+
+        clc_sl_free_storage(&sl);
+    }
+}
+
+static void TEST_erase_node_AND_erase_by_key(void)
+{
+    {
+        int total_freed = 0;
+
+        CLC_SL_define_empty_with_cb(int, sl, compare_int, fn_accumulate_int, &total_freed);
+
+        for (int i = 0; 1000 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_SL_insert_by_value(sl, int, i));
+        }
+
+        /* erase the odd elements by key, and multiples of 4 by node */
+        for (int i = 1; i < 1000; i += 2)
+        {
+            TEST_INT_EQ(0, clc_sl_erase_by_key(&sl, &i));
+        }
+
+        for (int i = 0; i < 1000; i += 4)
+        {
+            collect_c_skiplist_node_t* node;
+
+            TEST_INT_EQ(0, clc_sl_find_node(&sl, &i, &node));
+            TEST_INT_EQ(0, CLC_SL_erase_node(sl, node));
+        }
+
+        TEST_INT_EQ(250, CLC_SL_len(sl));
+        TEST_BOOLEAN_TRUE(elements_are_ordered(&sl));
+        TEST_INT_EQ(2, *CLC_SL_cfront_t(sl, int));
+        TEST_INT_EQ(998, *CLC_SL_cback_t(sl, int));
+
+        {
+            int const key = 3;
+
+            TEST_INT_EQ(ENOENT, clc_sl_erase_by_key(&sl, &key));
+        }
+
+        /* 0 + 1 + ... + 999 = 499500, less the remaining 2, 6, ..., 998 */
+        TEST_INT_EQ(499500 - 125000, total_freed);
+
+        clc_sl_free_storage(&sl);
+
+        TEST_INT_EQ(499500, total_freed);
+        TEST_BOOLEAN_TRUE(CLC_SL_is_empty(sl));
+        TEST_INT_EQ(0, sl.height);
+    }
+}
+
+static void TEST_erase_THEN_insert_REUSES_NODES(void)
+{
+    {
+        CLC_SL_define_empty(int, sl, compare_int);
+
+        for (int i = 0; 1000 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_SL_insert_by_value(sl, int, i));
+        }
+
+        {
+            collect_c_skiplist_block_t const* const blocks = sl.blocks;
+
+            /* a node of a given height is reused for an insertion of the
+             * same height, so repeated erase+insert of the same element
+             * (whose height is random) must eventually reuse the node
+             */
+            bool reused = false;
+
+            for (int i = 0; 100 != i && !reused; ++i)
+            {
+                int const                   key = 500;
+                collect_c_skiplist_node_t*  node_before;
+                collect_c_skiplist_node_t*  node_after;
+
+                TEST_INT_EQ(0, clc_sl_find_node(&sl, &key, &node_before));
+                TEST_INT_EQ(0, clc_sl_erase_by_key(&sl, &key));
+                TEST_INT_EQ(0, CLC_SL_insert_by_ref(sl, &key, &node_after));
+
+                reused = (node_before == node_after);
+            }
+
+            TEST_BOOLEAN_TRUE(reused);
+            TEST_BOOLEAN_TRUE(elements_are_ordered(&sl));
+
+            /* clear retains all nodes, so re-inserting requires no new blocks */
+            TEST_INT_EQ(0, CLC_SL_clear(sl));
+            TEST_BOOLEAN_TRUE(CLC_SL_is_empty(sl));
+
+            for (int i = 0; 100 != i; ++i)
+            {
+                TEST_INT_EQ(0, CLC_SL_insert_by_value(sl, int, i));
+            }
+
+            TEST_PTR_EQ(blocks, sl.blocks);
+            TEST_BOOLEAN_TRUE(elements_are_ordered(&sl));
+        }
+
+        clc_sl_free_storage(&sl);
+    }
+}
+
+static void TEST_clear_AND_free_storage_INVOKE_CALLBACK(void)
+{
+    {
+        int total_freed = 0;
+
+        CLC_SL_define_empty_with_cb(int, sl, compare_int, fn_accumulate_int, &total_freed);
+
+        for (int i = 1; 11 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_SL_insert_by_value(sl, int, i));
+        }
+
+        {
+            size_t num_dropped;
+
+            TEST_INT_EQ(0, CLC_SL_clear(sl, &num_dropped));
+            TEST_INT_EQ(10, num_dropped);
+            TEST_INT_EQ(55, total_freed);
+            TEST_PTR_EQ(NULL, CLC_SL_first_node(sl));
+            TEST_PTR_EQ(NULL, CLC_SL_last_node(sl));
+        }
+
+        for (int i = 1; 5 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_SL_insert_by_value(sl, int, i));
+        }
+
+        clc_sl_free_storage(&sl);
+
+        TEST_INT_EQ(65, total_freed);
+    }
+}
+
+static void TEST_define_empty_with_allocator_THEN_insert_THEN_erase(void)
+{
+    counting_allocator_context_t    ctxt        =   { 0 };
+    collect_c_allocator_t const     allocator   =   { &fn_counting_alloc, NULL, &fn_counting_free, &ctxt };
+
+    {
+        CLC_SL_define_empty_with_allocator(int, sl, compare_int, &allocator);
+
+        for (int i = 0; 1000 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_SL_insert_by_value(sl, int, (i * 7) % 1000));
+        }
+
+        TEST_INT_EQ(1000, CLC_SL_len(sl));
+        TEST_INT_GE(1, ctxt.num_allocs);
+        TEST_INT_EQ(0, ctxt.num_frees);
+
+        {
+            size_t const num_allocs = ctxt.num_allocs;
+
+            /* erased nodes are reused, so no further blocks are obtained */
+            for (int i = 1; i < 1000; i += 2)
+            {
+                TEST_INT_EQ(0, clc_sl_erase_by_key(&sl, &i));
+                TEST_INT_EQ(0, CLC_SL_insert_by_value(sl, int, 1000 + i));
+            }
+
+            TEST_INT_EQ(num_allocs, ctxt.num_allocs);
+        }
+
+        TEST_BOOLEAN_TRUE(elements_are_ordered(&sl));
+
+        clc_sl_free_storage(&sl);
+
+        TEST_INT_EQ(ctxt.num_allocs, ctxt.num_frees);
+        TEST_INT_EQ(0, ctxt.cb_outstanding);
+    }
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
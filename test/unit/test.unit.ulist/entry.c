@@ -0,0 +1,535 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test/unit/test.unit.ulist/entry.c
+ *
+ * Purpose: Unit-test for unrolled linked list.
+ *
+ * Created: 18th October 2026
+ * Updated: 18th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <collect-c/terse/ulist.h>
+
+#include <xtests/terse-api.h>
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+static void TEST_define_empty(void);
+static void TEST_push_back_1000_ELEMENTS(void);
+static void TEST_push_front_1000_ELEMENTS(void);
+static void TEST_insert_at_SPLITS_FULL_NODES(void);
+static void TEST_erase_at_MERGES_SPARSE_NODES(void);
+static void TEST_find_AND_rfind(void);
+static void TEST_pop_from_back_n_AND_pop_from_front_n(void);
+static void TEST_clear_AND_free_storage_INVOKE_CALLBACK(void);
+static void TEST_define_empty_with_allocator_THEN_push_back_THEN_erase_at(void);
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char* argv[])
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSE_HELP_OR_VERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.ulist", verbosity))
+    {
+        XTESTS_RUN_CASE(TEST_define_empty);
+        XTESTS_RUN_CASE(TEST_push_back_1000_ELEMENTS);
+        XTESTS_RUN_CASE(TEST_push_front_1000_ELEMENTS);
+        XTESTS_RUN_CASE(TEST_insert_at_SPLITS_FULL_NODES);
+        XTESTS_RUN_CASE(TEST_erase_at_MERGES_SPARSE_NODES);
+        XTESTS_RUN_CASE(TEST_find_AND_rfind);
+        XTESTS_RUN_CASE(TEST_pop_from_back_n_AND_pop_from_front_n);
+        XTESTS_RUN_CASE(TEST_clear_AND_free_storage_INVOKE_CALLBACK);
+        XTESTS_RUN_CASE(TEST_define_empty_with_allocator_THEN_push_back_THEN_erase_at);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function definitions
+ */
+
+int
+compare_int(
+    collect_c_ulist_t const*    ul
+,   void const*                 p_lhs
+,   void const*                 p_rhs
+)
+{
+    int const i_lhs = *(int const*)p_lhs;
+    int const i_rhs = *(int const*)p_rhs;
+
+    ((void)&ul);
+
+    return (i_lhs < i_rhs) ? -1 : (i_lhs > i_rhs) ? +1 : 0;
+}
+
+void
+fn_accumulate_int(
+    size_t  el_size
+,   size_t  el_index
+,   void*   el_ptr
+,   void*   param_element_free
+)
+{
+    ((void)&el_size);
+    ((void)&el_index);
+
+    *(int*)param_element_free += *(int const*)el_ptr;
+}
+
+/* verifies that the elements, visited node-by-node, are 0, 1, 2, ... */
+bool
+elements_are_ascending(
+    collect_c_ulist_t const*    ul
+)
+{
+    int     expected    =   0;
+    size_t  num_nodes   =   0;
+
+    for (collect_c_ulist_node_t const* n = ul->head; NULL != n; n = n->next, ++num_nodes)
+    {
+        if (0 == n->num_els ||
+            n->num_els > ul->node_capacity)
+        {
+            return false;
+        }
+
+        for (size_t i = 0; n->num_els != i; ++i, ++expected)
+        {
+            if (expected != *(int const*)CLC_UL_node_cel_v(*ul, n, i))
+            {
+                return false;
+            }
+        }
+    }
+
+    return (size_t)expected == ul->size && num_nodes == ul->num_nodes;
+}
+
+
+/* an allocator that counts its invocations, and the bytes outstanding, so
+ * that the sizes passed to it may be verified
+ */
+struct counting_allocator_context_t
+{
+    size_t  num_allocs;
+    size_t  num_frees;
+    size_t  cb_outstanding;
+};
+typedef struct counting_allocator_context_t counting_allocator_context_t;
+
+void* fn_counting_alloc(
+    void*   context
+,   size_t  cb
+)
+{
+    counting_allocator_context_t* const ctxt = (counting_allocator_context_t*)context;
+
+    ++ctxt->num_allocs;
+    ctxt->cb_outstanding += cb;
+
+    return malloc(cb);
+}
+
+void fn_counting_free(
+    void*   context
+,   void*   p
+,   size_t  cb
+)
+{
+    counting_allocator_context_t* const ctxt = (counting_allocator_context_t*)context;
+
+    ++ctxt->num_frees;
+    ctxt->cb_outstanding -= cb;
+
+    free(p);
+}
+
+static void TEST_define_empty(void)
+{
+    {
+        CLC_UL_define_empty(int, ul);
+
+        TEST_BOOLEAN_TRUE(CLC_UL_is_empty(ul));
+        TEST_INT_EQ(0, CLC_UL_len(ul));
+        TEST_INT_EQ(0, CLC_UL_num_nodes(ul));
+        TEST_INT_GE(2, ul.node_capacity);
+
+        clc_ul_free_storage(&ul);
+    }
+}
+
+static void TEST_push_back_1000_ELEMENTS(void)
+{
+    {
+        CLC_UL_define_empty(int, ul);
+
+        for (int i = 0; 1000 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_UL_push_back_by_value(ul, int, i));
+        }
+
+        TEST_INT_EQ(1000, CLC_UL_len(ul));
+        TEST_INT_EQ((1000 + ul.node_capacity - 1) / ul.node_capacity, CLC_UL_num_nodes(ul));
+        TEST_BOOLEAN_TRUE(elements_are_ascending(&ul));
+
+        TEST_INT_EQ(0, *CLC_UL_cfront_t(ul, int));
+        TEST_INT_EQ(999, *CLC_UL_cback_t(ul, int));
+
+        for (int i = 0; 1000 != i; ++i)
+        {
+            TEST_INT_EQ(i, *CLC_UL_cat_t(ul, int, (size_t)i));
+        }
+
+        clc_ul_free_storage(&ul);
+    }
+}
+
+static void TEST_push_front_1000_ELEMENTS(void)
+{
+    {
+        CLC_UL_define_empty(int, ul);
+
+        for (int i = 999; i >= 0; --i)
+        {
+            TEST_INT_EQ(0, CLC_UL_push_front_by_value(ul, int, i));
+        }
+
+        TEST_INT_EQ(1000, CLC_UL_len(ul));
+        TEST_BOOLEAN_TRUE(elements_are_ascending(&ul));
+
+        for (int i = 0; 1000 != i; ++i)
+        {
+            TEST_INT_EQ(i, *CLC_UL_cat_t(ul, int, (size_t)i));
+        }
+
+        clc_ul_free_storage(&ul);
+    }
+}
+
+static void TEST_insert_at_SPLITS_FULL_NODES(void)
+{
+    {
+        CLC_UL_define_empty(int, ul);
+
+        ul.node_capacity = 4;
+
+        /* insert the evens, then the odds in between them */
+
+        for (int i = 0; 100 != i; i += 2)
+        {
+            TEST_INT_EQ(0, CLC_UL_push_back_by_value(ul, int, i));
+        }
+
+        TEST_INT_EQ(50, CLC_UL_len(ul));
+        TEST_INT_EQ(13, CLC_UL_num_nodes(ul));
+
+        for (int i = 1; 100 != i + 1; i += 2)
+        {
+            TEST_INT_EQ(0, CLC_UL_insert_at(ul, (size_t)i, &i));
+        }
+
+        /* and one at the very end */
+        {
+            int const i = 99;
+
+            TEST_INT_EQ(0, CLC_UL_insert_at(ul, 99, &i));
+        }
+
+        TEST_INT_EQ(100, CLC_UL_len(ul));
+        TEST_INT_GE(25, CLC_UL_num_nodes(ul));
+        TEST_BOOLEAN_TRUE(elements_are_ascending(&ul));
+
+        clc_ul_free_storage(&ul);
+    }
+
+    {
+        CLC_UL_define_empty(int, ul);
+
+        ul.node_capacity = 1;
+
+        for (int i = 0; 10 != i; i += 2)
+        {
+            TEST_INT_EQ(0, CLC_UL_push_back_by_value(ul, int, i));
+        }
+
+        for (int i = 1; 10 != i + 1; i += 2)
+        {
+            TEST_INT_EQ(0, CLC_UL_insert_at(ul, (size_t)i, &i));
+        }
+
+        {
+            int const i = 9;
+
+            TEST_INT_EQ(0, CLC_UL_insert_at(ul, 9, &i));
+        }
+
+        TEST_INT_EQ(10, CLC_UL_len(ul));
+        TEST_INT_EQ(10, CLC_UL_num_nodes(ul));
+        TEST_BOOLEAN_TRUE(elements_are_ascending(&ul));
+
+        clc_ul_free_storage(&ul);
+    }
+}
+
+static void TEST_erase_at_MERGES_SPARSE_NODES(void)
+{
+    {
+        int total_freed = 0;
+
+        CLC_UL_define_empty_with_cb(int, ul, fn_accumulate_int, &total_freed);
+
+        ul.node_capacity = 8;
+
+        for (int i = 0; 64 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_UL_push_back_by_value(ul, int, i));
+        }
+
+        TEST_INT_EQ(8, CLC_UL_num_nodes(ul));
+
+        /* erase all but the first of every 8, leaving one element per node,
+         * which causes adjacent nodes to be merged
+         */
+
+        for (size_t i = 63; 0 != i; --i)
+        {
+            if (0 != (i % 8))
+            {
+                TEST_INT_EQ(0, CLC_UL_erase_at(ul, i));
+            }
+        }
+
+        TEST_INT_EQ(8, CLC_UL_len(ul));
+        TEST_INT_LT(8, CLC_UL_num_nodes(ul));
+
+        for (size_t i = 0; 8 != i; ++i)
+        {
+            TEST_INT_EQ((int)(i * 8), *CLC_UL_cat_t(ul, int, i));
+        }
+
+        TEST_INT_EQ((63 * 64) / 2 - (0 + 8 + 16 + 24 + 32 + 40 + 48 + 56), total_freed);
+
+        /* now erase all from the front */
+
+        for (; !CLC_UL_is_empty(ul); )
+        {
+            TEST_INT_EQ(0, CLC_UL_erase_at(ul, 0));
+        }
+
+        TEST_INT_EQ(0, CLC_UL_num_nodes(ul));
+        TEST_INT_EQ((63 * 64) / 2, total_freed);
+
+        clc_ul_free_storage(&ul);
+    }
+}
+
+static void TEST_find_AND_rfind(void)
+{
+    {
+        CLC_UL_define_empty(int, ul);
+
+        ul.node_capacity = 3;
+
+        for (int i = 0; 20 != i; ++i)
+        {
+            int const v = i % 5;
+
+            TEST_INT_EQ(0, CLC_UL_push_back_by_ref(ul, &v));
+        }
+
+        {
+            int const   v       =   3;
+            size_t      index;
+            void*       el_ptr;
+            size_t      num_searched;
+
+            TEST_INT_EQ(0, clc_ul_find(&ul, compare_int, &v, 0, &index, &el_ptr, &num_searched));
+            TEST_INT_EQ(3, index);
+            TEST_INT_EQ(4, num_searched);
+            TEST_PTR_EQ(CLC_UL_at_v(ul, 3), el_ptr);
+
+            TEST_INT_EQ(0, clc_ul_find(&ul, compare_int, &v, 2, &index, &el_ptr, &num_searched));
+            TEST_INT_EQ(13, index);
+            TEST_INT_EQ(14, num_searched);
+
+            TEST_INT_EQ(ENOENT, clc_ul_find(&ul, compare_int, &v, 4, &index, &el_ptr, &num_searched));
+            TEST_PTR_EQ(NULL, el_ptr);
+            TEST_INT_EQ(20, num_searched);
+
+            TEST_INT_EQ(0, clc_ul_rfind(&ul, compare_int, &v, 0, &index, &el_ptr, &num_searched));
+            TEST_INT_EQ(18, index);
+            TEST_INT_EQ(2, num_searched);
+            TEST_PTR_EQ(CLC_UL_at_v(ul, 18), el_ptr);
+
+            TEST_INT_EQ(0, clc_ul_rfind(&ul, compare_int, &v, 3, &index, NULL, NULL));
+            TEST_INT_EQ(3, index);
+        }
+
+        {
+            int const   v       =   5;
+            size_t      index;
+
+            TEST_INT_EQ(ENOENT, clc_ul_find(&ul, compare_int, &v, 0, &index, NULL, NULL));
+            TEST_INT_EQ(ENOENT, clc_ul_rfind(&ul, compare_int, &v, 0, &index, NULL, NULL));
+        }
+
+        clc_ul_free_storage(&ul);
+    }
+}
+
+static void TEST_pop_from_back_n_AND_pop_from_front_n(void)
+{
+    {
+        int total_freed = 0;
+
+        CLC_UL_define_empty_with_cb(int, ul, fn_accumulate_int, &total_freed);
+
+        ul.node_capacity = 4;
+
+        for (int i = 0; 20 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_UL_push_back_by_value(ul, int, i));
+        }
+
+        {
+            size_t num_dropped;
+
+            TEST_INT_EQ(0, clc_ul_pop_from_front_n(&ul, 6, &num_dropped));
+            TEST_INT_EQ(6, num_dropped);
+            TEST_INT_EQ(14, CLC_UL_len(ul));
+            TEST_INT_EQ(0 + 1 + 2 + 3 + 4 + 5, total_freed);
+            TEST_INT_EQ(6, *CLC_UL_cfront_t(ul, int));
+            TEST_INT_EQ(4, CLC_UL_num_nodes(ul));
+        }
+
+        {
+            size_t num_dropped;
+
+            TEST_INT_EQ(0, clc_ul_pop_from_back_n(&ul, 5, &num_dropped));
+            TEST_INT_EQ(5, num_dropped);
+            TEST_INT_EQ(9, CLC_UL_len(ul));
+            TEST_INT_EQ((19 * 20) / 2 - (6 + 7 + 8 + 9 + 10 + 11 + 12 + 13 + 14), total_freed);
+            TEST_INT_EQ(14, *CLC_UL_cback_t(ul, int));
+            TEST_INT_EQ(3, CLC_UL_num_nodes(ul));
+        }
+
+        TEST_INT_EQ(0, CLC_UL_pop_front(ul));
+        TEST_INT_EQ(0, CLC_UL_pop_back(ul));
+        TEST_INT_EQ(7, *CLC_UL_cfront_t(ul, int));
+        TEST_INT_EQ(13, *CLC_UL_cback_t(ul, int));
+
+        {
+            size_t num_dropped;
+
+            TEST_INT_EQ(0, clc_ul_pop_from_back_n(&ul, 100, &num_dropped));
+            TEST_INT_EQ(7, num_dropped);
+            TEST_BOOLEAN_TRUE(CLC_UL_is_empty(ul));
+            TEST_INT_EQ(0, CLC_UL_num_nodes(ul));
+            TEST_INT_EQ((19 * 20) / 2, total_freed);
+        }
+
+        clc_ul_free_storage(&ul);
+    }
+}
+
+static void TEST_clear_AND_free_storage_INVOKE_CALLBACK(void)
+{
+    {
+        int total_freed = 0;
+
+        CLC_UL_define_empty_with_cb(int, ul, fn_accumulate_int, &total_freed);
+
+        for (int i = 0; 100 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_UL_push_back_by_value(ul, int, i));
+        }
+
+        {
+            size_t num_dropped;
+
+            TEST_INT_EQ(0, CLC_UL_clear(ul, &num_dropped));
+            TEST_INT_EQ(100, num_dropped);
+            TEST_INT_EQ((99 * 100) / 2, total_freed);
+            TEST_BOOLEAN_TRUE(CLC_UL_is_empty(ul));
+            TEST_INT_EQ(0, CLC_UL_num_nodes(ul));
+        }
+
+        total_freed = 0;
+
+        for (int i = 0; 10 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_UL_push_front_by_value(ul, int, i));
+        }
+
+        clc_ul_free_storage(&ul);
+
+        TEST_INT_EQ(45, total_freed);
+    }
+}
+
+static void TEST_define_empty_with_allocator_THEN_push_back_THEN_erase_at(void)
+{
+    counting_allocator_context_t    ctxt        =   { 0 };
+    collect_c_allocator_t const     allocator   =   { &fn_counting_alloc, NULL, &fn_counting_free, &ctxt };
+
+    {
+        CLC_UL_define_empty_with_allocator(int, ul, &allocator);
+
+        ul.node_capacity = 8;
+
+        for (int i = 0; 64 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_UL_push_back_by_value(ul, int, i));
+        }
+
+        TEST_INT_EQ(8, ctxt.num_allocs);
+
+        /* merging sparse nodes releases them, one being kept as spare, so
+         * only the remaining nodes and the spare are outstanding
+         */
+        for (size_t i = 63; 0 != i; --i)
+        {
+            if (0 != (i % 8))
+            {
+                TEST_INT_EQ(0, CLC_UL_erase_at(ul, i));
+            }
+        }
+
+        TEST_INT_EQ(8, CLC_UL_len(ul));
+        TEST_INT_EQ(CLC_UL_num_nodes(ul) + (NULL != ul.spare), ctxt.num_allocs - ctxt.num_frees);
+
+        clc_ul_free_storage(&ul);
+
+        TEST_INT_EQ(ctxt.num_allocs, ctxt.num_frees);
+        TEST_INT_EQ(0, ctxt.cb_outstanding);
+    }
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
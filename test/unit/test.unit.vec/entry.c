@@ -4,7 +4,7 @@
  * Purpose: Unit-test for vector.
  *
  * Created: 5th February 2025
- * Updated: 11th February 2025
+ * Updated: 18th October 2026
  *
  * ////////////////////////////////////////////////////////////////////// */
 
@@ -19,7 +19,9 @@
 
 #include <errno.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -35,6 +37,27 @@ static void TEST_V_define_empty_AND_push_back_UNTIL_FULL_THEN_clear_THEN_push_fr
 static void TEST_V_define_empty_AND_allocate_storage_VERY_LARGE_THEN_push_back_1_ELEMENT_THEN_shrink_to_fit(void);
 static void TEST_V_define_empty_THEN_allocate_storage_THEN_push_back_UNTIL_FULL_THEN_reallocate(void);
 static void TEST_V_define_empty_THEN_allocate_storage_THEN_push_front_UNTIL_FULL_THEN_reallocate(void);
+static void TEST_V_define_empty_THEN_allocate_storage_THEN_push_back_10_ELEMENTS_THEN_pop_back_AND_pop_front(void);
+static void TEST_V_define_empty_WITH_NO_BOO_THEN_push_back_10_ELEMENTS_THEN_pop_from_front_n(void);
+static void TEST_V_define_empty_with_cb_THEN_push_back_10_ELEMENTS_THEN_truncate(void);
+static void TEST_V_define_empty_THEN_use_AS_WORK_QUEUE(void);
+static void TEST_V_define_empty_THEN_push_back_10_ELEMENTS_THEN_insert_n_by_ref_AND_erase_range(void);
+static void TEST_V_define_empty_THEN_insert_n_by_ref_WITH_REALLOCATION(void);
+static void TEST_V_define_on_stack_THEN_insert_n_by_ref_AND_erase_range(void);
+static void TEST_V_define_empty_THEN_reserve_THEN_push_back_WITHOUT_REALLOCATION(void);
+static void TEST_V_define_empty_THEN_push_back_THEN_reserve_FRONT_THEN_push_front_WITHOUT_REALLOCATION(void);
+static void TEST_V_define_empty_WITH_growth_policy_THEN_push_back(void);
+static void TEST_V_define_empty_THEN_allocate_storage_OF_0_AND_1_THEN_push_back_AND_push_front(void);
+static void TEST_V_define_empty_WITH_vm_threshold_THEN_push_back_MANY_THEN_edit(void);
+static void TEST_V_define_empty_WITH_F_USE_HUGE_PAGES_THEN_push_back_MANY(void);
+static void TEST_V_define_on_stack_with_spill_THEN_push_back_BEYOND_ARRAY(void);
+static void TEST_V_define_on_stack_with_spill_THEN_push_front_AND_insert_n_by_ref_AND_reserve(void);
+static void TEST_V_define_empty_with_allocator_THEN_push_back_AND_insert_n_by_ref_AND_shrink_to_fit(void);
+static void TEST_V_define_empty_THEN_push_back_THEN_sort_PATTERNS(void);
+static void TEST_V_define_empty_THEN_push_back_THEN_sort_ELEMENT_SIZES(void);
+static void TEST_V_define_empty_THEN_push_back_THEN_radix_sort_by_member(void);
+static void TEST_V_define_empty_THEN_push_back_THEN_find_AND_count_ELEMENT_SIZES(void);
+static void TEST_V_define_empty_THEN_push_back_THEN_find_by_value_AND_contains_FROM_OFFSET(void);
 
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -59,6 +82,27 @@ int main(int argc, char* argv[])
         XTESTS_RUN_CASE(TEST_V_define_empty_AND_allocate_storage_VERY_LARGE_THEN_push_back_1_ELEMENT_THEN_shrink_to_fit);
         XTESTS_RUN_CASE(TEST_V_define_empty_THEN_allocate_storage_THEN_push_back_UNTIL_FULL_THEN_reallocate);
         XTESTS_RUN_CASE(TEST_V_define_empty_THEN_allocate_storage_THEN_push_front_UNTIL_FULL_THEN_reallocate);
+        XTESTS_RUN_CASE(TEST_V_define_empty_THEN_allocate_storage_THEN_push_back_10_ELEMENTS_THEN_pop_back_AND_pop_front);
+        XTESTS_RUN_CASE(TEST_V_define_empty_WITH_NO_BOO_THEN_push_back_10_ELEMENTS_THEN_pop_from_front_n);
+        XTESTS_RUN_CASE(TEST_V_define_empty_with_cb_THEN_push_back_10_ELEMENTS_THEN_truncate);
+        XTESTS_RUN_CASE(TEST_V_define_empty_THEN_use_AS_WORK_QUEUE);
+        XTESTS_RUN_CASE(TEST_V_define_empty_THEN_push_back_10_ELEMENTS_THEN_insert_n_by_ref_AND_erase_range);
+        XTESTS_RUN_CASE(TEST_V_define_empty_THEN_insert_n_by_ref_WITH_REALLOCATION);
+        XTESTS_RUN_CASE(TEST_V_define_on_stack_THEN_insert_n_by_ref_AND_erase_range);
+        XTESTS_RUN_CASE(TEST_V_define_empty_THEN_reserve_THEN_push_back_WITHOUT_REALLOCATION);
+        XTESTS_RUN_CASE(TEST_V_define_empty_THEN_push_back_THEN_reserve_FRONT_THEN_push_front_WITHOUT_REALLOCATION);
+        XTESTS_RUN_CASE(TEST_V_define_empty_WITH_growth_policy_THEN_push_back);
+        XTESTS_RUN_CASE(TEST_V_define_empty_THEN_allocate_storage_OF_0_AND_1_THEN_push_back_AND_push_front);
+        XTESTS_RUN_CASE(TEST_V_define_empty_WITH_vm_threshold_THEN_push_back_MANY_THEN_edit);
+        XTESTS_RUN_CASE(TEST_V_define_empty_WITH_F_USE_HUGE_PAGES_THEN_push_back_MANY);
+        XTESTS_RUN_CASE(TEST_V_define_on_stack_with_spill_THEN_push_back_BEYOND_ARRAY);
+        XTESTS_RUN_CASE(TEST_V_define_on_stack_with_spill_THEN_push_front_AND_insert_n_by_ref_AND_reserve);
+        XTESTS_RUN_CASE(TEST_V_define_empty_with_allocator_THEN_push_back_AND_insert_n_by_ref_AND_shrink_to_fit);
+        XTESTS_RUN_CASE(TEST_V_define_empty_THEN_push_back_THEN_sort_PATTERNS);
+        XTESTS_RUN_CASE(TEST_V_define_empty_THEN_push_back_THEN_sort_ELEMENT_SIZES);
+        XTESTS_RUN_CASE(TEST_V_define_empty_THEN_push_back_THEN_radix_sort_by_member);
+        XTESTS_RUN_CASE(TEST_V_define_empty_THEN_push_back_THEN_find_AND_count_ELEMENT_SIZES);
+        XTESTS_RUN_CASE(TEST_V_define_empty_THEN_push_back_THEN_find_by_value_AND_contains_FROM_OFFSET);
 
         XTESTS_PRINT_RESULTS();
 
@@ -80,6 +124,61 @@ struct custom_t
 };
 typedef struct custom_t custom_t;
 
+/* an allocator that counts its invocations, and the bytes outstanding, so
+ * that the sizes passed to it may be verified
+ */
+struct counting_allocator_context_t
+{
+    size_t  num_allocs;
+    size_t  num_reallocs;
+    size_t  num_frees;
+    size_t  cb_outstanding;
+};
+typedef struct counting_allocator_context_t counting_allocator_context_t;
+
+void* fn_counting_alloc(
+    void*   context
+,   size_t  cb
+)
+{
+    counting_allocator_context_t* const ctxt = (counting_allocator_context_t*)context;
+
+    ++ctxt->num_allocs;
+    ctxt->cb_outstanding += cb;
+
+    return malloc(cb);
+}
+
+void* fn_counting_realloc(
+    void*   context
+,   void*   p
+,   size_t  cb_old
+,   size_t  cb_new
+)
+{
+    counting_allocator_context_t* const ctxt = (counting_allocator_context_t*)context;
+
+    ++ctxt->num_reallocs;
+    ctxt->cb_outstanding -= cb_old;
+    ctxt->cb_outstanding += cb_new;
+
+    return realloc(p, cb_new);
+}
+
+void fn_counting_free(
+    void*   context
+,   void*   p
+,   size_t  cb
+)
+{
+    counting_allocator_context_t* const ctxt = (counting_allocator_context_t*)context;
+
+    ++ctxt->num_frees;
+    ctxt->cb_outstanding -= cb;
+
+    free(p);
+}
+
 void fn_int_stub(
     size_t  el_size
 ,   size_t  el_index
@@ -93,6 +192,20 @@ void fn_int_stub(
     ((void)&param_element_free);
 }
 
+void fn_int_count(
+    size_t  el_size
+,   size_t  el_index
+,   void*   el_ptr
+,   void*   param_element_free
+)
+{
+    ((void)&el_size);
+    ((void)&el_index);
+    ((void)&el_ptr);
+
+    ++*(size_t*)param_element_free;
+}
+
 int
 accumulate_v2(
     collect_c_vec_t*    v
@@ -110,6 +223,23 @@ accumulate_v2(
 
     return r;
 }
+bool
+is_sequence_v(
+    collect_c_vec_t const*  v
+,   int                     first
+)
+{
+    for (size_t i = 0; v->size != i; ++i)
+    {
+        if (first + (int)i != *COLLECT_C_VEC_cat_t(*v, int, i))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 int
 accumulate_v3(
     int const*          b
@@ -786,5 +916,1466 @@ static void TEST_V_define_empty_THEN_allocate_storage_THEN_push_front_UNTIL_FULL
 }
 
 
+static void TEST_V_define_empty_THEN_allocate_storage_THEN_push_back_10_ELEMENTS_THEN_pop_back_AND_pop_front(void)
+{
+    {
+        CLC_V_define_empty(int, v);
+
+        int const r = collect_c_vec_allocate_storage(&v, 32);
+
+        TEST_INTEGER_EQUAL_ANY_OF2(0, ENOMEM, r);
+
+        if (0 == r)
+        {
+            for (int i = 0; 10 != i; ++i)
+            {
+                CLC_V_push_back_by_ref(v, &i);
+            }
+
+            TEST_INT_EQ(10, CLC_V_len(v));
+            TEST_INT_EQ( 8, CLC_V_spare_front(v));
+            TEST_INT_EQ(45, accumulate_v2(&v, 0));
+
+            TEST_INT_EQ(0, CLC_V_pop_back(v));
+
+            TEST_INT_EQ( 9, CLC_V_len(v));
+            TEST_INT_EQ( 8, *CLC_V_cback_t(v, int));
+            TEST_INT_EQ(36, accumulate_v2(&v, 0));
+
+            TEST_INT_EQ(0, CLC_V_pop_front(v));
+
+            TEST_INT_EQ( 8, CLC_V_len(v));
+            TEST_INT_EQ( 9, CLC_V_spare_front(v));
+            TEST_INT_EQ( 1, *CLC_V_cfront_t(v, int));
+            TEST_INT_EQ(36, accumulate_v2(&v, 0));
+
+            {
+                size_t num_dropped;
+
+                TEST_INT_EQ(0, collect_c_v_pop_from_front_n(&v, 3, &num_dropped));
+
+                TEST_INT_EQ( 3, num_dropped);
+                TEST_INT_EQ( 5, CLC_V_len(v));
+                TEST_INT_EQ(12, CLC_V_spare_front(v));
+                TEST_INT_EQ( 4, *CLC_V_cfront_t(v, int));
+                TEST_INT_EQ(30, accumulate_v2(&v, 0));
+
+                TEST_INT_EQ(0, collect_c_v_pop_from_back_n(&v, 2, &num_dropped));
+
+                TEST_INT_EQ( 2, num_dropped);
+                TEST_INT_EQ( 3, CLC_V_len(v));
+                TEST_INT_EQ( 6, *CLC_V_cback_t(v, int));
+                TEST_INT_EQ(15, accumulate_v2(&v, 0));
+
+                TEST_INT_EQ(0, collect_c_v_pop_from_front_n(&v, 100, &num_dropped));
+
+                TEST_INT_EQ( 3, num_dropped);
+                TEST_BOOLEAN_TRUE(CLC_V_is_empty(v));
+
+                TEST_INT_EQ(0, collect_c_v_pop_from_back_n(&v, 1, &num_dropped));
+
+                TEST_INT_EQ( 0, num_dropped);
+            }
+
+            collect_c_vec_free_storage(&v);
+        }
+    }
+}
+
+static void TEST_V_define_empty_WITH_NO_BOO_THEN_push_back_10_ELEMENTS_THEN_pop_from_front_n(void)
+{
+    {
+        CLC_V_define_empty(int, v);
+
+        v.flags |= CLC_V_F_NO_BOO;
+
+        int const r = collect_c_vec_allocate_storage(&v, 32);
+
+        TEST_INTEGER_EQUAL_ANY_OF2(0, ENOMEM, r);
+
+        if (0 == r)
+        {
+            for (int i = 0; 10 != i; ++i)
+            {
+                CLC_V_push_back_by_ref(v, &i);
+            }
+
+            TEST_INT_EQ(10, CLC_V_len(v));
+            TEST_INT_EQ( 0, CLC_V_spare_front(v));
+
+            {
+                size_t num_dropped;
+
+                TEST_INT_EQ(0, collect_c_v_pop_from_front_n(&v, 4, &num_dropped));
+
+                TEST_INT_EQ( 4, num_dropped);
+                TEST_INT_EQ( 6, CLC_V_len(v));
+                TEST_INT_EQ( 0, CLC_V_spare_front(v));
+                TEST_INT_EQ(26, CLC_V_spare_back(v));
+                TEST_INT_EQ( 4, *CLC_V_cfront_t(v, int));
+                TEST_INT_EQ( 9, *CLC_V_cback_t(v, int));
+                TEST_INT_EQ(39, accumulate_v2(&v, 0));
+            }
+
+            collect_c_vec_free_storage(&v);
+        }
+    }
+}
+
+static void TEST_V_define_empty_with_cb_THEN_push_back_10_ELEMENTS_THEN_truncate(void)
+{
+    {
+        size_t num_freed = 0;
+
+        CLC_V_define_empty_with_cb(int, v, fn_int_count, &num_freed);
+
+        int const r = collect_c_vec_allocate_storage(&v, 32);
+
+        TEST_INTEGER_EQUAL_ANY_OF2(0, ENOMEM, r);
+
+        if (0 == r)
+        {
+            for (int i = 0; 10 != i; ++i)
+            {
+                CLC_V_push_back_by_ref(v, &i);
+            }
+
+            TEST_INT_EQ(0, CLC_V_truncate(v, 20));
+
+            TEST_INT_EQ(10, CLC_V_len(v));
+            TEST_INT_EQ( 0, num_freed);
+
+            TEST_INT_EQ(0, CLC_V_truncate(v, 6));
+
+            TEST_INT_EQ( 6, CLC_V_len(v));
+            TEST_INT_EQ( 4, num_freed);
+            TEST_INT_EQ(15, accumulate_v2(&v, 0));
+
+            TEST_INT_EQ(0, CLC_V_pop_front(v));
+
+            TEST_INT_EQ( 5, num_freed);
+
+            {
+                size_t num_dropped;
+
+                TEST_INT_EQ(0, collect_c_v_pop_from_back_n(&v, 2, &num_dropped));
+
+                TEST_INT_EQ( 2, num_dropped);
+                TEST_INT_EQ( 7, num_freed);
+
+                TEST_INT_EQ(0, collect_c_v_truncate(&v, 0, &num_dropped));
+
+                TEST_INT_EQ( 3, num_dropped);
+                TEST_INT_EQ(10, num_freed);
+                TEST_BOOLEAN_TRUE(CLC_V_is_empty(v));
+            }
+
+            collect_c_vec_free_storage(&v);
+        }
+    }
+}
+
+static void TEST_V_define_empty_THEN_use_AS_WORK_QUEUE(void)
+{
+    {
+        CLC_V_define_empty(int, v);
+
+        int const r = collect_c_vec_allocate_storage(&v, 32);
+
+        TEST_INTEGER_EQUAL_ANY_OF2(0, ENOMEM, r);
+
+        if (0 == r)
+        {
+            int next_in     =   0;
+            int next_out    =   0;
+
+            for (; 16 != next_in; ++next_in)
+            {
+                CLC_V_push_back_by_ref(v, &next_in);
+            }
+
+            /* a steady-state queue of 16 elements should never need more
+             * than the original capacity
+             */
+            for (int i = 0; 10000 != i; ++i)
+            {
+                TEST_INT_EQ(0, CLC_V_push_back_by_ref(v, &next_in));
+                ++next_in;
+
+                TEST_INT_EQ(next_out, *CLC_V_cfront_t(v, int));
+                TEST_INT_EQ(0, CLC_V_pop_front(v));
+                ++next_out;
+            }
+
+            TEST_INT_EQ(16, CLC_V_len(v));
+            TEST_INT_EQ(40, v.capacity);
+            TEST_INT_EQ(next_out, *CLC_V_cfront_t(v, int));
+            TEST_INT_EQ(next_in - 1, *CLC_V_cback_t(v, int));
+
+            collect_c_vec_free_storage(&v);
+        }
+    }
+}
+
+static void TEST_V_define_empty_THEN_push_back_10_ELEMENTS_THEN_insert_n_by_ref_AND_erase_range(void)
+{
+    {
+        size_t num_freed = 0;
+
+        CLC_V_define_empty_with_cb(int, v, fn_int_count, &num_freed);
+
+        int const r = collect_c_vec_allocate_storage(&v, 32);
+
+        TEST_INTEGER_EQUAL_ANY_OF2(0, ENOMEM, r);
+
+        if (0 == r)
+        {
+            void* const start_storage = v.storage;
+
+            for (int i = 0; 10 != i; ++i)
+            {
+                CLC_V_push_back_by_ref(v, &i);
+            }
+
+            TEST_INT_EQ( 8, CLC_V_spare_front(v));
+
+            /* insert near the front, which moves the preceding elements */
+            {
+                int const els[] = { 100, 101, 102 };
+
+                TEST_INT_EQ(0, CLC_V_insert_n_by_ref(v, 2, 3, &els[0]));
+
+                TEST_INT_EQ(13, CLC_V_len(v));
+                TEST_INT_EQ( 5, CLC_V_spare_front(v));
+                TEST_INT_EQ(  0, *CLC_V_cat_t(v, int, 0));
+                TEST_INT_EQ(  1, *CLC_V_cat_t(v, int, 1));
+                TEST_INT_EQ(100, *CLC_V_cat_t(v, int, 2));
+                TEST_INT_EQ(102, *CLC_V_cat_t(v, int, 4));
+                TEST_INT_EQ(  2, *CLC_V_cat_t(v, int, 5));
+                TEST_INT_EQ(  9, *CLC_V_cat_t(v, int, 12));
+            }
+
+            /* insert near the back, which moves the following elements */
+            {
+                int const els[] = { 200, 201 };
+
+                TEST_INT_EQ(0, CLC_V_insert_n_by_ref(v, 12, 2, &els[0]));
+
+                TEST_INT_EQ(15, CLC_V_len(v));
+                TEST_INT_EQ( 5, CLC_V_spare_front(v));
+                TEST_INT_EQ(  8, *CLC_V_cat_t(v, int, 11));
+                TEST_INT_EQ(200, *CLC_V_cat_t(v, int, 12));
+                TEST_INT_EQ(201, *CLC_V_cat_t(v, int, 13));
+                TEST_INT_EQ(  9, *CLC_V_cat_t(v, int, 14));
+            }
+
+            /* insert at the end, which moves nothing */
+            {
+                int const el = 300;
+
+                TEST_INT_EQ(0, CLC_V_insert_n_by_ref(v, 15, 1, &el));
+
+                TEST_INT_EQ( 16, CLC_V_len(v));
+                TEST_INT_EQ(300, *CLC_V_cback_t(v, int));
+            }
+
+            TEST_PTR_EQ(start_storage, v.storage);
+            TEST_INT_EQ(0, num_freed);
+
+            /* erase near the front, which moves the preceding elements */
+            {
+                size_t num_dropped;
+
+                TEST_INT_EQ(0, collect_c_v_erase_range(&v, 2, 5, &num_dropped));
+
+                TEST_INT_EQ( 3, num_dropped);
+                TEST_INT_EQ( 3, num_freed);
+                TEST_INT_EQ(13, CLC_V_len(v));
+                TEST_INT_EQ( 8, CLC_V_spare_front(v));
+                TEST_INT_EQ( 0, *CLC_V_cat_t(v, int, 0));
+                TEST_INT_EQ( 1, *CLC_V_cat_t(v, int, 1));
+                TEST_INT_EQ( 2, *CLC_V_cat_t(v, int, 2));
+            }
+
+            /* erase near the back, which moves the following elements */
+            {
+                size_t num_dropped;
+
+                TEST_INT_EQ(0, collect_c_v_erase_range(&v, 9, 11, &num_dropped));
+
+                TEST_INT_EQ( 2, num_dropped);
+                TEST_INT_EQ( 5, num_freed);
+                TEST_INT_EQ(11, CLC_V_len(v));
+                TEST_INT_EQ( 8, CLC_V_spare_front(v));
+                TEST_INT_EQ( 9, *CLC_V_cat_t(v, int, 9));
+                TEST_INT_EQ(0 + 1 + 2 + 3 + 4 + 5 + 6 + 7 + 8 + 9 + 300, accumulate_v2(&v, 0));
+            }
+
+            /* erase an empty range */
+            {
+                TEST_INT_EQ(0, CLC_V_erase_range(v, 4, 4));
+
+                TEST_INT_EQ(11, CLC_V_len(v));
+                TEST_INT_EQ( 5, num_freed);
+            }
+
+            collect_c_vec_free_storage(&v);
+
+            TEST_INT_EQ(16, num_freed);
+        }
+    }
+}
+
+static void TEST_V_define_empty_THEN_insert_n_by_ref_WITH_REALLOCATION(void)
+{
+    {
+        CLC_V_define_empty(int, v);
+
+        int const r = collect_c_vec_allocate_storage(&v, 4);
+
+        TEST_INTEGER_EQUAL_ANY_OF2(0, ENOMEM, r);
+
+        if (0 == r)
+        {
+            int els[20];
+
+            for (int i = 0; 20 != i; ++i)
+            {
+                els[i] = 100 + i;
+            }
+
+            for (int i = 0; 4 != i; ++i)
+            {
+                CLC_V_push_back_by_ref(v, &i);
+            }
+
+            TEST_INT_EQ(5, v.capacity);
+
+            {
+                int const r2 = CLC_V_insert_n_by_ref(v, 2, 20, &els[0]);
+
+                TEST_INTEGER_EQUAL_ANY_OF2(0, ENOMEM, r2);
+
+                if (0 == r2)
+                {
+                    TEST_INT_EQ(24, CLC_V_len(v));
+                    TEST_INT_GE(24, v.capacity);
+                    TEST_INT_NE( 0, CLC_V_spare_front(v));
+
+                    TEST_INT_EQ(  0, *CLC_V_cat_t(v, int, 0));
+                    TEST_INT_EQ(  1, *CLC_V_cat_t(v, int, 1));
+                    TEST_INT_EQ(100, *CLC_V_cat_t(v, int, 2));
+                    TEST_INT_EQ(119, *CLC_V_cat_t(v, int, 21));
+                    TEST_INT_EQ(  2, *CLC_V_cat_t(v, int, 22));
+                    TEST_INT_EQ(  3, *CLC_V_cat_t(v, int, 23));
+                }
+            }
+
+            collect_c_vec_free_storage(&v);
+        }
+    }
+}
+
+static void TEST_V_define_on_stack_THEN_insert_n_by_ref_AND_erase_range(void)
+{
+    {
+        int array[8];
+
+        CLC_V_define_on_stack(v, array);
+
+        for (int i = 0; 4 != i; ++i)
+        {
+            CLC_V_push_back_by_ref(v, &i);
+        }
+
+        {
+            int const els[] = { 10, 11, 12, 13, 14 };
+
+            TEST_INT_EQ(ENOSPC, CLC_V_insert_n_by_ref(v, 1, 5, &els[0]));
+            TEST_INT_EQ(4, CLC_V_len(v));
+
+            TEST_INT_EQ(0, CLC_V_insert_n_by_ref(v, 1, 4, &els[0]));
+            TEST_INT_EQ(8, CLC_V_len(v));
+            TEST_INT_EQ(0, CLC_V_spare_front(v));
+
+            TEST_INT_EQ( 0, array[0]);
+            TEST_INT_EQ(10, array[1]);
+            TEST_INT_EQ(13, array[4]);
+            TEST_INT_EQ( 1, array[5]);
+            TEST_INT_EQ( 3, array[7]);
+        }
+
+        TEST_INT_EQ(0, CLC_V_erase_range(v, 0, 3));
+
+        TEST_INT_EQ(5, CLC_V_len(v));
+        TEST_INT_EQ(0, CLC_V_spare_front(v));
+        TEST_INT_EQ(12, array[0]);
+        TEST_INT_EQ( 3, array[4]);
+    }
+}
+
+static void TEST_V_define_empty_THEN_reserve_THEN_push_back_WITHOUT_REALLOCATION(void)
+{
+    {
+        CLC_V_define_empty(int, v);
+
+        int const r = CLC_V_reserve(v, 100, 0);
+
+        TEST_INTEGER_EQUAL_ANY_OF2(0, ENOMEM, r);
+
+        if (0 == r)
+        {
+            void* const start_storage = v.storage;
+
+            TEST_PTR_NE(NULL, start_storage);
+            TEST_INT_EQ(  0, CLC_V_spare_front(v));
+            TEST_INT_EQ(100, CLC_V_spare_back(v));
+
+            for (int i = 0; 100 != i; ++i)
+            {
+                CLC_V_push_back_by_ref(v, &i);
+            }
+
+            TEST_INT_EQ(100, CLC_V_len(v));
+            TEST_INT_EQ(  0, CLC_V_spare(v));
+            TEST_PTR_EQ(start_storage, v.storage);
+            TEST_INT_EQ(4950, accumulate_v2(&v, 0));
+
+            /* reserving no more than is held does nothing */
+
+            TEST_INT_EQ(0, CLC_V_reserve(v, 50, 0));
+            TEST_PTR_EQ(start_storage, v.storage);
+            TEST_INT_EQ(100, v.capacity);
+
+            collect_c_vec_free_storage(&v);
+        }
+    }
+}
+
+static void TEST_V_define_empty_THEN_push_back_THEN_reserve_FRONT_THEN_push_front_WITHOUT_REALLOCATION(void)
+{
+    {
+        CLC_V_define_empty(int, v);
+
+        int const r = collect_c_vec_allocate_storage(&v, 8);
+
+        TEST_INTEGER_EQUAL_ANY_OF2(0, ENOMEM, r);
+
+        if (0 == r)
+        {
+            for (int i = 0; 5 != i; ++i)
+            {
+                CLC_V_push_back_by_ref(v, &i);
+            }
+
+            TEST_INT_EQ( 2, CLC_V_spare_front(v));
+
+            {
+                int const r2 = CLC_V_reserve(v, 10, 20);
+
+                TEST_INTEGER_EQUAL_ANY_OF2(0, ENOMEM, r2);
+
+                if (0 == r2)
+                {
+                    void* const start_storage = v.storage;
+
+                    TEST_INT_EQ( 5, CLC_V_len(v));
+                    TEST_INT_EQ(20, CLC_V_spare_front(v));
+                    TEST_INT_EQ( 5, CLC_V_spare_back(v));
+                    TEST_INT_EQ(10, accumulate_v2(&v, 0));
+
+                    for (int i = 0; 20 != i; ++i)
+                    {
+                        int const value = -1 - i;
+
+                        CLC_V_push_front_by_ref(v, &value);
+                    }
+                    for (int i = 5; 10 != i; ++i)
+                    {
+                        CLC_V_push_back_by_ref(v, &i);
+                    }
+
+                    TEST_INT_EQ(30, CLC_V_len(v));
+                    TEST_INT_EQ( 0, CLC_V_spare(v));
+                    TEST_INT_EQ(-20, *CLC_V_cfront_t(v, int));
+                    TEST_INT_EQ(  9, *CLC_V_cback_t(v, int));
+                    TEST_PTR_EQ(start_storage, v.storage);
+                }
+            }
+
+            collect_c_vec_free_storage(&v);
+        }
+    }
+}
+
+static void TEST_V_define_empty_WITH_growth_policy_THEN_push_back(void)
+{
+    static collect_c_vec_growth_policy_t const policy =
+    {
+        .factor_numerator   =   2,
+        .factor_denominator =   1,
+        .min_step           =   16,
+        .round_to_bytes     =   4096,
+        .front_divisor      =   0,
+    };
+
+    {
+        CLC_V_define_empty(int, v);
+
+        v.growth_policy = &policy;
+
+        int const r = collect_c_vec_allocate_storage(&v, 1);
+
+        TEST_INTEGER_EQUAL_ANY_OF2(0, ENOMEM, r);
+
+        if (0 == r)
+        {
+            TEST_INT_EQ(1, v.capacity);
+            TEST_INT_EQ(0, CLC_V_spare_front(v));
+
+            for (int i = 0; 2 != i; ++i)
+            {
+                CLC_V_push_back_by_ref(v, &i);
+            }
+
+            /* grown by the minimum step, rounded up to the page */
+
+            TEST_INT_EQ(4096 / sizeof(int), v.capacity);
+            TEST_INT_EQ(0, CLC_V_spare_front(v));
+
+            for (int i = 2; 1025 != i; ++i)
+            {
+                CLC_V_push_back_by_ref(v, &i);
+            }
+
+            /* doubled */
+
+            TEST_INT_EQ(2048, v.capacity);
+            TEST_INT_EQ(0, CLC_V_spare_front(v));
+            TEST_INT_EQ(1025, CLC_V_len(v));
+            TEST_INT_EQ(1024, *CLC_V_cback_t(v, int));
+
+            collect_c_vec_free_storage(&v);
+        }
+    }
+}
+
+static void TEST_V_define_empty_THEN_allocate_storage_OF_0_AND_1_THEN_push_back_AND_push_front(void)
+{
+    for (size_t initial_capacity = 0; 2 != initial_capacity; ++initial_capacity)
+    {
+        CLC_V_define_empty(int, v);
+
+        int const r = collect_c_vec_allocate_storage(&v, initial_capacity);
+
+        if (0 == r)
+        {
+            for (int i = 0; 10 != i; ++i)
+            {
+                TEST_INT_EQ(0, CLC_V_push_back_by_ref(v, &i));
+            }
+            for (int i = 0; 10 != i; ++i)
+            {
+                TEST_INT_EQ(0, CLC_V_push_front_by_ref(v, &i));
+            }
+
+            TEST_INT_EQ(20, CLC_V_len(v));
+            TEST_INT_EQ(90, accumulate_v2(&v, 0));
+
+            collect_c_vec_free_storage(&v);
+        }
+    }
+}
+
+static void TEST_V_define_empty_WITH_vm_threshold_THEN_push_back_MANY_THEN_edit(void)
+{
+    static collect_c_vec_growth_policy_t const policy =
+    {
+        .factor_numerator   =   3,
+        .factor_denominator =   2,
+        .min_step           =   4,
+        .round_to_bytes     =   0,
+        .front_divisor      =   4,
+        .vm_threshold       =   4096,
+    };
+
+    {
+        CLC_V_define_empty(int, v);
+
+        v.growth_policy = &policy;
+
+        int const r = collect_c_vec_allocate_storage(&v, 16);
+
+        TEST_INTEGER_EQUAL_ANY_OF2(0, ENOMEM, r);
+
+        if (0 == r)
+        {
+            TEST_INT_EQ(0, (CLC_V_F_VM_STORAGE & v.flags));
+
+            for (int i = 0; 100000 != i; ++i)
+            {
+                TEST_INT_EQ(0, CLC_V_push_back_by_ref(v, &i));
+            }
+
+#if defined(__linux__)
+
+            TEST_INT_NE(0, (CLC_V_F_VM_STORAGE & v.flags));
+#endif
+
+            TEST_INT_EQ(100000, CLC_V_len(v));
+            TEST_INT_EQ(     0, *CLC_V_cfront_t(v, int));
+            TEST_INT_EQ( 99999, *CLC_V_cback_t(v, int));
+            TEST_BOOLEAN_TRUE(is_sequence_v(&v, 0));
+
+            /* push to the front, which re-centres */
+            {
+                int const value = -1;
+
+                TEST_INT_EQ(0, CLC_V_push_front_by_ref(v, &value));
+                TEST_INT_EQ(100001, CLC_V_len(v));
+                TEST_INT_EQ(-1, *CLC_V_cfront_t(v, int));
+                TEST_INT_EQ( 0, *CLC_V_cat_t(v, int, 1));
+                TEST_INT_EQ(99999, *CLC_V_cback_t(v, int));
+            }
+
+            /* insert many in the middle, which requires growth */
+            {
+                int* const els = malloc(sizeof(int) * 200000);
+
+                if (NULL != els)
+                {
+                    for (int i = 0; 200000 != i; ++i)
+                    {
+                        els[i] = 1000000 + i;
+                    }
+
+                    TEST_INT_EQ(0, CLC_V_insert_n_by_ref(v, 50001, 200000, els));
+                    TEST_INT_EQ(300001, CLC_V_len(v));
+                    TEST_INT_EQ(  49999, *CLC_V_cat_t(v, int, 50000));
+                    TEST_INT_EQ(1000000, *CLC_V_cat_t(v, int, 50001));
+                    TEST_INT_EQ(1199999, *CLC_V_cat_t(v, int, 250000));
+                    TEST_INT_EQ(  50000, *CLC_V_cat_t(v, int, 250001));
+                    TEST_INT_EQ(  99999, *CLC_V_cback_t(v, int));
+
+                    TEST_INT_EQ(0, CLC_V_erase_range(v, 50001, 250001));
+                    TEST_INT_EQ(100001, CLC_V_len(v));
+
+                    free(els);
+                }
+            }
+
+            TEST_INT_EQ(0, CLC_V_pop_front(v));
+            TEST_BOOLEAN_TRUE(is_sequence_v(&v, 0));
+
+            TEST_INT_EQ(0, CLC_V_reserve(v, 1000000, 0));
+            TEST_INT_LE(v.capacity, 1000000);
+            TEST_BOOLEAN_TRUE(is_sequence_v(&v, 0));
+
+            TEST_INT_EQ(0, CLC_V_shrink_to_fit(v));
+            TEST_BOOLEAN_TRUE(is_sequence_v(&v, 0));
+
+            collect_c_vec_free_storage(&v);
+
+            TEST_INT_EQ(0, (CLC_V_F_VM_STORAGE & v.flags));
+        }
+    }
+}
+
+static void TEST_V_define_empty_WITH_F_USE_HUGE_PAGES_THEN_push_back_MANY(void)
+{
+    {
+        CLC_V_define_empty(int, v);
+
+        v.flags |= CLC_V_F_USE_HUGE_PAGES;
+
+        int const r = collect_c_vec_allocate_storage(&v, 16);
+
+        TEST_INTEGER_EQUAL_ANY_OF2(0, ENOMEM, r);
+
+        if (0 == r)
+        {
+            for (int i = 0; 1000000 != i; ++i)
+            {
+                TEST_INT_EQ(0, CLC_V_push_back_by_ref(v, &i));
+            }
+
+#if defined(__linux__)
+
+            TEST_INT_NE(0, (CLC_V_F_VM_STORAGE & v.flags));
+            TEST_INT_EQ(0, ((uintptr_t)v.storage) % (2 * 1024 * 1024));
+#endif
+
+            TEST_INT_EQ(1000000, CLC_V_len(v));
+            TEST_BOOLEAN_TRUE(is_sequence_v(&v, 0));
+
+            /* whether any huge pages are obtained is up to the system, but
+             * none are counted beyond the storage
+             */
+            TEST_INT_EQ(0, collect_c_vec_huge_page_bytes(&v) % (2 * 1024 * 1024));
+            TEST_INT_LE(v.capacity * sizeof(int), collect_c_vec_huge_page_bytes(&v));
+
+            collect_c_vec_free_storage(&v);
+
+            TEST_INT_EQ(0, (CLC_V_F_VM_STORAGE & v.flags));
+            TEST_INT_EQ(0, collect_c_vec_huge_page_bytes(&v));
+        }
+    }
+}
+
+static void TEST_V_define_on_stack_with_spill_THEN_push_back_BEYOND_ARRAY(void)
+{
+    {
+        int array[16];
+
+        CLC_V_define_on_stack_with_spill(v, array);
+
+        for (int i = 0; 16 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_V_push_back_by_ref(v, &i));
+        }
+
+        /* still in the array */
+        TEST_PTR_EQ(&array[0], v.storage);
+        TEST_INT_NE(0, (CLC_V_F_USE_STACK_ARRAY & v.flags));
+        TEST_INT_EQ(16, CLC_V_len(v));
+        TEST_INT_EQ(15, array[15]);
+
+        for (int i = 16; 100 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_V_push_back_by_ref(v, &i));
+        }
+
+        /* now on the heap */
+        TEST_PTR_NE(&array[0], v.storage);
+        TEST_INT_EQ(0, (CLC_V_F_USE_STACK_ARRAY & v.flags));
+        TEST_INT_NE(0, (CLC_V_F_SPILL_TO_HEAP & v.flags));
+        TEST_INT_EQ(100, CLC_V_len(v));
+        TEST_BOOLEAN_TRUE(is_sequence_v(&v, 0));
+
+        /* ... and with base-offset optimisation */
+        {
+            size_t const spare_front = CLC_V_spare_front(v);
+
+            TEST_INT_EQ(0, CLC_V_pop_front(v));
+            TEST_INT_EQ(spare_front + 1, CLC_V_spare_front(v));
+        }
+        TEST_BOOLEAN_TRUE(is_sequence_v(&v, 1));
+
+        collect_c_vec_free_storage(&v);
+
+        TEST_PTR_EQ(NULL, v.storage);
+    }
+
+    {
+        int array[16];
+
+        CLC_V_define_on_stack_with_spill(v, array);
+
+        for (int i = 0; 10 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_V_push_back_by_ref(v, &i));
+        }
+
+        TEST_PTR_EQ(&array[0], v.storage);
+
+        /* frees nothing */
+        collect_c_vec_free_storage(&v);
+
+        TEST_INT_EQ(0, CLC_V_len(v));
+    }
+}
+
+static void TEST_V_define_on_stack_with_spill_THEN_push_front_AND_insert_n_by_ref_AND_reserve(void)
+{
+    /* push_front() */
+    {
+        int array[4];
+
+        CLC_V_define_on_stack_with_spill(v, array);
+
+        for (int i = 0; 5 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_V_push_front_by_value(v, int, 4 - i));
+        }
+
+        TEST_INT_EQ(0, (CLC_V_F_USE_STACK_ARRAY & v.flags));
+        TEST_INT_EQ(5, CLC_V_len(v));
+        TEST_BOOLEAN_TRUE(is_sequence_v(&v, 0));
+
+        collect_c_vec_free_storage(&v);
+    }
+
+    /* insert_n_by_ref() */
+    {
+        int array[4];
+
+        CLC_V_define_on_stack_with_spill(v, array);
+
+        int const els[] = { 1, 2, 3, 4 };
+
+        TEST_INT_EQ(0, CLC_V_push_back_by_value(v, int, 0));
+        TEST_INT_EQ(0, CLC_V_push_back_by_value(v, int, 5));
+        TEST_INT_EQ(0, CLC_V_insert_n_by_ref(v, 1, 4, &els[0]));
+
+        TEST_INT_EQ(0, (CLC_V_F_USE_STACK_ARRAY & v.flags));
+        TEST_INT_EQ(6, CLC_V_len(v));
+        TEST_BOOLEAN_TRUE(is_sequence_v(&v, 0));
+
+        collect_c_vec_free_storage(&v);
+    }
+
+    /* reserve() */
+    {
+        int array[4];
+
+        CLC_V_define_on_stack_with_spill(v, array);
+
+        TEST_INT_EQ(0, CLC_V_push_back_by_value(v, int, 0));
+        TEST_INT_EQ(0, CLC_V_push_back_by_value(v, int, 1));
+
+        TEST_INT_EQ(0, CLC_V_reserve(v, 4, 0));
+        TEST_PTR_EQ(&array[0], v.storage);
+
+        TEST_INT_EQ(0, CLC_V_reserve(v, 100, 10));
+        TEST_INT_EQ(0, (CLC_V_F_USE_STACK_ARRAY & v.flags));
+        TEST_INT_EQ(10, CLC_V_spare_front(v));
+        TEST_INT_LE(98, CLC_V_spare_back(v));
+        TEST_BOOLEAN_TRUE(is_sequence_v(&v, 0));
+
+        collect_c_vec_free_storage(&v);
+    }
+
+    /* without spill, ENOSPC as before */
+    {
+        int array[2];
+
+        CLC_V_define_on_stack(v, array);
+
+        TEST_INT_EQ(0, CLC_V_push_back_by_value(v, int, 0));
+        TEST_INT_EQ(0, CLC_V_push_back_by_value(v, int, 1));
+        TEST_INT_EQ(ENOSPC, CLC_V_push_back_by_value(v, int, 2));
+        TEST_INT_EQ(ENODEV, CLC_V_reserve(v, 4, 0));
+    }
+}
+
+static void TEST_V_define_empty_with_allocator_THEN_push_back_AND_insert_n_by_ref_AND_shrink_to_fit(void)
+{
+    int els[300];
+
+    for (int i = 0; 300 != i; ++i)
+    {
+        els[i] = 500 + i;
+    }
+
+    /* with pfn_realloc, and without (in which case it is emulated) */
+    for (int with_realloc = 0; 2 != with_realloc; ++with_realloc)
+    {
+        counting_allocator_context_t    ctxt        =   { 0 };
+        collect_c_allocator_t const     allocator   =   { &fn_counting_alloc, with_realloc ? &fn_counting_realloc : NULL, &fn_counting_free, &ctxt };
+
+        CLC_V_define_empty_with_allocator(int, v, &allocator);
+
+        int const r = collect_c_vec_allocate_storage(&v, 4);
+
+        TEST_INTEGER_EQUAL_ANY_OF2(0, ENOMEM, r);
+
+        if (0 == r)
+        {
+            TEST_INT_EQ(1, ctxt.num_allocs);
+
+            for (int i = 0; 1000 != i; ++i)
+            {
+                TEST_INT_EQ(0, CLC_V_push_back_by_ref(v, &i));
+            }
+
+            TEST_INT_EQ(v.capacity * v.el_size, ctxt.cb_outstanding);
+
+            if (with_realloc)
+            {
+                TEST_INT_NE(0, ctxt.num_reallocs);
+            }
+            else
+            {
+                TEST_INT_EQ(0, ctxt.num_reallocs);
+                TEST_INT_EQ(ctxt.num_allocs - 1, ctxt.num_frees);
+            }
+
+            TEST_INT_EQ(0, CLC_V_shrink_to_fit(v));
+            TEST_INT_EQ(v.capacity * v.el_size, ctxt.cb_outstanding);
+            TEST_INT_EQ(0, CLC_V_spare_back(v));
+            TEST_BOOLEAN_TRUE(is_sequence_v(&v, 0));
+
+            /* insert more than the front-spare, to force the
+             * allocate-and-copy growth
+             */
+            {
+                size_t const num_allocs = ctxt.num_allocs;
+
+                TEST_INT_EQ(0, CLC_V_insert_n_by_ref(v, 500, 300, &els[0]));
+                TEST_INT_EQ(num_allocs + 1, ctxt.num_allocs);
+                TEST_INT_EQ(1300, CLC_V_len(v));
+                TEST_INT_EQ(499, *CLC_V_cat_t(v, int, 499));
+                TEST_INT_EQ(500, *CLC_V_cat_t(v, int, 500));
+                TEST_INT_EQ(500, *CLC_V_cat_t(v, int, 800));
+                TEST_INT_EQ(v.capacity * v.el_size, ctxt.cb_outstanding);
+            }
+
+            TEST_INT_EQ(0, CLC_V_erase_range(v, 500, 800));
+            TEST_BOOLEAN_TRUE(is_sequence_v(&v, 0));
+
+            collect_c_vec_free_storage(&v);
+
+            TEST_INT_EQ(ctxt.num_allocs, ctxt.num_frees);
+            TEST_INT_EQ(0, ctxt.cb_outstanding);
+        }
+    }
+
+    /* a stack array spills into the allocator */
+    {
+        counting_allocator_context_t    ctxt        =   { 0 };
+        collect_c_allocator_t const     allocator   =   { &fn_counting_alloc, &fn_counting_realloc, &fn_counting_free, &ctxt };
+        int                             array[4];
+
+        CLC_V_define_on_stack_with_spill(v, array);
+
+        v.allocator = &allocator;
+
+        for (int i = 0; 10 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_V_push_back_by_ref(v, &i));
+        }
+
+        TEST_INT_EQ(1, ctxt.num_allocs);
+        TEST_INT_EQ(v.capacity * v.el_size, ctxt.cb_outstanding);
+        TEST_BOOLEAN_TRUE(is_sequence_v(&v, 0));
+
+        collect_c_vec_free_storage(&v);
+
+        TEST_INT_EQ(1, ctxt.num_frees);
+        TEST_INT_EQ(0, ctxt.cb_outstanding);
+    }
+}
+
+static int fn_compare_int(
+    collect_c_vec_t const*  v
+,   void const*             p_lhs
+,   void const*             p_rhs
+)
+{
+    int const lhs = *(int const*)p_lhs;
+    int const rhs = *(int const*)p_rhs;
+
+    ((void)&v);
+
+    return (lhs > rhs) - (lhs < rhs);
+}
+
+static int fn_compare_custom(
+    collect_c_vec_t const*  v
+,   void const*             p_lhs
+,   void const*             p_rhs
+)
+{
+    custom_t const* const lhs = (custom_t const*)p_lhs;
+    custom_t const* const rhs = (custom_t const*)p_rhs;
+
+    ((void)&v);
+
+    if (lhs->z != rhs->z)
+    {
+        return (lhs->z < rhs->z) ? -1 : +1;
+    }
+
+    return (lhs->x > rhs->x) - (lhs->x < rhs->x);
+}
+
+struct odd_t
+{
+    unsigned char   key;
+    unsigned char   pad[2];
+};
+typedef struct odd_t odd_t;
+
+static int fn_compare_odd(
+    collect_c_vec_t const*  v
+,   void const*             p_lhs
+,   void const*             p_rhs
+)
+{
+    odd_t const* const lhs = (odd_t const*)p_lhs;
+    odd_t const* const rhs = (odd_t const*)p_rhs;
+
+    ((void)&v);
+
+    return (lhs->key > rhs->key) - (lhs->key < rhs->key);
+}
+
+struct big_t
+{
+    uint32_t    key;
+    char        payload[96];
+};
+typedef struct big_t big_t;
+
+static int fn_compare_big(
+    collect_c_vec_t const*  v
+,   void const*             p_lhs
+,   void const*             p_rhs
+)
+{
+    big_t const* const lhs = (big_t const*)p_lhs;
+    big_t const* const rhs = (big_t const*)p_rhs;
+
+    ((void)&v);
+
+    return (lhs->key > rhs->key) - (lhs->key < rhs->key);
+}
+
+static uint32_t next_random(
+    uint32_t*   state
+)
+{
+    *state = (*state * 1664525u) + 1013904223u;
+
+    return *state >> 8;
+}
+
+static void TEST_V_define_empty_THEN_push_back_THEN_sort_PATTERNS(void)
+{
+    size_t const sizes[] = { 0, 1, 2, 10, 23, 24, 25, 100, 129, 1000, 20000 };
+
+    for (size_t is = 0; sizeof(sizes) / sizeof(sizes[0]) != is; ++is)
+    {
+        size_t const n = sizes[is];
+
+        /* random, ascending, descending, all-equal, organ-pipe, few
+         * distinct, sawtooth
+         */
+        for (int pattern = 0; 7 != pattern; ++pattern)
+        {
+            CLC_V_define_empty(int, v);
+
+            uint32_t    state   =   (uint32_t)(n + pattern);
+            int64_t     sum     =   0;
+
+            TEST_INT_EQ(0, CLC_V_reserve(v, n, 0));
+
+            for (size_t i = 0; n != i; ++i)
+            {
+                int el;
+
+                switch (pattern)
+                {
+                case 0:     el = (int)(next_random(&state) % 100000);           break;
+                case 1:     el = (int)i;                                        break;
+                case 2:     el = (int)(n - i);                                  break;
+                case 3:     el = 7;                                             break;
+                case 4:     el = (int)((i < n / 2) ? i : (n - i));              break;
+                case 5:     el = (int)(next_random(&state) % 4);                break;
+                default:    el = (int)(i % 50);                                 break;
+                }
+
+                sum += el;
+
+                TEST_INT_EQ(0, CLC_V_push_back_by_value(v, int, el));
+            }
+
+            CLC_V_sort(v, fn_compare_int);
+
+            TEST_INT_EQ(n, CLC_V_len(v));
+
+            for (size_t i = 0; n != i; ++i)
+            {
+                sum -= *CLC_V_cat_t(v, int, i);
+
+                if (0 != i)
+                {
+                    TEST_INT_LE(*CLC_V_cat_t(v, int, i), *CLC_V_cat_t(v, int, i - 1));
+                }
+            }
+
+            TEST_INT_EQ(0, sum);
+
+            if (NULL != v.storage)
+            {
+                collect_c_vec_free_storage(&v);
+            }
+        }
+    }
+
+    /* with base-offset, the elements are those from the offset */
+    {
+        CLC_V_define_empty(int, v);
+
+        TEST_INT_EQ(0, CLC_V_reserve(v, 100, 50));
+
+        for (int i = 0; 100 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_V_push_front_by_value(v, int, i));
+        }
+
+        TEST_INT_EQ(0, CLC_V_pop_front(v));
+
+        CLC_V_sort(v, fn_compare_int);
+
+        TEST_INT_EQ(99, CLC_V_len(v));
+        TEST_BOOLEAN_TRUE(is_sequence_v(&v, 0));
+
+        collect_c_vec_free_storage(&v);
+    }
+}
+
+static void TEST_V_define_empty_THEN_push_back_THEN_sort_ELEMENT_SIZES(void)
+{
+    /* 16 bytes */
+    {
+        CLC_V_define_empty(custom_t, v);
+
+        uint32_t state = 3;
+
+        TEST_INT_EQ(0, CLC_V_reserve(v, 5000, 0));
+
+        for (uint32_t i = 0; 5000 != i; ++i)
+        {
+            custom_t const el = { i, i * 2, next_random(&state) % 1000 };
+
+            TEST_INT_EQ(0, CLC_V_push_back_by_ref(v, &el));
+        }
+
+        CLC_V_sort(v, fn_compare_custom);
+
+        for (size_t i = 0; 5000 != i; ++i)
+        {
+            custom_t const* const el = CLC_V_cat_t(v, custom_t, i);
+
+            TEST_INT_EQ(el->x * 2, el->y);
+
+            if (0 != i)
+            {
+                TEST_INT_GE(0, fn_compare_custom(&v, el, CLC_V_cat_t(v, custom_t, i - 1)));
+            }
+        }
+
+        collect_c_vec_free_storage(&v);
+    }
+
+    /* 3 bytes */
+    {
+        CLC_V_define_empty(odd_t, v);
+
+        uint32_t state = 5;
+
+        TEST_INT_EQ(0, CLC_V_reserve(v, 3000, 0));
+
+        for (size_t i = 0; 3000 != i; ++i)
+        {
+            odd_t el;
+
+            el.key      =   (unsigned char)next_random(&state);
+            el.pad[0]   =   el.key;
+            el.pad[1]   =   (unsigned char)~el.key;
+
+            TEST_INT_EQ(0, CLC_V_push_back_by_ref(v, &el));
+        }
+
+        CLC_V_sort(v, fn_compare_odd);
+
+        for (size_t i = 0; 3000 != i; ++i)
+        {
+            odd_t const* const el = CLC_V_cat_t(v, odd_t, i);
+
+            TEST_INT_EQ(el->key, el->pad[0]);
+            TEST_INT_EQ((unsigned char)~el->key, el->pad[1]);
+
+            if (0 != i)
+            {
+                TEST_INT_LE(el->key, CLC_V_cat_t(v, odd_t, i - 1)->key);
+            }
+        }
+
+        collect_c_vec_free_storage(&v);
+    }
+
+    /* 100 bytes, larger than the temporary used in insertion */
+    {
+        CLC_V_define_empty(big_t, v);
+
+        uint32_t state = 7;
+
+        TEST_INT_EQ(0, CLC_V_reserve(v, 2000, 0));
+
+        for (size_t i = 0; 2000 != i; ++i)
+        {
+            big_t el;
+
+            el.key = next_random(&state) % 500;
+            memset(el.payload, (int)(el.key % 26) + 'a', sizeof(el.payload));
+
+            TEST_INT_EQ(0, CLC_V_push_back_by_ref(v, &el));
+        }
+
+        CLC_V_sort(v, fn_compare_big);
+
+        for (size_t i = 0; 2000 != i; ++i)
+        {
+            big_t const* const el = CLC_V_cat_t(v, big_t, i);
+
+            TEST_INT_EQ((int)(el->key % 26) + 'a', el->payload[0]);
+            TEST_INT_EQ((int)(el->key % 26) + 'a', el->payload[sizeof(el->payload) - 1]);
+
+            if (0 != i)
+            {
+                TEST_INT_LE(el->key, CLC_V_cat_t(v, big_t, i - 1)->key);
+            }
+        }
+
+        collect_c_vec_free_storage(&v);
+    }
+}
+
+static void TEST_V_define_empty_THEN_push_back_THEN_radix_sort_by_member(void)
+{
+    /* an 8-byte key in 16-byte elements, where the sort is stable */
+    {
+        CLC_V_define_empty(custom_t, v);
+
+        uint32_t state = 11;
+
+        TEST_INT_EQ(0, CLC_V_radix_sort_by_member(v, custom_t, z));
+
+        TEST_INT_EQ(0, CLC_V_reserve(v, 10000, 0));
+
+        for (uint32_t i = 0; 10000 != i; ++i)
+        {
+            uint64_t const  hi  =   (uint64_t)(next_random(&state) % 16) << 40;
+            custom_t const  el  =   { i, 0, hi | (next_random(&state) % 64) };
+
+            TEST_INT_EQ(0, CLC_V_push_back_by_ref(v, &el));
+        }
+
+        TEST_INT_EQ(0, CLC_V_radix_sort_by_member(v, custom_t, z));
+
+        for (size_t i = 1; 10000 != i; ++i)
+        {
+            custom_t const* const prev = CLC_V_cat_t(v, custom_t, i - 1);
+            custom_t const* const curr = CLC_V_cat_t(v, custom_t, i);
+
+            TEST_BOOLEAN_TRUE(prev->z < curr->z || (prev->z == curr->z && prev->x < curr->x));
+        }
+
+        collect_c_vec_free_storage(&v);
+    }
+
+    /* a 4-byte key in 4-byte elements, from an offset */
+    {
+        CLC_V_define_empty(uint32_t, v);
+
+        uint32_t state = 13;
+
+        TEST_INT_EQ(0, CLC_V_reserve(v, 1000, 10));
+
+        for (size_t i = 0; 1000 != i; ++i)
+        {
+            TEST_INT_EQ(0, CLC_V_push_back_by_value(v, uint32_t, next_random(&state) * 257u));
+        }
+
+        TEST_INT_EQ(0, CLC_V_pop_front(v));
+
+        TEST_INT_EQ(0, collect_c_vec_radix_sort(&v, 0, sizeof(uint32_t)));
+
+        TEST_INT_EQ(999, CLC_V_len(v));
+
+        for (size_t i = 1; 999 != i; ++i)
+        {
+            TEST_INT_LE(*CLC_V_cat_t(v, uint32_t, i), *CLC_V_cat_t(v, uint32_t, i - 1));
+        }
+
+        collect_c_vec_free_storage(&v);
+    }
+
+    /* a 1-byte key in 3-byte elements */
+    {
+        CLC_V_define_empty(odd_t, v);
+
+        uint32_t state = 17;
+
+        TEST_INT_EQ(0, CLC_V_reserve(v, 500, 0));
+
+        for (size_t i = 0; 500 != i; ++i)
+        {
+            odd_t el;
+
+            el.key      =   (unsigned char)next_random(&state);
+            el.pad[0]   =   (unsigned char)(i / 256);
+            el.pad[1]   =   (unsigned char)(i % 256);
+
+            TEST_INT_EQ(0, CLC_V_push_back_by_ref(v, &el));
+        }
+
+        TEST_INT_EQ(0, CLC_V_radix_sort_by_member(v, odd_t, key));
+
+        for (size_t i = 1; 500 != i; ++i)
+        {
+            odd_t const* const prev = CLC_V_cat_t(v, odd_t, i - 1);
+            odd_t const* const curr = CLC_V_cat_t(v, odd_t, i);
+
+            TEST_BOOLEAN_TRUE(prev->key < curr->key || (prev->key == curr->key && ((prev->pad[0] * 256) + prev->pad[1]) < ((curr->pad[0] * 256) + curr->pad[1])));
+        }
+
+        collect_c_vec_free_storage(&v);
+    }
+}
+
+
+/* verifies find and count, at every length up to 300, over elements that
+ * are each the key's bytes rotated by one, so that the key's bytes appear
+ * throughout the storage, but never at an element boundary
+ */
+static void verify_find_and_count_(
+    collect_c_vec_t*    v
+)
+{
+    size_t const    el_size =   v->el_size;
+    unsigned char   key[16];
+    unsigned char   bg[16];
+
+    for (size_t j = 0; el_size != j; ++j)
+    {
+        key[j]  =   (unsigned char)(0xA0 + j);
+        bg[j]   =   (1 == el_size) ? 0 : (unsigned char)(0xA0 + ((j + 1) % el_size));
+    }
+
+    TEST_INT_EQ(0, CLC_V_reserve(v, 300, 0));
+
+    for (size_t len = 0; 300 != len; ++len)
+    {
+        size_t ix;
+
+        TEST_INT_EQ(ENOENT, collect_c_vec_find_by_ref(v, key, &ix));
+        TEST_INT_EQ(0, collect_c_vec_count_by_ref(v, key));
+        TEST_BOOLEAN_FALSE(CLC_V_contains_by_ref(v, key));
+
+        if (0 != len)
+        {
+            size_t const    last    =   len - 1;
+            size_t const    mid     =   len / 2;
+
+            memcpy(CLC_V_at_v(v, last), key, el_size);
+
+            TEST_INT_EQ(0, collect_c_vec_find_by_ref(v, key, &ix));
+            TEST_INT_EQ(last, ix);
+            TEST_INT_EQ(1, collect_c_vec_count_by_ref(v, key));
+
+            memcpy(CLC_V_at_v(v, mid), key, el_size);
+
+            TEST_INT_EQ(0, collect_c_vec_find_by_ref(v, key, &ix));
+            TEST_INT_EQ(mid, ix);
+            TEST_INT_EQ((mid != last) ? 2 : 1, collect_c_vec_count_by_ref(v, key));
+
+            memcpy(CLC_V_at_v(v, 0), key, el_size);
+
+            TEST_INT_EQ(0, collect_c_vec_find_by_ref(v, key, NULL));
+            TEST_BOOLEAN_TRUE(CLC_V_contains_by_ref(v, key));
+            TEST_INT_EQ(1 + (0 != mid) + (mid != last), collect_c_vec_count_by_ref(v, key));
+
+            memcpy(CLC_V_at_v(v, 0), bg, el_size);
+            memcpy(CLC_V_at_v(v, mid), bg, el_size);
+            memcpy(CLC_V_at_v(v, last), bg, el_size);
+        }
+
+        TEST_INT_EQ(0, CLC_V_push_back_by_ref(v, bg));
+    }
+}
+
+static void TEST_V_define_empty_THEN_push_back_THEN_find_AND_count_ELEMENT_SIZES(void)
+{
+    {
+        CLC_V_define_empty(uint8_t, v);
+
+        verify_find_and_count_(&v);
+
+        collect_c_vec_free_storage(&v);
+    }
+
+    {
+        CLC_V_define_empty(uint16_t, v);
+
+        verify_find_and_count_(&v);
+
+        collect_c_vec_free_storage(&v);
+    }
+
+    {
+        CLC_V_define_empty(uint32_t, v);
+
+        verify_find_and_count_(&v);
+
+        collect_c_vec_free_storage(&v);
+    }
+
+    {
+        CLC_V_define_empty(uint64_t, v);
+
+        verify_find_and_count_(&v);
+
+        collect_c_vec_free_storage(&v);
+    }
+
+    /* sizes without a kernel */
+    {
+        CLC_V_define_empty(odd_t, v);
+
+        verify_find_and_count_(&v);
+
+        collect_c_vec_free_storage(&v);
+    }
+
+    {
+        CLC_V_define_empty(custom_t, v);
+
+        verify_find_and_count_(&v);
+
+        collect_c_vec_free_storage(&v);
+    }
+}
+
+static void TEST_V_define_empty_THEN_push_back_THEN_find_by_value_AND_contains_FROM_OFFSET(void)
+{
+    CLC_V_define_empty(int, v);
+
+    size_t ix = 0;
+
+    TEST_BOOLEAN_FALSE(CLC_V_contains_by_value(v, int, 0));
+    TEST_INT_EQ(0, CLC_V_count_by_value(v, int, 0));
+
+    TEST_INT_EQ(0, CLC_V_reserve(v, 100, 10));
+
+    for (int i = 0; 100 != i; ++i)
+    {
+        TEST_INT_EQ(0, CLC_V_push_back_by_value(v, int, i));
+    }
+
+    TEST_INT_EQ(0, CLC_V_pop_front(v));
+
+    TEST_BOOLEAN_FALSE(CLC_V_contains_by_value(v, int, 0));
+    TEST_BOOLEAN_TRUE(CLC_V_contains_by_value(v, int, 1));
+    TEST_BOOLEAN_TRUE(CLC_V_contains_by_value(v, int, 99));
+
+    TEST_INT_EQ(0, CLC_V_find_by_value(v, int, 50, &ix));
+    TEST_INT_EQ(49, ix);
+    TEST_INT_EQ(ENOENT, CLC_V_find_by_value(v, int, 100, &ix));
+    TEST_INT_EQ(49, ix);
+
+    TEST_INT_EQ(0, CLC_V_push_back_by_value(v, int, 7));
+    TEST_INT_EQ(0, CLC_V_push_front_by_value(v, int, 7));
+
+    TEST_INT_EQ(3, CLC_V_count_by_value(v, int, 7));
+    TEST_INT_EQ(0, CLC_V_find_by_value(v, int, 7, &ix));
+    TEST_INT_EQ(0, ix);
+
+    collect_c_vec_free_storage(&v);
+}
+
+
 /* ///////////////////////////// end of file //////////////////////////// */
 